@@ -26,6 +26,7 @@
 #include <gp_Parab.hxx>
 #include <gp_Pnt.hxx>
 #include <gp_Vec.hxx>
+#include <Standard_DimensionMismatch.hxx>
 #include <Standard_NotImplemented.hxx>
 
 IMPLEMENT_STANDARD_RTTIEXT(Adaptor3d_Curve, Standard_Transient)
@@ -195,6 +196,67 @@ void Adaptor3d_Curve::D2(const Standard_Real , gp_Pnt& , gp_Vec& , gp_Vec& ) con
   throw Standard_NotImplemented("Adaptor3d_Curve::D2");
 }
 
+//=======================================================================
+//function : D0
+//purpose  : 
+//=======================================================================
+
+void Adaptor3d_Curve::D0 (const TColStd_Array1OfReal& theParams,
+                          TColgp_Array1OfPnt&         thePoints) const
+{
+  Standard_DimensionMismatch_Raise_if (theParams.Length() != thePoints.Length(),
+                                       "Adaptor3d_Curve::D0(), wrong length of array of points");
+  for (Standard_Integer i = theParams.Lower(); i <= theParams.Upper(); i++)
+  {
+    D0 (theParams.Value (i), thePoints.ChangeValue (thePoints.Lower() + i - theParams.Lower()));
+  }
+}
+
+//=======================================================================
+//function : D1
+//purpose  : 
+//=======================================================================
+
+void Adaptor3d_Curve::D1 (const TColStd_Array1OfReal& theParams,
+                          TColgp_Array1OfPnt&         thePoints,
+                          TColgp_Array1OfVec&         theV1) const
+{
+  Standard_DimensionMismatch_Raise_if (theParams.Length() != thePoints.Length()
+                                    || theParams.Length() != theV1.Length(),
+                                       "Adaptor3d_Curve::D1(), wrong length of array of results");
+  for (Standard_Integer i = theParams.Lower(); i <= theParams.Upper(); i++)
+  {
+    const Standard_Integer anOffset = i - theParams.Lower();
+    D1 (theParams.Value (i),
+        thePoints.ChangeValue (thePoints.Lower() + anOffset),
+        theV1    .ChangeValue (theV1    .Lower() + anOffset));
+  }
+}
+
+//=======================================================================
+//function : D2
+//purpose  : 
+//=======================================================================
+
+void Adaptor3d_Curve::D2 (const TColStd_Array1OfReal& theParams,
+                          TColgp_Array1OfPnt&         thePoints,
+                          TColgp_Array1OfVec&         theV1,
+                          TColgp_Array1OfVec&         theV2) const
+{
+  Standard_DimensionMismatch_Raise_if (theParams.Length() != thePoints.Length()
+                                    || theParams.Length() != theV1.Length()
+                                    || theParams.Length() != theV2.Length(),
+                                       "Adaptor3d_Curve::D2(), wrong length of array of results");
+  for (Standard_Integer i = theParams.Lower(); i <= theParams.Upper(); i++)
+  {
+    const Standard_Integer anOffset = i - theParams.Lower();
+    D2 (theParams.Value (i),
+        thePoints.ChangeValue (thePoints.Lower() + anOffset),
+        theV1    .ChangeValue (theV1    .Lower() + anOffset),
+        theV2    .ChangeValue (theV2    .Lower() + anOffset));
+  }
+}
+
 
 //=======================================================================
 //function : D3
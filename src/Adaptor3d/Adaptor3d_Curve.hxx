@@ -26,6 +26,8 @@
 #include <Standard_DefineAlloc.hxx>
 #include <Standard_Handle.hxx>
 #include <TColStd_Array1OfReal.hxx>
+#include <TColgp_Array1OfPnt.hxx>
+#include <TColgp_Array1OfVec.hxx>
 #include <GeomAbs_CurveType.hxx>
 
 class gp_Pnt;
@@ -105,6 +107,22 @@ public:
   //! is not C2.
   Standard_EXPORT virtual void D2 (const Standard_Real U, gp_Pnt& P, gp_Vec& V1, gp_Vec& V2) const;
   
+  //! Computes the points for the array of parameters on the curve.
+  //! The results are stored in the array of the same length.
+  //! The default implementation calls D0() for each parameter.
+  //! Raises Standard_DimensionMismatch if the arrays have different lengths.
+  Standard_EXPORT virtual void D0 (const TColStd_Array1OfReal& theParams, TColgp_Array1OfPnt& thePoints) const;
+
+  //! Computes the points and the first derivatives for the array of parameters on the curve.
+  //! The default implementation calls D1() for each parameter.
+  //! Raises Standard_DimensionMismatch if the arrays have different lengths.
+  Standard_EXPORT virtual void D1 (const TColStd_Array1OfReal& theParams, TColgp_Array1OfPnt& thePoints, TColgp_Array1OfVec& theV1) const;
+
+  //! Computes the points, the first and second derivatives for the array of parameters
+  //! on the curve. The default implementation calls D2() for each parameter.
+  //! Raises Standard_DimensionMismatch if the arrays have different lengths.
+  Standard_EXPORT virtual void D2 (const TColStd_Array1OfReal& theParams, TColgp_Array1OfPnt& thePoints, TColgp_Array1OfVec& theV1, TColgp_Array1OfVec& theV2) const;
+
 
   //! Returns the point P of parameter U, the first, the second
   //! and the third derivative.
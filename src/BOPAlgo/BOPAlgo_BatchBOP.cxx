@@ -0,0 +1,941 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BOPAlgo_BatchBOP.hxx>
+
+#include <BOPAlgo_Alerts.hxx>
+#include <BOPAlgo_BOP.hxx>
+
+#include <BOPTools_BoxTree.hxx>
+#include <BOPTools_Parallel.hxx>
+
+#include <Bnd_Box.hxx>
+#include <Bnd_Tools.hxx>
+
+#include <BRep_Builder.hxx>
+#include <BRepBndLib.hxx>
+
+#include <NCollection_Array1.hxx>
+#include <NCollection_DataMap.hxx>
+
+#include <Precision.hxx>
+
+#include <TopExp.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Compound.hxx>
+#include <TopoDS_Iterator.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
+#include <TopTools_MapOfShape.hxx>
+
+#include <algorithm>
+
+//=======================================================================
+//class    : BOPAlgo_ArgumentBox
+//purpose  : Computes the bounding box of the argument
+//=======================================================================
+class BOPAlgo_ArgumentBox
+{
+public:
+
+  BOPAlgo_ArgumentBox() : myGap (0.0) {}
+
+  void SetShape (const TopoDS_Shape& theShape) { myShape = theShape; }
+
+  void SetGap (const Standard_Real theGap) { myGap = theGap; }
+
+  const Bnd_Box& Box() const { return myBox; }
+
+  void Perform()
+  {
+    BRepBndLib::Add (myShape, myBox, Standard_False);
+    if (!myBox.IsVoid())
+    {
+      myBox.Enlarge (myGap);
+    }
+  }
+
+private:
+  TopoDS_Shape myShape;
+  Standard_Real myGap;
+  Bnd_Box myBox;
+};
+
+typedef NCollection_Vector<BOPAlgo_ArgumentBox> BOPAlgo_VectorOfArgumentBox;
+
+//=======================================================================
+//class    : BOPAlgo_GroupBOP
+//purpose  : Performs Boolean operation on the group of arguments
+//=======================================================================
+class BOPAlgo_GroupBOP : public BOPAlgo_ParallelAlgo
+{
+public:
+
+  DEFINE_STANDARD_ALLOC
+
+  BOPAlgo_GroupBOP()
+  : BOPAlgo_ParallelAlgo(),
+    myGroupIndex (-1),
+    myOperation (BOPAlgo_UNKNOWN),
+    myNonDestructive (Standard_False),
+    myGlue (BOPAlgo_GlueOff),
+    myCheckInverted (Standard_True),
+    myFillHistory (Standard_True)
+  {}
+
+  void SetGroupIndex (const Standard_Integer theIndex) { myGroupIndex = theIndex; }
+
+  Standard_Integer GroupIndex() const { return myGroupIndex; }
+
+  const TopTools_ListOfShape& Arguments() const { return myArguments; }
+
+  TopTools_ListOfShape& ChangeArguments() { return myArguments; }
+
+  const TopTools_ListOfShape& Tools() const { return myTools; }
+
+  TopTools_ListOfShape& ChangeTools() { return myTools; }
+
+  void SetNonDestructive (const Standard_Boolean theFlag) { myNonDestructive = theFlag; }
+
+  //! Takes the options of the batch operation
+  void SetOptions (const BOPAlgo_BatchBOP& theBatch)
+  {
+    myOperation = theBatch.Operation();
+    myGlue = theBatch.Glue();
+    myCheckInverted = theBatch.CheckInverted();
+    myFillHistory = theBatch.HasHistory();
+    SetFuzzyValue (theBatch.FuzzyValue());
+    SetUseOBB (theBatch.UseOBB());
+    SetRunParallel (theBatch.RunParallel());
+  }
+
+  const TopoDS_Shape& Shape() const { return myShape; }
+
+  const Handle(BRepTools_History)& History() const { return myHistory; }
+
+  virtual void Perform()
+  {
+    Message_ProgressScope aPS (myProgressRange, NULL, 1);
+    if (!aPS.More())
+    {
+      return;
+    }
+
+    BOPAlgo_BOP aBOP;
+    aBOP.SetArguments (myArguments);
+    aBOP.SetTools (myTools);
+    aBOP.SetOperation (myOperation);
+    aBOP.SetNonDestructive (myNonDestructive);
+    aBOP.SetGlue (myGlue);
+    aBOP.SetCheckInverted (myCheckInverted);
+    aBOP.SetToFillHistory (myFillHistory);
+    aBOP.SetFuzzyValue (FuzzyValue());
+    aBOP.SetUseOBB (UseOBB());
+    aBOP.SetRunParallel (RunParallel());
+    aBOP.Perform (aPS.Next());
+
+    GetReport()->Merge (aBOP.GetReport());
+    if (aBOP.HasErrors())
+    {
+      return;
+    }
+
+    myShape = aBOP.Shape();
+    if (myFillHistory)
+    {
+      myHistory = aBOP.History();
+    }
+  }
+
+private:
+  Standard_Integer myGroupIndex;
+  TopTools_ListOfShape myArguments;
+  TopTools_ListOfShape myTools;
+  BOPAlgo_Operation myOperation;
+  Standard_Boolean myNonDestructive;
+  BOPAlgo_GlueEnum myGlue;
+  Standard_Boolean myCheckInverted;
+  Standard_Boolean myFillHistory;
+  TopoDS_Shape myShape;
+  Handle(BRepTools_History) myHistory;
+};
+
+typedef NCollection_Vector<BOPAlgo_GroupBOP> BOPAlgo_VectorOfGroupBOP;
+
+//=======================================================================
+//function : BOPAlgo_BatchBOP
+//purpose  :
+//=======================================================================
+BOPAlgo_BatchBOP::BOPAlgo_BatchBOP()
+: BOPAlgo_BuilderShape(),
+  myOperation (BOPAlgo_UNKNOWN),
+  myNonDestructive (Standard_False),
+  myGlue (BOPAlgo_GlueOff),
+  myCheckInverted (Standard_True),
+  myMaxTools (0),
+  myNbObjects (0),
+  myNbOperations (0)
+{
+}
+
+//=======================================================================
+//function : BOPAlgo_BatchBOP
+//purpose  :
+//=======================================================================
+BOPAlgo_BatchBOP::BOPAlgo_BatchBOP (const Handle(NCollection_BaseAllocator)& theAllocator)
+: BOPAlgo_BuilderShape (theAllocator),
+  myOperation (BOPAlgo_UNKNOWN),
+  myNonDestructive (Standard_False),
+  myGlue (BOPAlgo_GlueOff),
+  myCheckInverted (Standard_True),
+  myMaxTools (0),
+  myNbObjects (0),
+  myNbOperations (0)
+{
+}
+
+//=======================================================================
+//function : ~BOPAlgo_BatchBOP
+//purpose  :
+//=======================================================================
+BOPAlgo_BatchBOP::~BOPAlgo_BatchBOP()
+{
+}
+
+//=======================================================================
+//function : Clear
+//purpose  :
+//=======================================================================
+void BOPAlgo_BatchBOP::Clear()
+{
+  BOPAlgo_BuilderShape::Clear();
+  myShape.Nullify();
+  myShapes.Clear();
+  myNbObjects = 0;
+  myGroups.Clear();
+  myNbOperations = 0;
+}
+
+//=======================================================================
+//function : CheckData
+//purpose  :
+//=======================================================================
+void BOPAlgo_BatchBOP::CheckData()
+{
+  if (!(myOperation == BOPAlgo_COMMON ||
+        myOperation == BOPAlgo_FUSE ||
+        myOperation == BOPAlgo_CUT ||
+        myOperation == BOPAlgo_CUT21))
+  {
+    AddError (new BOPAlgo_AlertBOPNotSet);
+    return;
+  }
+
+  if (myArguments.IsEmpty() || myTools.IsEmpty())
+  {
+    AddError (new BOPAlgo_AlertTooFewArguments);
+    return;
+  }
+
+  for (Standard_Integer i = 0; i < 2; ++i)
+  {
+    const TopTools_ListOfShape& aLS = !i ? myArguments : myTools;
+    for (TopTools_ListOfShape::Iterator anIt (aLS); anIt.More(); anIt.Next())
+    {
+      if (anIt.Value().IsNull())
+      {
+        AddError (new BOPAlgo_AlertNullInputShapes);
+        return;
+      }
+    }
+  }
+}
+
+//=======================================================================
+//function : Perform
+//purpose  :
+//=======================================================================
+void BOPAlgo_BatchBOP::Perform (const Message_ProgressRange& theRange)
+{
+  GetReport()->Clear();
+  myShape.Nullify();
+  myShapes.Clear();
+  myGroups.Clear();
+  myNbOperations = 0;
+  myHistory.Nullify();
+
+  CheckData();
+  if (HasErrors())
+  {
+    return;
+  }
+
+  Message_ProgressScope aPS (theRange, "Performing Batch Boolean operation", 10);
+
+  MakeGroups();
+  if (HasErrors())
+  {
+    return;
+  }
+  aPS.Next();
+
+  PerformGroups (aPS.Next (9));
+  if (HasErrors())
+  {
+    return;
+  }
+
+  BuildResult();
+}
+
+//=======================================================================
+//function : MakeGroups
+//purpose  :
+//=======================================================================
+void BOPAlgo_BatchBOP::MakeGroups()
+{
+  // Collect all arguments, objects first
+  for (TopTools_ListOfShape::Iterator anIt (myArguments); anIt.More(); anIt.Next())
+  {
+    myShapes.Append (anIt.Value());
+  }
+  myNbObjects = myShapes.Length();
+  for (TopTools_ListOfShape::Iterator anIt (myTools); anIt.More(); anIt.Next())
+  {
+    myShapes.Append (anIt.Value());
+  }
+  const Standard_Integer aNbS = myShapes.Length();
+
+  // Compute the bounding boxes of the arguments
+  BOPAlgo_VectorOfArgumentBox aVBoxes;
+  for (Standard_Integer i = 0; i < aNbS; ++i)
+  {
+    BOPAlgo_ArgumentBox& aShapeBox = aVBoxes.Appended();
+    aShapeBox.SetShape (myShapes (i));
+    aShapeBox.SetGap (Max (myFuzzyValue, Precision::Confusion()));
+  }
+  BOPTools_Parallel::Perform (myRunParallel, aVBoxes);
+
+  // Each argument is the root of its own group at first
+  NCollection_Array1<Standard_Integer> aRoots (0, aNbS - 1);
+  for (Standard_Integer i = 0; i < aNbS; ++i)
+  {
+    aRoots (i) = i;
+  }
+
+  // Returns the root of the group of the argument
+  auto aFindRoot = [&aRoots] (Standard_Integer theIndex)
+  {
+    while (aRoots (theIndex) != theIndex)
+    {
+      aRoots (theIndex) = aRoots (aRoots (theIndex));
+      theIndex = aRoots (theIndex);
+    }
+    return theIndex;
+  };
+
+  // Unites the groups of two arguments keeping the smaller index as the root
+  auto anUnite = [&aRoots, &aFindRoot] (const Standard_Integer theIndex1,
+                                        const Standard_Integer theIndex2)
+  {
+    const Standard_Integer aRoot1 = aFindRoot (theIndex1);
+    const Standard_Integer aRoot2 = aFindRoot (theIndex2);
+    if (aRoot1 < aRoot2)
+    {
+      aRoots (aRoot2) = aRoot1;
+    }
+    else if (aRoot2 < aRoot1)
+    {
+      aRoots (aRoot1) = aRoot2;
+    }
+  };
+
+  BOPTools_BoxTree aBBTree;
+  aBBTree.SetSize (aNbS);
+  TColStd_ListOfInteger anEmpty;
+  for (Standard_Integer i = 0; i < aNbS; ++i)
+  {
+    const Bnd_Box& aBox = aVBoxes (i).Box();
+    if (aBox.IsVoid())
+    {
+      anEmpty.Append (i);
+      continue;
+    }
+    aBBTree.Add (i, Bnd_Tools::Bnd2BVH (aBox));
+  }
+  aBBTree.Build();
+
+  BOPTools_BoxPairSelector aPairSelector;
+  aPairSelector.SetBVHSets (&aBBTree, &aBBTree);
+  aPairSelector.SetSame (Standard_True);
+  aPairSelector.Select();
+
+  // Unite the tools with interfering bounding boxes first and remember
+  // the clusters of interfering tools, which cannot be put in different batches
+  const std::vector<BOPTools_BoxPairSelector::PairIDs>& aPairs = aPairSelector.Pairs();
+  for (std::vector<BOPTools_BoxPairSelector::PairIDs>::const_iterator anIt = aPairs.begin();
+       anIt != aPairs.end(); ++anIt)
+  {
+    if (anIt->ID1 >= myNbObjects && anIt->ID2 >= myNbObjects)
+    {
+      anUnite (anIt->ID1, anIt->ID2);
+    }
+  }
+  NCollection_Array1<Standard_Integer> aToolClusters (0, aNbS - 1);
+  for (Standard_Integer i = 0; i < aNbS; ++i)
+  {
+    aToolClusters (i) = aFindRoot (i);
+  }
+
+  // Unite the groups of all arguments with interfering bounding boxes
+  for (std::vector<BOPTools_BoxPairSelector::PairIDs>::const_iterator anIt = aPairs.begin();
+       anIt != aPairs.end(); ++anIt)
+  {
+    anUnite (anIt->ID1, anIt->ID2);
+  }
+
+  // The empty shapes are treated together with the first argument
+  // to let Boolean operation report them
+  for (TColStd_ListOfInteger::Iterator anIt (anEmpty); anIt.More(); anIt.Next())
+  {
+    anUnite (0, anIt.Value());
+  }
+
+  // Make the groups in the order of their first arguments
+  NCollection_Array1<Standard_Integer> aGroupOfRoot (0, aNbS - 1);
+  aGroupOfRoot.Init (-1);
+  for (Standard_Integer i = 0; i < aNbS; ++i)
+  {
+    const Standard_Integer aRoot = aFindRoot (i);
+    if (aGroupOfRoot (aRoot) < 0)
+    {
+      aGroupOfRoot (aRoot) = myGroups.Length();
+      myGroups.Appended();
+    }
+    myGroups.ChangeValue (aGroupOfRoot (aRoot)).Indices.Append (i);
+  }
+
+  // Define the treatment of the groups.
+  // The role of the arguments kept by CUT operation
+  const Standard_Boolean isCut = myOperation == BOPAlgo_CUT || myOperation == BOPAlgo_CUT21;
+  const Standard_Boolean isKeptObject = myOperation == BOPAlgo_CUT;
+  Standard_Integer aFirstOperation = -1, aFirstRemoved = -1;
+  TColStd_ListOfInteger aKeptToMerge;
+  const Standard_Integer aNbGroups = myGroups.Length();
+  for (Standard_Integer iG = 0; iG < aNbGroups; ++iG)
+  {
+    Group& aGroup = myGroups.ChangeValue (iG);
+    Standard_Boolean hasObjects = Standard_False, hasTools = Standard_False;
+    for (TColStd_ListOfInteger::Iterator anIt (aGroup.Indices); anIt.More(); anIt.Next())
+    {
+      (anIt.Value() < myNbObjects ? hasObjects : hasTools) = Standard_True;
+    }
+
+    if (hasObjects && hasTools)
+    {
+      aGroup.Status = GroupStatus_Operation;
+    }
+    else if (myOperation == BOPAlgo_FUSE)
+    {
+      aGroup.Status = aGroup.Indices.Extent() > 1 ? GroupStatus_Operation : GroupStatus_Keep;
+    }
+    else if (myOperation == BOPAlgo_COMMON || hasObjects != isKeptObject)
+    {
+      aGroup.Status = GroupStatus_Remove;
+    }
+    else
+    {
+      aGroup.Status = GroupStatus_Keep;
+      if (aGroup.Indices.Extent() > 1)
+      {
+        // The kept arguments interfere with each other and have to be split
+        // by the operation, which needs the arguments of the other role
+        aKeptToMerge.Append (iG);
+      }
+    }
+
+    if (aGroup.Status == GroupStatus_Operation && aFirstOperation < 0)
+    {
+      aFirstOperation = iG;
+    }
+    else if (aGroup.Status == GroupStatus_Remove && aFirstRemoved < 0)
+    {
+      aFirstRemoved = iG;
+    }
+  }
+
+  if (isCut && !aKeptToMerge.IsEmpty())
+  {
+    // Merge the groups of interfering kept arguments into the group processed
+    // by the operation, as the groups do not interfere the result will not change
+    const Standard_Integer aTarget = aFirstOperation >= 0 ? aFirstOperation : aFirstRemoved;
+    Group& aTargetGroup = myGroups.ChangeValue (aTarget);
+    aTargetGroup.Status = GroupStatus_Operation;
+    for (TColStd_ListOfInteger::Iterator anIt (aKeptToMerge); anIt.More(); anIt.Next())
+    {
+      Group& aGroup = myGroups.ChangeValue (anIt.Value());
+      aTargetGroup.Indices.Append (aGroup.Indices);
+      aGroup.Status = GroupStatus_Merged;
+    }
+  }
+
+  if (myMaxTools <= 0)
+  {
+    return;
+  }
+
+  // Split the tools of the large groups on the batches of non-interfering tools
+  for (Standard_Integer iG = 0; iG < aNbGroups; ++iG)
+  {
+    Group& aGroup = myGroups.ChangeValue (iG);
+    if (aGroup.Status != GroupStatus_Operation)
+    {
+      continue;
+    }
+
+    // Collect the clusters of interfering tools of the group
+    NCollection_DataMap<Standard_Integer, Standard_Integer> aClusterOfRoot;
+    NCollection_Vector<TColStd_ListOfInteger> aClusters;
+    NCollection_Vector<Bnd_Box> aClusterBoxes;
+    Bnd_Box aGroupBox;
+    Standard_Boolean hasObjects = Standard_False;
+    Standard_Integer aNbTools = 0;
+    for (TColStd_ListOfInteger::Iterator anIt (aGroup.Indices); anIt.More(); anIt.Next())
+    {
+      const Standard_Integer anIndex = anIt.Value();
+      if (anIndex < myNbObjects)
+      {
+        hasObjects = Standard_True;
+        continue;
+      }
+
+      const Standard_Integer* aCluster = aClusterOfRoot.Seek (aToolClusters (anIndex));
+      if (!aCluster)
+      {
+        aCluster = aClusterOfRoot.Bound (aToolClusters (anIndex), aClusters.Length());
+        aClusters.Appended();
+        aClusterBoxes.Appended();
+      }
+      aClusters.ChangeValue (*aCluster).Append (anIndex);
+      aClusterBoxes.ChangeValue (*aCluster).Add (aVBoxes (anIndex).Box());
+      aGroupBox.Add (aVBoxes (anIndex).Box());
+      ++aNbTools;
+    }
+
+    const Standard_Integer aNbClusters = aClusters.Length();
+    const Standard_Integer aNbBatches = Min ((aNbTools + myMaxTools - 1) / myMaxTools, aNbClusters);
+    if (!hasObjects || aNbBatches < 2)
+    {
+      continue;
+    }
+
+    // Order the clusters along the largest dimension of the group
+    // to make the batches of the tools close to each other
+    Standard_Integer aDir = 0;
+    if (!aGroupBox.IsVoid())
+    {
+      const gp_XYZ aSize = aGroupBox.CornerMax().XYZ() - aGroupBox.CornerMin().XYZ();
+      aDir = aSize.X() >= aSize.Y() ? (aSize.X() >= aSize.Z() ? 1 : 3) : (aSize.Y() >= aSize.Z() ? 2 : 3);
+    }
+    NCollection_Array1<Standard_Real> aCenters (0, aNbClusters - 1);
+    std::vector<Standard_Integer> anOrder (aNbClusters);
+    for (Standard_Integer i = 0; i < aNbClusters; ++i)
+    {
+      const Bnd_Box& aBox = aClusterBoxes (i);
+      aCenters (i) = aBox.IsVoid() || aDir == 0 ? -Precision::Infinite() :
+        0.5 * (aBox.CornerMin().Coord (aDir) + aBox.CornerMax().Coord (aDir));
+      anOrder[i] = i;
+    }
+    std::stable_sort (anOrder.begin(), anOrder.end(),
+                      [&aCenters] (const Standard_Integer theI1, const Standard_Integer theI2)
+                      {
+                        return aCenters (theI1) < aCenters (theI2);
+                      });
+
+    // Fill the batches with the clusters of nearly equal number of tools
+    Standard_Integer aNbAdded = 0;
+    TColStd_ListOfInteger* aBatch = &aGroup.Batches.Appended();
+    for (Standard_Integer i = 0; i < aNbClusters; ++i)
+    {
+      if (aNbAdded * aNbBatches >= aGroup.Batches.Length() * aNbTools)
+      {
+        aBatch = &aGroup.Batches.Appended();
+      }
+      TColStd_ListOfInteger& aCluster = aClusters.ChangeValue (anOrder[i]);
+      aNbAdded += aCluster.Extent();
+      aBatch->Append (aCluster);
+    }
+
+    if (aGroup.Batches.Length() < 2)
+    {
+      aGroup.Batches.Clear();
+    }
+  }
+}
+
+//=======================================================================
+//function : AddToCompound
+//purpose  : Adds the result of Boolean operation into the compound
+//=======================================================================
+static void AddToCompound (const TopoDS_Shape& theResult,
+                           TopoDS_Compound& theCompound)
+{
+  BRep_Builder aBB;
+  if (theCompound.IsNull())
+  {
+    aBB.MakeCompound (theCompound);
+  }
+  if (theResult.ShapeType() == TopAbs_COMPOUND)
+  {
+    for (TopoDS_Iterator anIt (theResult); anIt.More(); anIt.Next())
+    {
+      aBB.Add (theCompound, anIt.Value());
+    }
+  }
+  else
+  {
+    aBB.Add (theCompound, theResult);
+  }
+}
+
+//=======================================================================
+//function : UniteHistory
+//purpose  : Adds the history of the independent batch of the group
+//           into the history of the group
+//=======================================================================
+static void UniteHistory (const BOPAlgo_GroupBOP& theBatch,
+                          const Handle(BRepTools_History)& theHistory,
+                          TopTools_MapOfShape& theKept,
+                          TopTools_MapOfShape& theRemoved)
+{
+  const Handle(BRepTools_History)& aBatchHistory = theBatch.History();
+  if (aBatchHistory.IsNull())
+  {
+    return;
+  }
+
+  TopTools_IndexedMapOfShape aMS;
+  for (Standard_Integer i = 0; i < 2; ++i)
+  {
+    const TopTools_ListOfShape& aLS = !i ? theBatch.Arguments() : theBatch.Tools();
+    for (TopTools_ListOfShape::Iterator anIt (aLS); anIt.More(); anIt.Next())
+    {
+      TopExp::MapShapes (anIt.Value(), aMS);
+    }
+  }
+
+  // The objects are shared by the batches, the shapes created
+  // by different batches are different
+  for (TopTools_IndexedMapOfShape::Iterator anIt (aMS); anIt.More(); anIt.Next())
+  {
+    const TopoDS_Shape& aS = anIt.Value();
+    if (!BRepTools_History::IsSupportedType (aS))
+    {
+      continue;
+    }
+    for (TopTools_ListOfShape::Iterator aItG (aBatchHistory->Generated (aS)); aItG.More(); aItG.Next())
+    {
+      theHistory->AddGenerated (aS, aItG.Value());
+    }
+    const TopTools_ListOfShape& aModified = aBatchHistory->Modified (aS);
+    for (TopTools_ListOfShape::Iterator aItM (aModified); aItM.More(); aItM.Next())
+    {
+      theHistory->AddModified (aS, aItM.Value());
+    }
+    if (aModified.IsEmpty())
+    {
+      (aBatchHistory->IsRemoved (aS) ? theRemoved : theKept).Add (aS);
+    }
+  }
+}
+
+//=======================================================================
+//function : PerformGroups
+//purpose  :
+//=======================================================================
+void BOPAlgo_BatchBOP::PerformGroups (const Message_ProgressRange& theRange)
+{
+  // The batches of CUT and FUSE operations are applied to the result
+  // of the previous batch, so they are processed in subsequent stages.
+  // The batches of COMMON and CUT21 operations are independent.
+  const Standard_Boolean isSequential = myOperation == BOPAlgo_CUT || myOperation == BOPAlgo_FUSE;
+  const Standard_Integer aNbGroups = myGroups.Length();
+  Standard_Integer aNbStages = 1;
+  myNbOperations = 0;
+  for (Standard_Integer iG = 0; iG < aNbGroups; ++iG)
+  {
+    const Group& aGroup = myGroups (iG);
+    if (aGroup.Status == GroupStatus_Operation)
+    {
+      const Standard_Integer aNbBatches = Max (aGroup.Batches.Length(), 1);
+      myNbOperations += aNbBatches;
+      if (isSequential)
+      {
+        aNbStages = Max (aNbStages, aNbBatches);
+      }
+    }
+  }
+
+  // Shapes kept and removed by the independent batches of the groups
+  NCollection_DataMap<Standard_Integer, TopTools_MapOfShape> aKeptShapes, aRemovedShapes;
+
+  Message_ProgressScope aPS (theRange, "Performing Boolean operations on groups", myNbOperations);
+  for (Standard_Integer iStage = 0; iStage < aNbStages; ++iStage)
+  {
+    BOPAlgo_VectorOfGroupBOP aVGroups;
+    Standard_Boolean hasSharedObjects = Standard_False;
+    for (Standard_Integer iG = 0; iG < aNbGroups; ++iG)
+    {
+      const Group& aGroup = myGroups (iG);
+      if (aGroup.Status != GroupStatus_Operation)
+      {
+        continue;
+      }
+
+      const Standard_Integer aNbBatches = aGroup.Batches.Length();
+      if (aNbBatches == 0)
+      {
+        if (iStage > 0)
+        {
+          continue;
+        }
+
+        BOPAlgo_GroupBOP& aGroupBOP = aVGroups.Appended();
+        aGroupBOP.SetGroupIndex (iG);
+        aGroupBOP.SetOptions (*this);
+        for (TColStd_ListOfInteger::Iterator anIt (aGroup.Indices); anIt.More(); anIt.Next())
+        {
+          const Standard_Integer anIndex = anIt.Value();
+          (anIndex < myNbObjects ? aGroupBOP.ChangeArguments() : aGroupBOP.ChangeTools()).Append (myShapes (anIndex));
+        }
+
+        if (aGroupBOP.ChangeArguments().IsEmpty() || aGroupBOP.ChangeTools().IsEmpty())
+        {
+          // FUSE of arguments of the same role, the roles do not matter
+          TopTools_ListOfShape& aFull = aGroupBOP.ChangeArguments().IsEmpty() ? aGroupBOP.ChangeTools() : aGroupBOP.ChangeArguments();
+          TopTools_ListOfShape& anEmpty = aGroupBOP.ChangeArguments().IsEmpty() ? aGroupBOP.ChangeArguments() : aGroupBOP.ChangeTools();
+          anEmpty.Append (aFull.First());
+          aFull.RemoveFirst();
+        }
+        continue;
+      }
+
+      // Objects of the group
+      TopTools_ListOfShape anObjects;
+      if (isSequential && iStage > 0)
+      {
+        if (iStage >= aNbBatches || aGroup.Result.IsNull() || !TopoDS_Iterator (aGroup.Result).More())
+        {
+          // no more batches or nothing left to process
+          continue;
+        }
+        anObjects.Append (aGroup.Result);
+      }
+      else
+      {
+        for (TColStd_ListOfInteger::Iterator anIt (aGroup.Indices); anIt.More(); anIt.Next())
+        {
+          if (anIt.Value() < myNbObjects)
+          {
+            anObjects.Append (myShapes (anIt.Value()));
+          }
+        }
+      }
+
+      const Standard_Integer aFirstBatch = isSequential ? iStage : 0;
+      const Standard_Integer aLastBatch = isSequential ? iStage : aNbBatches - 1;
+      for (Standard_Integer iB = aFirstBatch; iB <= aLastBatch; ++iB)
+      {
+        BOPAlgo_GroupBOP& aGroupBOP = aVGroups.Appended();
+        aGroupBOP.SetGroupIndex (iG);
+        aGroupBOP.SetOptions (*this);
+        aGroupBOP.ChangeArguments() = anObjects;
+        for (TColStd_ListOfInteger::Iterator anIt (aGroup.Batches (iB)); anIt.More(); anIt.Next())
+        {
+          aGroupBOP.ChangeTools().Append (myShapes (anIt.Value()));
+        }
+      }
+      hasSharedObjects = hasSharedObjects || aLastBatch > aFirstBatch;
+    }
+
+    // The arguments of different groups may share the underlying shapes (e.g.
+    // the tools may be the located instances of the same shape), and the
+    // independent batches of one group share the objects. Destructive operation
+    // modifies the tolerances of the sub-shapes of the arguments, thus the
+    // operations sharing the arguments or processed simultaneously are always
+    // performed in non-destructive mode.
+    const Standard_Integer aNbOperations = aVGroups.Length();
+    const Standard_Boolean isNonDestructive = myNonDestructive || hasSharedObjects || (myRunParallel && aNbOperations > 1);
+    for (Standard_Integer i = 0; i < aNbOperations; ++i)
+    {
+      BOPAlgo_GroupBOP& aGroupBOP = aVGroups.ChangeValue (i);
+      aGroupBOP.SetNonDestructive (isNonDestructive);
+      aGroupBOP.SetProgressRange (aPS.Next());
+    }
+    BOPTools_Parallel::Perform (myRunParallel, aVGroups);
+    if (UserBreak (aPS))
+    {
+      return;
+    }
+
+    // Take the results in the order of the groups
+    for (Standard_Integer i = 0; i < aNbOperations; ++i)
+    {
+      const BOPAlgo_GroupBOP& aGroupBOP = aVGroups (i);
+      myReport->Merge (aGroupBOP.GetReport());
+
+      Group& aGroup = myGroups.ChangeValue (aGroupBOP.GroupIndex());
+      if (aGroup.Batches.Length() < 2 || isSequential)
+      {
+        // The result of the batch replaces the objects of the group,
+        // the history of the batch continues the history of the group
+        aGroup.Result = aGroupBOP.Shape();
+        if (aGroup.History.IsNull())
+        {
+          aGroup.History = aGroupBOP.History();
+        }
+        else
+        {
+          aGroup.History->Merge (aGroupBOP.History());
+        }
+        continue;
+      }
+
+      // The results of the independent batches do not interfere
+      if (!aGroupBOP.Shape().IsNull())
+      {
+        TopoDS_Compound aResult = TopoDS::Compound (aGroup.Result);
+        AddToCompound (aGroupBOP.Shape(), aResult);
+        aGroup.Result = aResult;
+      }
+      if (myFillHistory)
+      {
+        if (aGroup.History.IsNull())
+        {
+          aGroup.History = new BRepTools_History();
+          aKeptShapes.Bind (aGroupBOP.GroupIndex(), TopTools_MapOfShape());
+          aRemovedShapes.Bind (aGroupBOP.GroupIndex(), TopTools_MapOfShape());
+        }
+        UniteHistory (aGroupBOP, aGroup.History,
+                      aKeptShapes.ChangeFind (aGroupBOP.GroupIndex()),
+                      aRemovedShapes.ChangeFind (aGroupBOP.GroupIndex()));
+      }
+    }
+  }
+
+  // A shape of the objects shared by the independent batches is deleted
+  // only if it is deleted by all batches. The shape kept by one batch and
+  // modified by another one is the image of itself.
+  for (NCollection_DataMap<Standard_Integer, TopTools_MapOfShape>::Iterator anIt (aKeptShapes); anIt.More(); anIt.Next())
+  {
+    const Handle(BRepTools_History)& aHistory = myGroups (anIt.Key()).History;
+    const TopTools_MapOfShape& aKept = anIt.Value();
+    for (TopTools_MapOfShape::Iterator aItS (aKept); aItS.More(); aItS.Next())
+    {
+      if (!aHistory->Modified (aItS.Value()).IsEmpty())
+      {
+        aHistory->AddModified (aItS.Value(), aItS.Value());
+      }
+    }
+    for (TopTools_MapOfShape::Iterator aItS (aRemovedShapes.Find (anIt.Key())); aItS.More(); aItS.Next())
+    {
+      if (!aKept.Contains (aItS.Value()) && aHistory->Modified (aItS.Value()).IsEmpty())
+      {
+        aHistory->Remove (aItS.Value());
+      }
+    }
+  }
+}
+
+//=======================================================================
+//function : BuildResult
+//purpose  :
+//=======================================================================
+void BOPAlgo_BatchBOP::BuildResult()
+{
+  BRep_Builder aBB;
+  TopoDS_Compound aResult;
+  aBB.MakeCompound (aResult);
+
+  if (myFillHistory)
+  {
+    myHistory = new BRepTools_History();
+  }
+
+  TopTools_IndexedMapOfShape aMRemoved;
+  const Standard_Integer aNbGroups = myGroups.Length();
+  for (Standard_Integer iG = 0; iG < aNbGroups; ++iG)
+  {
+    const Group& aGroup = myGroups (iG);
+    switch (aGroup.Status)
+    {
+      case GroupStatus_Operation:
+      {
+        if (aGroup.Result.IsNull())
+        {
+          break;
+        }
+        AddToCompound (aGroup.Result, aResult);
+        if (myFillHistory)
+        {
+          // The arguments sharing sub-shapes have interfering bounding boxes and
+          // get into the same group, the groups may share only the underlying
+          // shapes of the located instances. So the histories of the groups
+          // do not intersect and merging of them is just their union
+          myHistory->Merge (aGroup.History);
+        }
+        break;
+      }
+      case GroupStatus_Keep:
+      {
+        for (TColStd_ListOfInteger::Iterator anIt (aGroup.Indices); anIt.More(); anIt.Next())
+        {
+          aBB.Add (aResult, myShapes (anIt.Value()));
+        }
+        break;
+      }
+      case GroupStatus_Remove:
+      {
+        if (myFillHistory)
+        {
+          for (TColStd_ListOfInteger::Iterator anIt (aGroup.Indices); anIt.More(); anIt.Next())
+          {
+            TopExp::MapShapes (myShapes (anIt.Value()), aMRemoved);
+          }
+        }
+        break;
+      }
+      case GroupStatus_Merged:
+        break;
+    }
+  }
+
+  if (!aMRemoved.IsEmpty())
+  {
+    // Delete only the sub-shapes which have not got into the result
+    // as is or through their modifications by the other groups
+    TopTools_IndexedMapOfShape aMResult;
+    TopExp::MapShapes (aResult, aMResult);
+    for (TopTools_IndexedMapOfShape::Iterator anIt (aMRemoved); anIt.More(); anIt.Next())
+    {
+      const TopoDS_Shape& aS = anIt.Value();
+      if (BRepTools_History::IsSupportedType (aS)
+      && !aMResult.Contains (aS)
+      &&  myHistory->Modified (aS).IsEmpty())
+      {
+        myHistory->Remove (aS);
+      }
+    }
+  }
+
+  myShape = aResult;
+}
@@ -0,0 +1,237 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _BOPAlgo_BatchBOP_HeaderFile
+#define _BOPAlgo_BatchBOP_HeaderFile
+
+#include <Standard.hxx>
+#include <Standard_DefineAlloc.hxx>
+#include <Standard_Handle.hxx>
+
+#include <BOPAlgo_BuilderShape.hxx>
+#include <BOPAlgo_GlueEnum.hxx>
+#include <BOPAlgo_Operation.hxx>
+#include <NCollection_Vector.hxx>
+#include <TColStd_ListOfInteger.hxx>
+#include <TopTools_ListOfShape.hxx>
+
+//! The BatchBOP algorithm performs the Boolean operation of the given type
+//! on the objects and the large number of tools (e.g. drilling of many holes
+//! in several plates or subtracting many fasteners from an assembly).
+//!
+//! Instead of one Boolean operation with all arguments the algorithm
+//! splits the arguments on the groups which cannot interfere with each other:
+//! two arguments get into the same group if their bounding boxes (enlarged
+//! by the fuzzy value) interfere, directly or through other arguments.
+//! The search of interfering boxes is performed with the help of BVH tree.
+//!
+//! Each group containing both objects and tools is processed by its own
+//! Boolean operation (BOPAlgo_BOP), the groups are processed in parallel
+//! if the parallel processing mode is set. The groups without objects or
+//! without tools are not intersected at all: their arguments are either
+//! passed into the result as is or removed from it, according to the type
+//! of the operation.
+//!
+//! All tools interfering with the same object get into the same group.
+//! If the maximal number of tools in one operation is set (see SetMaxToolsInOperation()),
+//! the tools of the larger group are split on the batches of the tools which do not
+//! interfere with the tools of the other batches. The batches are made of the tools
+//! close to each other, and the group is processed by one operation per batch:
+//! - For COMMON and CUT21 operations the batches are independent, as the result of
+//!   the group is the union of the results of the objects with each batch.
+//!   The operations of the batches are processed in parallel with all other operations;
+//! - For CUT and FUSE operations each batch is applied to the result of the operation
+//!   with the previous batch, so the batches of one group are processed in sequence.
+//!   It limits the size of a single operation, but does not make the operation
+//!   faster: the whole object takes part in each step, so cutting of many holes
+//!   in a single plate is not sped up by the algorithm.
+//!
+//! The result of the operation is the compound of the results of the groups
+//! in the order of the groups (the group order is the order of the first argument
+//! of the group in the lists of objects and tools). As the groups do not interfere,
+//! the result is equal to the result of the single Boolean operation with all arguments.
+//!
+//! The history of the operation is the union of the histories of the groups,
+//! the sub-shapes of the arguments of the removed groups which are not kept
+//! in the result are marked as deleted.
+//!
+//! The algorithm returns the following Error statuses:
+//! - *BOPAlgo_AlertBOPNotSet* - in case the type of Boolean operation is not set;
+//! - *BOPAlgo_AlertTooFewArguments* - in case there are no objects or tools;
+//! - *BOPAlgo_AlertNullInputShapes* - in case some of the arguments are null shapes;
+//! - Error statuses of the Boolean operations of the groups.
+//!
+//! Here is the example of usage of the algorithm:
+//! ~~~~
+//! TopTools_ListOfShape aPlates = ...;  // Objects
+//! TopTools_ListOfShape aHoles = ...;   // Tools
+//!
+//! BOPAlgo_BatchBOP aBatch;
+//! aBatch.SetArguments (aPlates);
+//! aBatch.SetTools (aHoles);
+//! aBatch.SetOperation (BOPAlgo_CUT);
+//! aBatch.SetRunParallel (Standard_True);
+//! aBatch.Perform();
+//! if (aBatch.HasErrors())
+//! {
+//!   // errors treatment
+//! }
+//! const TopoDS_Shape& aResult = aBatch.Shape();
+//! ~~~~
+class BOPAlgo_BatchBOP : public BOPAlgo_BuilderShape
+{
+public:
+
+  DEFINE_STANDARD_ALLOC
+
+public: //! @name Constructors
+
+  //! Empty constructor
+  Standard_EXPORT BOPAlgo_BatchBOP();
+
+  //! Constructor with allocator
+  Standard_EXPORT BOPAlgo_BatchBOP (const Handle(NCollection_BaseAllocator)& theAllocator);
+
+  Standard_EXPORT virtual ~BOPAlgo_BatchBOP();
+
+public: //! @name Setting input data for the algorithm
+
+  //! Sets the type of Boolean operation
+  void SetOperation (const BOPAlgo_Operation theOperation) { myOperation = theOperation; }
+
+  //! Returns the type of Boolean operation
+  BOPAlgo_Operation Operation() const { return myOperation; }
+
+  //! Sets the objects of the operation
+  void SetArguments (const TopTools_ListOfShape& theLS) { myArguments = theLS; }
+
+  //! Adds the object of the operation
+  void AddArgument (const TopoDS_Shape& theShape) { myArguments.Append (theShape); }
+
+  //! Returns the objects of the operation
+  const TopTools_ListOfShape& Arguments() const { return myArguments; }
+
+  //! Sets the tools of the operation
+  void SetTools (const TopTools_ListOfShape& theLS) { myTools = theLS; }
+
+  //! Adds the tool of the operation
+  void AddTool (const TopoDS_Shape& theShape) { myTools.Append (theShape); }
+
+  //! Returns the tools of the operation
+  const TopTools_ListOfShape& Tools() const { return myTools; }
+
+public: //! @name Options of the Boolean operations of the groups
+
+  //! Sets the flag that defines the mode of treatment.
+  //! In non-destructive mode the argument shapes are not modified.
+  //! Note that the groups processed in parallel are always performed
+  //! in non-destructive mode, as their arguments may share sub-shapes.
+  void SetNonDestructive (const Standard_Boolean theFlag) { myNonDestructive = theFlag; }
+
+  //! Returns the flag that defines the mode of treatment.
+  Standard_Boolean NonDestructive() const { return myNonDestructive; }
+
+  //! Sets the glue option for the algorithm
+  void SetGlue (const BOPAlgo_GlueEnum theGlue) { myGlue = theGlue; }
+
+  //! Returns the glue option of the algorithm
+  BOPAlgo_GlueEnum Glue() const { return myGlue; }
+
+  //! Enables/Disables the check of the input solids for inverted status
+  void SetCheckInverted (const Standard_Boolean theCheck) { myCheckInverted = theCheck; }
+
+  //! Returns the flag defining whether the check for input solids on inverted status
+  //! should be performed or not.
+  Standard_Boolean CheckInverted() const { return myCheckInverted; }
+
+  //! Sets the maximal number of tools of one group processed by a single
+  //! Boolean operation. The tools of the larger groups are split on the batches.
+  //! Zero (default) means that each group is processed by a single operation.
+  void SetMaxToolsInOperation (const Standard_Integer theNbTools) { myMaxTools = theNbTools; }
+
+  //! Returns the maximal number of tools of one group processed by a single operation.
+  Standard_Integer MaxToolsInOperation() const { return myMaxTools; }
+
+public: //! @name Performing the operation
+
+  //! Performs the operation
+  Standard_EXPORT virtual void Perform (const Message_ProgressRange& theRange = Message_ProgressRange()) Standard_OVERRIDE;
+
+public: //! @name Information about the groups
+
+  //! Returns the number of groups of non-interfering arguments.
+  Standard_Integer NbGroups() const { return myGroups.Length(); }
+
+  //! Returns the number of Boolean operations performed on the groups and their batches.
+  Standard_Integer NbOperations() const { return myNbOperations; }
+
+public: //! @name Clearing the contents of the algorithm
+
+  //! Clears the contents of the algorithm
+  Standard_EXPORT virtual void Clear() Standard_OVERRIDE;
+
+protected: //! @name Protected methods performing the operation
+
+  //! Checks the input data
+  Standard_EXPORT virtual void CheckData() Standard_OVERRIDE;
+
+  //! Splits the arguments on the groups of non-interfering arguments,
+  //! defines the treatment of each group and splits the tools of the
+  //! large groups on the batches.
+  Standard_EXPORT void MakeGroups();
+
+  //! Performs the Boolean operations of the groups
+  Standard_EXPORT void PerformGroups (const Message_ProgressRange& theRange);
+
+  //! Builds the result and the history from the results of the groups
+  Standard_EXPORT void BuildResult();
+
+protected: //! @name Fields
+
+  //! Treatment of the group of arguments
+  enum GroupStatus
+  {
+    GroupStatus_Operation, //!< The group is processed by Boolean operation
+    GroupStatus_Keep,      //!< The arguments of the group are passed into the result as is
+    GroupStatus_Remove,    //!< The arguments of the group are removed from the result
+    GroupStatus_Merged     //!< The arguments of the group are processed in other group
+  };
+
+  //! Group of non-interfering arguments
+  struct Group
+  {
+    TColStd_ListOfInteger Indices;     //!< Indices of the arguments (objects first, then tools)
+    GroupStatus Status;                //!< Treatment of the group
+    TopoDS_Shape Result;               //!< Result of Boolean operation of the group
+    Handle(BRepTools_History) History; //!< History of Boolean operation of the group
+    NCollection_Vector<TColStd_ListOfInteger> Batches; //!< Batches of the tools, if the group is split
+    Group() : Status (GroupStatus_Keep) {}
+  };
+
+  // Inputs
+  TopTools_ListOfShape myArguments;    //!< Objects
+  TopTools_ListOfShape myTools;        //!< Tools
+  BOPAlgo_Operation myOperation;       //!< Type of Boolean operation
+  Standard_Boolean myNonDestructive;   //!< Non-destructive mode of the groups operations
+  BOPAlgo_GlueEnum myGlue;             //!< Glue option of the groups operations
+  Standard_Boolean myCheckInverted;    //!< Check of the inverted solids
+  Standard_Integer myMaxTools;         //!< Maximal number of tools in one operation
+
+  // Intermediate
+  NCollection_Vector<TopoDS_Shape> myShapes; //!< All arguments (objects first, then tools)
+  Standard_Integer myNbObjects;              //!< Number of objects in <myShapes>
+  NCollection_Vector<Group> myGroups;        //!< Groups of non-interfering arguments
+  Standard_Integer myNbOperations;           //!< Number of groups processed by Boolean operation
+};
+
+#endif // _BOPAlgo_BatchBOP_HeaderFile
@@ -30,6 +30,7 @@
 #include <IntTools_Context.hxx>
 #include <NCollection_DataMap.hxx>
 #include <NCollection_List.hxx>
+#include <NCollection_Vector.hxx>
 #include <TopExp.hxx>
 #include <TopExp_Explorer.hxx>
 #include <TopoDS.hxx>
@@ -373,6 +374,126 @@ void BOPAlgo_BuilderSolid::PerformLoops(const Message_ProgressRange& theRange)
     myLoopsInternal.Append(aShell);
   }
 }
+//=======================================================================
+//class    : BOPAlgo_ShellClassifier
+//purpose  : Auxiliary class for classification of the shells
+//           as growths or holes in parallel mode
+//=======================================================================
+class BOPAlgo_ShellClassifier : public BOPAlgo_ParallelAlgo
+{
+public:
+  DEFINE_STANDARD_ALLOC
+
+  //! Constructor
+  BOPAlgo_ShellClassifier() : myIsHole (Standard_False) {}
+
+  //! Sets the shell to classify
+  void SetShell (const TopoDS_Shape& theShell) { myShell = theShell; }
+
+  //! Sets the context
+  void SetContext (const Handle(IntTools_Context)& theContext) { myContext = theContext; }
+
+  //! Returns the context
+  const Handle(IntTools_Context)& Context() const { return myContext; }
+
+  //! Returns true if the shell is a hole
+  Standard_Boolean IsHole() const { return myIsHole; }
+
+  //! Performs the classification
+  virtual void Perform()
+  {
+    Message_ProgressScope aPS (myProgressRange, NULL, 1);
+    if (UserBreak (aPS))
+    {
+      return;
+    }
+    myIsHole = ::IsHole (myShell, myContext);
+  }
+
+private:
+  TopoDS_Shape myShell;
+  Handle(IntTools_Context) myContext;
+  Standard_Boolean myIsHole;
+};
+
+typedef NCollection_Vector<BOPAlgo_ShellClassifier> BOPAlgo_VectorOfShellClassifier;
+
+//=======================================================================
+//class    : BOPAlgo_SolidHoles
+//purpose  : Auxiliary class for finding the hole shells located
+//           inside the growth solid in parallel mode
+//=======================================================================
+class BOPAlgo_SolidHoles : public BOPAlgo_ParallelAlgo
+{
+public:
+  DEFINE_STANDARD_ALLOC
+
+  //! Constructor
+  BOPAlgo_SolidHoles() : myHoleShells (NULL), myBBTree (NULL) {}
+
+  //! Sets the solid
+  void SetSolid (const TopoDS_Shape& theSolid) { mySolid = theSolid; }
+
+  //! Returns the solid
+  const TopoDS_Shape& Solid() const { return mySolid; }
+
+  //! Sets the hole shells and the tree of their bounding boxes
+  void SetHoleShells (const TopTools_IndexedMapOfShape& theHoleShells,
+                      BOPTools_BoxTree& theBBTree)
+  {
+    myHoleShells = &theHoleShells;
+    myBBTree = &theBBTree;
+  }
+
+  //! Sets the context
+  void SetContext (const Handle(IntTools_Context)& theContext) { myContext = theContext; }
+
+  //! Returns the context
+  const Handle(IntTools_Context)& Context() const { return myContext; }
+
+  //! Returns the bounding box of the solid
+  const Bnd_Box& Box() const { return myBox; }
+
+  //! Returns the indices of the hole shells located inside the solid
+  const TColStd_ListOfInteger& Holes() const { return myHoles; }
+
+  //! Performs the search of the holes
+  virtual void Perform()
+  {
+    Message_ProgressScope aPS (myProgressRange, NULL, 1);
+    if (UserBreak (aPS))
+    {
+      return;
+    }
+    BRepBndLib::Add (mySolid, myBox);
+
+    BOPTools_BoxTreeSelector aSelector;
+    aSelector.SetBox (Bnd_Tools::Bnd2BVH (myBox));
+    aSelector.SetBVHSet (myBBTree);
+    aSelector.Select();
+
+    TColStd_ListIteratorOfListOfInteger aItLI (aSelector.Indices());
+    for (; aItLI.More(); aItLI.Next())
+    {
+      Standard_Integer k = aItLI.Value();
+      if (IsInside (myHoleShells->FindKey (k), mySolid, myContext))
+      {
+        myHoles.Append (k);
+      }
+    }
+  }
+
+private:
+  TopoDS_Shape mySolid;
+  const TopTools_IndexedMapOfShape* myHoleShells;
+  BOPTools_BoxTree* myBBTree;
+  Handle(IntTools_Context) myContext;
+  Bnd_Box myBox;
+  TColStd_ListOfInteger myHoles;
+};
+
+typedef NCollection_Vector<BOPAlgo_SolidHoles> BOPAlgo_VectorOfSolidHoles;
+
 //=======================================================================
 //function : PerformAreas
 //purpose  : 
@@ -391,22 +512,48 @@ void BOPAlgo_BuilderSolid::PerformAreas(const Message_ProgressRange& theRange)
 
   Message_ProgressScope aMainScope(theRange, "Building solids", 10);
 
-  // Analyze the shells
   Message_ProgressScope aPSClass(aMainScope.Next(5), "Classify solids", myLoops.Size());
+
+  // In parallel mode classify all shells at once. Otherwise the shells
+  // are classified one by one, only if the fast check did not give the result.
+  BOPAlgo_VectorOfShellClassifier aVSC;
   TopTools_ListIteratorOfListOfShape aItLL(myLoops);
-  for (; aItLL.More(); aItLL.Next(), aPSClass.Next())
+  if (myRunParallel)
   {
+    for (; aItLL.More(); aItLL.Next())
+    {
+      BOPAlgo_ShellClassifier& aSC = aVSC.Appended();
+      aSC.SetShell (aItLL.Value());
+      aSC.SetProgressRange (aPSClass.Next());
+    }
+    //================================================================
+    BOPTools_Parallel::Perform (myRunParallel, aVSC, myContext);
+    //================================================================
     if (UserBreak (aPSClass))
     {
       return;
     }
+  }
+
+  // Analyze the shells
+  Standard_Integer iShell = 0;
+  for (aItLL.Initialize (myLoops); aItLL.More(); aItLL.Next(), ++iShell)
+  {
+    if (aVSC.IsEmpty())
+    {
+      if (UserBreak (aPSClass))
+      {
+        return;
+      }
+      aPSClass.Next();
+    }
     const TopoDS_Shape& aShell = aItLL.Value();
 
     Standard_Boolean bIsGrowth = IsGrowthShell(aShell, aMHF);
     if (!bIsGrowth)
     {
-      // Fast check did not give the result, run classification
-      bIsGrowth = !IsHole(aShell, myContext);
+      // Fast check did not give the result, use classification
+      bIsGrowth = aVSC.IsEmpty() ? !IsHole(aShell, myContext) : !aVSC(iShell).IsHole();
     }
 
     // Save the solid
@@ -464,35 +611,43 @@ void BOPAlgo_BuilderSolid::PerformAreas(const Message_ProgressRange& theRange)
   TopTools_IndexedDataMapOfShapeShape aHoleSolidMap;
 
   Message_ProgressScope aPSH(aMainScope.Next(4), "Adding holes", aNewSolids.Size());
+  BOPAlgo_VectorOfSolidHoles aVSH;
   TopTools_ListIteratorOfListOfShape aItLS(aNewSolids);
-  for (; aItLS.More(); aItLS.Next(), aPSH.Next())
+  for (; aItLS.More(); aItLS.Next())
   {
-    if (UserBreak (aPSH))
-    {
-      return;
-    }
-    const TopoDS_Shape& aSolid = aItLS.Value();
-
-    // Build box
-    Bnd_Box aBox;
-    BRepBndLib::Add(aSolid, aBox);
+    BOPAlgo_SolidHoles& aSH = aVSH.Appended();
+    aSH.SetSolid (aItLS.Value());
+    aSH.SetHoleShells (aHoleShells, aBBTree);
+    aSH.SetProgressRange (aPSH.Next());
+  }
+  // The holes will be added into the solids, thus in parallel mode the holes
+  // are searched with the separate context not to keep the classifiers of
+  // the solids without holes in the contexts of the threads.
+  Handle(IntTools_Context) aHolesContext;
+  if (!myRunParallel)
+  {
+    aHolesContext = myContext;
+  }
+  //================================================================
+  BOPTools_Parallel::Perform (myRunParallel, aVSH, aHolesContext);
+  //================================================================
+  if (UserBreak (aPSH))
+  {
+    return;
+  }
 
-    myBoxes.Bind(aSolid, aBox);
+  Standard_Integer aNbSH = aVSH.Length();
+  for (Standard_Integer iS = 0; iS < aNbSH; ++iS)
+  {
+    const BOPAlgo_SolidHoles& aSH = aVSH(iS);
+    const TopoDS_Shape& aSolid = aSH.Solid();
 
-    BOPTools_BoxTreeSelector aSelector;
-    aSelector.SetBox(Bnd_Tools::Bnd2BVH(aBox));
-    aSelector.SetBVHSet (&aBBTree);
-    aSelector.Select();
+    myBoxes.Bind(aSolid, aSH.Box());
 
-    const TColStd_ListOfInteger& aLI = aSelector.Indices();
-    TColStd_ListIteratorOfListOfInteger aItLI(aLI);
+    TColStd_ListIteratorOfListOfInteger aItLI(aSH.Holes());
     for (; aItLI.More(); aItLI.Next())
     {
-      Standard_Integer k = aItLI.Value();
-      const TopoDS_Shape& aHole = aHoleShells(k);
-      // Check if it is inside
-      if (!IsInside(aHole, aSolid, myContext))
-        continue;
+      const TopoDS_Shape& aHole = aHoleShells(aItLI.Value());
 
       // Save the relation
       TopoDS_Shape* pSolidWas = aHoleSolidMap.ChangeSeek(aHole);
@@ -563,6 +563,67 @@ void BOPAlgo_Builder::BuildSplitSolids(TopTools_DataMapOfShapeShape& theDraftSol
     }
   }
 }
+//=======================================================================
+//class    : BOPAlgo_ShapesInSolid
+//purpose  : Auxiliary class for finding the internal shapes
+//           located inside the solid in parallel mode
+//=======================================================================
+class BOPAlgo_ShapesInSolid : public BOPAlgo_ParallelAlgo
+{
+public:
+  DEFINE_STANDARD_ALLOC
+
+  //! Constructor
+  BOPAlgo_ShapesInSolid() : myShapes (NULL) {}
+
+  //! Sets the solid
+  void SetSolid (const TopoDS_Shape& theSolid) { mySolid = theSolid; }
+
+  //! Sets the shapes to classify
+  void SetShapes (const TopTools_ListOfShape& theLS) { myShapes = &theLS; }
+
+  //! Sets the context
+  void SetContext (const Handle(IntTools_Context)& theContext) { myContext = theContext; }
+
+  //! Returns the context
+  const Handle(IntTools_Context)& Context() const { return myContext; }
+
+  //! Returns the shapes located inside the solid
+  const TopTools_MapOfShape& InShapes() const { return myInShapes; }
+
+  //! Performs the classification
+  virtual void Perform()
+  {
+    Message_ProgressScope aPS (myProgressRange, NULL, 1);
+    if (UserBreak (aPS))
+    {
+      return;
+    }
+    const TopoDS_Solid& aSd = TopoDS::Solid (mySolid);
+    TopTools_ListIteratorOfListOfShape aIt (*myShapes);
+    for (; aIt.More(); aIt.Next())
+    {
+      TopoDS_Shape aSI = aIt.Value();
+      aSI.Orientation (TopAbs_INTERNAL);
+      //
+      TopAbs_State aState = BOPTools_AlgoTools::ComputeStateByOnePoint
+        (aSI, aSd, 1.e-11, myContext);
+      if (aState == TopAbs_IN)
+      {
+        myInShapes.Add (aSI);
+      }
+    }
+  }
+
+private:
+  TopoDS_Shape mySolid;
+  const TopTools_ListOfShape* myShapes;
+  Handle(IntTools_Context) myContext;
+  TopTools_MapOfShape myInShapes;
+};
+
+typedef NCollection_Vector<BOPAlgo_ShapesInSolid> BOPAlgo_VectorOfShapesInSolid;
+
 //=======================================================================
 //function :FillInternalShapes 
 //purpose  : 
@@ -571,7 +632,6 @@ void BOPAlgo_Builder::FillInternalShapes(const Message_ProgressRange& theRange)
 {
   Standard_Integer i, j,  aNbS, aNbSI, aNbSx;
   TopAbs_ShapeEnum aType;
-  TopAbs_State aState; 
   TopoDS_Iterator aItS;
   BRep_Builder aBB;
   TopTools_ListIteratorOfListOfShape aIt, aIt1;
@@ -742,20 +802,55 @@ void BOPAlgo_Builder::FillInternalShapes(const Message_ProgressRange& theRange)
   aMx.Clear();
 
   Message_ProgressScope aPSLoop(aPS.Next(9), "Looking for internal shapes", aLSd.Size());
-
+  //
+  // 5.1 In parallel mode classify the shapes relatively all solids at once.
+  //     Otherwise the shapes are classified in the loop below one by one,
+  //     skipping the shapes already settled into the previous solids.
+  BOPAlgo_VectorOfShapesInSolid aVSIS;
+  if (myRunParallel) {
+    aIt.Initialize(aLSd);
+    for (; aIt.More(); aIt.Next()) {
+      BOPAlgo_ShapesInSolid& aSIS=aVSIS.Appended();
+      aSIS.SetSolid(aIt.Value());
+      aSIS.SetShapes(aLSI);
+      aSIS.SetProgressRange(aPSLoop.Next());
+    }
+    //
+    // The internal shapes will be added into the solids, so the
+    // classifiers of the solids are kept in the separate context.
+    Handle(IntTools_Context) aCtx;
+    //================================================================
+    BOPTools_Parallel::Perform (myRunParallel, aVSIS, aCtx);
+    //================================================================
+    if (UserBreak(aPS)) {
+      return;
+    }
+  }
+  //
+  // 5.2 Put each shape into the first solid containing it
   aIt.Initialize(aLSd);
-  for (; aIt.More(); aIt.Next(), aPSLoop.Next()) {
+  for (i=0; aIt.More(); aIt.Next(), ++i) {
     TopoDS_Solid aSd=TopoDS::Solid(aIt.Value());
+    const TopTools_MapOfShape* pMIn=NULL;
+    if (aVSIS.IsEmpty()) {
+      aPSLoop.Next();
+    }
+    else {
+      pMIn=&aVSIS(i).InShapes();
+      if (pMIn->IsEmpty()) {
+        continue;
+      }
+    }
     //
     aIt1.Initialize(aLSI);
     for (; aIt1.More();) {
       TopoDS_Shape aSI = aIt1.Value();
       aSI.Orientation(TopAbs_INTERNAL);
       //
-      aState=BOPTools_AlgoTools::ComputeStateByOnePoint
-        (aSI, aSd, 1.e-11, myContext);
-      //
-      if (aState != TopAbs_IN) {
+      Standard_Boolean bIsIn = pMIn ? pMIn->Contains(aSI) :
+        (BOPTools_AlgoTools::ComputeStateByOnePoint
+          (aSI, aSd, 1.e-11, myContext) == TopAbs_IN);
+      if (!bIsIn) {
         aIt1.Next();
         continue;
       }
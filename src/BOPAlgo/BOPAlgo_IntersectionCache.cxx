@@ -0,0 +1,230 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BOPAlgo_IntersectionCache.hxx>
+
+#include <BOPDS_DS.hxx>
+#include <BRep_Tool.hxx>
+#include <Geom_Curve.hxx>
+#include <Geom2d_Curve.hxx>
+
+IMPLEMENT_STANDARD_RTTIEXT(BOPAlgo_IntersectionCache, Standard_Transient)
+
+//=======================================================================
+//function : Tolerances
+//purpose  :
+//=======================================================================
+BOPAlgo_IntersectionCache::Tolerances::Tolerances (const TopoDS_Face& theFace)
+: Face     (BRep_Tool::Tolerance (theFace)),
+  Edges    (BRep_Tool::MaxTolerance (theFace, TopAbs_EDGE)),
+  Vertices (BRep_Tool::MaxTolerance (theFace, TopAbs_VERTEX))
+{
+  //
+}
+
+//=======================================================================
+//function : BOPAlgo_IntersectionCache
+//purpose  :
+//=======================================================================
+BOPAlgo_IntersectionCache::BOPAlgo_IntersectionCache()
+: myNbHits   (0),
+  myNbMisses (0),
+  myNbTreeHits   (0),
+  myNbTreeMisses (0)
+{
+  //
+}
+
+//=======================================================================
+//function : FindFaceFace
+//purpose  :
+//=======================================================================
+Standard_Boolean BOPAlgo_IntersectionCache::FindFaceFace (const FaceFaceInput& theInput,
+                                                          IntTools_SequenceOfCurves& theCurves,
+                                                          IntTools_SequenceOfPntOn2Faces& thePoints,
+                                                          Standard_Boolean& theTangentFaces)
+{
+  const FaceFaceData* aData = myFaceFaceMap.Seek (FacePair (theInput.Face1, theInput.Face2));
+  if (aData == NULL
+  || !isSameInput (aData->Input, theInput)
+  || !(aData->Tolerances1 == Tolerances (theInput.Face1))
+  || !(aData->Tolerances2 == Tolerances (theInput.Face2)))
+  {
+    ++myNbMisses;
+    return Standard_False;
+  }
+
+  ++myNbHits;
+  copyCurves (aData->Curves, theCurves);
+  thePoints = aData->Points;
+  theTangentFaces = aData->TangentFaces;
+  return Standard_True;
+}
+
+//=======================================================================
+//function : BindFaceFace
+//purpose  :
+//=======================================================================
+void BOPAlgo_IntersectionCache::BindFaceFace (const FaceFaceInput& theInput,
+                                              const IntTools_SequenceOfCurves& theCurves,
+                                              const IntTools_SequenceOfPntOn2Faces& thePoints,
+                                              const Standard_Boolean theTangentFaces)
+{
+  const FacePair aPair (theInput.Face1, theInput.Face2);
+  FaceFaceData* aData = myFaceFaceMap.ChangeSeek (aPair);
+  if (aData == NULL)
+  {
+    aData = myFaceFaceMap.Bound (aPair, FaceFaceData());
+  }
+
+  aData->Input = theInput;
+  aData->Tolerances1 = Tolerances (theInput.Face1);
+  aData->Tolerances2 = Tolerances (theInput.Face2);
+  aData->Curves.Clear();
+  copyCurves (theCurves, aData->Curves);
+  aData->Points = thePoints;
+  aData->TangentFaces = theTangentFaces;
+}
+
+//=======================================================================
+//function : FindArgumentTree
+//purpose  :
+//=======================================================================
+Handle(BOPTools_BoxTree) BOPAlgo_IntersectionCache::FindArgumentTree (const BOPDS_DS& theDS,
+                                                                      const Standard_Integer theRange)
+{
+  const BOPDS_IndexRange& aRange = theDS.Range (theRange);
+  const ArgumentTreeData* aData = myArgumentTreeMap.Seek (theDS.Shape (aRange.First()));
+  Standard_Boolean isSame = aData != NULL && aData->Shapes.Length() == aRange.Last() - aRange.First() + 1;
+  for (Standard_Integer i = aRange.First(); isSame && i <= aRange.Last(); ++i)
+  {
+    const BOPDS_ShapeInfo& aSI = theDS.ShapeInfo (i);
+    const Bnd_Box& aBox = aData->Boxes (i - aRange.First());
+    isSame = aSI.Shape().IsSame (aData->Shapes (i - aRange.First()))
+          && aSI.Box().IsVoid() == aBox.IsVoid()
+          && (aBox.IsVoid()
+           || (aSI.Box().CornerMin().IsEqual (aBox.CornerMin(), 0.0)
+            && aSI.Box().CornerMax().IsEqual (aBox.CornerMax(), 0.0)));
+  }
+  if (!isSame)
+  {
+    ++myNbTreeMisses;
+    return Handle(BOPTools_BoxTree)();
+  }
+
+  ++myNbTreeHits;
+  return aData->Tree;
+}
+
+//=======================================================================
+//function : BindArgumentTree
+//purpose  :
+//=======================================================================
+void BOPAlgo_IntersectionCache::BindArgumentTree (const BOPDS_DS& theDS,
+                                                  const Standard_Integer theRange,
+                                                  const Handle(BOPTools_BoxTree)& theTree)
+{
+  const BOPDS_IndexRange& aRange = theDS.Range (theRange);
+  const TopoDS_Shape& anArgument = theDS.Shape (aRange.First());
+  ArgumentTreeData* aData = myArgumentTreeMap.ChangeSeek (anArgument);
+  if (aData == NULL)
+  {
+    aData = myArgumentTreeMap.Bound (anArgument, ArgumentTreeData());
+  }
+
+  aData->Shapes.Clear();
+  aData->Boxes.Clear();
+  for (Standard_Integer i = aRange.First(); i <= aRange.Last(); ++i)
+  {
+    const BOPDS_ShapeInfo& aSI = theDS.ShapeInfo (i);
+    aData->Shapes.Append (aSI.Shape());
+    aData->Boxes.Append (aSI.Box());
+  }
+  aData->Tree = theTree;
+}
+
+//=======================================================================
+//function : Clear
+//purpose  :
+//=======================================================================
+void BOPAlgo_IntersectionCache::Clear()
+{
+  myFaceFaceMap.Clear();
+  myArgumentTreeMap.Clear();
+  myNbHits = 0;
+  myNbMisses = 0;
+  myNbTreeHits = 0;
+  myNbTreeMisses = 0;
+}
+
+//=======================================================================
+//function : copyCurves
+//purpose  :
+//=======================================================================
+void BOPAlgo_IntersectionCache::copyCurves (const IntTools_SequenceOfCurves& theCurves,
+                                            IntTools_SequenceOfCurves& theCopies)
+{
+  // The curves of the Boolean operation can be modified in place
+  // (e.g. transformed), so the kept and the returned curves should not share geometry
+  for (IntTools_SequenceOfCurves::Iterator anIt (theCurves); anIt.More(); anIt.Next())
+  {
+    const IntTools_Curve& aCurve = anIt.Value();
+    Handle(Geom_Curve) aC3D;
+    Handle(Geom2d_Curve) aC2D1, aC2D2;
+    if (!aCurve.Curve().IsNull())
+    {
+      aC3D = Handle(Geom_Curve)::DownCast (aCurve.Curve()->Copy());
+    }
+    if (!aCurve.FirstCurve2d().IsNull())
+    {
+      aC2D1 = Handle(Geom2d_Curve)::DownCast (aCurve.FirstCurve2d()->Copy());
+    }
+    if (!aCurve.SecondCurve2d().IsNull())
+    {
+      aC2D2 = Handle(Geom2d_Curve)::DownCast (aCurve.SecondCurve2d()->Copy());
+    }
+    theCopies.Append (IntTools_Curve (aC3D, aC2D1, aC2D2,
+                                      aCurve.Tolerance(), aCurve.TangentialTolerance()));
+  }
+}
+
+//=======================================================================
+//function : isSameInput
+//purpose  :
+//=======================================================================
+Standard_Boolean BOPAlgo_IntersectionCache::isSameInput (const FaceFaceInput& theInput1,
+                                                         const FaceFaceInput& theInput2)
+{
+  if (!theInput1.Face1.IsEqual (theInput2.Face1)
+   || !theInput1.Face2.IsEqual (theInput2.Face2)
+   || theInput1.TolFF      != theInput2.TolFF
+   || theInput1.FuzzyValue != theInput2.FuzzyValue
+   || theInput1.Approx     != theInput2.Approx
+   || theInput1.Approx1    != theInput2.Approx1
+   || theInput1.Approx2    != theInput2.Approx2
+   || theInput1.ApproxTol  != theInput2.ApproxTol
+   || theInput1.Points.Extent() != theInput2.Points.Extent())
+  {
+    return Standard_False;
+  }
+
+  IntSurf_ListOfPntOn2S::Iterator anIt2 (theInput2.Points);
+  for (IntSurf_ListOfPntOn2S::Iterator anIt1 (theInput1.Points); anIt1.More(); anIt1.Next(), anIt2.Next())
+  {
+    if (!anIt1.Value().IsSame (anIt2.Value(), 0.0, 0.0))
+    {
+      return Standard_False;
+    }
+  }
+  return Standard_True;
+}
@@ -0,0 +1,217 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _BOPAlgo_IntersectionCache_HeaderFile
+#define _BOPAlgo_IntersectionCache_HeaderFile
+
+#include <Bnd_Box.hxx>
+#include <BOPTools_BoxTree.hxx>
+#include <IntSurf_ListOfPntOn2S.hxx>
+#include <IntTools_SequenceOfCurves.hxx>
+#include <IntTools_SequenceOfPntOn2Faces.hxx>
+#include <NCollection_DataMap.hxx>
+#include <Standard_Transient.hxx>
+#include <NCollection_Vector.hxx>
+#include <TopoDS_Face.hxx>
+#include <TopTools_ShapeMapHasher.hxx>
+
+class BOPDS_DS;
+
+class BOPAlgo_IntersectionCache;
+DEFINE_STANDARD_HANDLE(BOPAlgo_IntersectionCache, Standard_Transient)
+
+//! The class keeps the results of intersection of the couples of faces
+//! to share them between consecutive Boolean operations on slowly changing
+//! arguments (e.g. when the features are added to the same body one by one).
+//!
+//! The results are kept for the couple of faces with the same TShape,
+//! location and orientation and are reused only if the faces are intersected
+//! with the same parameters (fuzzy value, tolerance of intersection, approximation
+//! options, starting points) and if the tolerances of the faces and of their
+//! edges and vertices have not been changed since the results have been kept.
+//!
+//! The cache keeps also the BVH trees of the bounding boxes of the sub-shapes
+//! of the arguments (see BOPDS_Iterator::SetRangeTree()). The tree is reused
+//! for the argument with the same TShape and location if its sub-shapes are
+//! the same and have the same bounding boxes in the new data structure.
+//!
+//! The cache is not thread-safe, but the Boolean operations access it only
+//! from the calling thread before and after the parallel intersection of faces.
+//! The cache keeps the faces (and thus all their data) in memory,
+//! so it should be cleared when the arguments are not needed anymore.
+class BOPAlgo_IntersectionCache : public Standard_Transient
+{
+  DEFINE_STANDARD_RTTIEXT(BOPAlgo_IntersectionCache, Standard_Transient)
+public:
+
+  //! The input data of intersection of two faces
+  struct FaceFaceInput
+  {
+    TopoDS_Face           Face1;       //!< First face
+    TopoDS_Face           Face2;       //!< Second face
+    Standard_Real         TolFF;       //!< Tolerance of intersection
+    Standard_Real         FuzzyValue;  //!< Additional tolerance
+    Standard_Boolean      Approx;      //!< Approximation of 3D curves
+    Standard_Boolean      Approx1;     //!< Computation of 2D curves on the first face
+    Standard_Boolean      Approx2;     //!< Computation of 2D curves on the second face
+    Standard_Real         ApproxTol;   //!< Tolerance of approximation
+    IntSurf_ListOfPntOn2S Points;      //!< Starting points of intersection
+
+    FaceFaceInput()
+    : TolFF (0.0), FuzzyValue (0.0),
+      Approx (Standard_False), Approx1 (Standard_False), Approx2 (Standard_False),
+      ApproxTol (0.0) {}
+  };
+
+public:
+
+  //! Creates an empty cache.
+  Standard_EXPORT BOPAlgo_IntersectionCache();
+
+  //! Looks for the results of intersection of the faces with the given input data.
+  //! Returns true if the results are found, the returned curves are the copies
+  //! of the kept ones and can be modified.
+  Standard_EXPORT Standard_Boolean FindFaceFace (const FaceFaceInput& theInput,
+                                                 IntTools_SequenceOfCurves& theCurves,
+                                                 IntTools_SequenceOfPntOn2Faces& thePoints,
+                                                 Standard_Boolean& theTangentFaces);
+
+  //! Keeps the results of intersection of the faces with the given input data
+  //! replacing the previous results for the same couple of faces.
+  //! The copies of the given curves are kept.
+  Standard_EXPORT void BindFaceFace (const FaceFaceInput& theInput,
+                                     const IntTools_SequenceOfCurves& theCurves,
+                                     const IntTools_SequenceOfPntOn2Faces& thePoints,
+                                     const Standard_Boolean theTangentFaces);
+
+  //! Looks for the tree of the bounding boxes of the sub-shapes of the argument
+  //! with the given index of range in the data structure. Returns the tree kept
+  //! for the same argument if its sub-shapes and their boxes are the same,
+  //! otherwise returns null handle.
+  Standard_EXPORT Handle(BOPTools_BoxTree) FindArgumentTree (const BOPDS_DS& theDS,
+                                                             const Standard_Integer theRange);
+
+  //! Keeps the tree of the bounding boxes of the sub-shapes of the argument
+  //! with the given index of range in the data structure replacing the
+  //! previous tree of the same argument.
+  Standard_EXPORT void BindArgumentTree (const BOPDS_DS& theDS,
+                                         const Standard_Integer theRange,
+                                         const Handle(BOPTools_BoxTree)& theTree);
+
+  //! Returns the number of the kept couples of faces.
+  Standard_Integer NbFaceFace() const { return myFaceFaceMap.Extent(); }
+
+  //! Returns the number of the kept trees of the arguments.
+  Standard_Integer NbArgumentTrees() const { return myArgumentTreeMap.Extent(); }
+
+  //! Returns the number of the successful look-ups of the trees of the arguments.
+  Standard_Integer NbTreeHits() const { return myNbTreeHits; }
+
+  //! Returns the number of the failed look-ups of the trees of the arguments.
+  Standard_Integer NbTreeMisses() const { return myNbTreeMisses; }
+
+  //! Returns the number of the successful look-ups.
+  Standard_Integer NbHits() const { return myNbHits; }
+
+  //! Returns the number of the failed look-ups.
+  Standard_Integer NbMisses() const { return myNbMisses; }
+
+  //! Removes all kept results and resets the counters.
+  Standard_EXPORT void Clear();
+
+private:
+
+  //! Tolerances of the face and of its sub-shapes
+  struct Tolerances
+  {
+    Standard_Real Face;
+    Standard_Real Edges;
+    Standard_Real Vertices;
+
+    Tolerances() : Face (0.0), Edges (0.0), Vertices (0.0) {}
+
+    Tolerances (const TopoDS_Face& theFace);
+
+    bool operator== (const Tolerances& theOther) const
+    {
+      return Face == theOther.Face && Edges == theOther.Edges && Vertices == theOther.Vertices;
+    }
+  };
+
+  //! Kept input data and results of intersection of two faces
+  struct FaceFaceData
+  {
+    FaceFaceInput                  Input;
+    Tolerances                     Tolerances1;
+    Tolerances                     Tolerances2;
+    IntTools_SequenceOfCurves      Curves;
+    IntTools_SequenceOfPntOn2Faces Points;
+    Standard_Boolean               TangentFaces;
+
+    FaceFaceData() : TangentFaces (Standard_False) {}
+  };
+
+  //! Oriented couple of faces
+  struct FacePair
+  {
+    TopoDS_Face Face1;
+    TopoDS_Face Face2;
+
+    FacePair (const TopoDS_Face& theFace1, const TopoDS_Face& theFace2)
+    : Face1 (theFace1), Face2 (theFace2) {}
+  };
+
+  //! Hasher of the couples of faces taking into account the orientations
+  struct FacePairHasher
+  {
+    size_t operator() (const FacePair& thePair) const noexcept
+    {
+      const size_t aHashes[2] = { std::hash<TopoDS_Shape>{} (thePair.Face1) + thePair.Face1.Orientation(),
+                                  std::hash<TopoDS_Shape>{} (thePair.Face2) + thePair.Face2.Orientation() };
+      return opencascade::hashBytes (aHashes, sizeof (aHashes));
+    }
+
+    bool operator() (const FacePair& thePair1, const FacePair& thePair2) const noexcept
+    {
+      return thePair1.Face1.IsEqual (thePair2.Face1) && thePair1.Face2.IsEqual (thePair2.Face2);
+    }
+  };
+
+  //! Kept tree of the argument with its sub-shapes and their boxes
+  struct ArgumentTreeData
+  {
+    NCollection_Vector<TopoDS_Shape> Shapes;
+    NCollection_Vector<Bnd_Box>      Boxes;
+    Handle(BOPTools_BoxTree)         Tree;
+  };
+
+  //! Copies the curves with their geometry.
+  static void copyCurves (const IntTools_SequenceOfCurves& theCurves,
+                          IntTools_SequenceOfCurves& theCopies);
+
+  //! Checks if the input data are the same.
+  static Standard_Boolean isSameInput (const FaceFaceInput& theInput1,
+                                       const FaceFaceInput& theInput2);
+
+private:
+
+  NCollection_DataMap<FacePair, FaceFaceData, FacePairHasher> myFaceFaceMap;
+  NCollection_DataMap<TopoDS_Shape, ArgumentTreeData, TopTools_ShapeMapHasher> myArgumentTreeMap;
+  Standard_Integer myNbHits;
+  Standard_Integer myNbMisses;
+  Standard_Integer myNbTreeHits;
+  Standard_Integer myNbTreeMisses;
+
+};
+
+#endif // _BOPAlgo_IntersectionCache_HeaderFile
@@ -25,6 +25,7 @@
 #include <NCollection_BaseAllocator.hxx>
 #include <Standard_ErrorHandler.hxx>
 #include <Standard_Failure.hxx>
+#include <TColStd_ListOfInteger.hxx>
 
 namespace
 {
@@ -228,8 +229,28 @@ void BOPAlgo_PaveFiller::Init (const Message_ProgressRange& theRange)
   myIterator = new BOPDS_Iterator (myAllocator);
   myIterator->SetRunParallel (myRunParallel);
   myIterator->SetDS (myDS);
+  //
+  // take the trees of the arguments kept from the previous operations
+  TColStd_ListOfInteger aLRNew;
+  if (!myIntersectionCache.IsNull()) {
+    for (Standard_Integer iR = 0; iR < myDS->NbRanges(); ++iR) {
+      const Handle(BOPTools_BoxTree) aTree = myIntersectionCache->FindArgumentTree (*myDS, iR);
+      if (aTree.IsNull()) {
+        aLRNew.Append (iR);
+      }
+      else {
+        myIterator->SetRangeTree (iR, aTree);
+      }
+    }
+  }
+  //
   myIterator->Prepare (myContext, myUseOBB, myFuzzyValue);
   //
+  // keep the new trees of the arguments for the next operations
+  for (TColStd_ListOfInteger::Iterator aItLR (aLRNew); aItLR.More(); aItLR.Next()) {
+    myIntersectionCache->BindArgumentTree (*myDS, aItLR.Value(), myIterator->RangeTree (aItLR.Value()));
+  }
+  //
   // 4 NonDestructive flag
   SetNonDestructive();
 }
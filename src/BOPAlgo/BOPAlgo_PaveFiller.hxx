@@ -24,6 +24,7 @@
 
 #include <BOPAlgo_Algo.hxx>
 #include <BOPAlgo_GlueEnum.hxx>
+#include <BOPAlgo_IntersectionCache.hxx>
 #include <BOPAlgo_SectionAttribute.hxx>
 #include <BOPDS_DataMapOfPaveBlockListOfPaveBlock.hxx>
 #include <BOPDS_IndexedDataMapOfPaveBlockListOfInteger.hxx>
@@ -176,6 +177,21 @@ public:
     return myAvoidBuildPCurve;
   }
 
+  //! Sets the cache of intersection results to share the results of
+  //! intersection of the same faces with other operations (NULL by default).
+  //! The results of intersection of faces are taken from the cache if
+  //! they are found there, otherwise the new results are kept in it.
+  void SetIntersectionCache (const Handle(BOPAlgo_IntersectionCache)& theCache)
+  {
+    myIntersectionCache = theCache;
+  }
+
+  //! Returns the cache of intersection results
+  const Handle(BOPAlgo_IntersectionCache)& IntersectionCache() const
+  {
+    return myIntersectionCache;
+  }
+
 protected:
 
   typedef NCollection_DataMap
@@ -647,6 +663,7 @@ protected: //! Fields
   Standard_Boolean myIsPrimary;
   Standard_Boolean myAvoidBuildPCurve;
   BOPAlgo_GlueEnum myGlue;
+  Handle(BOPAlgo_IntersectionCache) myIntersectionCache; //!< Cache of intersection results shared with other operations
 
   BOPAlgo_DataMapOfIntegerMapOfPaveBlock myFPBDone; //!< Fence map of intersected faces and pave blocks
   TColStd_MapOfInteger myIncreasedSS; //!< Sub-shapes with increased tolerance during the operation
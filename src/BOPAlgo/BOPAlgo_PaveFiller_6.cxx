@@ -95,7 +95,7 @@ class BOPAlgo_FaceFace :
   BOPAlgo_FaceFace() : 
     IntTools_FaceFace(),  
     BOPAlgo_ParallelAlgo(),
-    myIF1(-1), myIF2(-1), myTolFF(1.e-7) {
+    myIF1(-1), myIF2(-1), myTolFF(1.e-7), myIsCached(Standard_False) {
   }
   //
   virtual ~BOPAlgo_FaceFace() {
@@ -147,9 +147,36 @@ class BOPAlgo_FaceFace :
   //
   const gp_Trsf& Trsf() const { return myTrsf; }
   //
+  //! Takes the results of intersection from the cache, if they are there.
+  //! In this case the intersection is not performed.
+  //! Should be called after setting all parameters of intersection.
+  void FindInCache(const Handle(BOPAlgo_IntersectionCache)& theCache) {
+    // keep the input data as they may be changed by the intersection
+    myCacheInput.Face1 = myF1;
+    myCacheInput.Face2 = myF2;
+    myCacheInput.TolFF = myTolFF;
+    myCacheInput.FuzzyValue = IntTools_FaceFace::myFuzzyValue;
+    myCacheInput.Approx = myApprox;
+    myCacheInput.Approx1 = myApprox1;
+    myCacheInput.Approx2 = myApprox2;
+    myCacheInput.ApproxTol = myTolApprox;
+    myCacheInput.Points = myListOfPnts;
+    //
+    myIsCached = theCache->FindFaceFace(myCacheInput, mySeqOfCurve, myPnts, myTangentFaces);
+    myIsDone = myIsCached;
+  }
+  //
+  //! Returns the input data of intersection for the cache of results
+  const BOPAlgo_IntersectionCache::FaceFaceInput& CacheInput() const {
+    return myCacheInput;
+  }
+  //
+  //! Returns true if the results of intersection have been taken from the cache
+  Standard_Boolean IsCached() const { return myIsCached; }
+  //
   virtual void Perform() {
     Message_ProgressScope aPS(myProgressRange, NULL, 1);
-    if (UserBreak(aPS))
+    if (myIsCached || UserBreak(aPS))
     {
       return;
     }
@@ -220,6 +247,8 @@ class BOPAlgo_FaceFace :
   Bnd_Box myBox1;
   Bnd_Box myBox2;
   gp_Trsf myTrsf;
+  BOPAlgo_IntersectionCache::FaceFaceInput myCacheInput;
+  Standard_Boolean myIsCached;
 };
 //
 //=======================================================================
@@ -428,6 +457,10 @@ void BOPAlgo_PaveFiller::PerformFF(const Message_ProgressRange& theRange)
       //
       aFaceFace.SetParameters(bApprox, bCompC2D1, bCompC2D2, anApproxTol);
       aFaceFace.SetFuzzyValue(myFuzzyValue);
+      //
+      if (!myIntersectionCache.IsNull()) {
+        aFaceFace.FindInCache(myIntersectionCache);
+      }
     }
     else {
       // for the Glue mode just add all interferences of that type
@@ -447,7 +480,7 @@ void BOPAlgo_PaveFiller::PerformFF(const Message_ProgressRange& theRange)
   }
   //======================================================
   // Perform intersection
-  BOPTools_Parallel::Perform (myRunParallel, aVFaceFace);
+  BOPTools_Parallel::Perform (myRunParallel, aVFaceFace, myContext);
   if (UserBreak(aPSOuter))
   {
     return;
@@ -474,9 +507,16 @@ void BOPAlgo_PaveFiller::PerformFF(const Message_ProgressRange& theRange)
     Standard_Boolean bTangentFaces = aFaceFace.TangentFaces();
     Standard_Real aTolFF = aFaceFace.TolFF();
     //
-    aFaceFace.PrepareLines3D(bSplitCurve);
-    //
-    aFaceFace.ApplyTrsf();
+    if (!aFaceFace.IsCached()) {
+      aFaceFace.PrepareLines3D(bSplitCurve);
+      //
+      aFaceFace.ApplyTrsf();
+      //
+      if (!myIntersectionCache.IsNull()) {
+        myIntersectionCache->BindFaceFace(aFaceFace.CacheInput(), aFaceFace.Lines(),
+                                          aFaceFace.Points(), bTangentFaces);
+      }
+    }
     //
     const IntTools_SequenceOfCurves& aCvsX = aFaceFace.Lines();
     const IntTools_SequenceOfPntOn2Faces& aPntsX = aFaceFace.Points();
@@ -27,6 +27,7 @@
 #include <BOPTools_BoxTree.hxx>
 #include <BOPTools_Parallel.hxx>
 #include <IntTools_Context.hxx>
+#include <NCollection_Array1.hxx>
 #include <NCollection_Vector.hxx>
 #include <algorithm>
 
@@ -68,6 +69,154 @@ class BOPDS_TSR : public BOPTools_BoxTreeSelector
 //=======================================================================
 typedef NCollection_Vector<BOPDS_TSR> BOPDS_VectorOfTSR;
 /////////////////////////////////////////////////////////////////////////
+//=======================================================================
+//class    : BOPDS_RangeTree
+//purpose  : BVH tree of the sub-shapes of one argument
+//=======================================================================
+class BOPDS_RangeTree
+{
+ public:
+  BOPDS_RangeTree() :
+    myDS(NULL),
+    myRange(-1) {}
+  //
+  void SetDS(const BOPDS_PDS& theDS) { myDS = theDS; }
+  //
+  void SetRange(const Standard_Integer theRange) { myRange = theRange; }
+  //
+  Standard_Integer Range() const { return myRange; }
+  //
+  const Handle(BOPTools_BoxTree)& Tree() const { return myTree; }
+  //
+  void Perform() {
+    // the sub-shapes are indexed from the first index of the range
+    const BOPDS_IndexRange& aRange = myDS->Range(myRange);
+    myTree = new BOPTools_BoxTree();
+    myTree->SetSize(aRange.Last() - aRange.First() + 1);
+    for (Standard_Integer i = aRange.First(); i <= aRange.Last(); ++i) {
+      const BOPDS_ShapeInfo& aSI = myDS->ShapeInfo(i);
+      if (aSI.HasBRep()) {
+        myTree->Add(i - aRange.First(), Bnd_Tools::Bnd2BVH(aSI.Box()));
+      }
+    }
+    myTree->Build();
+  }
+  //
+ protected:
+  BOPDS_PDS myDS;
+  Standard_Integer myRange;
+  Handle(BOPTools_BoxTree) myTree;
+};
+//
+//=======================================================================
+typedef NCollection_Vector<BOPDS_RangeTree> BOPDS_VectorOfRangeTree;
+/////////////////////////////////////////////////////////////////////////
+//=======================================================================
+//class    : BOPDS_RangePairSelector
+//purpose  : Selects the pairs of sub-shapes of two arguments with
+//           interfering bounding boxes and defines the types of
+//           their interferences
+//=======================================================================
+class BOPDS_RangePairSelector : public BOPTools_BoxPairSelector
+{
+ public:
+  BOPDS_RangePairSelector() :
+    BOPTools_BoxPairSelector(),
+    myDS(NULL),
+    myFirst1(0),
+    myFirst2(0) {}
+  //
+  virtual ~BOPDS_RangePairSelector() {
+  }
+  //
+  void SetDS(const BOPDS_PDS& theDS) { myDS = theDS; }
+  //
+  //! Sets the first indices of the ranges of the trees
+  void SetFirstIndices(const Standard_Integer theFirst1,
+                       const Standard_Integer theFirst2) {
+    myFirst1 = theFirst1;
+    myFirst2 = theFirst2;
+  }
+  //
+  //! Returns the type of interference of the pair or -1
+  //! if the pair should not be intersected.
+  Standard_Integer InterfType(const size_t thePair) const {
+    return myInterfTypes[thePair];
+  }
+  //
+  void Perform() {
+    Select();
+    //
+    myInterfTypes.resize(myPairs.size(), -1);
+    for (size_t iPair = 0; iPair < myPairs.size(); ++iPair) {
+      PairIDs& aPair = myPairs[iPair];
+      // indices of the sub-shapes in the DS
+      aPair.ID1 += myFirst1;
+      aPair.ID2 += myFirst2;
+      const BOPDS_ShapeInfo& aSI1 = myDS->ShapeInfo(aPair.ID1);
+      const BOPDS_ShapeInfo& aSI2 = myDS->ShapeInfo(aPair.ID2);
+      //
+      const TopAbs_ShapeEnum aType1 = aSI1.ShapeType();
+      const TopAbs_ShapeEnum aType2 = aSI2.ShapeType();
+      //
+      Standard_Integer iType1 = BOPDS_Tools::TypeToInteger(aType1);
+      Standard_Integer iType2 = BOPDS_Tools::TypeToInteger(aType2);
+      //
+      // avoid interfering of the shape with its sub-shapes
+      if (((iType1 < iType2) && aSI1.HasSubShape(aPair.ID2)) ||
+          ((iType1 > iType2) && aSI2.HasSubShape(aPair.ID1))) {
+        continue;
+      }
+      myInterfTypes[iPair] = BOPDS_Tools::TypeToInteger(aType1, aType2);
+    }
+  }
+  //
+ protected:
+  BOPDS_PDS myDS;
+  Standard_Integer myFirst1;
+  Standard_Integer myFirst2;
+  std::vector<Standard_Integer> myInterfTypes;
+};
+//
+//=======================================================================
+typedef NCollection_Vector<BOPDS_RangePairSelector> BOPDS_VectorOfRangePairSelector;
+/////////////////////////////////////////////////////////////////////////
+//=======================================================================
+//class    : BOPDS_ShapeOBB
+//purpose  : Oriented bounding box of the shape
+//=======================================================================
+class BOPDS_ShapeOBB
+{
+ public:
+  BOPDS_ShapeOBB() :
+    myGap(0.),
+    myOBB(NULL) {}
+  //
+  void SetShape(const TopoDS_Shape& theShape) { myShape = theShape; }
+  //
+  void SetGap(const Standard_Real theGap) { myGap = theGap; }
+  //
+  void SetContext(const Handle(IntTools_Context)& theContext) { myContext = theContext; }
+  //
+  const Handle(IntTools_Context)& Context() const { return myContext; }
+  //
+  const Bnd_OBB& OBB() const { return *myOBB; }
+  //
+  void Perform() {
+    // the box is cached by the context of the thread
+    myOBB = &myContext->OBB(myShape, myGap);
+  }
+  //
+ protected:
+  TopoDS_Shape myShape;
+  Standard_Real myGap;
+  Handle(IntTools_Context) myContext;
+  const Bnd_OBB* myOBB;
+};
+//
+//=======================================================================
+typedef NCollection_Vector<BOPDS_ShapeOBB> BOPDS_VectorOfShapeOBB;
+/////////////////////////////////////////////////////////////////////////
 
 //=======================================================================
 //function : 
@@ -156,6 +305,26 @@ Standard_Boolean BOPDS_Iterator::RunParallel()const
 void BOPDS_Iterator::SetDS(const BOPDS_PDS& aDS)
 {
   myDS=aDS;
+  myRangeTrees.Clear();
+}
+//=======================================================================
+// function: SetRangeTree
+// purpose: 
+//=======================================================================
+void BOPDS_Iterator::SetRangeTree(const Standard_Integer theRange,
+                                  const Handle(BOPTools_BoxTree)& theTree)
+{
+  myRangeTrees.SetValue(theRange, theTree);
+}
+//=======================================================================
+// function: RangeTree
+// purpose: 
+//=======================================================================
+const Handle(BOPTools_BoxTree)& BOPDS_Iterator::RangeTree
+  (const Standard_Integer theRange) const
+{
+  static const Handle(BOPTools_BoxTree) aNullTree;
+  return theRange < myRangeTrees.Length() ? myRangeTrees(theRange) : aNullTree;
 }
 //=======================================================================
 // function: DS
@@ -281,77 +450,105 @@ void BOPDS_Iterator::Intersect(const Handle(IntTools_Context)& theCtx,
                                const Standard_Boolean theCheckOBB,
                                const Standard_Real theFuzzyValue)
 {
-  const Standard_Integer aNb = myDS->NbSourceShapes();
+  const Standard_Integer aNbR = myDS->NbRanges();
 
-  // Prepare BVH
-  BOPTools_BoxTree aBoxTree;
-  aBoxTree.SetSize (aNb);
-  for (Standard_Integer i = 0; i < aNb; ++i)
+  // Build the BVH trees of the sub-shapes of the arguments
+  // except for the ones given by SetRangeTree()
+  BOPDS_VectorOfRangeTree aVRT;
+  for (Standard_Integer iR = 0; iR < aNbR; ++iR)
   {
-    const BOPDS_ShapeInfo& aSI = myDS->ShapeInfo(i);
-    if (!aSI.HasBRep())
+    if (!RangeTree (iR).IsNull())
       continue;
-    const Bnd_Box& aBox = aSI.Box();
-    aBoxTree.Add (i, Bnd_Tools::Bnd2BVH (aBox));
-  }
 
-  // Build BVH
-  aBoxTree.Build();
+    BOPDS_RangeTree& aRT = aVRT.Appended();
+    aRT.SetDS (myDS);
+    aRT.SetRange (iR);
+  }
+  BOPTools_Parallel::Perform (myRunParallel, aVRT);
+  for (BOPDS_VectorOfRangeTree::Iterator aItRT (aVRT); aItRT.More(); aItRT.Next())
+  {
+    myRangeTrees.SetValue (aItRT.Value().Range(), aItRT.Value().Tree());
+  }
 
   // Select pairs of shapes with interfering bounding boxes
-  BOPTools_BoxPairSelector aPairSelector;
-  aPairSelector.SetBVHSets (&aBoxTree, &aBoxTree);
-  aPairSelector.SetSame (Standard_True);
-  aPairSelector.Select();
-  aPairSelector.Sort();
-
-  // Treat the selected pairs
-  const std::vector<BOPTools_BoxPairSelector::PairIDs>& aPairs = aPairSelector.Pairs();
-  const Standard_Integer aNbPairs = static_cast<Standard_Integer> (aPairs.size());
-
-  Standard_Integer iPair = 0;
-
-  const Standard_Integer aNbR = myDS->NbRanges();
-  for (Standard_Integer iR = 0; iR < aNbR; ++iR)
+  // for each couple of arguments with interfering trees.
+  // The sub-shapes of the same argument are not checked.
+  BOPDS_VectorOfRangePairSelector aVRPS;
+  for (Standard_Integer iR1 = 0; iR1 < aNbR; ++iR1)
   {
-    const BOPDS_IndexRange& aRange = myDS->Range(iR);
+    const Handle(BOPTools_BoxTree)& aTree1 = myRangeTrees (iR1);
+    if (aTree1->Size() == 0)
+      continue;
 
-    for (; iPair < aNbPairs; ++iPair)
+    for (Standard_Integer iR2 = iR1 + 1; iR2 < aNbR; ++iR2)
     {
-      const BOPTools_BoxPairSelector::PairIDs& aPair = aPairs[iPair];
-      if (!aRange.Contains (aPair.ID1))
-        // Go to the next range
-        break;
-
-      if (aRange.Contains (aPair.ID2))
-        // Go to the next pair
+      const Handle(BOPTools_BoxTree)& aTree2 = myRangeTrees (iR2);
+      if (aTree2->Size() == 0 || aTree1->Box().IsOut (aTree2->Box()))
         continue;
 
-      const BOPDS_ShapeInfo& aSI1 = myDS->ShapeInfo (aPair.ID1);
-      const BOPDS_ShapeInfo& aSI2 = myDS->ShapeInfo (aPair.ID2);
+      BOPDS_RangePairSelector& aRPS = aVRPS.Appended();
+      aRPS.SetDS (myDS);
+      aRPS.SetBVHSets (aTree1.get(), aTree2.get());
+      aRPS.SetFirstIndices (myDS->Range (iR1).First(), myDS->Range (iR2).First());
+    }
+  }
+  BOPTools_Parallel::Perform (myRunParallel, aVRPS);
 
-      const TopAbs_ShapeEnum aType1 = aSI1.ShapeType();
-      const TopAbs_ShapeEnum aType2 = aSI2.ShapeType();
+  // Build Oriented bounding boxes of the shapes of the selected pairs
+  BOPDS_VectorOfShapeOBB aVSO;
+  NCollection_Array1<Standard_Integer> anOBBIndices (0, theCheckOBB ? myDS->NbSourceShapes() : 0);
+  if (theCheckOBB)
+  {
+    anOBBIndices.Init (-1);
+    for (BOPDS_VectorOfRangePairSelector::Iterator aItRPS (aVRPS); aItRPS.More(); aItRPS.Next())
+    {
+      const BOPDS_RangePairSelector& aRPS = aItRPS.Value();
+      const std::vector<BOPTools_BoxPairSelector::PairIDs>& aPairs = aRPS.Pairs();
+      for (size_t iPair = 0; iPair < aPairs.size(); ++iPair)
+      {
+        if (aRPS.InterfType (iPair) < 0)
+          continue;
 
-      Standard_Integer iType1 = BOPDS_Tools::TypeToInteger (aType1);
-      Standard_Integer iType2 = BOPDS_Tools::TypeToInteger (aType2);
+        const Standard_Integer anIDs[2] = { aPairs[iPair].ID1, aPairs[iPair].ID2 };
+        for (Standard_Integer i = 0; i < 2; ++i)
+        {
+          if (anOBBIndices (anIDs[i]) < 0)
+          {
+            anOBBIndices (anIDs[i]) = aVSO.Length();
+            BOPDS_ShapeOBB& aSO = aVSO.Appended();
+            aSO.SetShape (myDS->Shape (anIDs[i]));
+            aSO.SetGap (theFuzzyValue);
+          }
+        }
+      }
+    }
+    // the boxes are cached in the contexts of the threads
+    Handle(IntTools_Context) aCtx = theCtx;
+    BOPTools_Parallel::Perform (myRunParallel, aVSO, aCtx);
+  }
 
-      // avoid interfering of the shape with its sub-shapes
-      if (((iType1 < iType2) && aSI1.HasSubShape (aPair.ID2)) ||
-          ((iType1 > iType2) && aSI2.HasSubShape (aPair.ID1)))
+  // Treat the selected pairs
+  for (BOPDS_VectorOfRangePairSelector::Iterator aItRPS (aVRPS); aItRPS.More(); aItRPS.Next())
+  {
+    const BOPDS_RangePairSelector& aRPS = aItRPS.Value();
+    const std::vector<BOPTools_BoxPairSelector::PairIDs>& aPairs = aRPS.Pairs();
+    for (size_t iPair = 0; iPair < aPairs.size(); ++iPair)
+    {
+      const Standard_Integer iX = aRPS.InterfType (iPair);
+      if (iX < 0)
         continue;
 
+      const BOPTools_BoxPairSelector::PairIDs& aPair = aPairs[iPair];
       if (theCheckOBB)
       {
         // Check intersection of Oriented bounding boxes of the shapes
-        const Bnd_OBB& anOBB1 = theCtx->OBB (aSI1.Shape(), theFuzzyValue);
-        const Bnd_OBB& anOBB2 = theCtx->OBB (aSI2.Shape(), theFuzzyValue);
+        const Bnd_OBB& anOBB1 = aVSO (anOBBIndices (aPair.ID1)).OBB();
+        const Bnd_OBB& anOBB2 = aVSO (anOBBIndices (aPair.ID2)).OBB();
 
         if (anOBB1.IsOut (anOBB2))
           continue;
       }
 
-      Standard_Integer iX = BOPDS_Tools::TypeToInteger (aType1, aType2);
       myLists(iX).Append (BOPDS_Pair (Min (aPair.ID1, aPair.ID2),
                                       Max (aPair.ID1, aPair.ID2)));
     }
@@ -27,6 +27,7 @@
 #include <BOPDS_VectorOfVectorOfPair.hxx>
 #include <BOPTools_BoxTree.hxx>
 #include <NCollection_BaseAllocator.hxx>
+#include <NCollection_Vector.hxx>
 #include <Precision.hxx>
 #include <TopAbs_ShapeEnum.hxx>
 class IntTools_Context;
@@ -101,6 +102,20 @@ public:
   //! Returns the flag of parallel processing
   Standard_EXPORT Standard_Boolean RunParallel() const;
 
+  //! Sets the BVH tree of the bounding boxes of the sub-shapes of the argument
+  //! with the given index of range in the data structure. The tree is used by
+  //! the next Prepare() instead of building the new one, e.g. the tree kept
+  //! from the previous operation on the same argument.
+  //! The elements of the tree are the indices of the sub-shapes counted from
+  //! the first index of the range, so the tree does not depend on the position
+  //! of the argument in the data structure.
+  Standard_EXPORT void SetRangeTree (const Standard_Integer theRange,
+                                     const Handle(BOPTools_BoxTree)& theTree);
+
+  //! Returns the BVH tree of the bounding boxes of the sub-shapes of the argument
+  //! with the given index of range, built or taken by Prepare().
+  Standard_EXPORT const Handle(BOPTools_BoxTree)& RangeTree (const Standard_Integer theRange) const;
+
 
 public: //! @name Number of extra interfering types
 
@@ -128,6 +143,7 @@ protected: //! @name Fields
   BOPDS_VectorOfVectorOfPair myExtLists;         //!< Extra pairs of sub-shapes found after
                                                  //! intersection of increased sub-shapes
   Standard_Boolean myUseExt;                     //!< Information flag for using the extra lists
+  NCollection_Vector<Handle(BOPTools_BoxTree)> myRangeTrees; //!< Trees of the sub-shapes of the arguments
 
 };
 
@@ -35,6 +35,7 @@
 #include <BOPAlgo_Builder.hxx>
 #include <BOPAlgo_BuilderFace.hxx>
 #include <BOPAlgo_BuilderSolid.hxx>
+#include <BOPAlgo_PaveFiller.hxx>
 
 #include <TopTools_DataMapOfShapeShape.hxx>
 #include <TopTools_DataMapOfShapeListOfShape.hxx>
@@ -75,6 +76,7 @@ static Standard_Integer bopwho      (Draw_Interpretor&, Standard_Integer, const
 static Standard_Integer bopindex    (Draw_Interpretor&, Standard_Integer, const char**);
 static Standard_Integer bopsd       (Draw_Interpretor&, Standard_Integer, const char**);
 static Standard_Integer bopsc       (Draw_Interpretor&, Standard_Integer, const char**);
+static Standard_Integer bopcontext  (Draw_Interpretor&, Standard_Integer, const char**);
 
 // 1.2 pave blocks commands
 static Standard_Integer boppb       (Draw_Interpretor&, Standard_Integer, const char**);
@@ -129,6 +131,8 @@ void BOPTest::DebugCommands(Draw_Interpretor& theCommands)
                    __FILE__, bopsd,      g);
   theCommands.Add("bopsc", "Shows the section curves. Use: bopsc [nF1 [nF2]]",
                   __FILE__, bopsc,       g);
+  theCommands.Add("bopcontext", "Shows the statistics of the cache of the intersection context. Use: bopcontext",
+                  __FILE__, bopcontext,  g);
   theCommands.Add("boppb", "Shows information about pave blocks. Use: boppb [#e]",
                   __FILE__, boppb,       g);
   theCommands.Add("bopcb", "Shows information about common blocks. Use: bopcb [#e]",
@@ -758,6 +762,35 @@ Standard_Integer bopsc(Draw_Interpretor& di,
   return 0;
 }
 
+//=======================================================================
+//function : bopcontext
+//purpose  : 
+//=======================================================================
+Standard_Integer bopcontext(Draw_Interpretor& di,
+                            Standard_Integer n,
+                            const char** )
+{
+  if (n != 1) {
+    di << "Shows the statistics of the cache of the intersection context. Use: bopcontext\n";
+    return 1;
+  }
+  //
+  BOPDS_PDS pDS = BOPTest_Objects::PDS();
+  if (!pDS) {
+    di << " prepare PaveFiller first\n";
+    return 1;
+  }
+  //
+  const Handle(IntTools_Context)& aCtx = BOPTest_Objects::PaveFiller().Context();
+  const Standard_Integer aNbHits = aCtx->NbHits();
+  const Standard_Integer aNbMisses = aCtx->NbMisses();
+  di << "Look-ups: " << aNbHits + aNbMisses
+     << ", hits: " << aNbHits << ", misses: " << aNbMisses
+     << ", hits in kept thread contexts: " << aCtx->NbKeptHits() << "\n";
+  //
+  return 0;
+}
+
 //=======================================================================
 //function : boppb
 //purpose  : 
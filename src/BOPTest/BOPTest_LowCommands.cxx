@@ -19,6 +19,7 @@
 #include <BRep_GCurve.hxx>
 #include <BRep_TEdge.hxx>
 #include <BRep_Tool.hxx>
+#include <BRepBndLib.hxx>
 #include <BRepClass3d_SolidClassifier.hxx>
 #include <BRepClass_FaceClassifier.hxx>
 #include <DBRep.hxx>
@@ -48,6 +49,7 @@ static
                                       Standard_Real& Last);
 
 static  Standard_Integer bclassify   (Draw_Interpretor& , Standard_Integer , const char** );
+static  Standard_Integer bclassifygrid (Draw_Interpretor& , Standard_Integer , const char** );
 static  Standard_Integer b2dclassify (Draw_Interpretor& , Standard_Integer , const char** );
 static  Standard_Integer b2dclassifx (Draw_Interpretor& , Standard_Integer , const char** );
 static  Standard_Integer bhaspc      (Draw_Interpretor& , Standard_Integer , const char** );
@@ -65,6 +67,13 @@ static  Standard_Integer bhaspc      (Draw_Interpretor& , Standard_Integer , con
   const char* g = "BOPTest commands";
   theCommands.Add("bclassify"    , "use bclassify Solid Point [Tolerance=1.e-7]",
                   __FILE__, bclassify   , g);
+  theCommands.Add("bclassifygrid", "use bclassifygrid Solid NbX NbY NbZ [Tolerance=1.e-7] [-parallel] [-compare]\n"
+    "Classify the centers of NbX*NbY*NbZ cells of the bounding box of the Solid\n"
+    "and print the numbers of points IN, ON and OUT of the Solid.\n"
+    "-parallel: classify the points in parallel threads.\n"
+    "-compare: print the number of points classified differently\n"
+    "          by the classification of the points one by one.",
+                  __FILE__, bclassifygrid, g);
   theCommands.Add("b2dclassify"  , "use b2dclassify Face Point2d [Tol] [UseBox] [GapCheckTol]\n" 
     "Classify  the Point  Point2d  with  Tolerance <Tol> on the face described by <Face>.\n" 
     "<UseBox> == 1/0 (default <UseBox> = 0): switch on/off the use Bnd_Box in the classification.\n"
@@ -190,6 +199,100 @@ Standard_Integer bclassify (Draw_Interpretor& theDI,
   return 0;
 }
 
+//=======================================================================
+//function : bclassifygrid
+//purpose  : 
+//=======================================================================
+Standard_Integer bclassifygrid (Draw_Interpretor& theDI,
+                                Standard_Integer  theArgNb,
+                                const char**      theArgVec)
+{
+  if (theArgNb < 5)  {
+    theDI << " use bclassifygrid Solid NbX NbY NbZ [Tolerance=1.e-7] [-parallel] [-compare]\n";
+    return 1;
+  }
+
+  TopoDS_Shape aS = DBRep::Get (theArgVec[1]);
+  if (aS.IsNull())  {
+    theDI << " Null Shape is not allowed\n";
+    return 1;
+  }
+  else if (aS.ShapeType() != TopAbs_SOLID)  {
+    theDI << " Shape type must be SOLID\n";
+    return 1;
+  }
+
+  Standard_Integer aNb[3];
+  for (Standard_Integer i = 0; i < 3; ++i)  {
+    aNb[i] = Draw::Atoi (theArgVec[i + 2]);
+    if (aNb[i] < 1)  {
+      theDI << " The number of cells must be positive\n";
+      return 1;
+    }
+  }
+
+  Standard_Real aTol = 1.e-7;
+  Standard_Boolean toRunParallel = Standard_False, toCompare = Standard_False;
+  for (Standard_Integer i = 5; i < theArgNb; ++i)  {
+    if (!strcmp (theArgVec[i], "-parallel"))  {
+      toRunParallel = Standard_True;
+    }
+    else if (!strcmp (theArgVec[i], "-compare"))  {
+      toCompare = Standard_True;
+    }
+    else  {
+      aTol = Draw::Atof (theArgVec[i]);
+    }
+  }
+
+  Bnd_Box aBox;
+  BRepBndLib::Add (aS, aBox);
+  Standard_Real aMin[3], aMax[3];
+  aBox.Get (aMin[0], aMin[1], aMin[2], aMax[0], aMax[1], aMax[2]);
+
+  TColgp_Array1OfPnt aPoints (1, aNb[0] * aNb[1] * aNb[2]);
+  Standard_Integer aPntInd = aPoints.Lower();
+  for (Standard_Integer i = 0; i < aNb[0]; ++i)  {
+    for (Standard_Integer j = 0; j < aNb[1]; ++j)  {
+      for (Standard_Integer k = 0; k < aNb[2]; ++k)  {
+        aPoints.ChangeValue (aPntInd++) =
+          gp_Pnt (aMin[0] + (aMax[0] - aMin[0]) * (i + 0.5) / aNb[0],
+                  aMin[1] + (aMax[1] - aMin[1]) * (j + 0.5) / aNb[1],
+                  aMin[2] + (aMax[2] - aMin[2]) * (k + 0.5) / aNb[2]);
+      }
+    }
+  }
+
+  NCollection_Array1<TopAbs_State> aStates (aPoints.Lower(), aPoints.Upper());
+  BRepClass3d_SolidClassifier aSC (aS);
+  aSC.Perform (aPoints, aTol, aStates, toRunParallel);
+
+  Standard_Integer aNbIn = 0, aNbOn = 0, aNbOut = 0;
+  for (Standard_Integer i = aStates.Lower(); i <= aStates.Upper(); ++i)  {
+    switch (aStates (i))  {
+      case TopAbs_IN:  ++aNbIn;  break;
+      case TopAbs_ON:  ++aNbOn;  break;
+      case TopAbs_OUT: ++aNbOut; break;
+      default: break;
+    }
+  }
+  theDI << "IN: " << aNbIn << " ON: " << aNbOn << " OUT: " << aNbOut << "\n";
+
+  if (toCompare)  {
+    // classify the points one by one by the separate classifier
+    BRepClass3d_SolidClassifier aSCPoint (aS);
+    Standard_Integer aNbDiff = 0;
+    for (Standard_Integer i = aPoints.Lower(); i <= aPoints.Upper(); ++i)  {
+      aSCPoint.Perform (aPoints (i), aTol);
+      if (aSCPoint.State() != aStates (i))  {
+        ++aNbDiff;
+      }
+    }
+    theDI << "Number of points classified differently: " << aNbDiff << "\n";
+  }
+  return 0;
+}
+
 //=======================================================================
 //function : bhaspc
 //purpose  : 
@@ -23,6 +23,7 @@
 #include <BOPAlgo_PBuilder.hxx>
 #include <BOPAlgo_CellsBuilder.hxx>
 #include <BOPAlgo_GlueEnum.hxx>
+#include <BOPAlgo_IntersectionCache.hxx>
 //
 class BOPAlgo_PaveFiller;
 class BOPAlgo_Builder;
@@ -103,6 +104,9 @@ public:
   Standard_EXPORT static void SetAngular(const Standard_Real bAngTol);
   Standard_EXPORT static Standard_Real Angular();
 
+  Standard_EXPORT static void SetIntersectionCache(const Handle(BOPAlgo_IntersectionCache)& theCache);
+  Standard_EXPORT static const Handle(BOPAlgo_IntersectionCache)& IntersectionCache();
+
 protected:
 
 private:
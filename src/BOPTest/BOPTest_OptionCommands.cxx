@@ -28,6 +28,7 @@ static Standard_Integer bGlue(Draw_Interpretor&, Standard_Integer, const char**)
 static Standard_Integer bdrawwarnshapes(Draw_Interpretor&, Standard_Integer, const char**);
 static Standard_Integer bcheckinverted(Draw_Interpretor&, Standard_Integer, const char**);
 static Standard_Integer buseobb(Draw_Interpretor&, Standard_Integer, const char**);
+static Standard_Integer buseintcache(Draw_Interpretor&, Standard_Integer, const char**);
 static Standard_Integer bsimplify(Draw_Interpretor&, Standard_Integer, const char**);
 
 //=======================================================================
@@ -75,6 +76,12 @@ void BOPTest::OptionCommands(Draw_Interpretor& theCommands)
                              "\t\tUsage: buseobb 0 (off) / 1 (on)",
                   __FILE__, buseobb, g);
 
+  theCommands.Add("buseintcache", "Enables/disables sharing of the results of intersection of faces\n"
+                                  "\t\tbetween consecutive BOP algorithms with the new cache of results\n"
+                                  "\t\tUsage: buseintcache [0 (off) / 1 (on)]\n"
+                                  "\t\tw/o arguments shows the statistics of the current cache",
+                  __FILE__, buseintcache, g);
+
   theCommands.Add("bsimplify", "Enables/Disables the result simplification after BOP\n"
                                "\t\tUsage: bsimplify [-e 0/1] [-f 0/1] [-a tol]\n"
                                "\t\t-e 0/1 - enables/disables edges unification\n"
@@ -134,6 +141,9 @@ Standard_Integer boptions(Draw_Interpretor& di,
   Sprintf(buf, " Use OBB: %s \t\t\t(%s)\n", BOPTest_Objects::UseOBB() ? "Yes" : "No",
                "use \"buseobb\" command to change");
   di << buf;
+  Sprintf(buf, " Use intersection cache: %s \t(%s)\n", !BOPTest_Objects::IntersectionCache().IsNull() ? "Yes" : "No",
+               "use \"buseintcache\" command to change");
+  di << buf;
   Sprintf(buf, " Unify Edges: %s \t\t(%s)\n", BOPTest_Objects::UnifyEdges() ? "Yes" : "No",
                "use \"bsimplify -e\" command to change");
   di << buf;
@@ -285,6 +295,42 @@ Standard_Integer buseobb(Draw_Interpretor& di,
   return 0;
 }
 
+//=======================================================================
+//function : buseintcache
+//purpose  : 
+//=======================================================================
+Standard_Integer buseintcache(Draw_Interpretor& di,
+                              Standard_Integer n,
+                              const char** a)
+{
+  if (n > 2)
+  {
+    di.PrintHelp(a[0]);
+    return 1;
+  }
+
+  if (n == 1)
+  {
+    const Handle(BOPAlgo_IntersectionCache)& aCache = BOPTest_Objects::IntersectionCache();
+    if (aCache.IsNull())
+    {
+      di << "Intersection cache is not used\n";
+      return 0;
+    }
+    di << "Face/Face: " << aCache->NbFaceFace()
+       << ", hits: " << aCache->NbHits()
+       << ", misses: " << aCache->NbMisses()
+       << "; Trees: " << aCache->NbArgumentTrees()
+       << ", hits: " << aCache->NbTreeHits()
+       << ", misses: " << aCache->NbTreeMisses() << "\n";
+    return 0;
+  }
+
+  Standard_Integer iUse = Draw::Atoi(a[1]);
+  BOPTest_Objects::SetIntersectionCache(iUse != 0 ? new BOPAlgo_IntersectionCache() : NULL);
+  return 0;
+}
+
 //=======================================================================
 //function : bsimplify
 //purpose  : 
@@ -13,6 +13,7 @@
 // commercial license or contractual agreement.
 
 
+#include <BOPAlgo_BatchBOP.hxx>
 #include <BOPAlgo_BOP.hxx>
 #include <BOPAlgo_Builder.hxx>
 #include <BOPAlgo_Operation.hxx>
@@ -25,6 +26,7 @@
 #include <BOPTest_Objects.hxx>
 #include <BRepTest_Objects.hxx>
 #include <DBRep.hxx>
+#include <Draw.hxx>
 #include <OSD_Timer.hxx>
 #include <TopoDS_Shape.hxx>
 #include <Draw_ProgressIndicator.hxx>
@@ -38,6 +40,7 @@ static Standard_Integer bbuild   (Draw_Interpretor&, Standard_Integer, const cha
 static Standard_Integer bbop     (Draw_Interpretor&, Standard_Integer, const char**);
 static Standard_Integer bsplit   (Draw_Interpretor&, Standard_Integer, const char**);
 static Standard_Integer buildbop (Draw_Interpretor&, Standard_Integer, const char**);
+static Standard_Integer bbatchbop(Draw_Interpretor&, Standard_Integer, const char**);
 
 //=======================================================================
 //function : PartitionCommands
@@ -96,6 +99,21 @@ void BOPTest::PartitionCommands(Draw_Interpretor& theCommands)
                   "\t\ts1 s2 s3 s4 - arguments (solids) of the GF operation\n"
                   "\t\toperation   - type of boolean operation",
                   __FILE__, buildbop, g);
+
+  theCommands.Add("bbatchbop", "Performs Boolean operation on the objects and the tools added by baddobjects and baddtools commands\n"
+                  "\t\tsplitting them on the groups of non-interfering arguments processed by separate operations.\n"
+                  "\t\tUsage: bbatchbop result op [-maxtools N] [-t]\n"
+                  "\t\tWhere:\n"
+                  "\t\tresult - name of the result shape\n"
+                  "\t\top - type of Boolean operation. Possible values:\n"
+                  "\t\t     - 0/common - for Common operation\n"
+                  "\t\t     - 1/fuse - for Fuse operation\n"
+                  "\t\t     - 2/cut - for Cut operation\n"
+                  "\t\t     - 3/tuc/cut21 - for Cut21 operation\n"
+                  "\t\t-maxtools N - maximal number of tools of one group processed by a single operation,\n"
+                  "\t\t              the tools of the larger groups are split on the batches\n"
+                  "\t\t-t - optional parameter for enabling timer and showing elapsed time of the operation",
+                  __FILE__, bbatchbop, g);
 }
 
 //=======================================================================
@@ -165,6 +183,7 @@ Standard_Integer bfillds(Draw_Interpretor& di,
   aPF.SetFuzzyValue(aTol);
   aPF.SetGlue(aGlue);
   aPF.SetUseOBB(BOPTest_Objects::UseOBB());
+  aPF.SetIntersectionCache(BOPTest_Objects::IntersectionCache());
   //
   OSD_Timer aTimer;
   aTimer.Start();
@@ -640,3 +659,94 @@ Standard_Integer buildbop(Draw_Interpretor& di,
 
   return 0;
 }
+
+//=======================================================================
+//function : bbatchbop
+//purpose  : 
+//=======================================================================
+Standard_Integer bbatchbop(Draw_Interpretor& di,
+                           Standard_Integer n,
+                           const char** a)
+{
+  if (n < 3) {
+    di.PrintHelp(a[0]);
+    return 1;
+  }
+  //
+  BOPAlgo_Operation anOp = BOPTest::GetOperationType(a[2]);
+  if (anOp == BOPAlgo_UNKNOWN || anOp == BOPAlgo_SECTION)
+  {
+    di << "Invalid operation type\n";
+    return 0;
+  }
+  //
+  Standard_Boolean bShowTime = Standard_False;
+  Standard_Integer aMaxTools = 0;
+  for (Standard_Integer i = 3; i < n; ++i)
+  {
+    if (!strcmp(a[i], "-t"))
+    {
+      bShowTime = Standard_True;
+    }
+    else if (!strcmp(a[i], "-maxtools") && i + 1 < n)
+    {
+      aMaxTools = Draw::Atoi(a[++i]);
+    }
+    else
+    {
+      di << "Warning: invalid key\n";
+    }
+  }
+  //
+  BOPAlgo_BatchBOP aBatch;
+  aBatch.SetArguments(BOPTest_Objects::Shapes());
+  aBatch.SetTools(BOPTest_Objects::Tools());
+  aBatch.SetOperation(anOp);
+  aBatch.SetRunParallel(BOPTest_Objects::RunParallel());
+  aBatch.SetNonDestructive(BOPTest_Objects::NonDestructive());
+  aBatch.SetFuzzyValue(BOPTest_Objects::FuzzyValue());
+  aBatch.SetGlue(BOPTest_Objects::Glue());
+  aBatch.SetCheckInverted(BOPTest_Objects::CheckInverted());
+  aBatch.SetUseOBB(BOPTest_Objects::UseOBB());
+  aBatch.SetMaxToolsInOperation(aMaxTools);
+  aBatch.SetToFillHistory(BRepTest_Objects::IsHistoryNeeded());
+  //
+  Handle(Draw_ProgressIndicator) aProgress = new Draw_ProgressIndicator(di, 1);
+  //
+  OSD_Timer aTimer;
+  aTimer.Start();
+  //
+  aBatch.Perform(aProgress->Start());
+  BOPTest::ReportAlerts(aBatch.GetReport());
+
+  // Set history of the operation into the session
+  if (BRepTest_Objects::IsHistoryNeeded())
+  {
+    TopTools_ListOfShape anArgs = BOPTest_Objects::Shapes();
+    TopTools_ListOfShape aTools = BOPTest_Objects::Tools();
+    anArgs.Append(aTools);
+    BRepTest_Objects::SetHistory(anArgs, aBatch);
+  }
+
+  if (aBatch.HasErrors()) {
+    return 0;
+  }
+  //
+  aTimer.Stop();
+  //
+  di << "Groups: " << aBatch.NbGroups() << ", operations: " << aBatch.NbOperations() << "\n";
+  if (bShowTime) {
+    char buf[32];
+    Sprintf(buf, "  Tps: %7.2lf\n", aTimer.ElapsedTime());
+    di << buf;
+  }
+  //
+  const TopoDS_Shape& aR = aBatch.Shape();
+  if (aR.IsNull()) {
+    di << "Result is a null shape\n";
+    return 0;
+  }
+  //
+  DBRep::Set(a[1], aR);
+  return 0;
+}
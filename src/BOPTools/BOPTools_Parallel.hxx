@@ -17,8 +17,7 @@
 
 #include <OSD_Parallel.hxx>
 #include <OSD_ThreadPool.hxx>
-#include <NCollection_DataMap.hxx>
-#include <Standard_Mutex.hxx>
+#include <NCollection_Array1.hxx>
 #include <OSD_Thread.hxx>
 
 //! Implementation of Functors/Starters
@@ -46,39 +45,30 @@ class BOPTools_Parallel
     TypeSolverVector& mySolvers;
   };
 
-  //! Functor storing map of thread id -> algorithm context
+  //! Functor taking the contexts of the threads from the main thread context,
+  //! which keeps them for the next parallel loops
   template<class TypeSolverVector, class TypeContext>
   class ContextFunctor
   {
   public:
 
     //! Constructor
-    explicit ContextFunctor (TypeSolverVector& theVector) : mySolverVector(theVector) {}
+    explicit ContextFunctor (TypeSolverVector& theVector)
+    : mySolverVector(theVector),
+      myMainThreadId (OSD_Thread::Current()) {}
 
     //! Binds main thread context
     void SetContext (const opencascade::handle<TypeContext>& theContext)
     {
-      myContextMap.Bind (OSD_Thread::Current(), theContext);
+      myContext = theContext;
+      myContext->PrepareThreadContexts();
     }
 
     //! Returns current thread context
     const opencascade::handle<TypeContext>& GetThreadContext() const
     {
       const Standard_ThreadId aThreadID = OSD_Thread::Current();
-      if (const opencascade::handle<TypeContext>* aContextPtr = myContextMap.Seek (aThreadID))
-      {
-        if (!aContextPtr->IsNull())
-        {
-          return *aContextPtr;
-        }
-      }
-
-      // Create new context
-      opencascade::handle<TypeContext> aContext = new TypeContext (NCollection_BaseAllocator::CommonBaseAllocator());
-
-      Standard_Mutex::Sentry aLocker (myMutex);
-      myContextMap.Bind (aThreadID, aContext);
-      return myContextMap (aThreadID);
+      return aThreadID == myMainThreadId ? myContext : myContext->ThreadContext (aThreadID);
     }
 
     //! Defines functor interface
@@ -97,11 +87,14 @@ class BOPTools_Parallel
 
   private:
     TypeSolverVector& mySolverVector;
-    mutable NCollection_DataMap<Standard_ThreadId, opencascade::handle<TypeContext>> myContextMap;
-    mutable Standard_Mutex myMutex;
+    opencascade::handle<TypeContext> myContext;
+    Standard_ThreadId myMainThreadId;
   };
 
-  //! Functor storing array of algorithm contexts per thread in pool
+  //! Functor taking the contexts of the threads in pool from the main thread context,
+  //! which keeps them by the thread identity for the next parallel loops.
+  //! The contexts are cached in the array allocated once for the thread indices
+  //! of the launcher, as each index is used by one thread of the launcher only.
   template<class TypeSolverVector, class TypeContext>
   class ContextFunctor2
   {
@@ -115,6 +108,8 @@ class BOPTools_Parallel
     //! Binds main thread context
     void SetContext (const opencascade::handle<TypeContext>& theContext)
     {
+      myContext = theContext;
+      myContext->PrepareThreadContexts();
       myContextArray.ChangeLast() = theContext; // OSD_ThreadPool::Launcher::UpperThreadIndex() is reserved for a main thread
     }
 
@@ -125,7 +120,7 @@ class BOPTools_Parallel
       opencascade::handle<TypeContext>& aContext = myContextArray.ChangeValue (theThreadIndex);
       if (aContext.IsNull())
       {
-        aContext = new TypeContext (NCollection_BaseAllocator::CommonBaseAllocator());
+        aContext = myContext->ThreadContext (OSD_Thread::Current());
       }
       typename TypeSolverVector::value_type& aSolver = mySolverVector[theIndex];
       aSolver.SetContext (aContext);
@@ -138,6 +133,7 @@ class BOPTools_Parallel
 
   private:
     TypeSolverVector& mySolverVector;
+    opencascade::handle<TypeContext> myContext;
     mutable NCollection_Array1< opencascade::handle<TypeContext> > myContextArray;
   };
 
@@ -158,6 +154,10 @@ public:
                        TypeSolverVector& theSolverVector,
                        opencascade::handle<TypeContext>& theContext)
   {
+    if (theContext.IsNull())
+    {
+      theContext = new TypeContext (NCollection_BaseAllocator::CommonBaseAllocator());
+    }
     if (OSD_Parallel::ToUseOcctThreads())
     {
       const Handle(OSD_ThreadPool)& aThreadPool = OSD_ThreadPool::DefaultPool();
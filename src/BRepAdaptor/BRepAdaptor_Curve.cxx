@@ -33,6 +33,7 @@
 #include <gp_Pnt.hxx>
 #include <gp_Trsf.hxx>
 #include <gp_Vec.hxx>
+#include <Standard_DimensionMismatch.hxx>
 #include <Standard_NoSuchObject.hxx>
 #include <Standard_NullObject.hxx>
 #include <TopoDS_Edge.hxx>
@@ -450,6 +451,103 @@ void BRepAdaptor_Curve::D2(const Standard_Real U,
   V2.Transform(myTrsf);
 }
 
+//=======================================================================
+//function : D0
+//purpose  : 
+//=======================================================================
+
+void BRepAdaptor_Curve::D0 (const TColStd_Array1OfReal& theParams,
+                            TColgp_Array1OfPnt&         thePoints) const
+{
+  Standard_DimensionMismatch_Raise_if (theParams.Length() != thePoints.Length(),
+                                       "BRepAdaptor_Curve::D0(), wrong length of array of points");
+  if (myConSurf.IsNull())
+  {
+    myCurve.D0 (theParams, thePoints);
+  }
+  else
+  {
+    for (Standard_Integer i = theParams.Lower(); i <= theParams.Upper(); i++)
+    {
+      myConSurf->D0 (theParams.Value (i), thePoints.ChangeValue (thePoints.Lower() + i - theParams.Lower()));
+    }
+  }
+  for (Standard_Integer i = thePoints.Lower(); i <= thePoints.Upper(); i++)
+  {
+    thePoints.ChangeValue (i).Transform (myTrsf);
+  }
+}
+
+//=======================================================================
+//function : D1
+//purpose  : 
+//=======================================================================
+
+void BRepAdaptor_Curve::D1 (const TColStd_Array1OfReal& theParams,
+                            TColgp_Array1OfPnt&         thePoints,
+                            TColgp_Array1OfVec&         theV1) const
+{
+  Standard_DimensionMismatch_Raise_if (theParams.Length() != thePoints.Length()
+                                    || theParams.Length() != theV1.Length(),
+                                       "BRepAdaptor_Curve::D1(), wrong length of array of results");
+  if (myConSurf.IsNull())
+  {
+    myCurve.D1 (theParams, thePoints, theV1);
+  }
+  else
+  {
+    for (Standard_Integer i = theParams.Lower(); i <= theParams.Upper(); i++)
+    {
+      const Standard_Integer anOffset = i - theParams.Lower();
+      myConSurf->D1 (theParams.Value (i),
+                     thePoints.ChangeValue (thePoints.Lower() + anOffset),
+                     theV1    .ChangeValue (theV1    .Lower() + anOffset));
+    }
+  }
+  for (Standard_Integer anOffset = 0; anOffset < theParams.Length(); anOffset++)
+  {
+    thePoints.ChangeValue (thePoints.Lower() + anOffset).Transform (myTrsf);
+    theV1    .ChangeValue (theV1    .Lower() + anOffset).Transform (myTrsf);
+  }
+}
+
+//=======================================================================
+//function : D2
+//purpose  : 
+//=======================================================================
+
+void BRepAdaptor_Curve::D2 (const TColStd_Array1OfReal& theParams,
+                            TColgp_Array1OfPnt&         thePoints,
+                            TColgp_Array1OfVec&         theV1,
+                            TColgp_Array1OfVec&         theV2) const
+{
+  Standard_DimensionMismatch_Raise_if (theParams.Length() != thePoints.Length()
+                                    || theParams.Length() != theV1.Length()
+                                    || theParams.Length() != theV2.Length(),
+                                       "BRepAdaptor_Curve::D2(), wrong length of array of results");
+  if (myConSurf.IsNull())
+  {
+    myCurve.D2 (theParams, thePoints, theV1, theV2);
+  }
+  else
+  {
+    for (Standard_Integer i = theParams.Lower(); i <= theParams.Upper(); i++)
+    {
+      const Standard_Integer anOffset = i - theParams.Lower();
+      myConSurf->D2 (theParams.Value (i),
+                     thePoints.ChangeValue (thePoints.Lower() + anOffset),
+                     theV1    .ChangeValue (theV1    .Lower() + anOffset),
+                     theV2    .ChangeValue (theV2    .Lower() + anOffset));
+    }
+  }
+  for (Standard_Integer anOffset = 0; anOffset < theParams.Length(); anOffset++)
+  {
+    thePoints.ChangeValue (thePoints.Lower() + anOffset).Transform (myTrsf);
+    theV1    .ChangeValue (theV1    .Lower() + anOffset).Transform (myTrsf);
+    theV2    .ChangeValue (theV2    .Lower() + anOffset).Transform (myTrsf);
+  }
+}
+
 //=======================================================================
 //function : D3
 //purpose  : 
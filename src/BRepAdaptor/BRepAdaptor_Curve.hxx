@@ -162,6 +162,22 @@ public:
   //! is not C2.
   Standard_EXPORT void D2 (const Standard_Real U, gp_Pnt& P, gp_Vec& V1, gp_Vec& V2) const Standard_OVERRIDE;
   
+  //! Computes the points for the array of parameters on the edge.
+  //! For the edge with 3D curve the parameters are evaluated by GeomAdaptor_Curve::D0()
+  //! taking the array, i.e. span by span for B-spline and Bezier curves.
+  //! Raises Standard_DimensionMismatch if the arrays have different lengths.
+  Standard_EXPORT void D0 (const TColStd_Array1OfReal& theParams, TColgp_Array1OfPnt& thePoints) const Standard_OVERRIDE;
+
+  //! Computes the points and the first derivatives for the array of parameters on the edge.
+  //! The results are the same as the ones of D1() called for each point.
+  //! Raises Standard_DimensionMismatch if the arrays have different lengths.
+  Standard_EXPORT void D1 (const TColStd_Array1OfReal& theParams, TColgp_Array1OfPnt& thePoints, TColgp_Array1OfVec& theV1) const Standard_OVERRIDE;
+
+  //! Computes the points, the first and second derivatives for the array of parameters
+  //! on the edge. The results are the same as the ones of D2() called for each point.
+  //! Raises Standard_DimensionMismatch if the arrays have different lengths.
+  Standard_EXPORT void D2 (const TColStd_Array1OfReal& theParams, TColgp_Array1OfPnt& thePoints, TColgp_Array1OfVec& theV1, TColgp_Array1OfVec& theV2) const Standard_OVERRIDE;
+
 
   //! Returns the point P of parameter U, the first, the second
   //! and the third derivative.
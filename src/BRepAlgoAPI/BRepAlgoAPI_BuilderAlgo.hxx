@@ -20,6 +20,7 @@
 #include <Standard_Handle.hxx>
 
 #include <BOPAlgo_GlueEnum.hxx>
+#include <BOPAlgo_IntersectionCache.hxx>
 #include <BOPAlgo_PPaveFiller.hxx>
 #include <BOPAlgo_PBuilder.hxx>
 #include <BRepAlgoAPI_Algo.hxx>
@@ -133,6 +134,21 @@ public: //! @name Setting options
     return myCheckInverted;
   }
 
+  //! Sets the cache of intersection results to share the results of
+  //! intersection of faces between consecutive operations on the same
+  //! or slowly changing arguments (NULL by default, i.e. no sharing).
+  //! The same cache can be given to any number of operations.
+  void SetIntersectionCache(const Handle(BOPAlgo_IntersectionCache)& theCache)
+  {
+    myIntersectionCache = theCache;
+  }
+
+  //! Returns the cache of intersection results
+  const Handle(BOPAlgo_IntersectionCache)& IntersectionCache() const
+  {
+    return myIntersectionCache;
+  }
+
 
 public: //! @name Performing the operation
 
@@ -271,6 +287,7 @@ protected: //! @name Fields
   BOPAlgo_GlueEnum myGlue;           //!< Gluing mode management
   Standard_Boolean myCheckInverted;  //!< Check for inverted solids management
   Standard_Boolean myFillHistory;    //!< Controls the history collection
+  Handle(BOPAlgo_IntersectionCache) myIntersectionCache; //!< Cache of intersection results
 
   // Tools
   Standard_Boolean myIsIntersectionNeeded; //!< Flag to control whether the intersection
@@ -76,6 +76,7 @@
 #include <gp_Vec.hxx>
 #include <Message_ProgressScope.hxx>
 #include <NCollection_UBTreeFiller.hxx>
+#include <OSD_Parallel.hxx>
 #include <Precision.hxx>
 #include <Standard_Failure.hxx>
 #include <Standard_NoSuchObject.hxx>
@@ -1737,6 +1738,7 @@ void BRepBuilderAPI_Sewing::Init(const Standard_Real tolerance,
   //myCuttingFloatingEdgesMode = Standard_False; //gka
   mySameParameterMode  = Standard_True;
   myLocalToleranceMode = Standard_False;
+  myRunParallel        = Standard_False;
   mySewedShape.Nullify();
   // Load empty shape
   Load(TopoDS_Shape());
@@ -2752,10 +2754,204 @@ static Standard_Integer IsMergedVertices(const TopoDS_Shape& face1,
   return Status;
 }
 
+//=======================================================================
+//class    : BRepBuilderAPI_NearestNodeFunctor
+//purpose  : Searches the nearest node to be glued with each node.
+//           Only reads the shared data, so that nodes can be
+//           processed independently in parallel threads.
+//=======================================================================
+
+class BRepBuilderAPI_NearestNodeFunctor
+{
+public:
+
+  BRepBuilderAPI_NearestNodeFunctor (const TopTools_IndexedDataMapOfShapeShape& theVertexNode,
+                                     const TopTools_DataMapOfShapeListOfShape& theNodeEdges,
+                                     const TopTools_IndexedDataMapOfShapeListOfShape& theBoundFaces,
+                                     const TopTools_IndexedDataMapOfShapeListOfShape& theNodeVertices,
+                                     BRepBuilderAPI_CellFilter& theFilter,
+                                     const BRepBuilderAPI_VertexInspector& theInspector,
+                                     const Standard_Real theTolerance,
+                                     NCollection_Array1<TopoDS_Shape>& theNearestNodes,
+                                     const Standard_Integer theNbChunks)
+  : myVertexNode (theVertexNode),
+    myNodeEdges (theNodeEdges),
+    myBoundFaces (theBoundFaces),
+    myNodeVertices (theNodeVertices),
+    myFilter (&theFilter),
+    myInspector (theInspector),
+    myTolerance (theTolerance),
+    myNearestNodes (theNearestNodes),
+    myNbChunks (theNbChunks) {}
+
+  //! Processes the chunk of nodes with its own copy of inspector.
+  //! Cell filter is only inspected (inspector never purges targets).
+  void operator() (const Standard_Integer theChunk) const
+  {
+    const Standard_Integer aNbNodes = myNodeVertices.Extent();
+    const Standard_Integer aFirst = 1 + (Standard_Integer )((Standard_Size )aNbNodes * theChunk / myNbChunks);
+    const Standard_Integer aLast  = (Standard_Integer )((Standard_Size )aNbNodes * (theChunk + 1) / myNbChunks);
+    BRepBuilderAPI_VertexInspector anInspector (myInspector);
+    for (Standard_Integer i = aFirst; i <= aLast; i++)
+      myNearestNodes.ChangeValue (i) = NearestNode (i, anInspector);
+  }
+
+  //! Returns the nearest node to be glued with node of given index,
+  //! or null shape if there is no such node.
+  TopoDS_Shape NearestNode (const Standard_Integer theIndex,
+                            BRepBuilderAPI_VertexInspector& theInspector) const;
+
+private:
+  const TopTools_IndexedDataMapOfShapeShape&       myVertexNode;
+  const TopTools_DataMapOfShapeListOfShape&        myNodeEdges;
+  const TopTools_IndexedDataMapOfShapeListOfShape& myBoundFaces;
+  const TopTools_IndexedDataMapOfShapeListOfShape& myNodeVertices;
+  BRepBuilderAPI_CellFilter*                       myFilter;
+  const BRepBuilderAPI_VertexInspector&            myInspector;
+  Standard_Real                                    myTolerance;
+  NCollection_Array1<TopoDS_Shape>&                myNearestNodes;
+  Standard_Integer                                 myNbChunks;
+};
+
+//=======================================================================
+//function : NearestNode
+//purpose  : 
+//=======================================================================
+
+TopoDS_Shape BRepBuilderAPI_NearestNodeFunctor::NearestNode (const Standard_Integer theIndex,
+                                                             BRepBuilderAPI_VertexInspector& theInspector) const
+{
+  const TopoDS_Vertex& node1 = TopoDS::Vertex(myNodeVertices.FindKey(theIndex));
+  // Find near nodes
+  gp_Pnt pt1 = BRep_Tool::Pnt (node1);
+  theInspector.ClearResList();
+  theInspector.SetCurrent (pt1.XYZ());
+  gp_XYZ aPntMin = theInspector.Shift (pt1.XYZ(), -myTolerance);
+  gp_XYZ aPntMax = theInspector.Shift (pt1.XYZ(), myTolerance);
+  myFilter->Inspect (aPntMin, aPntMax, theInspector);
+  if (theInspector.ResInd().IsEmpty()) return TopoDS_Shape();
+  // Retrieve list of edges for the first node
+  const TopTools_ListOfShape& ledges1 = myNodeEdges.Find(node1);
+  // Explore list of near nodes and fill the sequence of glued nodes
+  TopTools_SequenceOfShape SeqNodes;
+  TopTools_ListOfShape listNodesSameEdge;
+  //gp_Pnt pt1 = BRep_Tool::Pnt(node1);
+  TColStd_ListIteratorOfListOfInteger iter1(theInspector.ResInd());
+  for (; iter1.More(); iter1.Next()) {
+    const TopoDS_Vertex& node2 = TopoDS::Vertex(myNodeVertices.FindKey(iter1.Value()));
+    if (node1 == node2) continue;
+    // Retrieve list of edges for the second node
+    const TopTools_ListOfShape& ledges2 = myNodeEdges.Find(node2);
+    // Check merging condition for the pair of nodes
+    Standard_Integer Status = 0, isSameEdge = Standard_False;
+    // Explore edges of the first node
+    TopTools_ListIteratorOfListOfShape Ie1(ledges1);
+    for (; Ie1.More() && !Status && !isSameEdge; Ie1.Next()) {
+      const TopoDS_Shape& e1 = Ie1.Value();
+      // Obtain real vertex from edge
+      TopoDS_Shape v1 = node1;
+      { //szv: Use brackets to destroy local variables
+        TopoDS_Vertex ov1, ov2;
+        TopExp::Vertices(TopoDS::Edge(e1),ov1,ov2);
+        if (myVertexNode.Contains(ov1)) {
+          if (node1.IsSame(myVertexNode.FindFromKey(ov1))) v1 = ov1;
+        }
+        if (myVertexNode.Contains(ov2)) {
+          if (node1.IsSame(myVertexNode.FindFromKey(ov2))) v1 = ov2;
+        }
+      }
+      // Create map of faces for e1
+      TopTools_MapOfShape Faces1;
+      const TopTools_ListOfShape& lfac1 = myBoundFaces.FindFromKey(e1);
+      if (lfac1.Extent()) {
+        TopTools_ListIteratorOfListOfShape itf(lfac1);
+        for (; itf.More(); itf.Next())
+          if (!itf.Value().IsNull())
+            Faces1.Add(itf.Value());
+      }
+      // Explore edges of the second node
+      TopTools_ListIteratorOfListOfShape Ie2(ledges2);
+      for (; Ie2.More() && !Status && !isSameEdge; Ie2.Next()) {
+        const TopoDS_Shape& e2 = Ie2.Value();
+        // Obtain real vertex from edge
+        TopoDS_Shape v2 = node2;
+        { //szv: Use brackets to destroy local variables
+          TopoDS_Vertex ov1, ov2;
+          TopExp::Vertices(TopoDS::Edge(e2),ov1,ov2);
+          if (myVertexNode.Contains(ov1)) {
+            if (node2.IsSame(myVertexNode.FindFromKey(ov1))) v2 = ov1;
+          }
+          if (myVertexNode.Contains(ov2)) {
+            if (node2.IsSame(myVertexNode.FindFromKey(ov2))) v2 = ov2;
+          }
+        }
+        // Explore faces for e2
+        const TopTools_ListOfShape& lfac2 = myBoundFaces.FindFromKey(e2);
+        if (lfac2.Extent()) {
+          TopTools_ListIteratorOfListOfShape itf(lfac2);
+          for (; itf.More() && !Status && !isSameEdge; itf.Next()) {
+            // Check merging conditions for the same face
+            if (Faces1.Contains(itf.Value())) {
+              Standard_Integer stat = IsMergedVertices(itf.Value(),e1,e2,v1,v2);
+              if (stat == 1) isSameEdge = Standard_True;
+              else Status = stat;
+            }
+          }
+        }
+        else if (Faces1.IsEmpty() && e1 == e2) {
+          Standard_Integer stat = IsMergedVertices(TopoDS_Face(),e1,e1,v1,v2);
+          if (stat == 1) isSameEdge = Standard_True;
+          else Status = stat;
+          break;
+        }
+      }
+    }
+    if (Status) continue;
+    if (isSameEdge) listNodesSameEdge.Append(node2);
+    // Append near node to the sequence
+    gp_Pnt pt2 = BRep_Tool::Pnt(node2);
+    Standard_Real dist = pt1.Distance(pt2);
+    if (dist < myTolerance) {
+      Standard_Boolean isIns = Standard_False;
+      for (Standard_Integer kk = 1; kk <= SeqNodes.Length() && !isIns; kk++) {
+        gp_Pnt pt = BRep_Tool::Pnt(TopoDS::Vertex(SeqNodes.Value(kk)));
+        if (dist < pt1.Distance(pt)) {
+          SeqNodes.InsertBefore(kk,node2);
+          isIns = Standard_True;
+        }
+      }
+      if (!isIns) SeqNodes.Append(node2);
+    }
+  }
+  if (SeqNodes.Length()) {
+    // Remove nodes near to some other from the same edge
+    if (listNodesSameEdge.Extent()) {
+      TopTools_ListIteratorOfListOfShape lInt(listNodesSameEdge);
+      for (; lInt.More(); lInt.Next()) {
+        const TopoDS_Vertex& n2 = TopoDS::Vertex(lInt.Value());
+        gp_Pnt p2 = BRep_Tool::Pnt(n2);
+        for (Standard_Integer k = 1; k <= SeqNodes.Length(); ) {
+          const TopoDS_Vertex& n1 = TopoDS::Vertex(SeqNodes.Value(k));
+          if (n1 != n2) {
+            gp_Pnt p1 = BRep_Tool::Pnt(n1);
+            if (p2.Distance(p1) >= pt1.Distance(p1)) { k++; continue; }
+          }
+          SeqNodes.Remove(k);
+        }
+      }
+    }
+    // Return nearest node if at least one exists
+    if (SeqNodes.Length())
+      return SeqNodes.First();
+  }
+  return TopoDS_Shape();
+}
+
 static Standard_Boolean GlueVertices(TopTools_IndexedDataMapOfShapeShape& aVertexNode,
                                      TopTools_DataMapOfShapeListOfShape& aNodeEdges,
                                      const TopTools_IndexedDataMapOfShapeListOfShape& aBoundFaces,
                                      const Standard_Real Tolerance,
+                                     const Standard_Boolean theRunParallel,
                                      const Message_ProgressRange& theProgress)
 {
   // Create map of node -> vertices
@@ -2782,133 +2978,31 @@ static Standard_Boolean GlueVertices(TopTools_IndexedDataMapOfShapeShape& aVerte
 #ifdef OCCT_DEBUG
   std::cout << "Glueing " << nbNodes << " nodes..." << std::endl;
 #endif
-  // Merge nearest nodes
-  TopTools_IndexedDataMapOfShapeShape NodeNearestNode;
+  // Find nearest nodes
+  NCollection_Array1<TopoDS_Shape> aNearestNodes (1, Max (nbNodes, 1));
   Message_ProgressScope aPS (theProgress, "Glueing nodes", nbNodes, Standard_True);
-  for (Standard_Integer i = 1; i <= nbNodes && aPS.More(); i++, aPS.Next()) {
-    const TopoDS_Vertex& node1 = TopoDS::Vertex(NodeVertices.FindKey(i));
-    // Find near nodes
-    gp_Pnt pt1 = BRep_Tool::Pnt (node1);
-    anInspector.SetCurrent (pt1.XYZ());
-    gp_XYZ aPntMin = anInspector.Shift (pt1.XYZ(), -Tolerance);
-    gp_XYZ aPntMax = anInspector.Shift (pt1.XYZ(), Tolerance);
-    aFilter.Inspect (aPntMin, aPntMax, anInspector);
-    if (anInspector.ResInd().IsEmpty()) continue;
-    // Retrieve list of edges for the first node
-    const TopTools_ListOfShape& ledges1 = aNodeEdges(node1);
-    // Explore list of near nodes and fill the sequence of glued nodes
-    TopTools_SequenceOfShape SeqNodes;
-    TopTools_ListOfShape listNodesSameEdge;
-    //gp_Pnt pt1 = BRep_Tool::Pnt(node1);
-    TColStd_ListIteratorOfListOfInteger iter1(anInspector.ResInd());
-    for (; iter1.More(); iter1.Next()) {
-      const TopoDS_Vertex& node2 = TopoDS::Vertex(NodeVertices.FindKey(iter1.Value()));
-      if (node1 == node2) continue;
-      // Retrieve list of edges for the second node
-      const TopTools_ListOfShape& ledges2 = aNodeEdges(node2);
-      // Check merging condition for the pair of nodes
-      Standard_Integer Status = 0, isSameEdge = Standard_False;
-      // Explore edges of the first node
-      TopTools_ListIteratorOfListOfShape Ie1(ledges1);
-      for (; Ie1.More() && !Status && !isSameEdge; Ie1.Next()) {
-	const TopoDS_Shape& e1 = Ie1.Value();
-	// Obtain real vertex from edge
-	TopoDS_Shape v1 = node1;
-	{ //szv: Use brackets to destroy local variables
-	  TopoDS_Vertex ov1, ov2;
-	  TopExp::Vertices(TopoDS::Edge(e1),ov1,ov2);
-	  if (aVertexNode.Contains(ov1)) {
-	    if (node1.IsSame(aVertexNode.FindFromKey(ov1))) v1 = ov1;
-	  }
-	  if (aVertexNode.Contains(ov2)) {
-	    if (node1.IsSame(aVertexNode.FindFromKey(ov2))) v1 = ov2;
-	  }
-	}
-	// Create map of faces for e1
-	TopTools_MapOfShape Faces1;
-	const TopTools_ListOfShape& lfac1 = aBoundFaces.FindFromKey(e1);
-	if (lfac1.Extent()) {
-	  TopTools_ListIteratorOfListOfShape itf(lfac1);
-	  for (; itf.More(); itf.Next())
-	    if (!itf.Value().IsNull())
-	      Faces1.Add(itf.Value());
-	}
-	// Explore edges of the second node
-        TopTools_ListIteratorOfListOfShape Ie2(ledges2);
-	for (; Ie2.More() && !Status && !isSameEdge; Ie2.Next()) {
-	  const TopoDS_Shape& e2 = Ie2.Value();
-	  // Obtain real vertex from edge
-	  TopoDS_Shape v2 = node2;
-	  { //szv: Use brackets to destroy local variables
-	    TopoDS_Vertex ov1, ov2;
-	    TopExp::Vertices(TopoDS::Edge(e2),ov1,ov2);
-	    if (aVertexNode.Contains(ov1)) {
-	      if (node2.IsSame(aVertexNode.FindFromKey(ov1))) v2 = ov1;
-	    }
-	    if (aVertexNode.Contains(ov2)) {
-	      if (node2.IsSame(aVertexNode.FindFromKey(ov2))) v2 = ov2;
-	    }
-	  }
-	  // Explore faces for e2
-	  const TopTools_ListOfShape& lfac2 = aBoundFaces.FindFromKey(e2);
-	  if (lfac2.Extent()) {
-	    TopTools_ListIteratorOfListOfShape itf(lfac2);
-	    for (; itf.More() && !Status && !isSameEdge; itf.Next()) {
-	      // Check merging conditions for the same face
-	      if (Faces1.Contains(itf.Value())) {
-		Standard_Integer stat = IsMergedVertices(itf.Value(),e1,e2,v1,v2);
-		if (stat == 1) isSameEdge = Standard_True;
-		else Status = stat;
-	      }
-	    }
-	  }
-          else if (Faces1.IsEmpty() && e1 == e2) {
-            Standard_Integer stat = IsMergedVertices(TopoDS_Face(),e1,e1,v1,v2);
-            if (stat == 1) isSameEdge = Standard_True;
-            else Status = stat;
-            break;
-          }
-	}
-      }
-      if (Status) continue;
-      if (isSameEdge) listNodesSameEdge.Append(node2);
-      // Append near node to the sequence
-      gp_Pnt pt2 = BRep_Tool::Pnt(node2);
-      Standard_Real dist = pt1.Distance(pt2);
-      if (dist < Tolerance) {
-	Standard_Boolean isIns = Standard_False;
-	for (Standard_Integer kk = 1; kk <= SeqNodes.Length() && !isIns; kk++) {
-	  gp_Pnt pt = BRep_Tool::Pnt(TopoDS::Vertex(SeqNodes.Value(kk)));
-	  if (dist < pt1.Distance(pt)) {
-	    SeqNodes.InsertBefore(kk,node2);
-	    isIns = Standard_True;
-	  }
-	}
-	if (!isIns) SeqNodes.Append(node2);
-      }
-    }
-    if (SeqNodes.Length()) {
-      // Remove nodes near to some other from the same edge
-      if (listNodesSameEdge.Extent()) {
-	TopTools_ListIteratorOfListOfShape lInt(listNodesSameEdge);
-	for (; lInt.More(); lInt.Next()) {
-	  const TopoDS_Vertex& n2 = TopoDS::Vertex(lInt.Value());
-	  gp_Pnt p2 = BRep_Tool::Pnt(n2);
-	  for (Standard_Integer k = 1; k <= SeqNodes.Length(); ) {
-	    const TopoDS_Vertex& n1 = TopoDS::Vertex(SeqNodes.Value(k));
-	    if (n1 != n2) {
-	      gp_Pnt p1 = BRep_Tool::Pnt(n1);
-	      if (p2.Distance(p1) >= pt1.Distance(p1)) { k++; continue; }
-	    }
-	    SeqNodes.Remove(k);
-	  }
-	}
-      }
-      // Bind nearest node if at least one exists
-      if (SeqNodes.Length())
-	NodeNearestNode.Add(node1,SeqNodes.First());
-    }
-    anInspector.ClearResList();
+  if (theRunParallel && nbNodes > 1)
+  {
+    // Each chunk of nodes uses its own copy of inspector
+    const Standard_Integer aNbChunks = Min (nbNodes, 4 * OSD_Parallel::NbLogicalProcessors());
+    const BRepBuilderAPI_NearestNodeFunctor aFunctor (aVertexNode, aNodeEdges, aBoundFaces, NodeVertices,
+                                                      aFilter, anInspector, Tolerance, aNearestNodes, aNbChunks);
+    OSD_Parallel::For (0, aNbChunks, aFunctor);
+    aPS.Next (nbNodes);
+  }
+  else
+  {
+    const BRepBuilderAPI_NearestNodeFunctor aFunctor (aVertexNode, aNodeEdges, aBoundFaces, NodeVertices,
+                                                      aFilter, anInspector, Tolerance, aNearestNodes, 1);
+    for (Standard_Integer i = 1; i <= nbNodes && aPS.More(); i++, aPS.Next())
+      aNearestNodes.ChangeValue (i) = aFunctor.NearestNode (i, anInspector);
+  }
+
+  // Merge nearest nodes in the order of nodes
+  TopTools_IndexedDataMapOfShapeShape NodeNearestNode;
+  for (Standard_Integer i = 1; i <= nbNodes; i++) {
+    if (!aNearestNodes.Value(i).IsNull())
+      NodeNearestNode.Add(NodeVertices.FindKey(i),aNearestNodes.Value(i));
   }
 
   // Create new nodes for chained nearest nodes
@@ -2943,7 +3037,7 @@ void BRepBuilderAPI_Sewing::VerticesAssembling(const Message_ProgressRange& theP
 #ifdef OCCT_DEBUG
       std::cout << "Assemble " << nbVert << " vertices on faces..." << std::endl;
 #endif
-      while (GlueVertices(myVertexNode,myNodeSections,myBoundFaces,myTolerance, aPS.Next()));
+      while (GlueVertices(myVertexNode,myNodeSections,myBoundFaces,myTolerance,myRunParallel,aPS.Next()));
     }
     if (!aPS.More())
       return;
@@ -2951,7 +3045,7 @@ void BRepBuilderAPI_Sewing::VerticesAssembling(const Message_ProgressRange& theP
 #ifdef OCCT_DEBUG
       std::cout << "Assemble " << nbVertFree << " vertices on floating edges..." << std::endl;
 #endif
-      while (GlueVertices(myVertexNodeFree,myNodeSections,myBoundFaces,myTolerance, aPS.Next()));
+      while (GlueVertices(myVertexNodeFree,myNodeSections,myBoundFaces,myTolerance,myRunParallel,aPS.Next()));
     }
   }
 }
@@ -3593,6 +3687,100 @@ Standard_Boolean BRepBuilderAPI_Sewing::MergedNearestEdges(const TopoDS_Shape& e
   return success;
 }
 
+//=======================================================================
+//class    : BRepBuilderAPI_CuttingCandidates
+//purpose  : Candidate vertices for cutting of the bound
+//           and their projections on the bound curve
+//=======================================================================
+
+struct BRepBuilderAPI_CuttingCandidates
+{
+  TopoDS_Vertex              V1, V2;
+  TopTools_IndexedMapOfShape Vertices;
+  TColStd_Array1OfReal       Dist;
+  TColStd_Array1OfReal       Para;
+  TColgp_Array1OfPnt         Proj;
+};
+
+//=======================================================================
+//class    : CuttingCandidatesFunctor
+//purpose  : Searches candidate vertices for cutting of the bound
+//           and projects them on the bound curve
+//=======================================================================
+
+class BRepBuilderAPI_Sewing::CuttingCandidatesFunctor
+{
+public:
+
+  CuttingCandidatesFunctor (const BRepBuilderAPI_Sewing& theSewing,
+                            const BRepBuilderAPI_BndBoxTree& theTree,
+                            NCollection_Array1<BRepBuilderAPI_CuttingCandidates>& theCandidates)
+  : mySewing (theSewing),
+    myTree (theTree),
+    myCandidates (theCandidates) {}
+
+  //! Fills candidates for the bound of given index.
+  void operator() (const Standard_Integer theIndex) const
+  {
+    BRepBuilderAPI_CuttingCandidates& aCandidates = myCandidates.ChangeValue (theIndex);
+    const TopoDS_Edge& bound = TopoDS::Edge(mySewing.myBoundFaces.FindKey(theIndex));
+    // Do not cut floating edges
+    if (!mySewing.myBoundFaces(theIndex).Extent()) return;
+    // Obtain bound curve
+    TopLoc_Location loc;
+    Standard_Real first, last;
+    Handle(Geom_Curve) c3d = BRep_Tool::Curve(bound, loc, first, last);
+    if (c3d.IsNull()) return;
+    if (!loc.IsIdentity()) {
+      c3d = Handle(Geom_Curve)::DownCast(c3d->Copy());
+      c3d->Transform(loc.Transformation());
+    }
+    // Obtain candidate vertices
+    { //szv: Use brackets to destroy local variables
+      // Create bounding box around curve
+      Bnd_Box aGlobalBox;
+      GeomAdaptor_Curve adptC(c3d,first,last);
+      BndLib_Add3dCurve::Add(adptC,mySewing.myTolerance,aGlobalBox);
+      // Sort vertices to find candidates
+      BRepBuilderAPI_BndBoxTreeSelector aSelector;
+      aSelector.SetCurrent (aGlobalBox);
+      myTree.Select (aSelector);
+      // Skip bound if no node is in the boundind box
+      if (!aSelector.ResInd().Extent()) return;
+      // Retrieve bound nodes
+      TopExp::Vertices(bound,aCandidates.V1,aCandidates.V2);
+      const TopoDS_Shape& Node1 = mySewing.myVertexNode.FindFromKey(aCandidates.V1);
+      const TopoDS_Shape& Node2 = mySewing.myVertexNode.FindFromKey(aCandidates.V2);
+      // Fill map of candidate vertices
+      TColStd_ListIteratorOfListOfInteger itl(aSelector.ResInd());
+      for (; itl.More(); itl.Next()) {
+        const Standard_Integer index = itl.Value();
+        const TopoDS_Shape& Node = mySewing.myVertexNode.FindFromIndex(index);
+        if (!Node.IsSame(Node1) && !Node.IsSame(Node2)) {
+          TopoDS_Shape vertex = mySewing.myVertexNode.FindKey(index);
+          aCandidates.Vertices.Add(vertex);
+        }
+      }
+    }
+    Standard_Integer nbCandidates = aCandidates.Vertices.Extent();
+    if (!nbCandidates) return;
+    // Project vertices on curve
+    aCandidates.Para.Resize (1, nbCandidates, Standard_False);
+    aCandidates.Dist.Resize (1, nbCandidates, Standard_False);
+    aCandidates.Proj.Resize (1, nbCandidates, Standard_False);
+    TColgp_Array1OfPnt arrPnt(1,nbCandidates);
+    for (Standard_Integer j = 1; j <= nbCandidates; j++)
+      arrPnt(j) = BRep_Tool::Pnt(TopoDS::Vertex(aCandidates.Vertices(j)));
+    mySewing.ProjectPointsOnCurve(arrPnt,c3d,first,last,
+      aCandidates.Dist,aCandidates.Para,aCandidates.Proj,Standard_True);
+  }
+
+private:
+  const BRepBuilderAPI_Sewing&                          mySewing;
+  const BRepBuilderAPI_BndBoxTree&                      myTree;
+  NCollection_Array1<BRepBuilderAPI_CuttingCandidates>& myCandidates;
+};
+
 //=======================================================================
 //function : Cutting
 //purpose  : Modifies :
@@ -3609,7 +3797,6 @@ void BRepBuilderAPI_Sewing::Cutting(const Message_ProgressRange& theProgress)
   Standard_Real eps = myTolerance*0.5;
   BRepBuilderAPI_BndBoxTree aTree;
   NCollection_UBTreeFiller <Standard_Integer, Bnd_Box> aTreeFiller (aTree);
-  BRepBuilderAPI_BndBoxTreeSelector aSelector;
   for (i = 1; i <= nbVertices; i++) {
     gp_Pnt pt = BRep_Tool::Pnt(TopoDS::Vertex(myVertexNode.FindKey(i)));
     Bnd_Box aBox;
@@ -3619,69 +3806,30 @@ void BRepBuilderAPI_Sewing::Cutting(const Message_ProgressRange& theProgress)
   }
   aTreeFiller.Fill();
 
-  Handle(Geom_Curve) c3d;
-  TopLoc_Location loc;
-  Standard_Real first, last;
   // Iterate on all boundaries
   Standard_Integer nbBounds = myBoundFaces.Extent();
+  if (!nbBounds) return;
   Message_ProgressScope aPS (theProgress, "Cutting bounds", nbBounds);
-  TopTools_IndexedDataMapOfShapeListOfShape::Iterator anIterB(myBoundFaces);
-  for (; anIterB.More() && aPS.More(); anIterB.Next(), aPS.Next()) {
-    const TopoDS_Edge& bound = TopoDS::Edge(anIterB.Key());
-    // Do not cut floating edges
-    if (!anIterB.Value().Extent()) continue;
-    // Obtain bound curve
-    c3d = BRep_Tool::Curve(bound, loc, first, last);
-    if (c3d.IsNull()) continue;
-    if (!loc.IsIdentity()) {
-      c3d = Handle(Geom_Curve)::DownCast(c3d->Copy());
-      c3d->Transform(loc.Transformation());
-    }
+  // Candidate vertices do not depend on cutting of other bounds,
+  // so that in parallel mode they are found for all bounds at once
+  NCollection_Array1<BRepBuilderAPI_CuttingCandidates> aCandidates (1, nbBounds);
+  const CuttingCandidatesFunctor aFunctor (*this, aTree, aCandidates);
+  if (myRunParallel)
+    OSD_Parallel::For (1, nbBounds + 1, aFunctor);
+  for (i = 1; i <= nbBounds && aPS.More(); i++, aPS.Next()) {
+    const TopoDS_Edge& bound = TopoDS::Edge(myBoundFaces.FindKey(i));
+    if (!myRunParallel)
+      aFunctor (i);
     // Create cutting sections
     TopTools_ListOfShape listSections;
     { //szv: Use brackets to destroy local variables
-      // Obtain candidate vertices
-      TopoDS_Vertex V1, V2;
-      TopTools_IndexedMapOfShape CandidateVertices;
-      { //szv: Use brackets to destroy local variables
-        // Create bounding box around curve
-        Bnd_Box aGlobalBox;
-        GeomAdaptor_Curve adptC(c3d,first,last);
-        BndLib_Add3dCurve::Add(adptC,myTolerance,aGlobalBox);
-        // Sort vertices to find candidates
-        aSelector.SetCurrent (aGlobalBox);
-        aTree.Select (aSelector); 
-        // Skip bound if no node is in the boundind box
-        if (!aSelector.ResInd().Extent()) continue;
-        // Retrieve bound nodes
-        TopExp::Vertices(bound,V1,V2);
-        const TopoDS_Shape& Node1 = myVertexNode.FindFromKey(V1);
-        const TopoDS_Shape& Node2 = myVertexNode.FindFromKey(V2);
-        // Fill map of candidate vertices
-        TColStd_ListIteratorOfListOfInteger itl(aSelector.ResInd());
-        for (; itl.More(); itl.Next()) {
-          const Standard_Integer index = itl.Value();
-          const TopoDS_Shape& Node = myVertexNode.FindFromIndex(index);
-          if (!Node.IsSame(Node1) && !Node.IsSame(Node2)) {
-            TopoDS_Shape vertex = myVertexNode.FindKey(index);
-            CandidateVertices.Add(vertex);
-          }
-        }
-        aSelector.ClearResList();
-      }
-      Standard_Integer nbCandidates = CandidateVertices.Extent();
-      if (!nbCandidates) continue;
-      // Project vertices on curve
-      TColStd_Array1OfReal arrPara(1,nbCandidates), arrDist(1,nbCandidates);
-      TColgp_Array1OfPnt arrPnt(1,nbCandidates), arrProj(1,nbCandidates);
-      for (Standard_Integer j = 1; j <= nbCandidates; j++)
-        arrPnt(j) = BRep_Tool::Pnt(TopoDS::Vertex(CandidateVertices(j)));
-      ProjectPointsOnCurve(arrPnt,c3d,first,last,arrDist,arrPara,arrProj,Standard_True);
+      BRepBuilderAPI_CuttingCandidates& aCand = aCandidates.ChangeValue (i);
+      if (!aCand.Vertices.Extent()) continue;
       // Create cutting nodes
       TopTools_SequenceOfShape seqNode;
       TColStd_SequenceOfReal seqPara;
-      CreateCuttingNodes(CandidateVertices,bound,
-        V1,V2,arrDist,arrPara,arrProj,seqNode,seqPara);
+      CreateCuttingNodes(aCand.Vertices,bound,
+        aCand.V1,aCand.V2,aCand.Dist,aCand.Para,aCand.Proj,seqNode,seqPara);
       if (!seqPara.Length()) continue;
       // Create cutting sections
       CreateSections(bound, seqNode, seqPara, listSections);
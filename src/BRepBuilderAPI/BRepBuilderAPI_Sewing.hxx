@@ -225,6 +225,14 @@ public:
   //! in this case WorkTolerance = myTolerance + tolEdge1+ tolEdg2;
     void SetLocalTolerancesMode (const Standard_Boolean theLocalTolerancesMode);
   
+  //! Sets mode for running independent stages of sewing in parallel threads:
+  //! search of nearest nodes for vertices assembling and projection
+  //! of vertices on bounds for cutting. The result does not depend on this mode.
+    void SetRunParallel (const Standard_Boolean theIsParallel);
+  
+  //! Returns mode for running in parallel threads (FALSE by default).
+    Standard_Boolean RunParallel() const;
+  
   //! Sets mode for non-manifold sewing.
     void SetNonManifoldMode (const Standard_Boolean theNonManifoldMode);
   
@@ -362,11 +370,17 @@ protected:
 
 private:
 
+  //! Functor searching candidate vertices for cutting of bounds
+  //! and projecting them on the bound curves.
+  class CuttingCandidatesFunctor;
+
+private:
 
   Standard_Boolean myFaceMode;
   Standard_Boolean myFloatingEdgesMode;
   Standard_Boolean mySameParameterMode;
   Standard_Boolean myLocalToleranceMode;
+  Standard_Boolean myRunParallel;
   Standard_Real myMinTolerance;
   Standard_Real myMaxTolerance;
   TopTools_MapOfShape myMergedEdges;
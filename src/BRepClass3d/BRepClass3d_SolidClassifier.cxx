@@ -59,8 +59,56 @@ static StatistiquesBRepClass3d STAT;
 
 #include <BRepClass3d_SolidClassifier.hxx>
 #include <gp_Pnt.hxx>
+#include <OSD_ThreadPool.hxx>
+#include <Standard_DimensionMismatch.hxx>
 #include <TopoDS_Shape.hxx>
 
+//=======================================================================
+//class    : BRepClass3d_SolidClassifierFunctor
+//purpose  : Classifies the points in parallel threads; each thread
+//           loads the solid into its own classifier on its first point
+//=======================================================================
+class BRepClass3d_SolidClassifierFunctor
+{
+public:
+  BRepClass3d_SolidClassifierFunctor (NCollection_Array1<BRepClass3d_SolidClassifier>& theClassifiers,
+                                      NCollection_Array1<Standard_Boolean>& theIsLoaded,
+                                      const TopoDS_Shape& theSolid,
+                                      const TColgp_Array1OfPnt& thePoints,
+                                      const Standard_Real theTol,
+                                      NCollection_Array1<TopAbs_State>& theStates)
+  : myClassifiers (theClassifiers),
+    myIsLoaded (theIsLoaded),
+    mySolid (theSolid),
+    myPoints (thePoints),
+    myTol (theTol),
+    myStates (theStates)
+  {}
+
+  void operator() (int theThreadIndex, int theIndex) const
+  {
+    BRepClass3d_SolidClassifier& aClassifier = myClassifiers.ChangeValue (theThreadIndex);
+    if (!myIsLoaded (theThreadIndex))
+    {
+      aClassifier.Load (mySolid);
+      myIsLoaded.ChangeValue (theThreadIndex) = Standard_True;
+    }
+    aClassifier.Perform (myPoints.Value (theIndex), myTol);
+    myStates.ChangeValue (theIndex - myPoints.Lower() + myStates.Lower()) = aClassifier.State();
+  }
+
+private:
+  BRepClass3d_SolidClassifierFunctor& operator= (const BRepClass3d_SolidClassifierFunctor&);
+
+private:
+  NCollection_Array1<BRepClass3d_SolidClassifier>& myClassifiers;
+  NCollection_Array1<Standard_Boolean>& myIsLoaded;
+  const TopoDS_Shape& mySolid;
+  const TColgp_Array1OfPnt& myPoints;
+  const Standard_Real myTol;
+  NCollection_Array1<TopAbs_State>& myStates;
+};
+
 BRepClass3d_SolidClassifier::BRepClass3d_SolidClassifier()
 {
   aSolidLoaded=isaholeinspace=Standard_False;
@@ -188,6 +236,42 @@ void BRepClass3d_SolidClassifier::Perform(const gp_Pnt& P,const Standard_Real To
 #endif
 }
 
+void BRepClass3d_SolidClassifier::Perform(const TColgp_Array1OfPnt& thePoints,
+                                          const Standard_Real theTol,
+                                          NCollection_Array1<TopAbs_State>& theStates,
+                                          const Standard_Boolean theToRunParallel)
+{
+  if (thePoints.Length() != theStates.Length())
+  {
+    throw Standard_DimensionMismatch ("BRepClass3d_SolidClassifier::Perform(), wrong length of array of states");
+  }
+
+  const Handle(OSD_ThreadPool)& aThreadPool = OSD_ThreadPool::DefaultPool();
+  const Standard_Integer aNbThreads = theToRunParallel && aSolidLoaded
+                                    ? Min (thePoints.Length(), aThreadPool->NbDefaultThreadsToLaunch())
+                                    : 1;
+  if (aNbThreads < 2)
+  {
+    for (Standard_Integer i = thePoints.Lower(); i <= thePoints.Upper(); ++i)
+    {
+      Perform (thePoints (i), theTol);
+      theStates.ChangeValue (i - thePoints.Lower() + theStates.Lower()) = State();
+    }
+    return;
+  }
+
+  // the explorer keeps the state of the current ray and face and the face
+  // intersectors keep their results, so that each thread classifies
+  // the points by its own classifier of the solid
+  NCollection_Array1<BRepClass3d_SolidClassifier> aClassifiers (0, aNbThreads - 1);
+  NCollection_Array1<Standard_Boolean> anIsLoaded (0, aNbThreads - 1);
+  anIsLoaded.Init (Standard_False);
+  BRepClass3d_SolidClassifierFunctor aFunctor (aClassifiers, anIsLoaded, explorer.GetShape(),
+                                               thePoints, theTol, theStates);
+  OSD_ThreadPool::Launcher aLauncher (*aThreadPool, aNbThreads);
+  aLauncher.Perform (thePoints.Lower(), thePoints.Upper() + 1, aFunctor);
+}
+
 void BRepClass3d_SolidClassifier::PerformInfinitePoint(const Standard_Real Tol) { 
 #if LBRCOMPT
   STAT.NbPerformInfinitePoint++;
@@ -23,6 +23,9 @@
 #include <Standard_Boolean.hxx>
 #include <BRepClass3d_SolidExplorer.hxx>
 #include <BRepClass3d_SClassifier.hxx>
+#include <NCollection_Array1.hxx>
+#include <TColgp_Array1OfPnt.hxx>
+#include <TopAbs_State.hxx>
 class TopoDS_Shape;
 class gp_Pnt;
 
@@ -50,6 +53,19 @@ public:
   //! Classify the point P with the
   //! tolerance Tol on the solid S.
   Standard_EXPORT void Perform (const gp_Pnt& P, const Standard_Real Tol);
+
+  //! Classifies the points thePoints with the tolerance theTol
+  //! on the loaded solid and puts their states into theStates,
+  //! which must have the same length as thePoints.
+  //! In sequential mode the points are classified one by one by Perform(),
+  //! so that State() returns the state of the last point.
+  //! In parallel mode each working thread loads the solid into its own
+  //! classifier and classifies its points by Perform() in the same way;
+  //! State() is not changed.
+  Standard_EXPORT void Perform (const TColgp_Array1OfPnt& thePoints,
+                                const Standard_Real theTol,
+                                NCollection_Array1<TopAbs_State>& theStates,
+                                const Standard_Boolean theToRunParallel = Standard_False);
   
   //! Classify an infinite point with the
   //! tolerance Tol on the solid S.
@@ -480,6 +480,7 @@ Standard_Integer BRepClass3d_SolidExplorer::OtherSegment(const gp_Pnt& P,
           aRestr = Standard_False;
           if(myMapOfInter.IsBound(face))
           {
+            delete (IntCurvesFace_Intersector *)myMapOfInter.Find(face);
             myMapOfInter.UnBind(face);
             void *ptr = (void *)(new IntCurvesFace_Intersector(face, Precision::Confusion(),
                                                                aRestr, Standard_False));
@@ -0,0 +1,246 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BRepExtrema_ClashDetector.hxx>
+
+#include <BRepExtrema_OverlapTool.hxx>
+#include <OSD_Parallel.hxx>
+#include <Standard_OutOfRange.hxx>
+#include <TopExp_Explorer.hxx>
+
+//=======================================================================
+//class    : ElementSetFunctor
+//purpose  : Builds the triangle sets and their BVH trees in parallel
+//=======================================================================
+class BRepExtrema_ClashDetector::ElementSetFunctor
+{
+public:
+  ElementSetFunctor (const NCollection_Vector<Standard_Integer>& theShapes,
+                     BRepExtrema_ClashDetector& theDetector)
+  : myShapes (theShapes),
+    myDetector (theDetector)
+  {}
+
+  void operator() (const Standard_Integer theIndex) const
+  {
+    const Standard_Integer aShape = myShapes.Value (theIndex);
+    BRepExtrema_ShapeList& aShapeList = myDetector.myShapeLists.ChangeValue (aShape);
+    for (TopExp_Explorer anIter (myDetector.myShapes.Value (aShape), TopAbs_FACE); anIter.More(); anIter.Next())
+    {
+      aShapeList.Append (anIter.Current());
+    }
+    for (TopExp_Explorer anIter (myDetector.myShapes.Value (aShape), TopAbs_EDGE); anIter.More(); anIter.Next())
+    {
+      aShapeList.Append (anIter.Current());
+    }
+
+    // the BVH tree is built on initialization and then only read by the pairs
+    Handle(BRepExtrema_TriangleSet) aSet = new BRepExtrema_TriangleSet;
+    if (!aSet->Init (aShapeList))
+    {
+      // the shape is not checked as in BRepExtrema_ShapeProximity
+      aSet->Clear();
+    }
+    myDetector.myElementSets.ChangeValue (aShape) = aSet;
+  }
+
+private:
+  ElementSetFunctor& operator= (const ElementSetFunctor&);
+
+private:
+  const NCollection_Vector<Standard_Integer>& myShapes;
+  BRepExtrema_ClashDetector& myDetector;
+};
+
+//=======================================================================
+//class    : PairFunctor
+//purpose  : Checks the pairs of shapes in parallel
+//=======================================================================
+class BRepExtrema_ClashDetector::PairFunctor
+{
+public:
+  PairFunctor (BRepExtrema_ClashDetector& theDetector)
+  : myDetector (theDetector)
+  {}
+
+  void operator() (const Standard_Integer theIndex) const
+  {
+    Pair& aPair = myDetector.myPairs.ChangeValue (theIndex);
+    BRepExtrema_OverlapTool anOverlapTool (myDetector.myElementSets.Value (aPair.Shape1),
+                                           myDetector.myElementSets.Value (aPair.Shape2));
+    anOverlapTool.Perform (myDetector.myTolerance);
+    if (anOverlapTool.OverlapSubShapes1().IsEmpty())
+    {
+      return;
+    }
+
+    aPair.Overlaps1 = anOverlapTool.OverlapSubShapes1();
+    aPair.Overlaps2 = anOverlapTool.OverlapSubShapes2();
+    if (myDetector.myReceiver != NULL)
+    {
+      Standard_Mutex::Sentry aSentry (myDetector.myMutex);
+      myDetector.myReceiver->OnClash (aPair.Shape1, aPair.Shape2, aPair.Overlaps1, aPair.Overlaps2);
+    }
+  }
+
+private:
+  PairFunctor& operator= (const PairFunctor&);
+
+private:
+  BRepExtrema_ClashDetector& myDetector;
+};
+
+//=======================================================================
+//function : BRepExtrema_ClashDetector
+//purpose  :
+//=======================================================================
+BRepExtrema_ClashDetector::BRepExtrema_ClashDetector (const Standard_Real theTolerance)
+: myTolerance   (theTolerance),
+  myFilter      (NULL),
+  myReceiver    (NULL),
+  myRunParallel (Standard_False),
+  myIsDone      (Standard_False)
+{
+  //
+}
+
+//=======================================================================
+//function : AddShape
+//purpose  :
+//=======================================================================
+Standard_Integer BRepExtrema_ClashDetector::AddShape (const TopoDS_Shape& theShape)
+{
+  myShapes.Append (theShape);
+  myShapeLists.Appended();
+  myElementSets.Appended();
+  myIsDone = Standard_False;
+  return myShapes.Upper();
+}
+
+//=======================================================================
+//function : AddPair
+//purpose  :
+//=======================================================================
+void BRepExtrema_ClashDetector::AddPair (const Standard_Integer theShape1,
+                                         const Standard_Integer theShape2)
+{
+  if (theShape1 < 0 || theShape1 >= myShapes.Length()
+   || theShape2 < 0 || theShape2 >= myShapes.Length())
+  {
+    throw Standard_OutOfRange ("BRepExtrema_ClashDetector::AddPair(), wrong index of shape");
+  }
+
+  Pair& aPair = myInputPairs.Appended();
+  aPair.Shape1 = theShape1;
+  aPair.Shape2 = theShape2;
+  myIsDone = Standard_False;
+}
+
+//=======================================================================
+//function : ClearPairs
+//purpose  :
+//=======================================================================
+void BRepExtrema_ClashDetector::ClearPairs()
+{
+  myInputPairs.Clear();
+  myPairs.Clear();
+  myClashes.Clear();
+  myIsDone = Standard_False;
+}
+
+//=======================================================================
+//function : Perform
+//purpose  :
+//=======================================================================
+void BRepExtrema_ClashDetector::Perform()
+{
+  myPairs.Clear();
+  myClashes.Clear();
+
+  // Build the missing triangle sets
+  NCollection_Vector<Standard_Integer> aShapesToInit;
+  for (Standard_Integer aShape = 0; aShape < myShapes.Length(); ++aShape)
+  {
+    if (myElementSets.Value (aShape).IsNull())
+    {
+      aShapesToInit.Append (aShape);
+    }
+  }
+  ElementSetFunctor anElementSetFunctor (aShapesToInit, *this);
+  OSD_Parallel::For (0, aShapesToInit.Length(), anElementSetFunctor, !myRunParallel);
+
+  // Select the pairs with overlapping bounding boxes
+  NCollection_Vector<BVH_Box<Standard_Real, 3> > aBoxes;
+  for (Standard_Integer aShape = 0; aShape < myShapes.Length(); ++aShape)
+  {
+    const Handle(BRepExtrema_TriangleSet)& aSet = myElementSets.Value (aShape);
+    BVH_Box<Standard_Real, 3>& aBox = aBoxes.Appended();
+    if (aSet->Size() > 0)
+    {
+      const BVH_Box<Standard_Real, 3> aSetBox = aSet->Box();
+      const BVH_Vec3d aTolVec (myTolerance, myTolerance, myTolerance);
+      aBox = BVH_Box<Standard_Real, 3> (aSetBox.CornerMin() - aTolVec, aSetBox.CornerMax() + aTolVec);
+    }
+  }
+
+  if (!myInputPairs.IsEmpty())
+  {
+    for (NCollection_Vector<Pair>::Iterator anIter (myInputPairs); anIter.More(); anIter.Next())
+    {
+      const Pair& aPair = anIter.Value();
+      if (aBoxes.Value (aPair.Shape1).IsValid() && aBoxes.Value (aPair.Shape2).IsValid()
+      && !aBoxes.Value (aPair.Shape1).IsOut (aBoxes.Value (aPair.Shape2)))
+      {
+        Pair& aNewPair = myPairs.Appended();
+        aNewPair.Shape1 = aPair.Shape1;
+        aNewPair.Shape2 = aPair.Shape2;
+      }
+    }
+  }
+  else
+  {
+    for (Standard_Integer aShape1 = 0; aShape1 < myShapes.Length(); ++aShape1)
+    {
+      const BVH_Box<Standard_Real, 3>& aBox1 = aBoxes.Value (aShape1);
+      if (!aBox1.IsValid())
+      {
+        continue;
+      }
+      for (Standard_Integer aShape2 = aShape1 + 1; aShape2 < myShapes.Length(); ++aShape2)
+      {
+        const BVH_Box<Standard_Real, 3>& aBox2 = aBoxes.Value (aShape2);
+        if (!aBox2.IsValid() || aBox1.IsOut (aBox2)
+         || (myFilter != NULL && !myFilter->ToCheck (aShape1, aShape2)))
+        {
+          continue;
+        }
+        Pair& aNewPair = myPairs.Appended();
+        aNewPair.Shape1 = aShape1;
+        aNewPair.Shape2 = aShape2;
+      }
+    }
+  }
+
+  // Check the pairs
+  PairFunctor aPairFunctor (*this);
+  OSD_Parallel::For (0, myPairs.Length(), aPairFunctor, !myRunParallel);
+
+  for (Standard_Integer aPairIdx = 0; aPairIdx < myPairs.Length(); ++aPairIdx)
+  {
+    if (!myPairs.Value (aPairIdx).Overlaps1.IsEmpty())
+    {
+      myClashes.Append (aPairIdx);
+    }
+  }
+  myIsDone = Standard_True;
+}
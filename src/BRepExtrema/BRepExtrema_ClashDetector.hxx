@@ -0,0 +1,196 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _BRepExtrema_ClashDetector_HeaderFile
+#define _BRepExtrema_ClashDetector_HeaderFile
+
+#include <BRepExtrema_MapOfIntegerPackedMapOfInteger.hxx>
+#include <BRepExtrema_TriangleSet.hxx>
+#include <NCollection_Vector.hxx>
+#include <Standard_Mutex.hxx>
+
+//! @brief Tool class for clash detection between many pairs of shapes
+//! (e.g. between the components of an assembly).
+//!
+//! The overlap test of each pair of shapes is the same as the one of
+//! BRepExtrema_ShapeProximity with finite tolerance: it is based on the
+//! existing triangulation of faces, which should be already built.
+//! The set of triangles of each shape and its BVH tree are built only once
+//! and are shared by all the pairs containing this shape.
+//!
+//! The pairs to be checked are either given explicitly by AddPair(),
+//! or all pairs of the loaded shapes accepted by the pair filter are checked.
+//! The pairs may be checked in parallel threads. The clashes are passed
+//! to the receiver as soon as they are found, and are also available
+//! after the computation in the order of the checked pairs.
+class BRepExtrema_ClashDetector
+{
+public:
+
+  //! Filter of the pairs of shapes to be checked.
+  struct PairFilter
+  {
+    //! Releases resources of pair filter.
+    virtual ~PairFilter() {}
+
+    //! Returns true if the pair of shapes with the given indices should be checked.
+    virtual Standard_Boolean ToCheck (const Standard_Integer theShape1,
+                                      const Standard_Integer theShape2) const = 0;
+  };
+
+  //! Receiver of the clashes found.
+  struct ClashReceiver
+  {
+    //! Releases resources of clash receiver.
+    virtual ~ClashReceiver() {}
+
+    //! Called for each pair of clashing shapes with the sets of IDs of overlapped faces.
+    //! In parallel mode it is called from the working threads, but never concurrently.
+    virtual void OnClash (const Standard_Integer theShape1,
+                          const Standard_Integer theShape2,
+                          const BRepExtrema_MapOfIntegerPackedMapOfInteger& theOverlaps1,
+                          const BRepExtrema_MapOfIntegerPackedMapOfInteger& theOverlaps2) = 0;
+  };
+
+public:
+
+  //! Creates clash detection tool with the given tolerance.
+  Standard_EXPORT BRepExtrema_ClashDetector (const Standard_Real theTolerance = 0.0);
+
+public:
+
+  //! Returns tolerance value for overlap test (distance between shapes).
+  Standard_Real Tolerance() const { return myTolerance; }
+
+  //! Sets tolerance value for overlap test (distance between shapes).
+  void SetTolerance (const Standard_Real theTolerance) { myTolerance = theTolerance; }
+
+  //! Sets the flag of parallel processing of the pairs.
+  void SetRunParallel (const Standard_Boolean theIsParallel) { myRunParallel = theIsParallel; }
+
+  //! Returns the flag of parallel processing of the pairs.
+  Standard_Boolean RunParallel() const { return myRunParallel; }
+
+  //! Sets the filter of pairs used if no pairs are given explicitly (NULL means all pairs).
+  void SetPairFilter (const PairFilter* theFilter) { myFilter = theFilter; }
+
+  //! Sets the receiver of the clashes found (may be NULL).
+  void SetClashReceiver (ClashReceiver* theReceiver) { myReceiver = theReceiver; }
+
+  //! Adds the shape and returns its index (started from 0).
+  Standard_EXPORT Standard_Integer AddShape (const TopoDS_Shape& theShape);
+
+  //! Returns the number of loaded shapes.
+  Standard_Integer NbShapes() const { return myShapes.Length(); }
+
+  //! Returns the shape with the given index (started from 0).
+  const TopoDS_Shape& Shape (const Standard_Integer theShape) const { return myShapes.Value (theShape); }
+
+  //! Adds the pair of shapes to be checked.
+  Standard_EXPORT void AddPair (const Standard_Integer theShape1,
+                                const Standard_Integer theShape2);
+
+  //! Removes the pairs given explicitly and the results.
+  Standard_EXPORT void ClearPairs();
+
+  //! Performs the clash detection. The triangle sets of the shapes are built
+  //! on the first use and kept for the next calls.
+  Standard_EXPORT void Perform();
+
+  //! True if the detection is completed.
+  Standard_Boolean IsDone() const { return myIsDone; }
+
+  //! Returns the number of pairs of clashing shapes.
+  Standard_Integer NbClashes() const { return myClashes.Length(); }
+
+  //! Returns the indices of shapes of the clash with the given index (started from 0).
+  void Clash (const Standard_Integer theClash,
+              Standard_Integer& theShape1,
+              Standard_Integer& theShape2) const
+  {
+    const Pair& aPair = myPairs.Value (myClashes.Value (theClash));
+    theShape1 = aPair.Shape1;
+    theShape2 = aPair.Shape2;
+  }
+
+  //! Returns set of IDs of overlapped faces of the 1st shape of the clash.
+  const BRepExtrema_MapOfIntegerPackedMapOfInteger& OverlapSubShapes1 (const Standard_Integer theClash) const
+  {
+    return myPairs.Value (myClashes.Value (theClash)).Overlaps1;
+  }
+
+  //! Returns set of IDs of overlapped faces of the 2nd shape of the clash.
+  const BRepExtrema_MapOfIntegerPackedMapOfInteger& OverlapSubShapes2 (const Standard_Integer theClash) const
+  {
+    return myPairs.Value (myClashes.Value (theClash)).Overlaps2;
+  }
+
+  //! Returns sub-shape of the shape with the given index (both started from 0).
+  const TopoDS_Shape& GetSubShape (const Standard_Integer theShape,
+                                   const Standard_Integer theID) const
+  {
+    return myShapeLists.Value (theShape).Value (theID);
+  }
+
+  //! Returns set of all the face triangles of the shape (built by Perform()).
+  const Handle(BRepExtrema_TriangleSet)& ElementSet (const Standard_Integer theShape) const
+  {
+    return myElementSets.Value (theShape);
+  }
+
+private:
+
+  //! Pair of shapes to be checked and its results.
+  struct Pair
+  {
+    Standard_Integer Shape1;
+    Standard_Integer Shape2;
+    BRepExtrema_MapOfIntegerPackedMapOfInteger Overlaps1;
+    BRepExtrema_MapOfIntegerPackedMapOfInteger Overlaps2;
+  };
+
+  class ElementSetFunctor;
+  class PairFunctor;
+
+private:
+
+  //! Maximum overlapping distance.
+  Standard_Real myTolerance;
+
+  //! Shapes to be checked.
+  NCollection_Vector<TopoDS_Shape> myShapes;
+  //! Lists of sub-shapes of the shapes.
+  NCollection_Vector<BRepExtrema_ShapeList> myShapeLists;
+  //! Sets of face triangles of the shapes (null if not built yet).
+  NCollection_Vector<Handle(BRepExtrema_TriangleSet)> myElementSets;
+
+  //! Pairs given explicitly.
+  NCollection_Vector<Pair> myInputPairs;
+  //! Checked pairs with their results.
+  NCollection_Vector<Pair> myPairs;
+  //! Indices of the clashing pairs.
+  NCollection_Vector<Standard_Integer> myClashes;
+
+  //! Filter of pairs.
+  const PairFilter* myFilter;
+  //! Receiver of clashes.
+  ClashReceiver* myReceiver;
+  //! Mutex serializing the calls of the receiver.
+  Standard_Mutex myMutex;
+
+  Standard_Boolean myRunParallel;
+  Standard_Boolean myIsDone;
+
+};
+
+#endif // _BRepExtrema_ClashDetector_HeaderFile
@@ -27,6 +27,8 @@
 #include <BRep_Tool.hxx>  
 #include <TopTools_MapOfShape.hxx>
 #include <BRepCheck_Shell.hxx>
+#include <NCollection_Vector.hxx>
+#include <OSD_Parallel.hxx>
 
 #ifdef OCCT_DEBUG
 static Standard_Integer AffichEps = 0;
@@ -110,22 +112,151 @@ void  BRepGProp::LinearProperties(const TopoDS_Shape& S, GProp_GProps& SProps, c
   }
 }
 
-static Standard_Real surfaceProperties(const TopoDS_Shape& S, GProp_GProps& Props, const Standard_Real Eps, const Standard_Boolean SkipShared,
-                                       const Standard_Boolean UseTriangulation)
+//=======================================================================
+//class    : BRepGProp_FaceProps
+//purpose  : Properties of one face computed separately from the others
+//=======================================================================
+struct BRepGProp_FaceProps
 {
-  Standard_Integer i;
+  TopoDS_Face      Face;
+  Standard_Integer Index;
+  Standard_Boolean UseTriangulation;
+  GProp_GProps     Props;
+  Standard_Real    Error;
+};
+
+//=======================================================================
+//class    : BRepGProp_FaceFunctor
+//purpose  : Computes the surface or volume properties of the faces.
+//           Each face is processed with its own tools, so that the faces
+//           may be processed in parallel threads.
+//=======================================================================
+class BRepGProp_FaceFunctor
+{
+public:
+  BRepGProp_FaceFunctor (NCollection_Vector<BRepGProp_FaceProps>& theFaces,
+                         const gp_Pnt& theLocation,
+                         const Standard_Real theEps,
+                         const Standard_Boolean theIsVolume)
+  : myFaces (theFaces),
+    myLocation (theLocation),
+    myEps (theEps),
+    myIsVolume (theIsVolume)
+  {}
+
+  void operator() (const Standard_Integer theIndex) const
+  {
+    BRepGProp_FaceProps& aFaceProps = myFaces.ChangeValue (theIndex);
+    const TopoDS_Face& F = aFaceProps.Face;
+    aFaceProps.Error = 0.0;
+    if (aFaceProps.UseTriangulation)
+    {
+      TopLoc_Location aLoc;
+      const Handle(Poly_Triangulation)& aTri = BRep_Tool::Triangulation (F, aLoc);
+      BRepGProp_MeshProps MG (myIsVolume ? BRepGProp_MeshProps::Vinert : BRepGProp_MeshProps::Sinert);
+      MG.SetLocation (myLocation);
+      MG.Perform (aTri, aLoc, F.Orientation());
+      aFaceProps.Props = MG;
+      return;
+    }
+
+    BRepGProp_Face   BF;
+    BRepGProp_Domain BD;
+    BF.Load (F);
+    Standard_Boolean IsNatRestr = (F.NbChildren() == 0);
+    if (!IsNatRestr) BD.Init (F);
+    if (myIsVolume)
+    {
+      BRepGProp_Vinert G;  G.SetLocation (myLocation);
+      perform (G, BF, BD, IsNatRestr, aFaceProps);
+    }
+    else
+    {
+      BRepGProp_Sinert G;  G.SetLocation (myLocation);
+      perform (G, BF, BD, IsNatRestr, aFaceProps);
+    }
+  }
+
+private:
+  template<class TheInert>
+  void perform (TheInert& G,
+                BRepGProp_Face& BF,
+                BRepGProp_Domain& BD,
+                const Standard_Boolean IsNatRestr,
+                BRepGProp_FaceProps& theFaceProps) const
+  {
+    if (myEps < 1.0) {
+      G.Perform(BF, BD, myEps);
+      theFaceProps.Error = G.GetEpsilon();
+    }
+    else {
+      if (IsNatRestr) G.Perform(BF);
+      else G.Perform(BF, BD);
+    }
+    theFaceProps.Props = G;
+  }
+
+  BRepGProp_FaceFunctor& operator= (const BRepGProp_FaceFunctor&);
+
+private:
+  NCollection_Vector<BRepGProp_FaceProps>& myFaces;
+  gp_Pnt           myLocation;
+  Standard_Real    myEps;
+  Standard_Boolean myIsVolume;
+};
+
+//=======================================================================
+//function : facesProperties
+//purpose  : Computes the properties of the faces and adds them to <Props>
+//           in the order of the faces, so that the result does not depend
+//           on the parallel mode
+//=======================================================================
+static Standard_Real facesProperties(NCollection_Vector<BRepGProp_FaceProps>& theFaces,
+                                     GProp_GProps& Props,
+                                     const gp_Pnt& P,
+                                     const Standard_Real Eps,
+                                     const Standard_Boolean IsVolume,
+                                     const Standard_Boolean IsParallel)
+{
+  BRepGProp_FaceFunctor aFunctor (theFaces, P, Eps, IsVolume);
+  OSD_Parallel::For (0, theFaces.Length(), aFunctor, !IsParallel);
+
 #ifdef OCCT_DEBUG
   Standard_Integer iErrorMax = 0;
 #endif
-  Standard_Real ErrorMax = 0.0, Error;
+  Standard_Real ErrorMax = 0.0;
+  for (NCollection_Vector<BRepGProp_FaceProps>::Iterator anIt (theFaces); anIt.More(); anIt.Next())
+  {
+    const BRepGProp_FaceProps& aFaceProps = anIt.Value();
+    Props.Add (aFaceProps.Props);
+    if (aFaceProps.UseTriangulation)
+    {
+      continue;
+    }
+    if (ErrorMax < aFaceProps.Error) {
+      ErrorMax = aFaceProps.Error;
+#ifdef OCCT_DEBUG
+      iErrorMax = aFaceProps.Index;
+#endif
+    }
+#ifdef OCCT_DEBUG
+    if(AffichEps) std::cout<<"\n"<<aFaceProps.Index<<":\tEps"<<(IsVolume ? "Volume" : "Area")<<" = "<< aFaceProps.Error;
+#endif
+  }
+#ifdef OCCT_DEBUG
+  if(AffichEps) std::cout<<"\n-----------------\n"<<iErrorMax<<":\tMaxError = "<<ErrorMax<<"\n";
+#endif
+  return ErrorMax;
+}
+
+static Standard_Real surfaceProperties(const TopoDS_Shape& S, GProp_GProps& Props, const Standard_Real Eps, const Standard_Boolean SkipShared,
+                                       const Standard_Boolean UseTriangulation, const Standard_Boolean IsParallel)
+{
+  Standard_Integer i;
   TopExp_Explorer ex; 
   gp_Pnt P(roughBaryCenter(S));
-  BRepGProp_Sinert G;  G.SetLocation(P);
-  BRepGProp_MeshProps MG(BRepGProp_MeshProps::Sinert);  
-  MG.SetLocation(P);
 
-  BRepGProp_Face   BF;
-  BRepGProp_Domain BD;
+  NCollection_Vector<BRepGProp_FaceProps> aFaces;
   TopTools_MapOfShape aFMap;
   TopLoc_Location aLocDummy;
 
@@ -154,57 +285,28 @@ static Standard_Real surfaceProperties(const TopoDS_Shape& S, GProp_GProps& Prop
       }
     }
 
-    if ((UseTriangulation && !NoTri) || (NoSurf && !NoTri))
-    {
-      TopAbs_Orientation anOri = F.Orientation();
-      const Handle(Poly_Triangulation)& aTri = BRep_Tool::Triangulation(F, aLocDummy);
-      MG.Perform(aTri, aLocDummy, anOri);
-      Props.Add(MG);
-    }
-    else
-    {
-      BF.Load(F);
-      Standard_Boolean IsNatRestr = (F.NbChildren() == 0);
-      if (!IsNatRestr) BD.Init(F);
-      if (Eps < 1.0) {
-        G.Perform(BF, BD, Eps);
-        Error = G.GetEpsilon();
-        if (ErrorMax < Error) {
-          ErrorMax = Error;
-#ifdef OCCT_DEBUG
-          iErrorMax = i;
-#endif
-        }
-      }
-      else {
-        if (IsNatRestr) G.Perform(BF);
-        else G.Perform(BF, BD);
-      }
-      Props.Add(G);
-#ifdef OCCT_DEBUG
-      if(AffichEps) std::cout<<"\n"<<i<<":\tEpsArea = "<< G.GetEpsilon();
-#endif
-    }
+    BRepGProp_FaceProps& aFaceProps = aFaces.Appended();
+    aFaceProps.Face  = F;
+    aFaceProps.Index = i;
+    aFaceProps.UseTriangulation = (UseTriangulation && !NoTri) || (NoSurf && !NoTri);
   }
-#ifdef OCCT_DEBUG
-  if(AffichEps) std::cout<<"\n-----------------\n"<<iErrorMax<<":\tMaxError = "<<ErrorMax<<"\n";
-#endif
-  return ErrorMax;
+  return facesProperties(aFaces, Props, P, Eps, Standard_False, IsParallel);
 }
 void  BRepGProp::SurfaceProperties(const TopoDS_Shape& S, GProp_GProps& Props, const Standard_Boolean SkipShared,
-                                   const Standard_Boolean UseTriangulation)
+                                   const Standard_Boolean UseTriangulation, const Standard_Boolean IsParallel)
 {
   // find the origin
   gp_Pnt P(0,0,0);
   P.Transform(S.Location());
   Props = GProp_GProps(P);
-  surfaceProperties(S,Props,1.0, SkipShared, UseTriangulation);
+  surfaceProperties(S,Props,1.0, SkipShared, UseTriangulation, IsParallel);
 }
-Standard_Real BRepGProp::SurfaceProperties(const TopoDS_Shape& S, GProp_GProps& Props, const Standard_Real Eps, const Standard_Boolean SkipShared){ 
+Standard_Real BRepGProp::SurfaceProperties(const TopoDS_Shape& S, GProp_GProps& Props, const Standard_Real Eps, const Standard_Boolean SkipShared,
+                                           const Standard_Boolean IsParallel){ 
   // find the origin
   gp_Pnt P(0,0,0);  P.Transform(S.Location());
   Props = GProp_GProps(P);
-  Standard_Real ErrorMax = surfaceProperties(S,Props,Eps,SkipShared, Standard_False);
+  Standard_Real ErrorMax = surfaceProperties(S,Props,Eps,SkipShared, Standard_False, IsParallel);
   return ErrorMax;
 }
 
@@ -214,21 +316,13 @@ Standard_Real BRepGProp::SurfaceProperties(const TopoDS_Shape& S, GProp_GProps&
 //=======================================================================
 
 static Standard_Real volumeProperties(const TopoDS_Shape& S, GProp_GProps& Props, const Standard_Real Eps, const Standard_Boolean SkipShared,
-                                      const Standard_Boolean UseTriangulation)
+                                      const Standard_Boolean UseTriangulation, const Standard_Boolean IsParallel)
 {
   Standard_Integer i;
-#ifdef OCCT_DEBUG
-  Standard_Integer iErrorMax = 0;
-#endif
-  Standard_Real ErrorMax = 0.0, Error = 0.0;
   TopExp_Explorer ex; 
   gp_Pnt P(roughBaryCenter(S)); 
-  BRepGProp_Vinert G;  G.SetLocation(P);
-  BRepGProp_MeshProps MG(BRepGProp_MeshProps::Vinert);
-  MG.SetLocation(P);
 
-  BRepGProp_Face   BF;
-  BRepGProp_Domain BD;
+  NCollection_Vector<BRepGProp_FaceProps> aFaces;
   TopTools_MapOfShape aFwdFMap;
   TopTools_MapOfShape aRvsFMap;
   TopLoc_Location aLocDummy;
@@ -269,45 +363,16 @@ static Standard_Real volumeProperties(const TopoDS_Shape& S, GProp_GProps& Props
 
     if (isFwd || isRvs)
     {
-      if ((UseTriangulation && !NoTri) || (NoSurf && !NoTri))
-      {
-        const Handle(Poly_Triangulation)& aTri = BRep_Tool::Triangulation(F, aLocDummy);
-        MG.Perform(aTri, aLocDummy, anOri);
-        Props.Add(MG);
-      }
-      else
-      {
-        BF.Load(F);
-        Standard_Boolean IsNatRestr = (F.NbChildren () == 0);
-        if (!IsNatRestr) BD.Init(F);
-        if (Eps < 1.0) {
-          G.Perform(BF, BD, Eps);
-          Error = G.GetEpsilon();
-          if (ErrorMax < Error) {
-            ErrorMax = Error;
-#ifdef OCCT_DEBUG
-            iErrorMax = i;
-#endif
-          }
-        }
-        else {
-          if (IsNatRestr) G.Perform(BF);
-          else G.Perform(BF, BD);
-        }
-        Props.Add(G);
-#ifdef OCCT_DEBUG
-        if(AffichEps) std::cout<<"\n"<<i<<":\tEpsVolume = "<< G.GetEpsilon();
-#endif
-      }
+      BRepGProp_FaceProps& aFaceProps = aFaces.Appended();
+      aFaceProps.Face  = F;
+      aFaceProps.Index = i;
+      aFaceProps.UseTriangulation = (UseTriangulation && !NoTri) || (NoSurf && !NoTri);
     }
   }
-#ifdef OCCT_DEBUG
-  if(AffichEps) std::cout<<"\n-----------------\n"<<iErrorMax<<":\tMaxError = "<<ErrorMax<<"\n";
-#endif
-  return ErrorMax;
+  return facesProperties(aFaces, Props, P, Eps, Standard_True, IsParallel);
 }
 void  BRepGProp::VolumeProperties(const TopoDS_Shape& S, GProp_GProps& Props, const Standard_Boolean OnlyClosed, const Standard_Boolean SkipShared,
-                                  const Standard_Boolean UseTriangulation)
+                                  const Standard_Boolean UseTriangulation, const Standard_Boolean IsParallel)
 {
   // find the origin
   gp_Pnt P(0,0,0);  P.Transform(S.Location());
@@ -321,9 +386,9 @@ void  BRepGProp::VolumeProperties(const TopoDS_Shape& S, GProp_GProps& Props, co
       {
         continue;
       }
-      if(BRep_Tool::IsClosed(Sh)) volumeProperties(Sh,Props,1.0,SkipShared, UseTriangulation);
+      if(BRep_Tool::IsClosed(Sh)) volumeProperties(Sh,Props,1.0,SkipShared, UseTriangulation, IsParallel);
     }
-  } else volumeProperties(S,Props,1.0,SkipShared, UseTriangulation);
+  } else volumeProperties(S,Props,1.0,SkipShared, UseTriangulation, IsParallel);
 }
 
 //=======================================================================
@@ -332,7 +397,8 @@ void  BRepGProp::VolumeProperties(const TopoDS_Shape& S, GProp_GProps& Props, co
 //=======================================================================
 
 Standard_Real BRepGProp::VolumeProperties(const TopoDS_Shape& S, GProp_GProps& Props, 
-  const Standard_Real Eps, const Standard_Boolean OnlyClosed, const Standard_Boolean SkipShared)
+  const Standard_Real Eps, const Standard_Boolean OnlyClosed, const Standard_Boolean SkipShared,
+  const Standard_Boolean IsParallel)
 { 
   // find the origin
   gp_Pnt P(0,0,0);  P.Transform(S.Location());
@@ -352,7 +418,7 @@ Standard_Real BRepGProp::VolumeProperties(const TopoDS_Shape& S, GProp_GProps& P
         continue;
       }
       if(BRep_Tool::IsClosed(Sh)) {
-        Error = volumeProperties(Sh,Props,Eps,SkipShared, Standard_False);
+        Error = volumeProperties(Sh,Props,Eps,SkipShared, Standard_False, IsParallel);
         if(ErrorMax < Error) {
           ErrorMax = Error;
 #ifdef OCCT_DEBUG
@@ -361,7 +427,7 @@ Standard_Real BRepGProp::VolumeProperties(const TopoDS_Shape& S, GProp_GProps& P
         }
       }
     }
-  } else ErrorMax = volumeProperties(S,Props,Eps,SkipShared, Standard_False);
+  } else ErrorMax = volumeProperties(S,Props,Eps,SkipShared, Standard_False, IsParallel);
 #ifdef OCCT_DEBUG
   if(AffichEps) std::cout<<"\n\n==================="<<iErrorMax<<":\tMaxEpsVolume = "<<ErrorMax<<"\n";
 #endif
@@ -18,10 +18,12 @@
 #include <algorithm>
 #include <BRepMesh_GeomTool.hxx>
 #include <GeomAdaptor_Curve.hxx>
+#include <GeomAdaptor_Surface.hxx>
 #include <GeomLib.hxx>
 #include <IMeshData_Edge.hxx>
 #include <IMeshData_Wire.hxx>
 #include <NCollection_Handle.hxx>
+#include <TColgp_Array1OfPnt2d.hxx>
 
 namespace
 {
@@ -265,9 +267,11 @@ namespace
   //! Checks whether intervals should be split.
   //! Returns true in case if it is impossible to compute normal 
   //! directly on intervals, false is returned elsewhere.
-  Standard_Boolean toSplitIntervals (const Handle (Geom_Surface)&  theSurf,
+  Standard_Boolean toSplitIntervals (const GeomAdaptor_Surface&   theSurf,
                                      const TColStd_Array1OfReal  (&theIntervals)[2])
   {
+    Standard_Integer aNbUVs = 0;
+    TColgp_Array1OfPnt2d aUVs (1, theIntervals[0].Length() * theIntervals[1].Length());
     Standard_Integer aIntervalU = theIntervals[0].Lower ();
     for (; aIntervalU <= theIntervals[0].Upper (); ++aIntervalU)
     {
@@ -278,17 +282,43 @@ namespace
       Standard_Integer aIntervalV = theIntervals[1].Lower ();
       for (; aIntervalV <= theIntervals[1].Upper (); ++aIntervalV)
       {
-        gp_Dir aNorm;
         const Standard_Real aParamV = theIntervals[1].Value(aIntervalV);
         if (Precision::IsInfinite (aParamV))
           continue;
 
-        if (GeomLib::NormEstim (theSurf, gp_Pnt2d (aParamU, aParamV), Precision::Confusion (), aNorm) != 0)
-        {
-          return Standard_True;
-        }
-        // TODO: do not split intervals if there is no normal in the middle of interval.
+        aUVs.SetValue (++aNbUVs, gp_Pnt2d (aParamU, aParamV));
+      }
+    }
+
+    if (aNbUVs == 0)
+    {
+      return Standard_False;
+    }
+
+    // The derivatives in all the nodes are evaluated at once, span by span.
+    // The normal is estimated by GeomLib::NormEstim() only in the nodes
+    // where the first derivatives do not define it.
+    const TColgp_Array1OfPnt2d aNodes (aUVs.First(), 1, aNbUVs);
+    TColgp_Array1OfPnt aPnts (1, aNbUVs);
+    TColgp_Array1OfVec aD1U  (1, aNbUVs), aD1V (1, aNbUVs);
+    theSurf.D1 (aNodes, aPnts, aD1U, aD1V);
+
+    const Standard_Real aTol2 = Precision::SquareConfusion();
+    for (Standard_Integer i = 1; i <= aNbUVs; ++i)
+    {
+      if (aD1U (i).SquareMagnitude() >= aTol2
+       && aD1V (i).SquareMagnitude() >= aTol2
+       && aD1U (i).Crossed (aD1V (i)).SquareMagnitude() >= aTol2)
+      {
+        continue;
+      }
+
+      gp_Dir aNorm;
+      if (GeomLib::NormEstim (theSurf.Surface(), aNodes (i), Precision::Confusion (), aNorm) != 0)
+      {
+        return Standard_True;
       }
+      // TODO: do not split intervals if there is no normal in the middle of interval.
     }
 
     return Standard_False;
@@ -460,7 +490,7 @@ Standard_Boolean BRepMesh_NURBSRangeSplitter::initParameters() const
   getUndefinedInterval(aSurface, Standard_True,  aContinuity, GetRangeU(), aIntervals[0]);
   getUndefinedInterval(aSurface, Standard_False, aContinuity, GetRangeV(), aIntervals[1]);
 
-  const Standard_Boolean isSplitIntervals = toSplitIntervals (aSurface->Surface().Surface(), aIntervals);
+  const Standard_Boolean isSplitIntervals = toSplitIntervals (aSurface->Surface(), aIntervals);
 
   if (!initParamsFromIntervals(aIntervals[0], GetRangeU(), isSplitIntervals,
                                const_cast<IMeshData::IMapOfReal&>(GetParametersU())))
@@ -17,6 +17,7 @@
 #include <DBRep.hxx>
 #include <BRepTest.hxx>
 #include <BRepExtrema_Poly.hxx>
+#include <BRepExtrema_ClashDetector.hxx>
 #include <BRepExtrema_DistShapeShape.hxx>
 #include <BRepExtrema_ShapeProximity.hxx>
 #include <BRepExtrema_SelfIntersection.hxx>
@@ -25,6 +26,7 @@
 #include <Draw_ProgressIndicator.hxx>
 #include <TopoDS_Builder.hxx>
 #include <TopoDS_Compound.hxx>
+#include <TopoDS_Iterator.hxx>
 #include <Draw.hxx>
 #include <Message.hxx>
 #include <OSD_Timer.hxx>
@@ -462,6 +464,98 @@ static int ShapeSelfIntersection (Draw_Interpretor& theDI, Standard_Integer theN
   return 0;
 }
 
+//==============================================================================
+//function : ShapeClashes
+//purpose  :
+//==============================================================================
+static int ShapeClashes (Draw_Interpretor& theDI, Standard_Integer theNbArgs, const char** theArgs)
+{
+  if (theNbArgs < 2)
+  {
+    Message::SendFail() << "Usage: " << theArgs[0] << " Shape [-tol <value>] [-parallel] [-profile]";
+    return 1;
+  }
+
+  TopoDS_Shape aShape = DBRep::Get (theArgs[1]);
+  if (aShape.IsNull())
+  {
+    Message::SendFail() << "Error: Failed to find specified shape";
+    return 1;
+  }
+
+  BRepExtrema_ClashDetector aTool;
+  Standard_Boolean aToProfile = Standard_False;
+
+  for (Standard_Integer anArgIdx = 2; anArgIdx < theNbArgs; ++anArgIdx)
+  {
+    TCollection_AsciiString aFlag (theArgs[anArgIdx]);
+    aFlag.LowerCase();
+
+    if (aFlag == "-tol")
+    {
+      if (++anArgIdx >= theNbArgs)
+      {
+        Message::SendFail() << "Error: wrong syntax at argument '" << aFlag;
+        return 1;
+      }
+
+      const Standard_Real aValue = Draw::Atof (theArgs[anArgIdx]);
+      if (aValue < 0.0)
+      {
+        Message::SendFail() << "Error: Tolerance value should be non-negative";
+        return 1;
+      }
+      aTool.SetTolerance (aValue);
+    }
+    else if (aFlag == "-parallel")
+    {
+      aTool.SetRunParallel (Standard_True);
+    }
+    else if (aFlag == "-profile")
+    {
+      aToProfile = Standard_True;
+    }
+    else
+    {
+      Message::SendFail() << "Error: unknown argument '" << theArgs[anArgIdx] << "'";
+      return 1;
+    }
+  }
+
+  for (TopoDS_Iterator anIter (aShape); anIter.More(); anIter.Next())
+  {
+    aTool.AddShape (anIter.Value());
+  }
+
+  OSD_Timer aTimer;
+  aTimer.Start();
+
+  // Perform clash detection between the sub-shapes
+  aTool.Perform();
+
+  aTimer.Stop();
+  if (!aTool.IsDone())
+  {
+    Message::SendFail() << "Error: Failed to perform clash detection";
+    return 1;
+  }
+
+  if (aToProfile)
+  {
+    theDI << "Executing clash detection: " << aTimer.ElapsedTime() << "\n";
+  }
+
+  for (Standard_Integer aClashIdx = 0; aClashIdx < aTool.NbClashes(); ++aClashIdx)
+  {
+    Standard_Integer aShape1 = 0, aShape2 = 0;
+    aTool.Clash (aClashIdx, aShape1, aShape2);
+    theDI << theArgs[1] << "_" << (aShape1 + 1) << " " << theArgs[1] << "_" << (aShape2 + 1) << "\n";
+  }
+  theDI << "Number of clashes: " << aTool.NbClashes() << "\n";
+
+  return 0;
+}
+
 //=======================================================================
 //function : ExtremaCommands
 //purpose  : 
@@ -518,4 +612,19 @@ void BRepTest::ExtremaCommands (Draw_Interpretor& theCommands)
                    __FILE__,
                    ShapeSelfIntersection,
                    aGroup);
+
+  theCommands.Add ("clashes",
+                   "clashes Shape [-tol <value>] [-parallel] [-profile]"
+                   "\n\t\t: Searches for pairs of clashing sub-shapes of the given shape"
+                   "\n\t\t: (e.g. components of an assembly) and prints their indices."
+                   "\n\t\t: The algorithm uses shape tessellation (should be computed in"
+                   "\n\t\t: advance), and provides approximate results. The options are:"
+                   "\n\t\t:   -tol      : non-negative tolerance value used for overlapping"
+                   "\n\t\t:               test (for zero tolerance, the strict intersection"
+                   "\n\t\t:               test will be performed)"
+                   "\n\t\t:   -parallel : checks the pairs of sub-shapes in parallel threads"
+                   "\n\t\t:   -profile  : outputs execution time of clash detection",
+                   __FILE__,
+                   ShapeClashes,
+                   aGroup);
 }
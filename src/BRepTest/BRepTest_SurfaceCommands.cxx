@@ -333,6 +333,7 @@ static Standard_Integer sewing (Draw_Interpretor& theDi,
   Standard_Boolean aSameParameterMode = Standard_True;
   Standard_Boolean aFloatingEdgesMode = Standard_False;
   Standard_Boolean aFaceMode = Standard_True;
+  Standard_Boolean aParallelMode = Standard_False;
   Standard_Boolean aSetMinTol = Standard_False;
   Standard_Real aMinTol = 0.;
   Standard_Real aMaxTol = Precision::Infinite();
@@ -378,6 +379,7 @@ static Standard_Integer sewing (Draw_Interpretor& theDi,
       case 'p': aSameParameterMode = aVal; break;
       case 'e': aFloatingEdgesMode = aVal; break;
       case 'f': aFaceMode = aVal; break;
+      case 't': aParallelMode = aVal; break;
       }
     }
     else
@@ -414,6 +416,7 @@ static Standard_Integer sewing (Draw_Interpretor& theDi,
     theDi << "  p - mode for same parameter processing for edges\n";
     theDi << "  e - mode for sewing floating edges\n";
     theDi << "  f - mode for sewing faces\n";
+    theDi << "  t - mode for running in parallel threads\n";
     return (1);
   }
     
@@ -438,6 +441,7 @@ static Standard_Integer sewing (Draw_Interpretor& theDi,
   aSewing.SetSameParameterMode (aSameParameterMode);
   aSewing.SetFloatingEdgesMode (aFloatingEdgesMode);
   aSewing.SetFaceMode (aFaceMode);
+  aSewing.SetRunParallel (aParallelMode);
   aSewing.SetMinTolerance (aMinTol);
   aSewing.SetMaxTolerance (aMaxTol);
 
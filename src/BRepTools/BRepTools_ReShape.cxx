@@ -498,6 +498,23 @@ Standard_Boolean BRepTools_ReShape::IsNewShape(const TopoDS_Shape& theShape) con
   return myNewShapes.Contains(theShape);
 }
 
+//=======================================================================
+//function : Append
+//purpose  :
+//=======================================================================
+
+void BRepTools_ReShape::Append (const BRepTools_ReShape& theOther)
+{
+  for (TShapeToReplacement::Iterator anIter (theOther.myShapeToReplacement); anIter.More(); anIter.Next())
+  {
+    myShapeToReplacement.Bind (anIter.Key(), anIter.Value());
+  }
+  for (TopTools_MapOfShape::Iterator anIter (theOther.myNewShapes); anIter.More(); anIter.Next())
+  {
+    myNewShapes.Add (anIter.Key());
+  }
+}
+
 //=======================================================================
 //function : History
 //purpose  :
@@ -149,6 +149,12 @@ public:
   //! Returns the history of the substituted shapes.
   Standard_EXPORT Handle(BRepTools_History) History() const;
 
+  //! Appends all substitution requests recorded by another reshaper.
+  //! Requests recorded for the same shapes in this reshaper are overridden.
+  //! Can be used to combine the results of reshapers which have
+  //! processed independent shapes (for instance, in parallel threads).
+  Standard_EXPORT void Append (const BRepTools_ReShape& theOther);
+
   DEFINE_STANDARD_RTTIEXT(BRepTools_ReShape,Standard_Transient)
 
 protected:
@@ -15,6 +15,7 @@
 #include <BSplCLib.hxx>
 
 #include <NCollection_LocalArray.hxx>
+#include <Standard_DimensionMismatch.hxx>
 
 #include <TColgp_HArray1OfPnt.hxx>
 #include <TColgp_HArray1OfPnt2d.hxx>
@@ -135,6 +136,49 @@ void BSplCLib_Cache::CalculateDerivative(const Standard_Real&    theParameter,
     PLib::RationalDerivative(aDerivative, aDerivative, aDimension - 1, aPntDeriv[0], theDerivArray);
 }
 
+void BSplCLib_Cache::CalculateDerivatives(const TColStd_Array1OfReal& theParameters,
+                                          const Standard_Integer      theDerivative,
+                                                Standard_Real*        theDerivArray) const
+{
+  Standard_Real* aPolesArray = ConvertArray(myPolesWeights);
+  const Standard_Integer aDimension = myPolesWeights->RowLength(); // number of columns
+  const Standard_Integer aStride = (theDerivative + 1) * aDimension;
+
+  // When the degree of curve is lesser than the requested derivative,
+  // the cells corresponding to greater derivatives stay zero
+  Standard_Integer aDerivative = theDerivative;
+  if (!myIsRational && myParams.Degree < theDerivative)
+    aDerivative = myParams.Degree;
+
+  // Factors to unnormalize the derivatives, the same for all the points
+  Standard_Real aFactors[4] = { 1.0, 1.0, 1.0, 1.0 };
+  for (Standard_Integer deriv = 1; deriv <= aDerivative; deriv++)
+    aFactors[deriv] = aFactors[deriv - 1] / myParams.SpanLength;
+
+  Standard_Real aTmpContainer[16];
+  for (Standard_Integer i = theParameters.Lower(); i <= theParameters.Upper(); ++i)
+  {
+    Standard_Real* aDerivArray = theDerivArray + (i - theParameters.Lower()) * aStride;
+    Standard_Real* aPntDeriv = myIsRational ? aTmpContainer : aDerivArray;
+    for (Standard_Integer ind = (aDerivative + 1) * aDimension; ind < aStride; ind++)
+      aPntDeriv[ind] = 0.0;
+
+    Standard_Real aNewParameter = myParams.PeriodicNormalization (theParameters.Value (i));
+    aNewParameter = (aNewParameter - myParams.SpanStart) / myParams.SpanLength;
+
+    PLib::EvalPolynomial(aNewParameter, aDerivative, myParams.Degree, aDimension,
+                         aPolesArray[0], aPntDeriv[0]);
+    for (Standard_Integer deriv = 1; deriv <= aDerivative; deriv++)
+    {
+      for (Standard_Integer ind = 0; ind < aDimension; ind++)
+        aPntDeriv[aDimension * deriv + ind] *= aFactors[deriv];
+    }
+
+    if (myIsRational) // calculate derivatives divided by weights derivatives
+      PLib::RationalDerivative(aDerivative, aDerivative, aDimension - 1, aPntDeriv[0], aDerivArray[0]);
+  }
+}
+
 
 void BSplCLib_Cache::D0(const Standard_Real& theParameter, gp_Pnt2d& thePoint) const
 {
@@ -270,3 +314,79 @@ void BSplCLib_Cache::D3(const Standard_Real& theParameter,
   theTorsion.SetCoord(aPntDeriv[aShift], aPntDeriv[aShift + 1], aPntDeriv[aShift + 2]);
 }
 
+
+void BSplCLib_Cache::D0(const TColStd_Array1OfReal& theParameters,
+                              TColgp_Array1OfPnt&   thePoints) const
+{
+  Standard_DimensionMismatch_Raise_if (theParameters.Length() != thePoints.Length(),
+                                       "BSplCLib_Cache::D0(), wrong length of array of points");
+
+  // the data of the span are the same for all the points
+  Standard_Real* aPolesArray = ConvertArray(myPolesWeights);
+  Standard_Real aPoint[4];
+  const Standard_Integer aDimension = myPolesWeights->RowLength(); // number of columns
+
+  for (Standard_Integer i = theParameters.Lower(); i <= theParameters.Upper(); ++i)
+  {
+    Standard_Real aNewParameter = myParams.PeriodicNormalization (theParameters.Value (i));
+    aNewParameter = (aNewParameter - myParams.SpanStart) / myParams.SpanLength;
+
+    PLib::NoDerivativeEvalPolynomial(aNewParameter, myParams.Degree,
+                                     aDimension, myParams.Degree * aDimension,
+                                     aPolesArray[0], aPoint[0]);
+
+    gp_Pnt& aResult = thePoints.ChangeValue (thePoints.Lower() + i - theParameters.Lower());
+    aResult.SetCoord(aPoint[0], aPoint[1], aPoint[2]);
+    if (myIsRational)
+      aResult.ChangeCoord().Divide(aPoint[3]);
+  }
+}
+
+void BSplCLib_Cache::D1(const TColStd_Array1OfReal& theParameters,
+                              TColgp_Array1OfPnt&   thePoints,
+                              TColgp_Array1OfVec&   theTangents) const
+{
+  Standard_DimensionMismatch_Raise_if (theParameters.Length() != thePoints.Length()
+                                    || theParameters.Length() != theTangents.Length(),
+                                       "BSplCLib_Cache::D1(), wrong length of array of results");
+
+  Standard_Integer aDimension = myPolesWeights->RowLength(); // number of columns
+  const Standard_Integer aStride = 2 * aDimension;
+  NCollection_LocalArray<Standard_Real> aPntDeriv (theParameters.Length() * aStride);
+  CalculateDerivatives(theParameters, 1, aPntDeriv);
+  if (myIsRational) // the size of each row was changed by PLib::RationalDerivative
+    aDimension -= 1;
+
+  for (Standard_Integer anIndex = 0; anIndex < theParameters.Length(); ++anIndex)
+  {
+    const Standard_Real* aDeriv = &aPntDeriv[anIndex * aStride];
+    thePoints  .ChangeValue (thePoints  .Lower() + anIndex).SetCoord(aDeriv[0], aDeriv[1], aDeriv[2]);
+    theTangents.ChangeValue (theTangents.Lower() + anIndex).SetCoord(aDeriv[aDimension], aDeriv[aDimension + 1], aDeriv[aDimension + 2]);
+  }
+}
+
+void BSplCLib_Cache::D2(const TColStd_Array1OfReal& theParameters,
+                              TColgp_Array1OfPnt&   thePoints,
+                              TColgp_Array1OfVec&   theTangents,
+                              TColgp_Array1OfVec&   theCurvatures) const
+{
+  Standard_DimensionMismatch_Raise_if (theParameters.Length() != thePoints.Length()
+                                    || theParameters.Length() != theTangents.Length()
+                                    || theParameters.Length() != theCurvatures.Length(),
+                                       "BSplCLib_Cache::D2(), wrong length of array of results");
+
+  Standard_Integer aDimension = myPolesWeights->RowLength(); // number of columns
+  const Standard_Integer aStride = 3 * aDimension;
+  NCollection_LocalArray<Standard_Real> aPntDeriv (theParameters.Length() * aStride);
+  CalculateDerivatives(theParameters, 2, aPntDeriv);
+  if (myIsRational) // the size of each row was changed by PLib::RationalDerivative
+    aDimension -= 1;
+
+  for (Standard_Integer anIndex = 0; anIndex < theParameters.Length(); ++anIndex)
+  {
+    const Standard_Real* aDeriv = &aPntDeriv[anIndex * aStride];
+    thePoints    .ChangeValue (thePoints    .Lower() + anIndex).SetCoord(aDeriv[0], aDeriv[1], aDeriv[2]);
+    theTangents  .ChangeValue (theTangents  .Lower() + anIndex).SetCoord(aDeriv[aDimension], aDeriv[aDimension + 1], aDeriv[aDimension + 2]);
+    theCurvatures.ChangeValue (theCurvatures.Lower() + anIndex).SetCoord(aDeriv[aDimension<<1], aDeriv[(aDimension<<1) + 1], aDeriv[(aDimension<<1) + 2]);
+  }
+}
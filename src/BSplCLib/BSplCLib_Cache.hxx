@@ -16,6 +16,8 @@
 
 #include <BSplCLib_CacheParams.hxx>
 #include <TColStd_HArray2OfReal.hxx>
+#include <TColgp_Array1OfPnt.hxx>
+#include <TColgp_Array1OfVec.hxx>
 
 //! \brief A cache class for Bezier and B-spline curves.
 //!
@@ -117,6 +119,35 @@ public:
                                 gp_Vec&        theCurvature,
                                 gp_Vec&        theTorsion) const;
 
+  //! Calculates the points on the 3D curve for the array of parameters.
+  //! All the parameters should be placed in the span of the cache (see IsCacheValid()).
+  //! The results are the same as the ones of D0() called for each point,
+  //! while the data of the span are taken once for all the points.
+  //! \param[in]  theParameters parameters of calculation of the values
+  //! \param[out] thePoints     the results of calculation (the points on the curve)
+  Standard_EXPORT void D0(const TColStd_Array1OfReal& theParameters,
+                                TColgp_Array1OfPnt&   thePoints) const;
+
+  //! Calculates the points on the 3D curve and the first derivatives for the array of parameters.
+  //! All the parameters should be placed in the span of the cache (see IsCacheValid()).
+  //! \param[in]  theParameters parameters of calculation of the values
+  //! \param[out] thePoints     the points on the curve
+  //! \param[out] theTangents   tangent vectors (first derivatives) in the calculated points
+  Standard_EXPORT void D1(const TColStd_Array1OfReal& theParameters,
+                                TColgp_Array1OfPnt&   thePoints,
+                                TColgp_Array1OfVec&   theTangents) const;
+
+  //! Calculates the points on the 3D curve and two derivatives for the array of parameters.
+  //! All the parameters should be placed in the span of the cache (see IsCacheValid()).
+  //! \param[in]  theParameters parameters of calculation of the values
+  //! \param[out] thePoints     the points on the curve
+  //! \param[out] theTangents   tangent vectors (1st derivatives) in the calculated points
+  //! \param[out] theCurvatures curvature vectors (2nd derivatives) in the calculated points
+  Standard_EXPORT void D2(const TColStd_Array1OfReal& theParameters,
+                                TColgp_Array1OfPnt&   thePoints,
+                                TColgp_Array1OfVec&   theTangents,
+                                TColgp_Array1OfVec&   theCurvatures) const;
+
 
   DEFINE_STANDARD_RTTIEXT(BSplCLib_Cache,Standard_Transient)
 
@@ -131,6 +162,18 @@ protected:
                            const Standard_Integer& theDerivative, 
                                  Standard_Real&    theDerivArray) const;
 
+  //! Fills arrays of derivatives in the selected points of the curve.
+  //! The data of the span and the scale factors of the derivatives are prepared
+  //! once for all the points; the results are the same as the ones of
+  //! CalculateDerivative() called for each point.
+  //! \param[in]  theParameters parameters of the calculation
+  //! \param[in]  theDerivative maximal derivative to be calculated
+  //! \param[out] theDerivArray result arrays of derivatives, one after another, each of
+  //!                           size (theDerivative+1)*(PntDim+1) as for CalculateDerivative()
+  void CalculateDerivatives(const TColStd_Array1OfReal& theParameters,
+                            const Standard_Integer      theDerivative,
+                                  Standard_Real*        theDerivArray) const;
+
   // copying is prohibited
   BSplCLib_Cache (const BSplCLib_Cache&);
   void operator = (const BSplCLib_Cache&);
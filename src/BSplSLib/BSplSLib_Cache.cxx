@@ -15,6 +15,7 @@
 #include <BSplSLib.hxx>
 
 #include <NCollection_LocalArray.hxx>
+#include <Standard_DimensionMismatch.hxx>
 
 #include <TColgp_HArray2OfPnt.hxx>
 #include <TColStd_HArray2OfReal.hxx>
@@ -104,6 +105,13 @@ void BSplSLib_Cache::D0(const Standard_Real& theU,
   aNewU = (aNewU - aSpanStartU) / aSpanLengthU;
   aNewV = (aNewV - aSpanStartV) / aSpanLengthV;
 
+  localD0 (aNewU, aNewV, thePoint);
+}
+
+void BSplSLib_Cache::localD0 (const Standard_Real theLocalU,
+                              const Standard_Real theLocalV,
+                              gp_Pnt&             thePoint) const
+{
   Standard_Real* aPolesArray = ConvertArray(myPolesWeights);
   Standard_Real aPoint[4];
 
@@ -114,13 +122,13 @@ void BSplSLib_Cache::D0(const Standard_Real& theU,
   Standard_Real aParameters[2];
   if (myParamsU.Degree > myParamsV.Degree)
   {
-    aParameters[0] = aNewV;
-    aParameters[1] = aNewU;
+    aParameters[0] = theLocalV;
+    aParameters[1] = theLocalU;
   }
   else
   {
-    aParameters[0] = aNewU;
-    aParameters[1] = aNewV;
+    aParameters[0] = theLocalU;
+    aParameters[1] = theLocalV;
   }
 
   NCollection_LocalArray<Standard_Real> aTransientCoeffs(aCacheCols); // array for intermediate results
@@ -163,6 +171,17 @@ void BSplSLib_Cache::D1(const Standard_Real& theU,
   aNewU = (aNewU - aSpanStartU) * anInvU;
   aNewV = (aNewV - aSpanStartV) * anInvV;
 
+  localD1 (aNewU, aNewV, anInvU, anInvV, thePoint, theTangentU, theTangentV);
+}
+
+void BSplSLib_Cache::localD1 (const Standard_Real theLocalU,
+                              const Standard_Real theLocalV,
+                              const Standard_Real theInvU,
+                              const Standard_Real theInvV,
+                              gp_Pnt&             thePoint,
+                              gp_Vec&             theTangentU,
+                              gp_Vec&             theTangentV) const
+{
   Standard_Real* aPolesArray = ConvertArray(myPolesWeights);
   Standard_Real aPntDeriv[16]; // result storage (point and derivative coordinates)
   for (Standard_Integer i = 0; i< 16; i++) aPntDeriv[i] = 0.0;
@@ -175,13 +194,13 @@ void BSplSLib_Cache::D1(const Standard_Real& theU,
   Standard_Real aParameters[2];
   if (myParamsU.Degree > myParamsV.Degree)
   {
-    aParameters[0] = aNewV;
-    aParameters[1] = aNewU;
+    aParameters[0] = theLocalV;
+    aParameters[1] = theLocalU;
   }
   else
   {
-    aParameters[0] = aNewU;
-    aParameters[1] = aNewV;
+    aParameters[0] = theLocalU;
+    aParameters[1] = theLocalV;
   }
 
   NCollection_LocalArray<Standard_Real> aTransientCoeffs(aCacheCols<<1); // array for intermediate results
@@ -219,8 +238,8 @@ void BSplSLib_Cache::D1(const Standard_Real& theU,
     Standard_Integer aShift = aDimension<<1;
     theTangentV.SetCoord(aResult[aShift], aResult[aShift + 1], aResult[aShift + 2]);
   }
-  theTangentU.Multiply(anInvU);
-  theTangentV.Multiply(anInvV);
+  theTangentU.Multiply(theInvU);
+  theTangentV.Multiply(theInvV);
 }
 
 
@@ -249,6 +268,21 @@ void BSplSLib_Cache::D2(const Standard_Real& theU,
   aNewU = (aNewU - aSpanStartU) * anInvU;
   aNewV = (aNewV - aSpanStartV) * anInvV;
 
+  localD2 (aNewU, aNewV, anInvU, anInvV, thePoint, theTangentU, theTangentV,
+           theCurvatureU, theCurvatureV, theCurvatureUV);
+}
+
+void BSplSLib_Cache::localD2 (const Standard_Real theLocalU,
+                              const Standard_Real theLocalV,
+                              const Standard_Real theInvU,
+                              const Standard_Real theInvV,
+                              gp_Pnt&             thePoint,
+                              gp_Vec&             theTangentU,
+                              gp_Vec&             theTangentV,
+                              gp_Vec&             theCurvatureU,
+                              gp_Vec&             theCurvatureV,
+                              gp_Vec&             theCurvatureUV) const
+{
   Standard_Real* aPolesArray = ConvertArray(myPolesWeights);
   Standard_Real aPntDeriv[36]; // result storage (point and derivative coordinates)
   for (Standard_Integer i = 0; i < 36; i++) aPntDeriv[i] = 0.0;
@@ -261,13 +295,13 @@ void BSplSLib_Cache::D2(const Standard_Real& theU,
   Standard_Real aParameters[2];
   if (myParamsU.Degree > myParamsV.Degree)
   {
-    aParameters[0] = aNewV;
-    aParameters[1] = aNewU;
+    aParameters[0] = theLocalV;
+    aParameters[1] = theLocalU;
   }
   else
   {
-    aParameters[0] = aNewU;
-    aParameters[1] = aNewV;
+    aParameters[0] = theLocalU;
+    aParameters[1] = theLocalV;
   }
 
   NCollection_LocalArray<Standard_Real> aTransientCoeffs(3 * aCacheCols); // array for intermediate results
@@ -333,10 +367,102 @@ void BSplSLib_Cache::D2(const Standard_Real& theU,
     aShift += (aDimension << 1);
     theCurvatureV.SetCoord(aResult[aShift], aResult[aShift + 1], aResult[aShift + 2]);
   }
-  theTangentU.Multiply(anInvU);
-  theTangentV.Multiply(anInvV);
-  theCurvatureU.Multiply(anInvU * anInvU);
-  theCurvatureV.Multiply(anInvV * anInvV);
-  theCurvatureUV.Multiply(anInvU * anInvV);
+  theTangentU.Multiply(theInvU);
+  theTangentV.Multiply(theInvV);
+  theCurvatureU.Multiply(theInvU * theInvU);
+  theCurvatureV.Multiply(theInvV * theInvV);
+  theCurvatureUV.Multiply(theInvU * theInvV);
+}
+
+
+void BSplSLib_Cache::D0 (const TColgp_Array1OfPnt2d& theParams,
+                         TColgp_Array1OfPnt&         thePoints) const
+{
+  Standard_DimensionMismatch_Raise_if (theParams.Length() != thePoints.Length(),
+                                       "BSplSLib_Cache::D0(), wrong length of array of points");
+
+  // parameters of the span are the same for all the points
+  const Standard_Real aSpanLengthU = 0.5 * myParamsU.SpanLength;
+  const Standard_Real aSpanStartU = myParamsU.SpanStart + aSpanLengthU;
+  const Standard_Real aSpanLengthV = 0.5 * myParamsV.SpanLength;
+  const Standard_Real aSpanStartV = myParamsV.SpanStart + aSpanLengthV;
+
+  for (Standard_Integer i = theParams.Lower(); i <= theParams.Upper(); ++i)
+  {
+    const gp_Pnt2d& aParam = theParams.Value (i);
+    const Standard_Real aNewU = (myParamsU.PeriodicNormalization (aParam.X()) - aSpanStartU) / aSpanLengthU;
+    const Standard_Real aNewV = (myParamsV.PeriodicNormalization (aParam.Y()) - aSpanStartV) / aSpanLengthV;
+    localD0 (aNewU, aNewV, thePoints.ChangeValue (thePoints.Lower() + i - theParams.Lower()));
+  }
 }
 
+void BSplSLib_Cache::D1 (const TColgp_Array1OfPnt2d& theParams,
+                         TColgp_Array1OfPnt&         thePoints,
+                         TColgp_Array1OfVec&         theTangentsU,
+                         TColgp_Array1OfVec&         theTangentsV) const
+{
+  Standard_DimensionMismatch_Raise_if (theParams.Length() != thePoints.Length()
+                                    || theParams.Length() != theTangentsU.Length()
+                                    || theParams.Length() != theTangentsV.Length(),
+                                       "BSplSLib_Cache::D1(), wrong length of array of results");
+
+  // parameters of the span are the same for all the points
+  const Standard_Real aSpanLengthU = 0.5 * myParamsU.SpanLength;
+  const Standard_Real aSpanStartU = myParamsU.SpanStart + aSpanLengthU;
+  const Standard_Real aSpanLengthV = 0.5 * myParamsV.SpanLength;
+  const Standard_Real aSpanStartV = myParamsV.SpanStart + aSpanLengthV;
+  const Standard_Real anInvU = 1.0 / aSpanLengthU;
+  const Standard_Real anInvV = 1.0 / aSpanLengthV;
+
+  for (Standard_Integer i = theParams.Lower(); i <= theParams.Upper(); ++i)
+  {
+    const gp_Pnt2d& aParam = theParams.Value (i);
+    const Standard_Real aNewU = (myParamsU.PeriodicNormalization (aParam.X()) - aSpanStartU) * anInvU;
+    const Standard_Real aNewV = (myParamsV.PeriodicNormalization (aParam.Y()) - aSpanStartV) * anInvV;
+    const Standard_Integer anIndex = i - theParams.Lower();
+    localD1 (aNewU, aNewV, anInvU, anInvV,
+             thePoints   .ChangeValue (thePoints   .Lower() + anIndex),
+             theTangentsU.ChangeValue (theTangentsU.Lower() + anIndex),
+             theTangentsV.ChangeValue (theTangentsV.Lower() + anIndex));
+  }
+}
+
+void BSplSLib_Cache::D2 (const TColgp_Array1OfPnt2d& theParams,
+                         TColgp_Array1OfPnt&         thePoints,
+                         TColgp_Array1OfVec&         theTangentsU,
+                         TColgp_Array1OfVec&         theTangentsV,
+                         TColgp_Array1OfVec&         theCurvaturesU,
+                         TColgp_Array1OfVec&         theCurvaturesV,
+                         TColgp_Array1OfVec&         theCurvaturesUV) const
+{
+  Standard_DimensionMismatch_Raise_if (theParams.Length() != thePoints.Length()
+                                    || theParams.Length() != theTangentsU.Length()
+                                    || theParams.Length() != theTangentsV.Length()
+                                    || theParams.Length() != theCurvaturesU.Length()
+                                    || theParams.Length() != theCurvaturesV.Length()
+                                    || theParams.Length() != theCurvaturesUV.Length(),
+                                       "BSplSLib_Cache::D2(), wrong length of array of results");
+
+  // parameters of the span are the same for all the points
+  const Standard_Real aSpanLengthU = 0.5 * myParamsU.SpanLength;
+  const Standard_Real aSpanStartU = myParamsU.SpanStart + aSpanLengthU;
+  const Standard_Real aSpanLengthV = 0.5 * myParamsV.SpanLength;
+  const Standard_Real aSpanStartV = myParamsV.SpanStart + aSpanLengthV;
+  const Standard_Real anInvU = 1.0 / aSpanLengthU;
+  const Standard_Real anInvV = 1.0 / aSpanLengthV;
+
+  for (Standard_Integer i = theParams.Lower(); i <= theParams.Upper(); ++i)
+  {
+    const gp_Pnt2d& aParam = theParams.Value (i);
+    const Standard_Real aNewU = (myParamsU.PeriodicNormalization (aParam.X()) - aSpanStartU) * anInvU;
+    const Standard_Real aNewV = (myParamsV.PeriodicNormalization (aParam.Y()) - aSpanStartV) * anInvV;
+    const Standard_Integer anIndex = i - theParams.Lower();
+    localD2 (aNewU, aNewV, anInvU, anInvV,
+             thePoints      .ChangeValue (thePoints      .Lower() + anIndex),
+             theTangentsU   .ChangeValue (theTangentsU   .Lower() + anIndex),
+             theTangentsV   .ChangeValue (theTangentsV   .Lower() + anIndex),
+             theCurvaturesU .ChangeValue (theCurvaturesU .Lower() + anIndex),
+             theCurvaturesV .ChangeValue (theCurvaturesV .Lower() + anIndex),
+             theCurvaturesUV.ChangeValue (theCurvaturesUV.Lower() + anIndex));
+  }
+}
@@ -16,6 +16,9 @@
 
 #include <TColStd_HArray2OfReal.hxx>
 #include <TColStd_Array2OfReal.hxx>
+#include <TColgp_Array1OfPnt.hxx>
+#include <TColgp_Array1OfPnt2d.hxx>
+#include <TColgp_Array1OfVec.hxx>
 
 #include <BSplCLib_CacheParams.hxx>
 
@@ -103,9 +106,75 @@ public:
                                 gp_Vec&        theCurvatureV, 
                                 gp_Vec&        theCurvatureUV) const;
 
+  //! Calculates the points on the surface for the array of parameters.
+  //! All the parameters should be placed in the span of the cache (see IsCacheValid()).
+  //! The results are the same as the ones of D0() called for each point,
+  //! while the data of the span are computed once for all the points.
+  //! \param[in]  theParams  parameters (U,V) of the points
+  //! \param[out] thePoints  the results of calculation (the points on the surface)
+  Standard_EXPORT void D0 (const TColgp_Array1OfPnt2d& theParams,
+                           TColgp_Array1OfPnt&         thePoints) const;
+
+  //! Calculates the points on the surface and the first derivatives for the array of parameters.
+  //! All the parameters should be placed in the span of the cache (see IsCacheValid()).
+  //! \param[in]  theParams     parameters (U,V) of the points
+  //! \param[out] thePoints     the points on the surface
+  //! \param[out] theTangentsU  tangent vectors along U axis in the calculated points
+  //! \param[out] theTangentsV  tangent vectors along V axis in the calculated points
+  Standard_EXPORT void D1 (const TColgp_Array1OfPnt2d& theParams,
+                           TColgp_Array1OfPnt&         thePoints,
+                           TColgp_Array1OfVec&         theTangentsU,
+                           TColgp_Array1OfVec&         theTangentsV) const;
+
+  //! Calculates the points on the surface and the derivatives till second order for the array of parameters.
+  //! All the parameters should be placed in the span of the cache (see IsCacheValid()).
+  //! \param[in]  theParams        parameters (U,V) of the points
+  //! \param[out] thePoints        the points on the surface
+  //! \param[out] theTangentsU     tangent vectors along U axis in the calculated points
+  //! \param[out] theTangentsV     tangent vectors along V axis in the calculated points
+  //! \param[out] theCurvaturesU   2nd derivatives on U in the calculated points
+  //! \param[out] theCurvaturesV   2nd derivatives on V in the calculated points
+  //! \param[out] theCurvaturesUV  2nd mixed derivatives on U and V in the calculated points
+  Standard_EXPORT void D2 (const TColgp_Array1OfPnt2d& theParams,
+                           TColgp_Array1OfPnt&         thePoints,
+                           TColgp_Array1OfVec&         theTangentsU,
+                           TColgp_Array1OfVec&         theTangentsV,
+                           TColgp_Array1OfVec&         theCurvaturesU,
+                           TColgp_Array1OfVec&         theCurvaturesV,
+                           TColgp_Array1OfVec&         theCurvaturesUV) const;
+
 
   DEFINE_STANDARD_RTTIEXT(BSplSLib_Cache,Standard_Transient)
 
+private:
+  //! Calculates the point on the surface for the parameters normalized in the span
+  void localD0 (const Standard_Real theLocalU,
+                const Standard_Real theLocalV,
+                gp_Pnt&             thePoint) const;
+
+  //! Calculates the point and the first derivatives for the parameters normalized in the span;
+  //! the derivatives are scaled by the inverted half-lengths of the span
+  void localD1 (const Standard_Real theLocalU,
+                const Standard_Real theLocalV,
+                const Standard_Real theInvU,
+                const Standard_Real theInvV,
+                gp_Pnt&             thePoint,
+                gp_Vec&             theTangentU,
+                gp_Vec&             theTangentV) const;
+
+  //! Calculates the point and the derivatives till second order for the parameters normalized in the span;
+  //! the derivatives are scaled by the inverted half-lengths of the span
+  void localD2 (const Standard_Real theLocalU,
+                const Standard_Real theLocalV,
+                const Standard_Real theInvU,
+                const Standard_Real theInvV,
+                gp_Pnt&             thePoint,
+                gp_Vec&             theTangentU,
+                gp_Vec&             theTangentV,
+                gp_Vec&             theCurvatureU,
+                gp_Vec&             theCurvatureV,
+                gp_Vec&             theCurvatureUV) const;
+
 private:
   // copying is prohibited
   BSplSLib_Cache (const BSplSLib_Cache&);
@@ -100,6 +100,12 @@ public:
   //! Raised if the continuity of the current interval
   //! is not C2.
   Standard_EXPORT void D2 (const Standard_Real U, gp_Pnt& P, gp_Vec& V1, gp_Vec& V2) const Standard_OVERRIDE;
+
+  //! Computes the points and the derivatives for arrays of parameters
+  //! by the default implementation of Adaptor3d_Curve.
+  using Adaptor3d_Curve::D0;
+  using Adaptor3d_Curve::D1;
+  using Adaptor3d_Curve::D2;
   
 
   //! Returns the point P of parameter U, the first, the second
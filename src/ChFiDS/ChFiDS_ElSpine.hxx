@@ -90,6 +90,12 @@ public:
   Standard_EXPORT virtual void D1 (const Standard_Real AbsC, gp_Pnt& P, gp_Vec& V1) const Standard_OVERRIDE;
   
   Standard_EXPORT virtual void D2 (const Standard_Real AbsC, gp_Pnt& P, gp_Vec& V1, gp_Vec& V2) const Standard_OVERRIDE;
+
+  //! Computes the points and the derivatives for arrays of parameters
+  //! by the default implementation of Adaptor3d_Curve.
+  using Adaptor3d_Curve::D0;
+  using Adaptor3d_Curve::D1;
+  using Adaptor3d_Curve::D2;
   
   Standard_EXPORT virtual void D3 (const Standard_Real AbsC, gp_Pnt& P, gp_Vec& V1, gp_Vec& V2, gp_Vec& V3) const Standard_OVERRIDE;
   
@@ -22,8 +22,6 @@
 #include <gp_Pnt.hxx>
 #include <gp_Pnt2d.hxx>
 
-static Standard_Real uinf,vinf,usup,vsup;
-
 Standard_Integer Contap_HContTool::NbSamplesV
 (const Handle(Adaptor3d_Surface)& S,
  const Standard_Real ,
@@ -122,8 +120,13 @@ Standard_Integer Contap_HContTool::NbSamplesU
   return(nbs);
 }
 
-Standard_Integer Contap_HContTool::NbSamplePoints
-(const Handle(Adaptor3d_Surface)& S)
+// Computes the sampled domain of the surface, infinite bounds
+// are replaced by finite ones.
+static void Contap_HContTool_Bounds (const Handle(Adaptor3d_Surface)& S,
+                                     Standard_Real& uinf,
+                                     Standard_Real& usup,
+                                     Standard_Real& vinf,
+                                     Standard_Real& vsup)
 {
   uinf = S->FirstUParameter();
   usup = S->LastUParameter();
@@ -161,6 +164,13 @@ Standard_Integer Contap_HContTool::NbSamplePoints
   else if (vsup == RealLast()) {
     vsup = vinf + 2.e5;
   }
+}
+
+Standard_Integer Contap_HContTool::NbSamplePoints
+(const Handle(Adaptor3d_Surface)& S)
+{
+  Standard_Real uinf, usup, vinf, vsup;
+  Contap_HContTool_Bounds(S, uinf, usup, vinf, vsup);
   if(S->GetType() ==   GeomAbs_BSplineSurface) { 
     Standard_Integer m = (NbSamplesU(S,uinf,usup)/3) * (NbSamplesV(S,vinf,vsup)/3);
     if(m>5) return(m); 
@@ -175,6 +185,8 @@ void Contap_HContTool::SamplePoint (const Handle(Adaptor3d_Surface)& S,
                                     Standard_Real& U,
                                     Standard_Real& V )
 {
+  Standard_Real uinf, usup, vinf, vsup;
+  Contap_HContTool_Bounds(S, uinf, usup, vinf, vsup);
   if(S->GetType() ==   GeomAbs_BSplineSurface) {
     Standard_Integer nbIntU = NbSamplesU(S,uinf,usup)/3;
     Standard_Integer nbIntV = NbSamplesV(S,vinf,vsup)/3;
@@ -259,6 +259,29 @@ void Extrema_ExtPS::Initialize (const Adaptor3d_Surface& theS,
   myExtPRevS.Nullify();
 }
 
+//=======================================================================
+//function : Initialize
+//purpose  : 
+//=======================================================================
+
+void Extrema_ExtPS::Initialize (const Adaptor3d_Surface& theS,
+                                const Extrema_ExtPS&     theOther)
+{
+  myS = &theS;
+  myuinf = theOther.myuinf;
+  myusup = theOther.myusup;
+  myvinf = theOther.myvinf;
+  myvsup = theOther.myvsup;
+  mytolu = theOther.mytolu;
+  mytolv = theOther.mytolv;
+  mytype = myS->GetType();
+
+  myExtPS.Initialize (*myS, theOther.myExtPS);
+
+  myExtPExtS.Nullify();
+  myExtPRevS.Nullify();
+}
+
 //=======================================================================
 //function : Perform
 //purpose  : 
@@ -70,6 +70,13 @@ public:
   
   //! Initializes the fields of the algorithm.
   Standard_EXPORT void Initialize (const Adaptor3d_Surface& S, const Standard_Real Uinf, const Standard_Real Usup, const Standard_Real Vinf, const Standard_Real Vsup, const Standard_Real TolU, const Standard_Real TolV);
+
+  //! Initializes the algorithm with the bounds, tolerances, search flag
+  //! and algorithm of <theOther> for the surface <S>, which should be
+  //! the same as (or a copy of) the surface of <theOther>.
+  //! The grid of sample points of the general surface already built
+  //! by <theOther> is reused (see Extrema_GenExtPS::Initialize()).
+  Standard_EXPORT void Initialize (const Adaptor3d_Surface& S, const Extrema_ExtPS& theOther);
   
   //! Computes the distances.
   //! An exception is raised if the fields have not been
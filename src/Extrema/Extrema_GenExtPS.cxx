@@ -319,6 +319,35 @@ void Extrema_GenExtPS::Initialize(const Adaptor3d_Surface& S,
   myInit = Standard_False;
 }
 
+// =======================================================================
+// function : Initialize
+// purpose  :
+// =======================================================================
+void Extrema_GenExtPS::Initialize (const Adaptor3d_Surface& S,
+                                   const Extrema_GenExtPS&  theOther)
+{
+  myFlag = theOther.myFlag;
+  myAlgo = theOther.myAlgo;
+  Initialize (S, theOther.myusample, theOther.myvsample,
+              theOther.myumin, theOther.myusup, theOther.myvmin, theOther.myvsup,
+              theOther.mytolu, theOther.mytolv);
+  if (!theOther.myInit || myAlgo != Extrema_ExtAlgo_Grad)
+  {
+    return;
+  }
+
+  // the parameters and the nodes of the grid are only read by Perform(),
+  // while the distances stored in the nodes are recomputed for each point
+  myUParams = theOther.myUParams;
+  myVParams = theOther.myVParams;
+  myPoints.Resize (0, myusample + 1, 0, myvsample + 1, false);
+  myPoints.Assign (theOther.myPoints);
+  myFacePntParams .Resize (0, myusample,     0, myvsample, false);
+  myUEdgePntParams.Resize (1, myusample - 1, 1, myvsample, false);
+  myVEdgePntParams.Resize (1, myusample,     1, myvsample - 1, false);
+  myInit = Standard_True;
+}
+
 inline static void fillParams(const TColStd_Array1OfReal& theKnots,
                               Standard_Integer theDegree,
                               Standard_Real theParMin,
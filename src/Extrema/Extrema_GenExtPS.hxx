@@ -74,6 +74,14 @@ public:
   Standard_EXPORT void Initialize (const Adaptor3d_Surface& S, const Standard_Integer NbU, const Standard_Integer NbV, const Standard_Real TolU, const Standard_Real TolV);
   
   Standard_EXPORT void Initialize (const Adaptor3d_Surface& S, const Standard_Integer NbU, const Standard_Integer NbV, const Standard_Real Umin, const Standard_Real Usup, const Standard_Real Vmin, const Standard_Real Vsup, const Standard_Real TolU, const Standard_Real TolV);
+
+  //! Initializes the algorithm with the sampling, bounds, tolerances,
+  //! search flag and algorithm of <theOther> for the surface <S>,
+  //! which should be the same as (or a copy of) the surface of <theOther>.
+  //! The grid of sample points already built by <theOther> is copied,
+  //! so that the surface is not evaluated again in the grid nodes
+  //! (e.g. when the points are projected by several algorithms in parallel threads).
+  Standard_EXPORT void Initialize (const Adaptor3d_Surface& S, const Extrema_GenExtPS& theOther);
   
   //! the algorithm is done with the point P.
   //! An exception is raised if the fields have not
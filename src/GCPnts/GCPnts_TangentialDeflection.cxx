@@ -27,6 +27,7 @@
 #include <math_PSO.hxx>
 #include <Precision.hxx>
 #include <Standard_ConstructionError.hxx>
+#include <TColgp_Array1OfPnt.hxx>
 #include <TColStd_Array1OfReal.hxx>
 
 namespace
@@ -44,6 +45,11 @@ namespace
     C.D2 (U, P, V1, V2);
   }
 
+  inline static void D0 (const Adaptor3d_Curve& C, const TColStd_Array1OfReal& U, TColgp_Array1OfPnt& P)
+  {
+    C.D0 (U, P);
+  }
+
   static void D0 (const Adaptor2d_Curve2d& C, const Standard_Real U, gp_Pnt& PP)
   {
     Standard_Real X, Y;
@@ -53,6 +59,14 @@ namespace
     PP.SetCoord (X, Y, 0.0);
   }
 
+  static void D0 (const Adaptor2d_Curve2d& C, const TColStd_Array1OfReal& U, TColgp_Array1OfPnt& PP)
+  {
+    for (Standard_Integer i = U.Lower(); i <= U.Upper(); ++i)
+    {
+      D0 (C, U (i), PP (PP.Lower() + i - U.Lower()));
+    }
+  }
+
   static void D2 (const Adaptor2d_Curve2d& C, const Standard_Real U,
                   gp_Pnt& PP, gp_Vec& VV1, gp_Vec& VV2)
   {
@@ -312,15 +326,22 @@ void GCPnts_TangentialDeflection::PerformLinear (const TheCurve& theC)
   myPoints    .Append (P);
   if (myMinNbPnts > 2)
   {
+    // the inner points are evaluated at once
+    TColStd_Array1OfReal aParams (2, myMinNbPnts - 1);
+    TColgp_Array1OfPnt   aPoints (2, myMinNbPnts - 1);
     Standard_Real Du = (myLastU - myFirstu) / myMinNbPnts;
     Standard_Real U = myFirstu + Du;
     for (Standard_Integer i = 2; i < myMinNbPnts; i++)
     {
-      D0 (theC, U, P);
-      myParameters.Append (U);
-      myPoints    .Append (P);
+      aParams (i) = U;
       U += Du;
     }
+    D0 (theC, aParams, aPoints);
+    for (Standard_Integer i = 2; i < myMinNbPnts; i++)
+    {
+      myParameters.Append (aParams (i));
+      myPoints    .Append (aPoints (i));
+    }
   }
   D0 (theC, myLastU, P);
   myParameters.Append (myLastU);
@@ -564,6 +585,10 @@ void GCPnts_TangentialDeflection::PerformCurve (const TheCurve& theC)
       }
       ////
       Standard_Real param = 0.;
+      // the points of each interval are evaluated at once,
+      // for B-spline and Bezier curves the interval is a span of the curve
+      TColStd_Array1OfReal aParams (1, NbPoints);
+      TColgp_Array1OfPnt   aPoints (1, NbPoints);
       for (i = 1; i <= NbInterv && IsLine; ++i)
       {
         // Avoid usage intervals out of [myFirstu, myLastU].
@@ -586,10 +611,15 @@ void GCPnts_TangentialDeflection::PerformCurve (const TheCurve& theC)
         }
 
         const Standard_Real delta = (Intervs(i+1) - Intervs(i))/NbPoints;
+        for (j = 1; j <= NbPoints; ++j)
+        {
+          aParams (j) = Intervs(i) + j*delta;
+        }
+        D0 (theC, aParams, aPoints);
         for (j = 1; j <= NbPoints && IsLine; ++j)
         {
-          param = Intervs(i) + j*delta;
-          D0 (theC, param, MiddlePoint);
+          param = aParams (j);
+          MiddlePoint = aPoints (j);
           V2 = (MiddlePoint.XYZ() - CurrentPoint.XYZ());
           L2 = V2.Modulus ();
           if (L2 > LTol)
@@ -18,10 +18,98 @@
 #include <Extrema_ExtPS.hxx>
 #include <GeomAPI_ProjectPointOnSurf.hxx>
 #include <gp_Pnt.hxx>
+#include <OSD_ThreadPool.hxx>
 #include <Precision.hxx>
+#include <Standard_DimensionMismatch.hxx>
 #include <Standard_OutOfRange.hxx>
 #include <StdFail_NotDone.hxx>
 
+//=======================================================================
+//function : nearestSolution
+//purpose  : Returns the distance to the nearest solution and its parameters
+//=======================================================================
+static Standard_Real nearestSolution (const Extrema_ExtPS& theExtPS,
+                                      gp_Pnt2d& theParams)
+{
+  if (!theExtPS.IsDone() || theExtPS.NbExt() == 0)
+  {
+    return -1.0;
+  }
+
+  Standard_Integer anIndex = 1;
+  Standard_Real aDist2Min = theExtPS.SquareDistance (1);
+  for (Standard_Integer i = 2; i <= theExtPS.NbExt(); i++)
+  {
+    const Standard_Real aDist2 = theExtPS.SquareDistance (i);
+    if (aDist2 < aDist2Min)
+    {
+      aDist2Min = aDist2;
+      anIndex = i;
+    }
+  }
+
+  Standard_Real aU = 0.0, aV = 0.0;
+  theExtPS.Point (anIndex).Parameter (aU, aV);
+  theParams.SetCoord (aU, aV);
+  return sqrt (aDist2Min);
+}
+
+//=======================================================================
+//class    : GeomAPI_ProjectPointOnSurfFunctor
+//purpose  : Projects the points in parallel threads; the surface adaptor
+//           caches the evaluated span and the extrema algorithm keeps
+//           the state of the current point, so that each thread uses
+//           its own copies of them initialized by the main algorithm
+//=======================================================================
+class GeomAPI_ProjectPointOnSurfFunctor
+{
+public:
+  GeomAPI_ProjectPointOnSurfFunctor (const GeomAdaptor_Surface& theSurface,
+                                     const Extrema_ExtPS& theExtPS,
+                                     NCollection_Array1<Handle(Adaptor3d_Surface)>& theSurfaces,
+                                     NCollection_Array1<Extrema_ExtPS>& theExtPSs,
+                                     const TColgp_Array1OfPnt& thePoints,
+                                     TColgp_Array1OfPnt2d& theParams,
+                                     TColStd_Array1OfReal& theDistances)
+  : mySurface (theSurface),
+    myExtPS (theExtPS),
+    mySurfaces (theSurfaces),
+    myExtPSs (theExtPSs),
+    myPoints (thePoints),
+    myParams (theParams),
+    myDistances (theDistances)
+  {}
+
+  void operator() (int theThreadIndex, int theIndex) const
+  {
+    Handle(Adaptor3d_Surface)& aSurface = mySurfaces.ChangeValue (theThreadIndex);
+    Extrema_ExtPS& anExtPS = myExtPSs.ChangeValue (theThreadIndex);
+    if (aSurface.IsNull())
+    {
+      aSurface = mySurface.ShallowCopy();
+      anExtPS.Initialize (*aSurface, myExtPS);
+    }
+
+    anExtPS.Perform (myPoints.Value (theIndex));
+    const Standard_Integer anOffset = theIndex - myPoints.Lower();
+    myDistances.ChangeValue (myDistances.Lower() + anOffset) =
+      nearestSolution (anExtPS, myParams.ChangeValue (myParams.Lower() + anOffset));
+  }
+
+private:
+  GeomAPI_ProjectPointOnSurfFunctor& operator= (const GeomAPI_ProjectPointOnSurfFunctor&);
+
+private:
+  const GeomAdaptor_Surface& mySurface;
+  const Extrema_ExtPS& myExtPS;
+  NCollection_Array1<Handle(Adaptor3d_Surface)>& mySurfaces;
+  NCollection_Array1<Extrema_ExtPS>& myExtPSs;
+  const TColgp_Array1OfPnt& myPoints;
+  TColgp_Array1OfPnt2d& myParams;
+  TColStd_Array1OfReal& myDistances;
+};
+
+
 //=======================================================================
 //function : GeomAPI_ProjectPointOnSurf
 //purpose  : 
@@ -257,6 +345,56 @@ GeomAPI_ProjectPointOnSurf::GeomAPI_ProjectPointOnSurf()
   myExtPS.Perform(P);
   Init ();
 }
+//=======================================================================
+//function : Perform
+//purpose  : 
+//=======================================================================
+Standard_Integer GeomAPI_ProjectPointOnSurf::Perform (const TColgp_Array1OfPnt& thePoints,
+                                                      TColgp_Array1OfPnt2d& theParams,
+                                                      TColStd_Array1OfReal& theDistances,
+                                                      const Standard_Boolean theToRunParallel)
+{
+  if (thePoints.Length() != theParams.Length()
+   || thePoints.Length() != theDistances.Length())
+  {
+    throw Standard_DimensionMismatch ("GeomAPI_ProjectPointOnSurf::Perform(), wrong length of arrays");
+  }
+  if (thePoints.IsEmpty())
+  {
+    return 0;
+  }
+
+  // the first point is projected by the main algorithm,
+  // which builds the grid of sample points shared by the others
+  Perform (thePoints.First());
+  theDistances.ChangeFirst() = nearestSolution (myExtPS, theParams.ChangeFirst());
+
+  const Standard_Integer aNbOthers = thePoints.Length() - 1;
+  if (aNbOthers > 0)
+  {
+    const Handle(OSD_ThreadPool)& aThreadPool = OSD_ThreadPool::DefaultPool();
+    const Standard_Integer aNbThreads = theToRunParallel
+                                      ? Min (aNbOthers, aThreadPool->NbDefaultThreadsToLaunch())
+                                      : 1;
+    NCollection_Array1<Handle(Adaptor3d_Surface)> aSurfaces (0, aNbThreads - 1);
+    NCollection_Array1<Extrema_ExtPS> anExtPSs (0, aNbThreads - 1);
+    GeomAPI_ProjectPointOnSurfFunctor aFunctor (myGeomAdaptor, myExtPS, aSurfaces, anExtPSs,
+                                                thePoints, theParams, theDistances);
+    OSD_ThreadPool::Launcher aLauncher (*aThreadPool, aNbThreads);
+    aLauncher.Perform (thePoints.Lower() + 1, thePoints.Upper() + 1, aFunctor);
+  }
+
+  Standard_Integer aNbProjected = 0;
+  for (TColStd_Array1OfReal::Iterator anIter (theDistances); anIter.More(); anIter.Next())
+  {
+    if (anIter.Value() >= 0.0)
+    {
+      ++aNbProjected;
+    }
+  }
+  return aNbProjected;
+}
+
 //=======================================================================
 //function : IsDone
 //purpose  : 
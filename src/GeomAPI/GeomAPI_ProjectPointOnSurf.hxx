@@ -26,6 +26,9 @@
 #include <GeomAdaptor_Surface.hxx>
 #include <Extrema_ExtAlgo.hxx>
 #include <Extrema_ExtFlag.hxx>
+#include <TColgp_Array1OfPnt.hxx>
+#include <TColgp_Array1OfPnt2d.hxx>
+#include <TColStd_Array1OfReal.hxx>
 class gp_Pnt;
 class Geom_Surface;
 
@@ -95,6 +98,19 @@ public:
 
   //! Performs the projection of a point on the current surface.
   Standard_EXPORT void Perform (const gp_Pnt& P);
+
+  //! Performs the projection of many points on the current surface.
+  //! For each point the parameters (U,V) of its nearest orthogonal projection
+  //! and the distance to it are stored in the arrays <theParams> and <theDistances>
+  //! (of the same length as <thePoints>); the distance is negative if the projection fails.
+  //! The grid of sample points of the surface is evaluated only once and is shared
+  //! by all the points, which are projected in parallel threads if <theToRunParallel> is true.
+  //! The other methods return the solutions for the first point.
+  //! Returns the number of the projected points.
+  Standard_EXPORT Standard_Integer Perform (const TColgp_Array1OfPnt& thePoints,
+                                            TColgp_Array1OfPnt2d& theParams,
+                                            TColStd_Array1OfReal& theDistances,
+                                            const Standard_Boolean theToRunParallel = Standard_False);
   
   Standard_EXPORT Standard_Boolean IsDone() const;
   
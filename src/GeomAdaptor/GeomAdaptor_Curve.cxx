@@ -46,6 +46,7 @@
 #include <gp_Pnt.hxx>
 #include <gp_Vec.hxx>
 #include <Precision.hxx>
+#include <Standard_DimensionMismatch.hxx>
 #include <Standard_DomainError.hxx>
 #include <Standard_NoSuchObject.hxx>
 #include <Standard_NotImplemented.hxx>
@@ -53,11 +54,29 @@
 #include <TColStd_Array1OfInteger.hxx>
 #include <TColStd_Array1OfReal.hxx>
 
+#include <algorithm>
+
 //#include <GeomConvert_BSplineCurveKnotSplitting.hxx>
 static const Standard_Real PosTol = Precision::PConfusion() / 2;
 
 IMPLEMENT_STANDARD_RTTIEXT(GeomAdaptor_Curve, Adaptor3d_Curve)
 
+//! Compares the offsets of the parameters by the values of the parameters
+class GeomAdaptor_CurveParamComparator
+{
+public:
+  GeomAdaptor_CurveParamComparator (const TColStd_Array1OfReal& theParams)
+  : myParams (theParams)
+  {}
+
+  bool operator() (const Standard_Integer theOffset1, const Standard_Integer theOffset2) const
+  {
+    return myParams.Value (theOffset1) < myParams.Value (theOffset2);
+  }
+
+private:
+  const TColStd_Array1OfReal& myParams;
+};
 //=======================================================================
 //function : ShallowCopy
 //purpose  : 
@@ -655,6 +674,303 @@ void GeomAdaptor_Curve::D2(const Standard_Real U,
 }
 }
 
+//=======================================================================
+//function : D0
+//purpose  : 
+//=======================================================================
+
+void GeomAdaptor_Curve::D0 (const TColStd_Array1OfReal& theParams,
+                            TColgp_Array1OfPnt&         thePoints) const
+{
+  Standard_DimensionMismatch_Raise_if (theParams.Length() != thePoints.Length(),
+                                       "GeomAdaptor_Curve::D0(), wrong length of array of points");
+  if (myTypeCurve != GeomAbs_BezierCurve && myTypeCurve != GeomAbs_BSplineCurve)
+  {
+    for (Standard_Integer i = theParams.Lower(); i <= theParams.Upper(); i++)
+    {
+      D0 (theParams.Value (i), thePoints.ChangeValue (thePoints.Lower() + i - theParams.Lower()));
+    }
+    return;
+  }
+
+  const Standard_Integer aNbParams = theParams.Length();
+  TColStd_Array1OfInteger anOrder (1, aNbParams);
+  if (!sortParams (theParams, anOrder))
+  {
+    // the parameters of each span already follow each other
+    spanD0 (theParams, thePoints);
+    return;
+  }
+
+  TColStd_Array1OfReal aParams (1, aNbParams);
+  for (Standard_Integer i = 1; i <= aNbParams; i++)
+  {
+    aParams.SetValue (i, theParams.Value (theParams.Lower() + anOrder.Value (i)));
+  }
+  TColgp_Array1OfPnt aPoints (1, aNbParams);
+  spanD0 (aParams, aPoints);
+  for (Standard_Integer i = 1; i <= aNbParams; i++)
+  {
+    thePoints.SetValue (thePoints.Lower() + anOrder.Value (i), aPoints.Value (i));
+  }
+}
+
+//=======================================================================
+//function : D1
+//purpose  : 
+//=======================================================================
+
+void GeomAdaptor_Curve::D1 (const TColStd_Array1OfReal& theParams,
+                            TColgp_Array1OfPnt&         thePoints,
+                            TColgp_Array1OfVec&         theV1) const
+{
+  Standard_DimensionMismatch_Raise_if (theParams.Length() != thePoints.Length()
+                                    || theParams.Length() != theV1.Length(),
+                                       "GeomAdaptor_Curve::D1(), wrong length of array of results");
+  if (myTypeCurve != GeomAbs_BezierCurve && myTypeCurve != GeomAbs_BSplineCurve)
+  {
+    for (Standard_Integer i = theParams.Lower(); i <= theParams.Upper(); i++)
+    {
+      const Standard_Integer anOffset = i - theParams.Lower();
+      D1 (theParams.Value (i),
+          thePoints.ChangeValue (thePoints.Lower() + anOffset),
+          theV1    .ChangeValue (theV1    .Lower() + anOffset));
+    }
+    return;
+  }
+
+  const Standard_Integer aNbParams = theParams.Length();
+  TColStd_Array1OfInteger anOrder (1, aNbParams);
+  if (!sortParams (theParams, anOrder))
+  {
+    // the parameters of each span already follow each other
+    spanD1 (theParams, thePoints, theV1);
+    return;
+  }
+
+  TColStd_Array1OfReal aParams (1, aNbParams);
+  for (Standard_Integer i = 1; i <= aNbParams; i++)
+  {
+    aParams.SetValue (i, theParams.Value (theParams.Lower() + anOrder.Value (i)));
+  }
+  TColgp_Array1OfPnt aPoints (1, aNbParams);
+  TColgp_Array1OfVec aV1 (1, aNbParams);
+  spanD1 (aParams, aPoints, aV1);
+  for (Standard_Integer i = 1; i <= aNbParams; i++)
+  {
+    const Standard_Integer anOffset = anOrder.Value (i);
+    thePoints.SetValue (thePoints.Lower() + anOffset, aPoints.Value (i));
+    theV1    .SetValue (theV1    .Lower() + anOffset, aV1    .Value (i));
+  }
+}
+
+//=======================================================================
+//function : D2
+//purpose  : 
+//=======================================================================
+
+void GeomAdaptor_Curve::D2 (const TColStd_Array1OfReal& theParams,
+                            TColgp_Array1OfPnt&         thePoints,
+                            TColgp_Array1OfVec&         theV1,
+                            TColgp_Array1OfVec&         theV2) const
+{
+  Standard_DimensionMismatch_Raise_if (theParams.Length() != thePoints.Length()
+                                    || theParams.Length() != theV1.Length()
+                                    || theParams.Length() != theV2.Length(),
+                                       "GeomAdaptor_Curve::D2(), wrong length of array of results");
+  if (myTypeCurve != GeomAbs_BezierCurve && myTypeCurve != GeomAbs_BSplineCurve)
+  {
+    for (Standard_Integer i = theParams.Lower(); i <= theParams.Upper(); i++)
+    {
+      const Standard_Integer anOffset = i - theParams.Lower();
+      D2 (theParams.Value (i),
+          thePoints.ChangeValue (thePoints.Lower() + anOffset),
+          theV1    .ChangeValue (theV1    .Lower() + anOffset),
+          theV2    .ChangeValue (theV2    .Lower() + anOffset));
+    }
+    return;
+  }
+
+  const Standard_Integer aNbParams = theParams.Length();
+  TColStd_Array1OfInteger anOrder (1, aNbParams);
+  if (!sortParams (theParams, anOrder))
+  {
+    // the parameters of each span already follow each other
+    spanD2 (theParams, thePoints, theV1, theV2);
+    return;
+  }
+
+  TColStd_Array1OfReal aParams (1, aNbParams);
+  for (Standard_Integer i = 1; i <= aNbParams; i++)
+  {
+    aParams.SetValue (i, theParams.Value (theParams.Lower() + anOrder.Value (i)));
+  }
+  TColgp_Array1OfPnt aPoints (1, aNbParams);
+  TColgp_Array1OfVec aV1 (1, aNbParams), aV2 (1, aNbParams);
+  spanD2 (aParams, aPoints, aV1, aV2);
+  for (Standard_Integer i = 1; i <= aNbParams; i++)
+  {
+    const Standard_Integer anOffset = anOrder.Value (i);
+    thePoints.SetValue (thePoints.Lower() + anOffset, aPoints.Value (i));
+    theV1    .SetValue (theV1    .Lower() + anOffset, aV1    .Value (i));
+    theV2    .SetValue (theV2    .Lower() + anOffset, aV2    .Value (i));
+  }
+}
+
+//=======================================================================
+//function : sortParams
+//purpose  : 
+//=======================================================================
+
+Standard_Boolean GeomAdaptor_Curve::sortParams (const TColStd_Array1OfReal& theParams,
+                                                TColStd_Array1OfInteger&    theOrder) const
+{
+  if (myTypeCurve != GeomAbs_BSplineCurve)
+  {
+    // Bezier curve has the single span
+    return Standard_False;
+  }
+
+  // the parameters are sorted by values, so that the parameters of each span follow each other;
+  // usually the parameters of discretization are already sorted
+  BSplCLib_CacheParams aSpanParams (myBSplineCurve->Degree(), myBSplineCurve->IsPeriodic(),
+                                    myBSplineCurve->KnotSequence());
+  TColStd_Array1OfReal aParams (0, theParams.Length() - 1);
+  Standard_Boolean isSorted = Standard_True;
+  for (Standard_Integer anOffset = 0; anOffset < theParams.Length(); anOffset++)
+  {
+    aParams.SetValue (anOffset, aSpanParams.PeriodicNormalization (theParams.Value (theParams.Lower() + anOffset)));
+    theOrder.SetValue (theOrder.Lower() + anOffset, anOffset);
+    isSorted = isSorted && (anOffset == 0 || aParams.Value (anOffset - 1) <= aParams.Value (anOffset));
+  }
+  if (isSorted)
+  {
+    return Standard_False;
+  }
+
+  std::stable_sort (&theOrder.ChangeFirst(), &theOrder.ChangeLast() + 1,
+                    GeomAdaptor_CurveParamComparator (aParams));
+  return Standard_True;
+}
+
+//=======================================================================
+//function : spanChunk
+//purpose  : 
+//=======================================================================
+
+Standard_Integer GeomAdaptor_Curve::spanChunk (const TColStd_Array1OfReal& theParams,
+                                               const Standard_Integer      theFirst,
+                                               const Standard_Integer      theLast) const
+{
+  // the boundary parameters are not evaluated via the cache (see IsBoundary())
+  const Standard_Boolean isBSpline = !myBSplineCurve.IsNull();
+  const Standard_Real aParam = theParams.Value (theFirst);
+  if (isBSpline && (aParam == myFirst || aParam == myLast))
+  {
+    return theFirst - 1;
+  }
+  if (myCurveCache.IsNull() || !myCurveCache->IsCacheValid (aParam))
+  {
+    RebuildCache (aParam);
+  }
+
+  Standard_Integer aLast = theFirst;
+  for (; aLast < theLast; ++aLast)
+  {
+    const Standard_Real aNextParam = theParams.Value (aLast + 1);
+    if ((isBSpline && (aNextParam == myFirst || aNextParam == myLast))
+     || !myCurveCache->IsCacheValid (aNextParam))
+    {
+      break;
+    }
+  }
+  return aLast;
+}
+
+//=======================================================================
+//function : spanD0
+//purpose  : 
+//=======================================================================
+
+void GeomAdaptor_Curve::spanD0 (const TColStd_Array1OfReal& theParams,
+                                TColgp_Array1OfPnt&         thePoints) const
+{
+  const Standard_Integer aShift = thePoints.Lower() - theParams.Lower();
+  for (Standard_Integer aFirst = theParams.Lower(), aLast = 0; aFirst <= theParams.Upper(); aFirst = aLast + 1)
+  {
+    aLast = spanChunk (theParams, aFirst, theParams.Upper());
+    if (aLast < aFirst)
+    {
+      aLast = aFirst;
+      D0 (theParams (aFirst), thePoints (aFirst + aShift));
+      continue;
+    }
+
+    const TColStd_Array1OfReal aChunkParams (theParams (aFirst), aFirst, aLast);
+    TColgp_Array1OfPnt aChunkPoints (thePoints (aFirst + aShift), aFirst, aLast);
+    myCurveCache->D0 (aChunkParams, aChunkPoints);
+  }
+}
+
+//=======================================================================
+//function : spanD1
+//purpose  : 
+//=======================================================================
+
+void GeomAdaptor_Curve::spanD1 (const TColStd_Array1OfReal& theParams,
+                                TColgp_Array1OfPnt&         thePoints,
+                                TColgp_Array1OfVec&         theV1) const
+{
+  const Standard_Integer aShiftP  = thePoints.Lower() - theParams.Lower();
+  const Standard_Integer aShiftV1 = theV1.Lower()     - theParams.Lower();
+  for (Standard_Integer aFirst = theParams.Lower(), aLast = 0; aFirst <= theParams.Upper(); aFirst = aLast + 1)
+  {
+    aLast = spanChunk (theParams, aFirst, theParams.Upper());
+    if (aLast < aFirst)
+    {
+      aLast = aFirst;
+      D1 (theParams (aFirst), thePoints (aFirst + aShiftP), theV1 (aFirst + aShiftV1));
+      continue;
+    }
+
+    const TColStd_Array1OfReal aChunkParams (theParams (aFirst), aFirst, aLast);
+    TColgp_Array1OfPnt aChunkPoints (thePoints (aFirst + aShiftP), aFirst, aLast);
+    TColgp_Array1OfVec aChunkV1 (theV1 (aFirst + aShiftV1), aFirst, aLast);
+    myCurveCache->D1 (aChunkParams, aChunkPoints, aChunkV1);
+  }
+}
+
+//=======================================================================
+//function : spanD2
+//purpose  : 
+//=======================================================================
+
+void GeomAdaptor_Curve::spanD2 (const TColStd_Array1OfReal& theParams,
+                                TColgp_Array1OfPnt&         thePoints,
+                                TColgp_Array1OfVec&         theV1,
+                                TColgp_Array1OfVec&         theV2) const
+{
+  const Standard_Integer aShiftP  = thePoints.Lower() - theParams.Lower();
+  const Standard_Integer aShiftV1 = theV1.Lower()     - theParams.Lower();
+  const Standard_Integer aShiftV2 = theV2.Lower()     - theParams.Lower();
+  for (Standard_Integer aFirst = theParams.Lower(), aLast = 0; aFirst <= theParams.Upper(); aFirst = aLast + 1)
+  {
+    aLast = spanChunk (theParams, aFirst, theParams.Upper());
+    if (aLast < aFirst)
+    {
+      aLast = aFirst;
+      D2 (theParams (aFirst), thePoints (aFirst + aShiftP), theV1 (aFirst + aShiftV1), theV2 (aFirst + aShiftV2));
+      continue;
+    }
+
+    const TColStd_Array1OfReal aChunkParams (theParams (aFirst), aFirst, aLast);
+    TColgp_Array1OfPnt aChunkPoints (thePoints (aFirst + aShiftP), aFirst, aLast);
+    TColgp_Array1OfVec aChunkV1 (theV1 (aFirst + aShiftV1), aFirst, aLast);
+    TColgp_Array1OfVec aChunkV2 (theV2 (aFirst + aShiftV2), aFirst, aLast);
+    myCurveCache->D2 (aChunkParams, aChunkPoints, aChunkV1, aChunkV2);
+  }
+}
+
 //=======================================================================
 //function : D3
 //purpose  : 
@@ -24,6 +24,10 @@
 #include <GeomEvaluator_Curve.hxx>
 #include <Standard_NullObject.hxx>
 #include <Standard_ConstructionError.hxx>
+#include <TColStd_Array1OfInteger.hxx>
+#include <TColStd_Array1OfReal.hxx>
+#include <TColgp_Array1OfPnt.hxx>
+#include <TColgp_Array1OfVec.hxx>
 
 DEFINE_STANDARD_HANDLE(GeomAdaptor_Curve, Adaptor3d_Curve)
 
@@ -134,6 +138,25 @@ public:
   //! else the derivatives are computed on the basis curve.
   Standard_EXPORT void D2 (const Standard_Real U, gp_Pnt& P, gp_Vec& V1, gp_Vec& V2) const Standard_OVERRIDE;
   
+  //! Computes the points for the array of parameters on the curve.
+  //! The results are stored in the array of the same length.
+  //! For B-spline and Bezier curves the parameters are evaluated span by span,
+  //! so that the cache of each span is built once and is used for all its points.
+  //! Raises Standard_DimensionMismatch if the arrays have different lengths.
+  Standard_EXPORT void D0 (const TColStd_Array1OfReal& theParams, TColgp_Array1OfPnt& thePoints) const Standard_OVERRIDE;
+
+  //! Computes the points and the first derivatives for the array of parameters on the curve.
+  //! The results are the same as the ones of D1() called for each point.
+  //! For B-spline and Bezier curves the parameters are evaluated span by span.
+  //! Raises Standard_DimensionMismatch if the arrays have different lengths.
+  Standard_EXPORT void D1 (const TColStd_Array1OfReal& theParams, TColgp_Array1OfPnt& thePoints, TColgp_Array1OfVec& theV1) const Standard_OVERRIDE;
+
+  //! Computes the points, the first and second derivatives for the array of parameters
+  //! on the curve. The results are the same as the ones of D2() called for each point.
+  //! For B-spline and Bezier curves the parameters are evaluated span by span.
+  //! Raises Standard_DimensionMismatch if the arrays have different lengths.
+  Standard_EXPORT void D2 (const TColStd_Array1OfReal& theParams, TColgp_Array1OfPnt& thePoints, TColgp_Array1OfVec& theV1, TColgp_Array1OfVec& theV2) const Standard_OVERRIDE;
+
 
   //! Returns the point P of parameter U, the first, the second
   //! and the third derivative.
@@ -224,6 +247,28 @@ private:
   //! \param theParameter the value on the knot axis which identifies the caching span
   void RebuildCache (const Standard_Real theParameter) const;
 
+  //! Sorts the parameters of B-spline curve so that the parameters of each span follow each other.
+  //! \param theParams parameters to be evaluated
+  //! \param theOrder  offsets of the parameters in <theParams> in the sorted order
+  //! \return FALSE if the parameters are already in the proper order
+  Standard_Boolean sortParams (const TColStd_Array1OfReal& theParams, TColStd_Array1OfInteger& theOrder) const;
+
+  //! Rebuilds the cache for the parameter <theFirst> if needed and returns the index
+  //! of the last parameter of the sequence [theFirst, theLast] lying in the span of the cache.
+  //! Returns theFirst - 1 if the parameter <theFirst> is boundary one, which is not evaluated via the cache.
+  Standard_Integer spanChunk (const TColStd_Array1OfReal& theParams,
+                              const Standard_Integer      theFirst,
+                              const Standard_Integer      theLast) const;
+
+  //! Evaluates the points of B-spline or Bezier curve for the sequence of parameters span by span.
+  void spanD0 (const TColStd_Array1OfReal& theParams, TColgp_Array1OfPnt& thePoints) const;
+
+  //! Evaluates the points and the first derivatives of B-spline or Bezier curve span by span.
+  void spanD1 (const TColStd_Array1OfReal& theParams, TColgp_Array1OfPnt& thePoints, TColgp_Array1OfVec& theV1) const;
+
+  //! Evaluates the points, the first and second derivatives of B-spline or Bezier curve span by span.
+  void spanD2 (const TColStd_Array1OfReal& theParams, TColgp_Array1OfPnt& thePoints, TColgp_Array1OfVec& theV1, TColgp_Array1OfVec& theV2) const;
+
 private:
 
   Handle(Geom_Curve) myCurve;
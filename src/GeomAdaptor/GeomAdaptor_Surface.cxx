@@ -54,16 +54,36 @@
 #include <gp_Torus.hxx>
 #include <gp_Vec.hxx>
 #include <Precision.hxx>
+#include <Standard_DimensionMismatch.hxx>
 #include <Standard_DomainError.hxx>
 #include <Standard_NoSuchObject.hxx>
 #include <Standard_NullObject.hxx>
 #include <TColStd_Array1OfInteger.hxx>
 #include <TColStd_Array1OfReal.hxx>
 
+#include <algorithm>
+
 static const Standard_Real PosTol = Precision::PConfusion()*0.5;
 
 IMPLEMENT_STANDARD_RTTIEXT(GeomAdaptor_Surface, Adaptor3d_Surface)
 
+//! Compares the offsets of the parameters by the indices of their spans
+class GeomAdaptor_SpanComparator
+{
+public:
+  GeomAdaptor_SpanComparator (const TColStd_Array1OfInteger& theSpans)
+  : mySpans (theSpans)
+  {}
+
+  bool operator() (const Standard_Integer theOffset1, const Standard_Integer theOffset2) const
+  {
+    return mySpans.Value (theOffset1) < mySpans.Value (theOffset2);
+  }
+
+private:
+  const TColStd_Array1OfInteger& mySpans;
+};
+
 //=======================================================================
 //function : LocalContinuity
 //purpose  : 
@@ -854,6 +874,298 @@ void GeomAdaptor_Surface::D2(const Standard_Real U,
 }
 
 
+//=======================================================================
+//function : D0
+//purpose  : 
+//=======================================================================
+
+void GeomAdaptor_Surface::D0 (const TColgp_Array1OfPnt2d& theUVs,
+                              TColgp_Array1OfPnt&         thePoints) const
+{
+  Standard_DimensionMismatch_Raise_if (theUVs.Length() != thePoints.Length(),
+                                       "GeomAdaptor_Surface::D0(), wrong length of array of points");
+  if (mySurfaceType != GeomAbs_BezierSurface && mySurfaceType != GeomAbs_BSplineSurface)
+  {
+    for (Standard_Integer i = theUVs.Lower(); i <= theUVs.Upper(); i++)
+    {
+      const gp_Pnt2d& aUV = theUVs.Value (i);
+      D0 (aUV.X(), aUV.Y(), thePoints.ChangeValue (thePoints.Lower() + i - theUVs.Lower()));
+    }
+    return;
+  }
+  if (mySurfaceType == GeomAbs_BezierSurface)
+  {
+    // the single span of Bezier surface contains all the parameters
+    if (!theUVs.IsEmpty())
+    {
+      spanChunk (theUVs, theUVs.Lower(), theUVs.Lower());
+      mySurfaceCache->D0 (theUVs, thePoints);
+    }
+    return;
+  }
+
+  const Standard_Integer aNbUVs = theUVs.Length();
+  TColStd_Array1OfInteger anOrder (1, aNbUVs);
+  sortBySpans (theUVs, Standard_False, anOrder);
+  TColgp_Array1OfPnt2d aUVs (1, aNbUVs);
+  for (Standard_Integer i = 1; i <= aNbUVs; i++)
+  {
+    aUVs.SetValue (i, theUVs.Value (theUVs.Lower() + anOrder.Value (i)));
+  }
+
+  TColgp_Array1OfPnt aPoints (1, aNbUVs);
+  for (Standard_Integer aFirst = 1, aLast = 0; aFirst <= aNbUVs; aFirst = aLast + 1)
+  {
+    aLast = spanChunk (aUVs, aFirst, aNbUVs);
+    const TColgp_Array1OfPnt2d aChunkUVs (aUVs (aFirst), aFirst, aLast);
+    TColgp_Array1OfPnt aChunkPoints (aPoints (aFirst), aFirst, aLast);
+    mySurfaceCache->D0 (aChunkUVs, aChunkPoints);
+  }
+
+  for (Standard_Integer i = 1; i <= aNbUVs; i++)
+  {
+    thePoints.SetValue (thePoints.Lower() + anOrder.Value (i), aPoints.Value (i));
+  }
+}
+
+//=======================================================================
+//function : D1
+//purpose  : 
+//=======================================================================
+
+void GeomAdaptor_Surface::D1 (const TColgp_Array1OfPnt2d& theUVs,
+                              TColgp_Array1OfPnt&         thePoints,
+                              TColgp_Array1OfVec&         theD1U,
+                              TColgp_Array1OfVec&         theD1V) const
+{
+  Standard_DimensionMismatch_Raise_if (theUVs.Length() != thePoints.Length()
+                                    || theUVs.Length() != theD1U.Length()
+                                    || theUVs.Length() != theD1V.Length(),
+                                       "GeomAdaptor_Surface::D1(), wrong length of array of results");
+  if (mySurfaceType != GeomAbs_BezierSurface && mySurfaceType != GeomAbs_BSplineSurface)
+  {
+    for (Standard_Integer i = theUVs.Lower(); i <= theUVs.Upper(); i++)
+    {
+      const gp_Pnt2d& aUV = theUVs.Value (i);
+      const Standard_Integer anOffset = i - theUVs.Lower();
+      D1 (aUV.X(), aUV.Y(),
+          thePoints.ChangeValue (thePoints.Lower() + anOffset),
+          theD1U   .ChangeValue (theD1U   .Lower() + anOffset),
+          theD1V   .ChangeValue (theD1V   .Lower() + anOffset));
+    }
+    return;
+  }
+  if (mySurfaceType == GeomAbs_BezierSurface)
+  {
+    // the single span of Bezier surface contains all the parameters
+    if (!theUVs.IsEmpty())
+    {
+      spanChunk (theUVs, theUVs.Lower(), theUVs.Lower());
+      mySurfaceCache->D1 (theUVs, thePoints, theD1U, theD1V);
+    }
+    return;
+  }
+
+  const Standard_Integer aNbUVs = theUVs.Length();
+  TColStd_Array1OfInteger anOrder (1, aNbUVs);
+  const Standard_Integer aNbCached = sortBySpans (theUVs, Standard_True, anOrder);
+  TColgp_Array1OfPnt2d aUVs (1, aNbUVs);
+  for (Standard_Integer i = 1; i <= aNbUVs; i++)
+  {
+    aUVs.SetValue (i, theUVs.Value (theUVs.Lower() + anOrder.Value (i)));
+  }
+
+  TColgp_Array1OfPnt aPoints (1, aNbUVs);
+  TColgp_Array1OfVec aD1U (1, aNbUVs), aD1V (1, aNbUVs);
+  for (Standard_Integer aFirst = 1, aLast = 0; aFirst <= aNbCached; aFirst = aLast + 1)
+  {
+    aLast = spanChunk (aUVs, aFirst, aNbCached);
+    const TColgp_Array1OfPnt2d aChunkUVs (aUVs (aFirst), aFirst, aLast);
+    TColgp_Array1OfPnt aChunkPoints (aPoints (aFirst), aFirst, aLast);
+    TColgp_Array1OfVec aChunkD1U (aD1U (aFirst), aFirst, aLast);
+    TColgp_Array1OfVec aChunkD1V (aD1V (aFirst), aFirst, aLast);
+    mySurfaceCache->D1 (aChunkUVs, aChunkPoints, aChunkD1U, aChunkD1V);
+  }
+  // the points close to the bounds are evaluated one by one
+  for (Standard_Integer i = aNbCached + 1; i <= aNbUVs; i++)
+  {
+    D1 (aUVs (i).X(), aUVs (i).Y(), aPoints (i), aD1U (i), aD1V (i));
+  }
+
+  for (Standard_Integer i = 1; i <= aNbUVs; i++)
+  {
+    const Standard_Integer anOffset = anOrder.Value (i);
+    thePoints.SetValue (thePoints.Lower() + anOffset, aPoints.Value (i));
+    theD1U   .SetValue (theD1U   .Lower() + anOffset, aD1U   .Value (i));
+    theD1V   .SetValue (theD1V   .Lower() + anOffset, aD1V   .Value (i));
+  }
+}
+
+//=======================================================================
+//function : D2
+//purpose  : 
+//=======================================================================
+
+void GeomAdaptor_Surface::D2 (const TColgp_Array1OfPnt2d& theUVs,
+                              TColgp_Array1OfPnt&         thePoints,
+                              TColgp_Array1OfVec&         theD1U,
+                              TColgp_Array1OfVec&         theD1V,
+                              TColgp_Array1OfVec&         theD2U,
+                              TColgp_Array1OfVec&         theD2V,
+                              TColgp_Array1OfVec&         theD2UV) const
+{
+  Standard_DimensionMismatch_Raise_if (theUVs.Length() != thePoints.Length()
+                                    || theUVs.Length() != theD1U.Length()
+                                    || theUVs.Length() != theD1V.Length()
+                                    || theUVs.Length() != theD2U.Length()
+                                    || theUVs.Length() != theD2V.Length()
+                                    || theUVs.Length() != theD2UV.Length(),
+                                       "GeomAdaptor_Surface::D2(), wrong length of array of results");
+  if (mySurfaceType != GeomAbs_BezierSurface && mySurfaceType != GeomAbs_BSplineSurface)
+  {
+    for (Standard_Integer i = theUVs.Lower(); i <= theUVs.Upper(); i++)
+    {
+      const gp_Pnt2d& aUV = theUVs.Value (i);
+      const Standard_Integer anOffset = i - theUVs.Lower();
+      D2 (aUV.X(), aUV.Y(),
+          thePoints.ChangeValue (thePoints.Lower() + anOffset),
+          theD1U   .ChangeValue (theD1U   .Lower() + anOffset),
+          theD1V   .ChangeValue (theD1V   .Lower() + anOffset),
+          theD2U   .ChangeValue (theD2U   .Lower() + anOffset),
+          theD2V   .ChangeValue (theD2V   .Lower() + anOffset),
+          theD2UV  .ChangeValue (theD2UV  .Lower() + anOffset));
+    }
+    return;
+  }
+  if (mySurfaceType == GeomAbs_BezierSurface)
+  {
+    // the single span of Bezier surface contains all the parameters
+    if (!theUVs.IsEmpty())
+    {
+      spanChunk (theUVs, theUVs.Lower(), theUVs.Lower());
+      mySurfaceCache->D2 (theUVs, thePoints, theD1U, theD1V, theD2U, theD2V, theD2UV);
+    }
+    return;
+  }
+
+  const Standard_Integer aNbUVs = theUVs.Length();
+  TColStd_Array1OfInteger anOrder (1, aNbUVs);
+  const Standard_Integer aNbCached = sortBySpans (theUVs, Standard_True, anOrder);
+  TColgp_Array1OfPnt2d aUVs (1, aNbUVs);
+  for (Standard_Integer i = 1; i <= aNbUVs; i++)
+  {
+    aUVs.SetValue (i, theUVs.Value (theUVs.Lower() + anOrder.Value (i)));
+  }
+
+  TColgp_Array1OfPnt aPoints (1, aNbUVs);
+  TColgp_Array1OfVec aD1U (1, aNbUVs), aD1V (1, aNbUVs), aD2U (1, aNbUVs), aD2V (1, aNbUVs), aD2UV (1, aNbUVs);
+  for (Standard_Integer aFirst = 1, aLast = 0; aFirst <= aNbCached; aFirst = aLast + 1)
+  {
+    aLast = spanChunk (aUVs, aFirst, aNbCached);
+    const TColgp_Array1OfPnt2d aChunkUVs (aUVs (aFirst), aFirst, aLast);
+    TColgp_Array1OfPnt aChunkPoints (aPoints (aFirst), aFirst, aLast);
+    TColgp_Array1OfVec aChunkD1U  (aD1U  (aFirst), aFirst, aLast);
+    TColgp_Array1OfVec aChunkD1V  (aD1V  (aFirst), aFirst, aLast);
+    TColgp_Array1OfVec aChunkD2U  (aD2U  (aFirst), aFirst, aLast);
+    TColgp_Array1OfVec aChunkD2V  (aD2V  (aFirst), aFirst, aLast);
+    TColgp_Array1OfVec aChunkD2UV (aD2UV (aFirst), aFirst, aLast);
+    mySurfaceCache->D2 (aChunkUVs, aChunkPoints, aChunkD1U, aChunkD1V, aChunkD2U, aChunkD2V, aChunkD2UV);
+  }
+  // the points close to the bounds are evaluated one by one
+  for (Standard_Integer i = aNbCached + 1; i <= aNbUVs; i++)
+  {
+    D2 (aUVs (i).X(), aUVs (i).Y(), aPoints (i), aD1U (i), aD1V (i), aD2U (i), aD2V (i), aD2UV (i));
+  }
+
+  for (Standard_Integer i = 1; i <= aNbUVs; i++)
+  {
+    const Standard_Integer anOffset = anOrder.Value (i);
+    thePoints.SetValue (thePoints.Lower() + anOffset, aPoints.Value (i));
+    theD1U   .SetValue (theD1U   .Lower() + anOffset, aD1U   .Value (i));
+    theD1V   .SetValue (theD1V   .Lower() + anOffset, aD1V   .Value (i));
+    theD2U   .SetValue (theD2U   .Lower() + anOffset, aD2U   .Value (i));
+    theD2V   .SetValue (theD2V   .Lower() + anOffset, aD2V   .Value (i));
+    theD2UV  .SetValue (theD2UV  .Lower() + anOffset, aD2UV  .Value (i));
+  }
+}
+
+//=======================================================================
+//function : sortBySpans
+//purpose  : 
+//=======================================================================
+
+Standard_Integer GeomAdaptor_Surface::sortBySpans (const TColgp_Array1OfPnt2d& theUVs,
+                                                   const Standard_Boolean      theToSkipBounds,
+                                                   TColStd_Array1OfInteger&    theOrder) const
+{
+  // the parameters close to the bounds go to the end of the order
+  Standard_Integer aNbCached = 0, aNbOnBounds = 0;
+  for (Standard_Integer anOffset = 0; anOffset < theUVs.Length(); anOffset++)
+  {
+    const gp_Pnt2d& aUV = theUVs.Value (theUVs.Lower() + anOffset);
+    const Standard_Boolean isOnBound = theToSkipBounds && !myBSplineSurface.IsNull()
+                                    && (Abs (aUV.X() - myUFirst) <= myTolU || Abs (aUV.X() - myULast) <= myTolU
+                                     || Abs (aUV.Y() - myVFirst) <= myTolV || Abs (aUV.Y() - myVLast) <= myTolV);
+    if (isOnBound)
+    {
+      theOrder.SetValue (theOrder.Upper() - aNbOnBounds++, anOffset);
+    }
+    else
+    {
+      theOrder.SetValue (theOrder.Lower() + aNbCached++, anOffset);
+    }
+  }
+  if (mySurfaceType != GeomAbs_BSplineSurface || aNbCached < 2)
+  {
+    // Bezier surface has the single span
+    return aNbCached;
+  }
+
+  // the spans are located in the same way as on building the cache
+  const TColStd_Array1OfReal& aKnotsU = myBSplineSurface->UKnotSequence();
+  const TColStd_Array1OfReal& aKnotsV = myBSplineSurface->VKnotSequence();
+  BSplCLib_CacheParams aParamsU (myBSplineSurface->UDegree(), myBSplineSurface->IsUPeriodic(), aKnotsU);
+  BSplCLib_CacheParams aParamsV (myBSplineSurface->VDegree(), myBSplineSurface->IsVPeriodic(), aKnotsV);
+  TColStd_Array1OfInteger aSpans (0, theUVs.Length() - 1);
+  for (Standard_Integer i = theOrder.Lower(); i < theOrder.Lower() + aNbCached; i++)
+  {
+    const gp_Pnt2d& aUV = theUVs.Value (theUVs.Lower() + theOrder.Value (i));
+    Standard_Real aU = aParamsU.PeriodicNormalization (aUV.X());
+    Standard_Real aV = aParamsV.PeriodicNormalization (aUV.Y());
+    aParamsU.LocateParameter (aU, aKnotsU);
+    aParamsV.LocateParameter (aV, aKnotsV);
+    aSpans.SetValue (theOrder.Value (i), aParamsV.SpanIndex * (aKnotsU.Length() + 1) + aParamsU.SpanIndex);
+  }
+
+  std::stable_sort (&theOrder.ChangeFirst(), &theOrder.ChangeFirst() + aNbCached,
+                    GeomAdaptor_SpanComparator (aSpans));
+  return aNbCached;
+}
+
+//=======================================================================
+//function : spanChunk
+//purpose  : 
+//=======================================================================
+
+Standard_Integer GeomAdaptor_Surface::spanChunk (const TColgp_Array1OfPnt2d& theUVs,
+                                                 const Standard_Integer      theFirst,
+                                                 const Standard_Integer      theLast) const
+{
+  const gp_Pnt2d& aUV = theUVs.Value (theFirst);
+  if (mySurfaceCache.IsNull() || !mySurfaceCache->IsCacheValid (aUV.X(), aUV.Y()))
+  {
+    RebuildCache (aUV.X(), aUV.Y());
+  }
+
+  Standard_Integer aLast = theFirst;
+  while (aLast < theLast
+      && mySurfaceCache->IsCacheValid (theUVs.Value (aLast + 1).X(), theUVs.Value (aLast + 1).Y()))
+  {
+    ++aLast;
+  }
+  return aLast;
+}
+
 //=======================================================================
 //function : D3
 //purpose  : 
@@ -23,7 +23,11 @@
 #include <GeomEvaluator_Surface.hxx>
 #include <Geom_Surface.hxx>
 #include <Standard_NullObject.hxx>
+#include <TColStd_Array1OfInteger.hxx>
 #include <TColStd_Array1OfReal.hxx>
+#include <TColgp_Array1OfPnt.hxx>
+#include <TColgp_Array1OfPnt2d.hxx>
+#include <TColgp_Array1OfVec.hxx>
 
 DEFINE_STANDARD_HANDLE(GeomAdaptor_Surface, Adaptor3d_Surface)
 
@@ -164,6 +168,25 @@ public:
   //! else the derivatives are computed on the basis surface.
   Standard_EXPORT void D2 (const Standard_Real U, const Standard_Real V, gp_Pnt& P, gp_Vec& D1U, gp_Vec& D1V, gp_Vec& D2U, gp_Vec& D2V, gp_Vec& D2UV) const Standard_OVERRIDE;
   
+  //! Computes the points for the array of parameters (U,V) on the surface.
+  //! The results are stored in the array of the same length.
+  //! For B-spline and Bezier surfaces the parameters are evaluated span by span,
+  //! so that the cache of each span is built once and is used for all its points.
+  //! Raises Standard_DimensionMismatch if the arrays have different lengths.
+  Standard_EXPORT void D0 (const TColgp_Array1OfPnt2d& theUVs, TColgp_Array1OfPnt& thePoints) const;
+
+  //! Computes the points and the first derivatives for the array of parameters (U,V)
+  //! on the surface. The results are the same as the ones of D1() called for each point.
+  //! For B-spline and Bezier surfaces the parameters are evaluated span by span.
+  //! Raises Standard_DimensionMismatch if the arrays have different lengths.
+  Standard_EXPORT void D1 (const TColgp_Array1OfPnt2d& theUVs, TColgp_Array1OfPnt& thePoints, TColgp_Array1OfVec& theD1U, TColgp_Array1OfVec& theD1V) const;
+
+  //! Computes the points, the first and second derivatives for the array of parameters (U,V)
+  //! on the surface. The results are the same as the ones of D2() called for each point.
+  //! For B-spline and Bezier surfaces the parameters are evaluated span by span.
+  //! Raises Standard_DimensionMismatch if the arrays have different lengths.
+  Standard_EXPORT void D2 (const TColgp_Array1OfPnt2d& theUVs, TColgp_Array1OfPnt& thePoints, TColgp_Array1OfVec& theD1U, TColgp_Array1OfVec& theD1V, TColgp_Array1OfVec& theD2U, TColgp_Array1OfVec& theD2V, TColgp_Array1OfVec& theD2UV) const;
+
   //! Computes the point,  the first, second and third
   //! derivatives on the surface.
   //!
@@ -260,6 +283,19 @@ private:
   //! \param theV second parameter to identify the span for caching
   Standard_EXPORT void RebuildCache (const Standard_Real theU, const Standard_Real theV) const;
 
+  //! Sorts the parameters of B-spline or Bezier surface by the spans containing them.
+  //! \param theUVs          parameters to be evaluated
+  //! \param theToSkipBounds if true, the parameters close to the bounds of the surface,
+  //!                        which are not evaluated via the cache by D1() and D2(),
+  //!                        are placed at the end of the order
+  //! \param theOrder        offsets of the parameters in <theUVs> in the sorted order
+  //! \return the number of the parameters to be evaluated via the cache
+  Standard_Integer sortBySpans (const TColgp_Array1OfPnt2d& theUVs, const Standard_Boolean theToSkipBounds, TColStd_Array1OfInteger& theOrder) const;
+
+  //! Rebuilds the cache for the parameter <theFirst> if needed and returns the index
+  //! of the last parameter of the sequence [theFirst, theLast] lying in the span of the cache.
+  Standard_Integer spanChunk (const TColgp_Array1OfPnt2d& theUVs, const Standard_Integer theFirst, const Standard_Integer theLast) const;
+
   protected:
 
   Handle(Geom_Surface) mySurface;
@@ -53,6 +53,12 @@ public:
   //! Shallow copy of adaptor
   Standard_EXPORT virtual Handle(Adaptor3d_Surface) ShallowCopy() const Standard_OVERRIDE;
 
+  //! Computes the points and the derivatives for arrays of parameters (U,V)
+  //! as GeomAdaptor_Surface does.
+  using GeomAdaptor_Surface::D0;
+  using GeomAdaptor_Surface::D1;
+  using GeomAdaptor_Surface::D2;
+
   //! Changes the Curve
   Standard_EXPORT void Load (const Handle(Adaptor3d_Curve)& C);
   
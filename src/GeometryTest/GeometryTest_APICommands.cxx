@@ -168,6 +168,62 @@ static Standard_Integer proj (Draw_Interpretor& di, Standard_Integer n, const ch
   return 0;
 }
 
+//=======================================================================
+//function : projpoints
+//purpose  : 
+//=======================================================================
+
+static Standard_Integer projpoints (Draw_Interpretor& di, Standard_Integer n, const char** a)
+{
+  Standard_Boolean isParallel = Standard_False;
+  if (n > 1 && !strcmp (a[n - 1], "-parallel"))
+  {
+    isParallel = Standard_True;
+    --n;
+  }
+  if (n < 5 || (n - 2) % 3 != 0)
+  {
+    di << "Use: projpoints surf x1 y1 z1 [x2 y2 z2 ...] [-parallel]\n";
+    return 1;
+  }
+
+  Handle(Geom_Surface) GS = DrawTrSurf::GetSurface (a[1]);
+  if (GS.IsNull())
+  {
+    di << "Error: " << a[1] << " is not a surface\n";
+    return 1;
+  }
+
+  const Standard_Integer aNbPoints = (n - 2) / 3;
+  TColgp_Array1OfPnt aPoints (1, aNbPoints);
+  for (Standard_Integer i = 1; i <= aNbPoints; i++)
+  {
+    aPoints (i).SetCoord (Draw::Atof (a[3 * i - 1]), Draw::Atof (a[3 * i]), Draw::Atof (a[3 * i + 1]));
+  }
+
+  Standard_Real U1, U2, V1, V2;
+  GS->Bounds (U1, U2, V1, V2);
+  GeomAPI_ProjectPointOnSurf aProj;
+  aProj.Init (GS, U1, U2, V1, V2);
+
+  TColgp_Array1OfPnt2d aParams (1, aNbPoints);
+  TColStd_Array1OfReal aDistances (1, aNbPoints);
+  const Standard_Integer aNbProjected = aProj.Perform (aPoints, aParams, aDistances, isParallel);
+  for (Standard_Integer i = 1; i <= aNbPoints; i++)
+  {
+    di << "Point " << i << ": ";
+    if (aDistances (i) < 0.0)
+    {
+      di << "projection failed\n";
+      continue;
+    }
+    di << "Parameters: " << aParams (i).X() << " " << aParams (i).Y()
+       << " Distance: " << aDistances (i) << "\n";
+  }
+  di << "Number of projected points: " << aNbProjected << "\n";
+  return 0;
+}
+
 //=======================================================================
 //function : appro
 //purpose  : 
@@ -754,6 +810,10 @@ void GeometryTest::APICommands(Draw_Interpretor& theCommands)
                   "\t\tOptional parameters are relevant to surf only.\n"
                   "\t\tIf initial {u v} are given then local extrema is called",__FILE__, proj);
 
+  theCommands.Add("projpoints", "projpoints surf x1 y1 z1 [x2 y2 z2 ...] [-parallel]\n"
+                  "\t\tProjects the points on the surface at once and prints the nearest solutions.\n"
+                  "\t\t-parallel : project the points in parallel threads",__FILE__, projpoints);
+
   theCommands.Add("appro", "appro result nbpoint [curve]",__FILE__, appro);
   theCommands.Add("surfapp","surfapp result nbupoint nbvpoint x y z ....",
 		  __FILE__,
@@ -69,7 +69,10 @@
 
 #include <Adaptor3d_Curve.hxx>
 
+#include <GeomAdaptor_Curve.hxx>
 #include <GeomAdaptor_Surface.hxx>
+#include <TColgp_Array1OfVec.hxx>
+#include <IntPolyh_Intersection.hxx>
 
 #include <ProjLib_HCompProjectedCurve.hxx>
 #include <Precision.hxx>
@@ -888,6 +891,72 @@ Standard_Real CompLocalDev(const Adaptor3d_Curve& theCurve,
   return Sqrt(d);
 }
 
+//=======================================================================
+//function : cbatcheval
+//purpose  : 
+//=======================================================================
+
+static Standard_Integer cbatcheval (Draw_Interpretor& di, Standard_Integer n, const char** a)
+{
+  if (n < 3 || n > 4 || (n == 4 && strcmp (a[3], "-shuffle")))
+  {
+    di << "Use: cbatcheval curve nbpoints [-shuffle]\n";
+    return 1;
+  }
+
+  Handle(Geom_Curve) aCurve = DrawTrSurf::GetCurve (a[1]);
+  const Standard_Integer aNbPnts = Draw::Atoi (a[2]);
+  if (aCurve.IsNull() || aNbPnts < 2)
+  {
+    di << "Error: wrong arguments\n";
+    return 1;
+  }
+
+  Handle(Adaptor3d_Curve) anAdaptor = new GeomAdaptor_Curve (aCurve);
+  const Standard_Real aFirst = anAdaptor->FirstParameter(), aLast = anAdaptor->LastParameter();
+  if (Precision::IsInfinite (aFirst) || Precision::IsInfinite (aLast))
+  {
+    di << "Error: the curve is not bounded\n";
+    return 1;
+  }
+
+  // the parameters go in increasing order or, with -shuffle,
+  // the even ones in increasing order and the odd ones in decreasing order
+  TColStd_Array1OfReal aParams (1, aNbPnts);
+  for (Standard_Integer i = 1; i <= aNbPnts; ++i)
+  {
+    Standard_Integer anIndex = i;
+    if (n == 4)
+    {
+      const Standard_Integer aNbEven = aNbPnts / 2;
+      anIndex = i <= aNbEven ? 2 * i : aNbPnts - 2 * (i - aNbEven - 1) - (aNbPnts % 2 == 0 ? 1 : 0);
+    }
+    aParams (i) = anIndex == aNbPnts ? aLast : aFirst + (aLast - aFirst) * (anIndex - 1) / (aNbPnts - 1);
+  }
+
+  TColgp_Array1OfPnt aPnts0 (1, aNbPnts), aPnts1 (1, aNbPnts), aPnts2 (1, aNbPnts);
+  TColgp_Array1OfVec aD1V1 (1, aNbPnts), aD2V1 (1, aNbPnts), aD2V2 (1, aNbPnts);
+  anAdaptor->D0 (aParams, aPnts0);
+  anAdaptor->D1 (aParams, aPnts1, aD1V1);
+  anAdaptor->D2 (aParams, aPnts2, aD2V1, aD2V2);
+
+  Standard_Real aMaxDev[3] = { 0.0, 0.0, 0.0 };
+  for (Standard_Integer i = 1; i <= aNbPnts; ++i)
+  {
+    gp_Pnt aP;
+    gp_Vec aV1, aV2;
+    anAdaptor->D0 (aParams (i), aP);
+    aMaxDev[0] = Max (aMaxDev[0], aP.Distance (aPnts0 (i)));
+    anAdaptor->D1 (aParams (i), aP, aV1);
+    aMaxDev[1] = Max (aMaxDev[1], Max (aP.Distance (aPnts1 (i)), (aV1 - aD1V1 (i)).Magnitude()));
+    anAdaptor->D2 (aParams (i), aP, aV1, aV2);
+    aMaxDev[2] = Max (aMaxDev[2], Max (aP.Distance (aPnts2 (i)),
+                                       Max ((aV1 - aD2V1 (i)).Magnitude(), (aV2 - aD2V2 (i)).Magnitude())));
+  }
+  di << "Max deviation of D0: " << aMaxDev[0] << ", D1: " << aMaxDev[1] << ", D2: " << aMaxDev[2] << "\n";
+  return 0;
+}
+
 //=======================================================================
 //function : crvpoints
 //purpose  : 
@@ -1470,6 +1539,28 @@ static Standard_Integer surfpoints (Draw_Interpretor& /*di*/, Standard_Integer /
 
 
 
+//=======================================================================
+//function : intersectparallel
+//purpose  : 
+//=======================================================================
+static Standard_Integer intersectparallel (Draw_Interpretor& di,
+                                           Standard_Integer n, const char** a)
+{
+  if (n > 2)
+  {
+    di << "Use: intersectparallel [0/1]\n";
+    return 1;
+  }
+
+  if (n == 2)
+  {
+    IntPolyh_Intersection::SetParallelMode (Draw::Atoi (a[1]) != 0);
+  }
+  di << "Parallel mode of intersection of triangles: "
+     << (IntPolyh_Intersection::GetParallelMode() ? "on" : "off") << "\n";
+  return 0;
+}
+
 //=======================================================================
 //function : intersect
 //purpose  : 
@@ -1809,11 +1900,25 @@ void  GeometryTest::CurveCommands(Draw_Interpretor& theCommands)
 		  __FILE__,
 		  intersection,g);
 
+  theCommands.Add("intersectparallel",
+                  "intersectparallel [0/1] : switches off (0) or on (1) the parallel check\n\t\t  "
+                  "of couples of triangles in the intersection of parametric surfaces;\n\t\t  "
+                  "prints the current mode",
+                  __FILE__,
+                  intersectparallel,g);
+
   theCommands.Add("crvpoints",
 		  "crvpoints result <curve or wire> deflection",
 		  __FILE__,
 		  crvpoints,g);
 
+  theCommands.Add("cbatcheval",
+                  "cbatcheval curve nbpoints [-shuffle] : evaluates the points and derivatives of the curve\n\t\t  "
+                  "for nbpoints parameters by one call and point by point and prints the maximal deviations;\n\t\t  "
+                  "with -shuffle the parameters are not sorted",
+                  __FILE__,
+                  cbatcheval,g);
+
   theCommands.Add("crvtpoints",
 		  "crvtpoints result <curve or wire> deflection angular deflection - tangential deflection points",
 		  __FILE__,
@@ -37,6 +37,9 @@
 #include <Geom2dAdaptor_Curve.hxx>
 
 #include <Precision.hxx>
+#include <TColgp_Array1OfPnt.hxx>
+#include <TColgp_Array1OfPnt2d.hxx>
+#include <TColgp_Array1OfVec.hxx>
 
 #include <GeomFill.hxx>
 #include <GeomFill_BSplineCurves.hxx>
@@ -377,6 +380,84 @@ static Standard_Integer GetSurfaceContinuity( Draw_Interpretor& theDI,
 }
 
 
+//=======================================================================
+//function : sbatcheval
+//purpose  : Compares the batch evaluation of the surface with the point by point one
+//=======================================================================
+static Standard_Integer sbatcheval (Draw_Interpretor& theDI,
+                                   Standard_Integer theNArg,
+                                   const char** theArgv)
+{
+  if (theNArg < 4 || theNArg > 5 || (theNArg == 5 && strcmp (theArgv[4], "-shuffle")))
+  {
+    theDI << "Use: sbatcheval surface nbu nbv [-shuffle]\n";
+    return 1;
+  }
+
+  Handle(Geom_Surface) aSurface = DrawTrSurf::GetSurface (theArgv[1]);
+  const Standard_Integer aNbU = Draw::Atoi (theArgv[2]), aNbV = Draw::Atoi (theArgv[3]);
+  if (aSurface.IsNull() || aNbU < 2 || aNbV < 2)
+  {
+    theDI << "Error: wrong arguments\n";
+    return 1;
+  }
+
+  GeomAdaptor_Surface anAdaptor (aSurface);
+  const Standard_Real aU1 = anAdaptor.FirstUParameter(), aU2 = anAdaptor.LastUParameter();
+  const Standard_Real aV1 = anAdaptor.FirstVParameter(), aV2 = anAdaptor.LastVParameter();
+  if (Precision::IsInfinite (aU1) || Precision::IsInfinite (aU2)
+   || Precision::IsInfinite (aV1) || Precision::IsInfinite (aV2))
+  {
+    theDI << "Error: the surface is not bounded\n";
+    return 1;
+  }
+
+  // the nodes of the grid go row by row or, with -shuffle,
+  // the even ones in increasing order and the odd ones in decreasing order
+  const Standard_Integer aNbPnts = aNbU * aNbV;
+  TColgp_Array1OfPnt2d aUVs (1, aNbPnts);
+  for (Standard_Integer i = 1; i <= aNbPnts; ++i)
+  {
+    Standard_Integer anIndex = i;
+    if (theNArg == 5)
+    {
+      const Standard_Integer aNbEven = aNbPnts / 2;
+      anIndex = i <= aNbEven ? 2 * i : aNbPnts - 2 * (i - aNbEven - 1) - (aNbPnts % 2 == 0 ? 1 : 0);
+    }
+    const Standard_Integer iU = (anIndex - 1) / aNbV, iV = (anIndex - 1) % aNbV;
+    aUVs (i).SetCoord (iU == aNbU - 1 ? aU2 : aU1 + (aU2 - aU1) * iU / (aNbU - 1),
+                       iV == aNbV - 1 ? aV2 : aV1 + (aV2 - aV1) * iV / (aNbV - 1));
+  }
+
+  TColgp_Array1OfPnt aPnts0 (1, aNbPnts), aPnts1 (1, aNbPnts), aPnts2 (1, aNbPnts);
+  TColgp_Array1OfVec aD1U1 (1, aNbPnts), aD1V1 (1, aNbPnts);
+  TColgp_Array1OfVec aD1U2 (1, aNbPnts), aD1V2 (1, aNbPnts);
+  TColgp_Array1OfVec aD2U (1, aNbPnts), aD2V (1, aNbPnts), aD2UV (1, aNbPnts);
+  anAdaptor.D0 (aUVs, aPnts0);
+  anAdaptor.D1 (aUVs, aPnts1, aD1U1, aD1V1);
+  anAdaptor.D2 (aUVs, aPnts2, aD1U2, aD1V2, aD2U, aD2V, aD2UV);
+
+  Standard_Real aMaxDev[3] = { 0.0, 0.0, 0.0 };
+  for (Standard_Integer i = 1; i <= aNbPnts; ++i)
+  {
+    const Standard_Real aU = aUVs (i).X(), aV = aUVs (i).Y();
+    gp_Pnt aP;
+    gp_Vec aDU, aDV, aDUU, aDVV, aDUV;
+    anAdaptor.D0 (aU, aV, aP);
+    aMaxDev[0] = Max (aMaxDev[0], aP.Distance (aPnts0 (i)));
+    anAdaptor.D1 (aU, aV, aP, aDU, aDV);
+    aMaxDev[1] = Max (aMaxDev[1], aP.Distance (aPnts1 (i)));
+    aMaxDev[1] = Max (aMaxDev[1], Max ((aDU - aD1U1 (i)).Magnitude(), (aDV - aD1V1 (i)).Magnitude()));
+    anAdaptor.D2 (aU, aV, aP, aDU, aDV, aDUU, aDVV, aDUV);
+    aMaxDev[2] = Max (aMaxDev[2], aP.Distance (aPnts2 (i)));
+    aMaxDev[2] = Max (aMaxDev[2], Max ((aDU - aD1U2 (i)).Magnitude(), (aDV - aD1V2 (i)).Magnitude()));
+    aMaxDev[2] = Max (aMaxDev[2], Max ((aDUU - aD2U (i)).Magnitude(), (aDVV - aD2V (i)).Magnitude()));
+    aMaxDev[2] = Max (aMaxDev[2], (aDUV - aD2UV (i)).Magnitude());
+  }
+  theDI << "Max deviation of D0: " << aMaxDev[0] << ", D1: " << aMaxDev[1] << ", D2: " << aMaxDev[2] << "\n";
+  return 0;
+}
+
 //=======================================================================
 //function : SurfaceCommands
 //purpose  : 
@@ -430,6 +511,13 @@ void  GeometryTest::SurfaceCommands(Draw_Interpretor& theCommands)
 		  __FILE__,
 		  GetSurfaceContinuity,g);
 
+ theCommands.Add("sbatcheval",
+		  "sbatcheval surface nbu nbv [-shuffle]: \n\tEvaluates the points and derivatives of the surface in the nbu x nbv grid"
+		  "\n\tby one call and point by point and prints the maximal deviations;"
+		  "\n\twith -shuffle the nodes are not sorted",
+		  __FILE__,
+		  sbatcheval,g);
+
 
 }
 
@@ -21,10 +21,50 @@
 #include <HLRAlgo_ListOfBPoint.hxx>
 #include <HLRAlgo_PolyShellData.hxx>
 #include <HLRAlgo_PolyMask.hxx>
+#include <OSD_Parallel.hxx>
 #include <Precision.hxx>
+#include <TColStd_Array1OfInteger.hxx>
 
 IMPLEMENT_STANDARD_RTTIEXT(HLRAlgo_PolyAlgo,Standard_Transient)
 
+//=======================================================================
+//class    : HideFunctor
+//purpose  : Computes the hidden parts of the segments in parallel
+//=======================================================================
+
+class HLRAlgo_PolyAlgo::HideFunctor
+{
+public:
+
+  HideFunctor (const HLRAlgo_PolyAlgo& theAlgo,
+               const NCollection_Array1<HLRAlgo_BiPoint*>& theSegments,
+               const TColStd_Array1OfInteger& theShells,
+               NCollection_Array1<HLRAlgo_EdgeStatus>& theStatus)
+  : myAlgo     (theAlgo),
+    mySegments (theSegments),
+    myShells   (theShells),
+    myStatus   (theStatus)
+  {}
+
+  void operator() (const Standard_Integer theIndex) const
+  {
+    // the triangle keeps the intermediate data of the hiding
+    HLRAlgo_PolyData::Triangle aTriangle = myAlgo.myTriangle;
+    myAlgo.hideSegment (*mySegments (theIndex), myShells (theIndex),
+                        aTriangle, myStatus (theIndex));
+  }
+
+private:
+  HideFunctor (const HideFunctor&);
+  HideFunctor& operator= (const HideFunctor&);
+
+private:
+  const HLRAlgo_PolyAlgo&                     myAlgo;
+  const NCollection_Array1<HLRAlgo_BiPoint*>& mySegments;
+  const TColStd_Array1OfInteger&              myShells;
+  NCollection_Array1<HLRAlgo_EdgeStatus>&     myStatus;
+};
+
 //=======================================================================
 //function : HLRAlgo_PolyAlgo
 //purpose  : 
@@ -33,7 +73,9 @@ IMPLEMENT_STANDARD_RTTIEXT(HLRAlgo_PolyAlgo,Standard_Transient)
 HLRAlgo_PolyAlgo::HLRAlgo_PolyAlgo ()
 : myNbrShell(0),
   myCurShell(0),
-  myFound(Standard_False)
+  myCurSeg(0),
+  myFound(Standard_False),
+  myRunParallel(Standard_False)
 {
   myTriangle.TolParam   = 0.00000001;
   myTriangle.TolAng = 0.0001;
@@ -56,6 +98,8 @@ void HLRAlgo_PolyAlgo::Clear()
 {
   NCollection_Array1<Handle(HLRAlgo_PolyShellData)> anEmpty;
   myHShell.Move (anEmpty);
+  NCollection_Array1<HLRAlgo_EdgeStatus> anEmptyStatus;
+  mySegStatus.Move (anEmptyStatus);
   myNbrShell = 0;
 }
 
@@ -276,6 +320,7 @@ void HLRAlgo_PolyAlgo::Update ()
 	if (yShellMax < yPolyTMax) yShellMax = yPolyTMax;
 	if (zShellMin > zPolyTMin) zShellMin = zPolyTMin;
 	if (zShellMax < zPolyTMax) zShellMax = zPolyTMax;
+	aPd->UpdateHidingTree (DecaX, DecaY, SurDX, SurDY);
       }
     }
     if (nbFaHi > 0) {
@@ -309,6 +354,41 @@ void HLRAlgo_PolyAlgo::Update ()
       aShellIndices.Max = 0;
     }
   }
+
+  NCollection_Array1<HLRAlgo_EdgeStatus> anEmptyStatus;
+  mySegStatus.Move (anEmptyStatus);
+  if (!myRunParallel)
+  {
+    return;
+  }
+
+  // the hidden parts of all the segments are computed in parallel
+  // and returned by Hide() in the order of the iteration
+  Standard_Integer aNbSeg = 0;
+  for (Standard_Integer aShellIter = myHShell.Lower(); aShellIter <= myHShell.Upper(); ++aShellIter)
+  {
+    aNbSeg += myHShell.Value (aShellIter)->Edges().Extent();
+  }
+  if (aNbSeg == 0)
+  {
+    return;
+  }
+
+  NCollection_Array1<HLRAlgo_BiPoint*> aSegments (1, aNbSeg);
+  TColStd_Array1OfInteger aShells (1, aNbSeg);
+  Standard_Integer aSegIter = 0;
+  for (Standard_Integer aShellIter = myHShell.Lower(); aShellIter <= myHShell.Upper(); ++aShellIter)
+  {
+    for (HLRAlgo_ListIteratorOfListOfBPoint anIt (myHShell.ChangeValue (aShellIter)->Edges()); anIt.More(); anIt.Next())
+    {
+      ++aSegIter;
+      aSegments (aSegIter) = &anIt.ChangeValue();
+      aShells (aSegIter) = aShellIter;
+    }
+  }
+  mySegStatus.Resize (1, aNbSeg, Standard_False);
+  HideFunctor aFunctor (*this, aSegments, aShells, mySegStatus);
+  OSD_Parallel::For (1, aNbSeg + 1, aFunctor);
 }
 
 //=======================================================================
@@ -318,6 +398,7 @@ void HLRAlgo_PolyAlgo::Update ()
 void HLRAlgo_PolyAlgo::NextHide()
 {
   myFound = Standard_False;
+  myCurSeg++;
   if (myCurShell != 0)
   {
     mySegListIt.Next();
@@ -350,24 +431,44 @@ HLRAlgo_BiPoint::PointsT& HLRAlgo_PolyAlgo::Hide (HLRAlgo_EdgeStatus& theStatus,
                                                   Standard_Boolean& theIntl)
 {
   HLRAlgo_BiPoint& aBP = mySegListIt.ChangeValue();
-  HLRAlgo_BiPoint::PointsT&  aPoints   = aBP.Points();
-  HLRAlgo_BiPoint::IndicesT& anIndices = aBP.Indices();
-  theStatus = HLRAlgo_EdgeStatus (0.0, (Standard_ShortReal)myTriangle.TolParam,
-                                  1.0, (Standard_ShortReal)myTriangle.TolParam);
-  theIndex = anIndices.ShapeIndex;
+  theIndex = aBP.Indices().ShapeIndex;
   theReg1  = aBP.Rg1Line();
   theRegn  = aBP.RgNLine();
   theOutl  = aBP.OutLine();
   theIntl  = aBP.IntLine();
-  if (aBP.Hidden())
+  if (mySegStatus.IsEmpty())
+  {
+    hideSegment (aBP, myCurShell, myTriangle, theStatus);
+  }
+  else
+  {
+    theStatus = mySegStatus (myCurSeg);
+  }
+  return aBP.Points();
+}
+
+//=======================================================================
+//function : hideSegment
+//purpose  :
+//=======================================================================
+void HLRAlgo_PolyAlgo::hideSegment (HLRAlgo_BiPoint& theBP,
+                                    const Standard_Integer theShell,
+                                    HLRAlgo_PolyData::Triangle& theTriangle,
+                                    HLRAlgo_EdgeStatus& theStatus) const
+{
+  HLRAlgo_BiPoint::PointsT&  aPoints   = theBP.Points();
+  HLRAlgo_BiPoint::IndicesT& anIndices = theBP.Indices();
+  theStatus = HLRAlgo_EdgeStatus (0.0, (Standard_ShortReal)theTriangle.TolParam,
+                                  1.0, (Standard_ShortReal)theTriangle.TolParam);
+  if (theBP.Hidden())
   {
     theStatus.HideAll();
-    return aPoints;
+    return;
   }
 
   for (Standard_Integer s = 1; s <= myNbrShell; s++)
   {
-    const Handle(HLRAlgo_PolyShellData)& aPsd = myHShell.ChangeValue (s);
+    const Handle(HLRAlgo_PolyShellData)& aPsd = myHShell.Value (s);
     if (!aPsd->Hiding())
     {
       continue;
@@ -377,21 +478,20 @@ HLRAlgo_BiPoint::PointsT& HLRAlgo_PolyAlgo::Hide (HLRAlgo_EdgeStatus& theStatus,
     if (((aShellIndices.Max - anIndices.MinSeg) & 0x80100200) == 0 &&
         ((anIndices.MaxSeg - aShellIndices.Min) & 0x80100000) == 0)
     {
-      const Standard_Boolean isHidingShell = (s == myCurShell);
+      const Standard_Boolean isHidingShell = (s == theShell);
       NCollection_Array1<Handle(HLRAlgo_PolyData)>& aFace = aPsd->HidingPolyData();
       const Standard_Integer nbFace = aFace.Upper();
       for (Standard_Integer f = 1; f <= nbFace; f++)
       {
         const Handle(HLRAlgo_PolyData)& aPd = aFace.ChangeValue (f);
         aPd->HideByPolyData (aPoints,
-                              myTriangle,
+                              theTriangle,
                               anIndices,
                               isHidingShell,
                               theStatus);
       }
     }
   }
-  return aPoints;
 }
 
 //=======================================================================
@@ -19,8 +19,8 @@
 
 #include <HLRAlgo_PolyData.hxx>
 #include <HLRAlgo_ListIteratorOfListOfBPoint.hxx>
+#include <HLRAlgo_EdgeStatus.hxx>
 
-class HLRAlgo_EdgeStatus;
 class HLRAlgo_PolyShellData;
 
 class HLRAlgo_PolyAlgo;
@@ -42,12 +42,21 @@ public:
 
   Standard_EXPORT void Clear();
 
+  //! Sets the mode of computation of the hidden parts of
+  //! all the segments in parallel threads by Update().
+  void SetRunParallel (const Standard_Boolean theIsParallel) { myRunParallel = theIsParallel; }
+
+  //! Returns True if the hidden parts of the segments are
+  //! computed in parallel threads.
+  Standard_Boolean RunParallel() const { return myRunParallel; }
+
   //! Prepare all the data to process the algo.
   Standard_EXPORT void Update();
 
   void InitHide()
   {
     myCurShell = 0;
+    myCurSeg = 0;
     NextHide();
   }
 
@@ -82,14 +91,28 @@ public:
 
   DEFINE_STANDARD_RTTIEXT(HLRAlgo_PolyAlgo,Standard_Transient)
 
+private:
+
+  //! Computes the hidden parts of the segment <theBP> of
+  //! the shell <theShell>.
+  void hideSegment (HLRAlgo_BiPoint& theBP,
+                    const Standard_Integer theShell,
+                    HLRAlgo_PolyData::Triangle& theTriangle,
+                    HLRAlgo_EdgeStatus& theStatus) const;
+
+  class HideFunctor;
+
 private:
 
   NCollection_Array1<Handle(HLRAlgo_PolyShellData)> myHShell;
+  NCollection_Array1<HLRAlgo_EdgeStatus> mySegStatus;
   HLRAlgo_PolyData::Triangle myTriangle;
   HLRAlgo_ListIteratorOfListOfBPoint mySegListIt;
   Standard_Integer myNbrShell;
   Standard_Integer myCurShell;
+  Standard_Integer myCurSeg;
   Standard_Boolean myFound;
+  Standard_Boolean myRunParallel;
 
 };
 
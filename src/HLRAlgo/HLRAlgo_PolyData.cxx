@@ -18,14 +18,72 @@
 
 #include <HLRAlgo_EdgeStatus.hxx>
 #include <HLRAlgo_PolyMask.hxx>
+#include <BVH_LinearBuilder.hxx>
+#include <BVH_Traverse.hxx>
+#include <NCollection_Vector.hxx>
 
 #include <Standard_Type.hxx>
 
+#include <algorithm>
+
 IMPLEMENT_STANDARD_RTTIEXT(HLRAlgo_PolyData,Standard_Transient)
 
 #ifdef OCCT_DEBUG
 static Standard_Integer HLRAlgo_PolyData_ERROR = Standard_False;
 #endif
+//! Minimal number of the hiding triangles of a face to sort their boxes in a BVH tree.
+static const Standard_Integer HLRAlgo_PolyData_MinNbTrianglesForTree = 32;
+
+//=======================================================================
+//class    : HLRAlgo_HidingBoxSelector
+//purpose  : Selects from the BVH tree the hiding triangles which
+//           boxes are not rejected by the box of the segment.
+//=======================================================================
+
+class HLRAlgo_HidingBoxSelector :
+  public BVH_Traverse<Standard_Real, 2,
+                      BVH_BoxSet<Standard_Real, 2, Standard_Integer>,
+                      Standard_Boolean>
+{
+public:
+
+  HLRAlgo_HidingBoxSelector (const BVH_Box<Standard_Real, 2>& theBox,
+                             NCollection_Vector<Standard_Integer>& theIndices)
+  : myBox (theBox),
+    myIndices (theIndices)
+  {}
+
+  virtual Standard_Boolean RejectNode (const BVH_Vec2d& theCMin,
+                                       const BVH_Vec2d& theCMax,
+                                       Standard_Boolean& theIsInside) const Standard_OVERRIDE
+  {
+    Standard_Boolean hasOverlap;
+    theIsInside = myBox.Contains (theCMin, theCMax, hasOverlap);
+    return !hasOverlap;
+  }
+
+  virtual Standard_Boolean AcceptMetric (const Standard_Boolean& theIsInside) const Standard_OVERRIDE
+  {
+    return theIsInside;
+  }
+
+  virtual Standard_Boolean Accept (const Standard_Integer theIndex,
+                                   const Standard_Boolean& theIsInside) Standard_OVERRIDE
+  {
+    if (theIsInside || !myBox.IsOut (this->myBVHSet->Box (theIndex)))
+    {
+      myIndices.Append (this->myBVHSet->Element (theIndex));
+      return Standard_True;
+    }
+    return Standard_False;
+  }
+
+private:
+
+  BVH_Box<Standard_Real, 2>        myBox;
+  NCollection_Vector<Standard_Integer>& myIndices;
+};
+
 //=======================================================================
 //function : PolyData
 //purpose  : 
@@ -110,6 +168,49 @@ HLRAlgo_PolyData::UpdateGlobalMinMax (Box& theBox)
   }
 }
 
+//=======================================================================
+//function : UpdateHidingTree
+//purpose  : 
+//=======================================================================
+
+void HLRAlgo_PolyData::UpdateHidingTree (const Standard_Real theDecaX,
+                                         const Standard_Real theDecaY,
+                                         const Standard_Real theSurDX,
+                                         const Standard_Real theSurDY)
+{
+  myHidingTree.Nullify();
+  if (myHPHDat.IsNull() ||
+      myHPHDat->Length() < HLRAlgo_PolyData_MinNbTrianglesForTree)
+    return;
+
+  const TColgp_Array1OfXYZ&    Nodes = myHNodes->Array1();
+  const HLRAlgo_Array1OfTData& TData = myHTData->Array1();
+  HLRAlgo_Array1OfPHDat&       PHDat = myHPHDat->ChangeArray1();
+  myHidingTree = new BVH_BoxSet<Standard_Real, 2, Standard_Integer>
+    (new BVH_LinearBuilder<Standard_Real, 2>());
+  myHidingTree->SetSize(PHDat.Length());
+
+  for (Standard_Integer h = PHDat.Lower(); h <= PHDat.Upper(); h++) {
+    const HLRAlgo_TriangleData& aTriangle = TData(PHDat(h).Indices().Index);
+    const gp_XYZ& P1 = Nodes(aTriangle.Node1);
+    const gp_XYZ& P2 = Nodes(aTriangle.Node2);
+    const gp_XYZ& P3 = Nodes(aTriangle.Node3);
+    const Standard_Real xMin = Min(P1.X(), Min(P2.X(), P3.X()));
+    const Standard_Real xMax = Max(P1.X(), Max(P2.X(), P3.X()));
+    const Standard_Real yMin = Min(P1.Y(), Min(P2.Y(), P3.Y()));
+    const Standard_Real yMax = Max(P1.Y(), Max(P2.Y(), P3.Y()));
+    // same grid as the encoded MinMax of the triangle
+    const Standard_Integer nxMin = (Standard_Integer)((theDecaX + xMin) * theSurDX);
+    const Standard_Integer nyMin = (Standard_Integer)((theDecaY + yMin) * theSurDY);
+    const Standard_Integer nxMax = (Standard_Integer)((theDecaX + xMax) * theSurDX);
+    const Standard_Integer nyMax = (Standard_Integer)((theDecaY + yMax) * theSurDY);
+    myHidingTree->Add(h, BVH_Box<Standard_Real, 2>
+                      (BVH_Vec2d((Standard_Real)nxMin, (Standard_Real)nyMin),
+                       BVH_Vec2d((Standard_Real)nxMax, (Standard_Real)nyMax)));
+  }
+  myHidingTree->Build();
+}
+
 //=======================================================================
 //function : HideByPolyData
 //purpose  : 
@@ -124,102 +225,141 @@ void HLRAlgo_PolyData::HideByPolyData (const HLRAlgo_BiPoint::PointsT& thePoints
   if (((myFaceIndices.Max - theIndices.MinSeg) & 0x80100200) == 0 &&
       ((theIndices.MaxSeg - myFaceIndices.Min) & 0x80100000) == 0) {
     HLRAlgo_Array1OfPHDat& PHDat = myHPHDat->ChangeArray1();
-    const HLRAlgo_Array1OfTData& TData = myHTData->Array1();
-    Standard_Real d1,d2;
-    Standard_Boolean NotConnex    = Standard_False;
-    Standard_Boolean isCrossing   = Standard_False;
-    Standard_Boolean toHideBefore = Standard_False;
-    Standard_Integer TFlag = 0;
-    Standard_Integer h,h2 = PHDat.Upper();
-    HLRAlgo_PolyHidingData* PH = &(PHDat(1));
+    if (myHidingTree.IsNull()) {
+      Standard_Integer h,h2 = PHDat.Upper();
+      HLRAlgo_PolyHidingData* PH = &(PHDat(1));
     
-    for (h = 1; h <= h2; h++) {
-      HLRAlgo_PolyHidingData::TriangleIndices& aTriangleIndices = PH->Indices();
-      if (((aTriangleIndices.Max - theIndices.MinSeg) & 0x80100200) == 0 &&
-	  ((theIndices.MaxSeg - aTriangleIndices.Min) & 0x80100000) == 0) {
-	const HLRAlgo_TriangleData& aTriangle = TData(aTriangleIndices.Index);
-	NotConnex = Standard_True;
-	if (HidingShell) {
-	  if      (myFaceIndices.Index == theIndices.FaceConex1) {
-	    if      (theIndices.Face1Pt1 == aTriangle.Node1)
-	      NotConnex = theIndices.Face1Pt2 != aTriangle.Node2 && theIndices.Face1Pt2 != aTriangle.Node3;
-	    else if (theIndices.Face1Pt1 == aTriangle.Node2)
-	      NotConnex = theIndices.Face1Pt2 != aTriangle.Node3 && theIndices.Face1Pt2 != aTriangle.Node1;
-	    else if (theIndices.Face1Pt1 == aTriangle.Node3)
-	      NotConnex = theIndices.Face1Pt2 != aTriangle.Node1 && theIndices.Face1Pt2 != aTriangle.Node2;
-	  }
-	  else if (myFaceIndices.Index == theIndices.FaceConex2) {
-	    if      (theIndices.Face2Pt1 == aTriangle.Node1)
-	      NotConnex = theIndices.Face2Pt2 != aTriangle.Node2 && theIndices.Face2Pt2 != aTriangle.Node3;
-	    else if (theIndices.Face2Pt1 == aTriangle.Node2)
-	      NotConnex = theIndices.Face2Pt2 != aTriangle.Node3 && theIndices.Face2Pt2 != aTriangle.Node1;
-	    else if (theIndices.Face2Pt1 == aTriangle.Node3)
-	      NotConnex = theIndices.Face2Pt2 != aTriangle.Node1 && theIndices.Face2Pt2 != aTriangle.Node2;
-	  }
-	}
-	if (NotConnex) {
-	  HLRAlgo_PolyHidingData::PlaneT& aPlane = PH->Plane();
-	  d1 = aPlane.Normal * thePoints.PntP1 - aPlane.D;
-	  d2 = aPlane.Normal * thePoints.PntP2 - aPlane.D;
-	  if      (d1 > theTriangle.Tolerance) {
-	    if    (d2 < -theTriangle.Tolerance) {
-	      theTriangle.Param = d1 / ( d1 - d2 );
-	      toHideBefore = Standard_False;
-	      isCrossing   = Standard_True;
-	      TFlag = aTriangle.Flags;
-	      const TColgp_Array1OfXYZ& Nodes = myHNodes->Array1();
-	      const gp_XYZ            & P1    = Nodes(aTriangle.Node1);
-	      const gp_XYZ            & P2    = Nodes(aTriangle.Node2);
-	      const gp_XYZ            & P3    = Nodes(aTriangle.Node3);
+      for (h = 1; h <= h2; h++) {
+        hideByHidingData (*PH, thePoints, theTriangle, theIndices, HidingShell, status);
+        PH++;
+      }
+    }
+    else {
+      // the triangles crossing the box of the segment (enlarged by
+      // one cell of the grid as the encoded Min of the triangles)
+      // are hidden in the order of the list of hiding triangles
+      const BVH_Box<Standard_Real, 2> aSegBox
+        (BVH_Vec2d((Standard_Real)((theIndices.MinSeg >> 21) - 1),
+                   (Standard_Real)(((theIndices.MinSeg >> 10) & 0x7ff) - 1)),
+         BVH_Vec2d((Standard_Real)((theIndices.MaxSeg >> 21) + 1),
+                   (Standard_Real)(((theIndices.MaxSeg >> 10) & 0x7ff) + 1)));
+      NCollection_Vector<Standard_Integer> aSelected;
+      HLRAlgo_HidingBoxSelector aSelector (aSegBox, aSelected);
+      aSelector.SetBVHSet (myHidingTree.get());
+      aSelector.Select();
+      std::sort (aSelected.begin(), aSelected.end());
+
+      for (NCollection_Vector<Standard_Integer>::Iterator anIt (aSelected);
+           anIt.More(); anIt.Next()) {
+        hideByHidingData (PHDat(anIt.Value()), thePoints, theTriangle,
+                          theIndices, HidingShell, status);
+      }
+    }
+  }
+}
+
+//=======================================================================
+//function : hideByHidingData
+//purpose  : 
+//=======================================================================
+
+void HLRAlgo_PolyData::hideByHidingData (HLRAlgo_PolyHidingData& thePH,
+                                         const HLRAlgo_BiPoint::PointsT& thePoints,
+                                         Triangle& theTriangle,
+                                         const HLRAlgo_BiPoint::IndicesT& theIndices,
+                                         const Standard_Boolean HidingShell,
+                                         HLRAlgo_EdgeStatus& status)
+{
+  const HLRAlgo_Array1OfTData& TData = myHTData->Array1();
+  Standard_Real d1,d2;
+  Standard_Boolean NotConnex    = Standard_False;
+  Standard_Boolean isCrossing   = Standard_False;
+  Standard_Boolean toHideBefore = Standard_False;
+  Standard_Integer TFlag = 0;
+  HLRAlgo_PolyHidingData* PH = &thePH;
+  HLRAlgo_PolyHidingData::TriangleIndices& aTriangleIndices = PH->Indices();
+  if (((aTriangleIndices.Max - theIndices.MinSeg) & 0x80100200) == 0 &&
+      ((theIndices.MaxSeg - aTriangleIndices.Min) & 0x80100000) == 0) {
+    const HLRAlgo_TriangleData& aTriangle = TData(aTriangleIndices.Index);
+    NotConnex = Standard_True;
+    if (HidingShell) {
+      if      (myFaceIndices.Index == theIndices.FaceConex1) {
+        if      (theIndices.Face1Pt1 == aTriangle.Node1)
+          NotConnex = theIndices.Face1Pt2 != aTriangle.Node2 && theIndices.Face1Pt2 != aTriangle.Node3;
+        else if (theIndices.Face1Pt1 == aTriangle.Node2)
+          NotConnex = theIndices.Face1Pt2 != aTriangle.Node3 && theIndices.Face1Pt2 != aTriangle.Node1;
+        else if (theIndices.Face1Pt1 == aTriangle.Node3)
+          NotConnex = theIndices.Face1Pt2 != aTriangle.Node1 && theIndices.Face1Pt2 != aTriangle.Node2;
+      }
+      else if (myFaceIndices.Index == theIndices.FaceConex2) {
+        if      (theIndices.Face2Pt1 == aTriangle.Node1)
+          NotConnex = theIndices.Face2Pt2 != aTriangle.Node2 && theIndices.Face2Pt2 != aTriangle.Node3;
+        else if (theIndices.Face2Pt1 == aTriangle.Node2)
+          NotConnex = theIndices.Face2Pt2 != aTriangle.Node3 && theIndices.Face2Pt2 != aTriangle.Node1;
+        else if (theIndices.Face2Pt1 == aTriangle.Node3)
+          NotConnex = theIndices.Face2Pt2 != aTriangle.Node1 && theIndices.Face2Pt2 != aTriangle.Node2;
+      }
+    }
+    if (NotConnex) {
+      HLRAlgo_PolyHidingData::PlaneT& aPlane = PH->Plane();
+      d1 = aPlane.Normal * thePoints.PntP1 - aPlane.D;
+      d2 = aPlane.Normal * thePoints.PntP2 - aPlane.D;
+      if      (d1 > theTriangle.Tolerance) {
+        if    (d2 < -theTriangle.Tolerance) {
+          theTriangle.Param = d1 / ( d1 - d2 );
+          toHideBefore = Standard_False;
+          isCrossing   = Standard_True;
+          TFlag = aTriangle.Flags;
+          const TColgp_Array1OfXYZ& Nodes = myHNodes->Array1();
+          const gp_XYZ            & P1    = Nodes(aTriangle.Node1);
+          const gp_XYZ            & P2    = Nodes(aTriangle.Node2);
+          const gp_XYZ            & P3    = Nodes(aTriangle.Node3);
+          theTriangle.V1 = gp_XY(P1.X(), P1.Y());
+          theTriangle.V2 = gp_XY(P2.X(), P2.Y());
+          theTriangle.V3 = gp_XY(P3.X(), P3.Y());
+          hideByOneTriangle (thePoints, theTriangle, isCrossing, toHideBefore, TFlag, status);
+        }
+      }
+      else if (d1 < -theTriangle.Tolerance) {
+        if    (d2 > theTriangle.Tolerance) {
+          theTriangle.Param = d1 / ( d1 - d2 );
+          toHideBefore = Standard_True;
+          isCrossing   = Standard_True;
+          TFlag = aTriangle.Flags;
+          const TColgp_Array1OfXYZ& Nodes = myHNodes->Array1();
+          const gp_XYZ            & P1    = Nodes(aTriangle.Node1);
+          const gp_XYZ            & P2    = Nodes(aTriangle.Node2);
+          const gp_XYZ            & P3    = Nodes(aTriangle.Node3);
+          theTriangle.V1 = gp_XY(P1.X(), P1.Y());
+          theTriangle.V2 = gp_XY(P2.X(), P2.Y());
+          theTriangle.V3 = gp_XY(P3.X(), P3.Y());
+          hideByOneTriangle (thePoints, theTriangle, isCrossing, toHideBefore, TFlag, status);
+        }
+        else {
+          isCrossing = Standard_False;
+          TFlag = aTriangle.Flags;
+          const TColgp_Array1OfXYZ& Nodes = myHNodes->Array1();
+          const gp_XYZ            & P1    = Nodes(aTriangle.Node1);
+          const gp_XYZ            & P2    = Nodes(aTriangle.Node2);
+          const gp_XYZ            & P3    = Nodes(aTriangle.Node3);
+          theTriangle.V1 = gp_XY(P1.X(), P1.Y());
+          theTriangle.V2 = gp_XY(P2.X(), P2.Y());
+          theTriangle.V3 = gp_XY(P3.X(), P3.Y());
+          hideByOneTriangle (thePoints, theTriangle, isCrossing, toHideBefore, TFlag, status);
+        }
+      }
+      else if (d2 < -theTriangle.Tolerance) {
+        isCrossing = Standard_False;
+        TFlag = aTriangle.Flags;
+        const TColgp_Array1OfXYZ& Nodes = myHNodes->Array1();
+        const gp_XYZ            & P1    = Nodes(aTriangle.Node1);
+        const gp_XYZ            & P2    = Nodes(aTriangle.Node2);
+        const gp_XYZ            & P3    = Nodes(aTriangle.Node3);
         theTriangle.V1 = gp_XY(P1.X(), P1.Y());
         theTriangle.V2 = gp_XY(P2.X(), P2.Y());
         theTriangle.V3 = gp_XY(P3.X(), P3.Y());
-	      hideByOneTriangle (thePoints, theTriangle, isCrossing, toHideBefore, TFlag, status);
-	    }
-	  }
-	  else if (d1 < -theTriangle.Tolerance) {
-	    if    (d2 > theTriangle.Tolerance) {
-	      theTriangle.Param = d1 / ( d1 - d2 );
-	      toHideBefore = Standard_True;
-	      isCrossing   = Standard_True;
-	      TFlag = aTriangle.Flags;
-	      const TColgp_Array1OfXYZ& Nodes = myHNodes->Array1();
-	      const gp_XYZ            & P1    = Nodes(aTriangle.Node1);
-	      const gp_XYZ            & P2    = Nodes(aTriangle.Node2);
-	      const gp_XYZ            & P3    = Nodes(aTriangle.Node3);
-	      theTriangle.V1 = gp_XY(P1.X(), P1.Y());
-	      theTriangle.V2 = gp_XY(P2.X(), P2.Y());
-	      theTriangle.V3 = gp_XY(P3.X(), P3.Y());
-	      hideByOneTriangle (thePoints, theTriangle, isCrossing, toHideBefore, TFlag, status);
-	    }
-	    else {
-	      isCrossing = Standard_False;
-	      TFlag = aTriangle.Flags;
-	      const TColgp_Array1OfXYZ& Nodes = myHNodes->Array1();
-	      const gp_XYZ            & P1    = Nodes(aTriangle.Node1);
-	      const gp_XYZ            & P2    = Nodes(aTriangle.Node2);
-	      const gp_XYZ            & P3    = Nodes(aTriangle.Node3);
-	      theTriangle.V1 = gp_XY(P1.X(), P1.Y());
-	      theTriangle.V2 = gp_XY(P2.X(), P2.Y());
-	      theTriangle.V3 = gp_XY(P3.X(), P3.Y());
-	      hideByOneTriangle (thePoints, theTriangle, isCrossing, toHideBefore, TFlag, status);
-	    }
-	  }
-	  else if (d2 < -theTriangle.Tolerance) {
-	    isCrossing = Standard_False;
-	    TFlag = aTriangle.Flags;
-	    const TColgp_Array1OfXYZ& Nodes = myHNodes->Array1();
-	    const gp_XYZ            & P1    = Nodes(aTriangle.Node1);
-	    const gp_XYZ            & P2    = Nodes(aTriangle.Node2);
-	    const gp_XYZ            & P3    = Nodes(aTriangle.Node3);
-	    theTriangle.V1 = gp_XY(P1.X(), P1.Y());
-	    theTriangle.V2 = gp_XY(P2.X(), P2.Y());
-	    theTriangle.V3 = gp_XY(P3.X(), P3.Y());
-	    hideByOneTriangle(thePoints, theTriangle, isCrossing, toHideBefore, TFlag, status);
-	  }
-	}
+        hideByOneTriangle(thePoints, theTriangle, isCrossing, toHideBefore, TFlag, status);
       }
-      PH++;
     }
   }
 }
@@ -27,6 +27,7 @@
 #include <HLRAlgo_HArray1OfPHDat.hxx>
 #include <Standard_Transient.hxx>
 #include <Standard_Boolean.hxx>
+#include <BVH_BoxSet.hxx>
 
 class HLRAlgo_EdgeStatus;
 
@@ -112,6 +113,17 @@ public:
   
     Standard_Boolean Hiding() const;
   
+  //! Sorts  the boxes of the  hiding triangles in a BVH
+  //! tree used to select the triangles which may hide a
+  //! segment.  The boxes are computed  on the grid of the
+  //! encoded  MinMax defined  by <theDecaX>, <theDecaY>,
+  //! <theSurDX>  and <theSurDY>. The tree is  built only
+  //! for the faces with many hiding triangles.
+  Standard_EXPORT void UpdateHidingTree (const Standard_Real theDecaX,
+                                         const Standard_Real theDecaY,
+                                         const Standard_Real theSurDX,
+                                         const Standard_Real theSurDY);
+
   //! process hiding between <Pt1> and <Pt2>.
   Standard_EXPORT void HideByPolyData (const HLRAlgo_BiPoint::PointsT& thePoints, Triangle& theTriangle, HLRAlgo_BiPoint::IndicesT& theIndices, const Standard_Boolean HidingShell, HLRAlgo_EdgeStatus& status);
   
@@ -124,6 +136,14 @@ public:
 
 private:
 
+  //! process hiding between <Pt1> and <Pt2> by one hiding triangle.
+  void hideByHidingData (HLRAlgo_PolyHidingData& thePH,
+                         const HLRAlgo_BiPoint::PointsT& thePoints,
+                         Triangle& theTriangle,
+                         const HLRAlgo_BiPoint::IndicesT& theIndices,
+                         const Standard_Boolean HidingShell,
+                         HLRAlgo_EdgeStatus& status);
+
   //! evident.
   void hideByOneTriangle (const HLRAlgo_BiPoint::PointsT& thePoints,
                           Triangle& theTriangle,
@@ -136,6 +156,7 @@ private:
   Handle(TColgp_HArray1OfXYZ) myHNodes;
   Handle(HLRAlgo_HArray1OfTData) myHTData;
   Handle(HLRAlgo_HArray1OfPHDat) myHPHDat;
+  opencascade::handle<BVH_BoxSet<Standard_Real, 2, Standard_Integer> > myHidingTree;
 
 };
 
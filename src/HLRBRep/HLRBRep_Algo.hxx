@@ -53,6 +53,10 @@ DEFINE_STANDARD_HANDLE(HLRBRep_Algo, HLRBRep_InternalAlgo)
 //! -   identifying the shape or shapes to be visualized
 //! -   calculating the outlines
 //! -   calculating the visible and hidden lines of the shape.
+//! The loaded data are modified by the computation for the given point of view,
+//! so several views of the same shape are computed by separate HLRBRep_Algo
+//! objects, which may be used concurrently in parallel threads
+//! (see HLRBRep_ViewsAlgo).
 //! Warning
 //! -   Superimposed lines are not eliminated by this algorithm.
 //! -   There must be no unfinished objects inside the shape you wish to visualize.
@@ -17,6 +17,8 @@
 //#define No_Standard_OutOfRange
 
 #include <BRepTopAdaptor_Tool.hxx>
+#include <BVH_LinearBuilder.hxx>
+#include <BVH_Traverse.hxx>
 #include <BRepTopAdaptor_TopolTool.hxx>
 #include <ElCLib.hxx>
 #include <Geom2d_Curve.hxx>
@@ -41,16 +43,19 @@
 #include <StdFail_UndefinedDerivative.hxx>
 #include <TColStd_ListIteratorOfListOfInteger.hxx>
 
+#include <algorithm>
+#include <atomic>
 #include <stdio.h>
 IMPLEMENT_STANDARD_RTTIEXT(HLRBRep_Data,Standard_Transient)
 
-Standard_Integer nbOkIntersection;
-Standard_Integer nbPtIntersection;
-Standard_Integer nbSegIntersection;
-Standard_Integer nbClassification;
-Standard_Integer nbCal1Intersection; // pairs of unrejected edges
-Standard_Integer nbCal2Intersection; // true intersections (not vertex)
-Standard_Integer nbCal3Intersection; // Curve-Surface intersections
+// the counters are atomic as several views may be hidden concurrently
+std::atomic<Standard_Integer> nbOkIntersection;
+std::atomic<Standard_Integer> nbPtIntersection;
+std::atomic<Standard_Integer> nbSegIntersection;
+std::atomic<Standard_Integer> nbClassification;
+std::atomic<Standard_Integer> nbCal1Intersection; // pairs of unrejected edges
+std::atomic<Standard_Integer> nbCal2Intersection; // true intersections (not vertex)
+std::atomic<Standard_Integer> nbCal3Intersection; // Curve-Surface intersections
 
 static const Standard_Real CutLar = 2.e-1;
 static const Standard_Real CutBig = 1.e-1;
@@ -407,11 +412,13 @@ HLRBRep_Data::HLRBRep_Data (const Standard_Integer NV,
 			    myEData      (0,NE),
 			    myFData      (0,NF),
 			    myEdgeIndices(0,NE),
+			    myFaceEdgeIndices(0,NE),
 			    myToler((Standard_ShortReal)1e-5),
 			    myLLProps(2,Epsilon(1.)),
 			    myFLProps(2,Epsilon(1.)),
 			    mySLProps(2,Epsilon(1.)),
-			    myHideCount(0)
+			    myHideCount(0),
+			    myNbrFaceEd(0)
 {
   myReject = new TableauRejection();
   ((TableauRejection *)myReject)->SetDim(myNbEdges);
@@ -794,6 +801,82 @@ void HLRBRep_Data::Update (const HLRAlgo_Projector& P)
   }
 }
 
+//! Minimal number of the sorted edges to build the BVH tree of their boxes.
+static const Standard_Integer HLRBRep_Data_MinNbEdgesForTree = 32;
+
+//=======================================================================
+//function : HLRBRep_Data_ProjectedBox
+//purpose  : Returns the box of the first two projected coordinates
+//           (x and -y) stored in the encoded MinMax.
+//=======================================================================
+
+static BVH_Box<Standard_Real, 2>
+HLRBRep_Data_ProjectedBox (const HLRAlgo_EdgesBlock::MinMaxIndices& theMinMax)
+{
+  HLRAlgo_EdgesBlock::MinMaxIndices aMin, aMax;
+  HLRAlgo::DecodeMinMax(theMinMax, aMin, aMax);
+  return BVH_Box<Standard_Real, 2>
+    (BVH_Vec2d((Standard_Real)aMin.Min[0], (Standard_Real)aMin.Min[1]),
+     BVH_Vec2d((Standard_Real)aMax.Min[0], (Standard_Real)aMax.Min[1]));
+}
+
+//=======================================================================
+//class    : HLRBRep_EdgeBoxSelector
+//purpose  : Selects from the BVH tree the edges which boxes are
+//           not rejected by the box of the hiding face. It keeps
+//           all the edges accepted by the complete MinMax test
+//           done in NextEdge.
+//=======================================================================
+
+class HLRBRep_EdgeBoxSelector :
+  public BVH_Traverse<Standard_Real, 2,
+                      BVH_BoxSet<Standard_Real, 2, Standard_Integer>,
+                      Standard_Boolean>
+{
+public:
+
+  HLRBRep_EdgeBoxSelector (const BVH_Box<Standard_Real, 2>& theBox,
+                           TColStd_Array1OfInteger& theIndices)
+  : myBox (theBox),
+    myIndices (theIndices),
+    myNbIndices (0)
+  {}
+
+  //! Returns the number of the selected edges
+  Standard_Integer NbIndices() const { return myNbIndices; }
+
+  virtual Standard_Boolean RejectNode (const BVH_Vec2d& theCMin,
+                                       const BVH_Vec2d& theCMax,
+                                       Standard_Boolean& theIsInside) const Standard_OVERRIDE
+  {
+    Standard_Boolean hasOverlap;
+    theIsInside = myBox.Contains (theCMin, theCMax, hasOverlap);
+    return !hasOverlap;
+  }
+
+  virtual Standard_Boolean AcceptMetric (const Standard_Boolean& theIsInside) const Standard_OVERRIDE
+  {
+    return theIsInside;
+  }
+
+  virtual Standard_Boolean Accept (const Standard_Integer theIndex,
+                                   const Standard_Boolean& theIsInside) Standard_OVERRIDE
+  {
+    if (theIsInside || !myBox.IsOut (this->myBVHSet->Box (theIndex)))
+    {
+      myIndices (++myNbIndices) = this->myBVHSet->Element (theIndex);
+      return Standard_True;
+    }
+    return Standard_False;
+  }
+
+private:
+
+  BVH_Box<Standard_Real, 2> myBox;
+  TColStd_Array1OfInteger&  myIndices;
+  Standard_Integer          myNbIndices;
+};
+
 //=======================================================================
 //function : InitBoundSort
 //purpose  : 
@@ -831,6 +914,20 @@ HLRBRep_Data::InitBoundSort (const HLRAlgo_EdgesBlock::MinMaxIndices& MinMaxTot,
       }
     }
   }
+
+  // the edges crossing the box of each hiding face are taken
+  // from a BVH tree instead of testing all the sorted edges
+  myEdgeTree.Nullify();
+  if (myNbrSortEd >= HLRBRep_Data_MinNbEdgesForTree) {
+    myEdgeTree = new BVH_BoxSet<Standard_Real, 2, Standard_Integer>
+      (new BVH_LinearBuilder<Standard_Real, 2>());
+    myEdgeTree->SetSize(myNbrSortEd);
+    for (Standard_Integer i = 1; i <= myNbrSortEd; i++) {
+      const Standard_Integer e = myEdgeIndices(i);
+      myEdgeTree->Add(e, HLRBRep_Data_ProjectedBox(myEData(e).MinMax()));
+    }
+    myEdgeTree->Build();
+  }
 }
 
 //=======================================================================
@@ -874,6 +971,21 @@ void HLRBRep_Data::InitEdge (const Standard_Integer FI,
     myClassifier = BRT.GetTopolTool();
   }
   
+  if (myEdgeTree.IsNull())
+    myNbrFaceEd = myNbrSortEd;
+  else {
+    // the selected edges are sorted to be hidden in the same order
+    // as in the list of the sorted edges
+    HLRBRep_EdgeBoxSelector aSelector
+      (HLRBRep_Data_ProjectedBox(*iFaceMinMax), myFaceEdgeIndices);
+    aSelector.SetBVHSet(myEdgeTree.get());
+    aSelector.Select();
+    myNbrFaceEd = aSelector.NbIndices();
+    if (myNbrFaceEd > 1)
+      std::sort(&myFaceEdgeIndices.ChangeValue(1),
+                &myFaceEdgeIndices.ChangeValue(1) + myNbrFaceEd);
+  }
+  
   if (iFaceTest) {
     iFaceSmpl = !iFaceData->Cut();
     myFaceItr2.InitEdge(*iFaceData);
@@ -924,7 +1036,7 @@ Standard_Boolean HLRBRep_Data::MoreEdge ()
       NextEdge(Standard_False);
     }
   }
-  return myCurSortEd <= myNbrSortEd;
+  return myCurSortEd <= myNbrFaceEd;
 }
 //=======================================================================
 //function : NextEdge
@@ -1014,8 +1126,9 @@ void HLRBRep_Data::NextEdge (const Standard_Boolean skip)
 
 Standard_Integer HLRBRep_Data::Edge () const
 {
-  if (iFaceTest) return myFaceItr2.Edge();
-  else           return myEdgeIndices(myCurSortEd);
+  if (iFaceTest)               return myFaceItr2.Edge();
+  else if (myEdgeTree.IsNull()) return myEdgeIndices(myCurSortEd);
+  else                         return myFaceEdgeIndices(myCurSortEd);
 }
 
 //=======================================================================
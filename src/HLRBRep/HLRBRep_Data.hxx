@@ -41,6 +41,7 @@
 #include <BRepTopAdaptor_MapOfShapeTool.hxx>
 #include <TopAbs_State.hxx>
 #include <HLRAlgo_InterferenceList.hxx>
+#include <BVH_BoxSet.hxx>
 class BRepTopAdaptor_TopolTool;
 class gp_Dir2d;
 class HLRBRep_EdgeData;
@@ -94,6 +95,9 @@ public:
     TopTools_IndexedMapOfShape& FaceMap();
   
   //! to compare with only non rejected edges.
+  //! When there are many such edges their boxes are
+  //! also sorted in a BVH tree used by InitEdge to get
+  //! the edges crossing the box of the hiding face.
   Standard_EXPORT void InitBoundSort (const HLRAlgo_EdgesBlock::MinMaxIndices& MinMaxTot, const Standard_Integer e1, const Standard_Integer e2);
   
   //! Begin an iteration only  on visible Edges
@@ -206,6 +210,8 @@ private:
   HLRBRep_Array1OfEData myEData;
   HLRBRep_Array1OfFData myFData;
   TColStd_Array1OfInteger myEdgeIndices;
+  TColStd_Array1OfInteger myFaceEdgeIndices;
+  opencascade::handle<BVH_BoxSet<Standard_Real, 2, Standard_Integer> > myEdgeTree;
   Standard_ShortReal myToler;
   HLRAlgo_Projector myProj;
   HLRBRep_CLProps myLLProps;
@@ -228,6 +234,7 @@ private:
   Standard_Real mySurD[16];
   Standard_Integer myCurSortEd;
   Standard_Integer myNbrSortEd;
+  Standard_Integer myNbrFaceEd;
   Standard_Integer myLE;
   Standard_Boolean myLEOutLine;
   Standard_Boolean myLEInternal;
@@ -29,16 +29,17 @@
 #include <Standard_Type.hxx>
 #include <TColStd_Array1OfReal.hxx>
 
+#include <atomic>
 #include <stdio.h>
 IMPLEMENT_STANDARD_RTTIEXT(HLRBRep_InternalAlgo,Standard_Transient)
 
-extern Standard_Integer nbPtIntersection;   // total P.I.
-extern Standard_Integer nbSegIntersection;  // total S.I
-extern Standard_Integer nbClassification;   // total classification
-extern Standard_Integer nbOkIntersection;   // pairs of intersecting edges
-extern Standard_Integer nbCal1Intersection; // pairs of unrejected edges
-extern Standard_Integer nbCal2Intersection; // true intersections (not vertex)
-extern Standard_Integer nbCal3Intersection; // curve-surface intersections
+extern std::atomic<Standard_Integer> nbPtIntersection;   // total P.I.
+extern std::atomic<Standard_Integer> nbSegIntersection;  // total S.I
+extern std::atomic<Standard_Integer> nbClassification;   // total classification
+extern std::atomic<Standard_Integer> nbOkIntersection;   // pairs of intersecting edges
+extern std::atomic<Standard_Integer> nbCal1Intersection; // pairs of unrejected edges
+extern std::atomic<Standard_Integer> nbCal2Intersection; // true intersections (not vertex)
+extern std::atomic<Standard_Integer> nbCal3Intersection; // curve-surface intersections
 
 static Standard_Integer HLRBRep_InternalAlgo_TRACE = Standard_True;
 static Standard_Integer HLRBRep_InternalAlgo_TRACE10 = Standard_True; 
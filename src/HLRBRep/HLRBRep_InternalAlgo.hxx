@@ -108,6 +108,8 @@ public:
   Standard_EXPORT void PartialHide();
   
   //! hide all the DataStructure.
+  //! The faces hide the edges sequentially, several views
+  //! may be computed in parallel by HLRBRep_ViewsAlgo.
   Standard_EXPORT void Hide();
   
   //! hide the Shape <S> by itself.
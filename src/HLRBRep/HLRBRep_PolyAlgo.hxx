@@ -145,6 +145,13 @@ public:
     myTolEnd = 1.0 - theTol;
   }
 
+  //! Returns True if the hidden parts of the edges are computed in parallel threads.
+  Standard_Boolean RunParallel() const { return myAlgo->RunParallel(); }
+
+  //! Sets the mode of computation of the hidden parts of the edges
+  //! in parallel threads by Update(); by default sequential.
+  void SetRunParallel (const Standard_Boolean theIsParallel) { myAlgo->SetRunParallel (theIsParallel); }
+
   //! Launches calculation of outlines of the shape
   //! visualized by this framework. Used after setting the point of view and
   //! defining the shape or shapes to be visualized.
@@ -0,0 +1,105 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <HLRBRep_ViewsAlgo.hxx>
+
+#include <OSD_Parallel.hxx>
+
+//=======================================================================
+//class    : HLRBRep_ViewFunctor
+//purpose  : Computes the views by separate algorithms
+//=======================================================================
+class HLRBRep_ViewFunctor
+{
+public:
+  HLRBRep_ViewFunctor (const TopTools_ListOfShape&                    theShapes,
+                       const TColStd_ListOfInteger&                   theNbIsos,
+                       const NCollection_Vector<HLRAlgo_Projector>&    theProjectors,
+                       NCollection_Vector<Handle(HLRBRep_Algo)>&       theAlgos)
+  : myShapes (theShapes),
+    myNbIsos (theNbIsos),
+    myProjectors (theProjectors),
+    myAlgos (theAlgos)
+  {}
+
+  void operator() (const Standard_Integer theIndex) const
+  {
+    Handle(HLRBRep_Algo) anAlgo = new HLRBRep_Algo();
+    TopTools_ListIteratorOfListOfShape aItS (myShapes);
+    TColStd_ListIteratorOfListOfInteger aItN (myNbIsos);
+    for (; aItS.More(); aItS.Next(), aItN.Next())
+    {
+      anAlgo->Add (aItS.Value(), aItN.Value());
+    }
+    anAlgo->Projector (myProjectors (theIndex));
+    anAlgo->Update();
+    anAlgo->Hide();
+    myAlgos.ChangeValue (theIndex) = anAlgo;
+  }
+
+private:
+  HLRBRep_ViewFunctor (const HLRBRep_ViewFunctor&);
+  HLRBRep_ViewFunctor& operator= (const HLRBRep_ViewFunctor&);
+
+private:
+  const TopTools_ListOfShape&                 myShapes;
+  const TColStd_ListOfInteger&                myNbIsos;
+  const NCollection_Vector<HLRAlgo_Projector>& myProjectors;
+  NCollection_Vector<Handle(HLRBRep_Algo)>&   myAlgos;
+};
+
+//=======================================================================
+//function : HLRBRep_ViewsAlgo
+//purpose  : 
+//=======================================================================
+HLRBRep_ViewsAlgo::HLRBRep_ViewsAlgo()
+: myRunParallel (Standard_False)
+{
+}
+
+//=======================================================================
+//function : Add
+//purpose  : 
+//=======================================================================
+void HLRBRep_ViewsAlgo::Add (const TopoDS_Shape& theShape,
+                             const Standard_Integer theNbIso)
+{
+  myShapes.Append (theShape);
+  myNbIsos.Append (theNbIso);
+}
+
+//=======================================================================
+//function : AddView
+//purpose  : 
+//=======================================================================
+Standard_Integer HLRBRep_ViewsAlgo::AddView (const HLRAlgo_Projector& theProjector)
+{
+  myProjectors.Append (theProjector);
+  myAlgos.Append (Handle(HLRBRep_Algo)());
+  return myProjectors.Length();
+}
+
+//=======================================================================
+//function : Perform
+//purpose  : 
+//=======================================================================
+void HLRBRep_ViewsAlgo::Perform()
+{
+  for (Standard_Integer i = 0; i < myAlgos.Length(); ++i)
+  {
+    myAlgos.ChangeValue (i).Nullify();
+  }
+
+  HLRBRep_ViewFunctor aFunctor (myShapes, myNbIsos, myProjectors, myAlgos);
+  OSD_Parallel::For (0, myProjectors.Length(), aFunctor, !myRunParallel);
+}
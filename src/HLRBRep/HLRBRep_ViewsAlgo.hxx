@@ -0,0 +1,99 @@
+// Copyright (c) 2026 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _HLRBRep_ViewsAlgo_HeaderFile
+#define _HLRBRep_ViewsAlgo_HeaderFile
+
+#include <HLRAlgo_Projector.hxx>
+#include <HLRBRep_Algo.hxx>
+#include <NCollection_Vector.hxx>
+#include <TopTools_ListOfShape.hxx>
+#include <TColStd_ListOfInteger.hxx>
+
+//! Computes the visible and hidden lines of the same shapes
+//! for several points of view.
+//!
+//! The loaded data of HLRBRep_Algo are modified by the computation for its
+//! point of view, so each view is computed by its own HLRBRep_Algo.
+//! The views do not share any data and are computed in parallel threads
+//! if the parallel mode is switched on. The results do not depend on the mode.
+//! The hiding of the edges in one view is sequential: the faces hide
+//! the edges one after another through the state of the HLRBRep_Data
+//! of the view (the current face, its intersector and the edge status),
+//! so the parallelism is given only by the number of the views.
+//!
+//! Use the function:
+//! -   Add to select the shape or shapes to be visualized
+//! -   AddView to define the points of view
+//! -   Perform to compute the outlines and the visible and hidden lines
+//!     in all the views
+//! -   Algo to get the algorithm of the view, which results are
+//!     extracted by HLRBRep_HLRToShape.
+class HLRBRep_ViewsAlgo
+{
+public:
+
+  DEFINE_STANDARD_ALLOC
+
+  //! Constructs an empty framework.
+  Standard_EXPORT HLRBRep_ViewsAlgo();
+
+  //! Adds the shape <theShape> to be visualized in all the views
+  //! with <theNbIso> isoparameters on its faces.
+  Standard_EXPORT void Add (const TopoDS_Shape& theShape,
+                            const Standard_Integer theNbIso = 0);
+
+  //! Adds the point of view defined by the projector.
+  //! Returns the index of the view.
+  Standard_EXPORT Standard_Integer AddView (const HLRAlgo_Projector& theProjector);
+
+  //! Returns the number of the views.
+  Standard_Integer NbViews() const
+  {
+    return myProjectors.Length();
+  }
+
+  //! Switches on/off the parallel computation of the views.
+  void SetRunParallel (const Standard_Boolean theIsParallel)
+  {
+    myRunParallel = theIsParallel;
+  }
+
+  //! Returns the flag of the parallel computation of the views.
+  Standard_Boolean RunParallel() const
+  {
+    return myRunParallel;
+  }
+
+  //! Computes the outlines and the visible and hidden lines
+  //! of the shapes in all the views.
+  Standard_EXPORT void Perform();
+
+  //! Returns the algorithm of the view <theIndex> (1 <= theIndex <= NbViews()).
+  //! The algorithm is null until Perform() is called.
+  const Handle(HLRBRep_Algo)& Algo (const Standard_Integer theIndex) const
+  {
+    return myAlgos (theIndex - 1);
+  }
+
+private:
+
+  TopTools_ListOfShape                     myShapes;
+  TColStd_ListOfInteger                    myNbIsos;
+  NCollection_Vector<HLRAlgo_Projector>    myProjectors;
+  NCollection_Vector<Handle(HLRBRep_Algo)> myAlgos;
+  Standard_Boolean                         myRunParallel;
+
+};
+
+#endif // _HLRBRep_ViewsAlgo_HeaderFile
@@ -21,6 +21,7 @@
 #include <HLRAppli_ReflectLines.hxx>
 #include <HLRBRep_Algo.hxx>
 #include <HLRBRep_HLRToShape.hxx>
+#include <HLRBRep_ViewsAlgo.hxx>
 #include <HLRTest_OutLiner.hxx>
 #include <HLRTest_Projector.hxx>
 #include <HLRTopoBRep_OutLiner.hxx>
@@ -551,6 +552,77 @@ static Standard_Integer hlrin2d(Draw_Interpretor& , Standard_Integer n, const ch
   return 0;
 }
 
+//=======================================================================
+//function : hlrviews
+//purpose  : 
+//=======================================================================
+
+static Standard_Integer hlrviews(Draw_Interpretor& di, Standard_Integer n, const char** a)
+{
+  if (n < 6)
+  {
+    di << "Syntax error: wrong number of arguments\n";
+    return 1;
+  }
+
+  TopoDS_Shape aShape = DBRep::Get(a[2]);
+  if (aShape.IsNull())
+  {
+    di << "Error: " << a[2] << " is not a shape\n";
+    return 1;
+  }
+
+  HLRBRep_ViewsAlgo aViews;
+  aViews.Add (aShape);
+
+  Standard_Integer anArgIter = 3;
+  if (!strcmp (a[anArgIter], "-parallel"))
+  {
+    aViews.SetRunParallel (Standard_True);
+    ++anArgIter;
+  }
+  if ((n - anArgIter) % 3 != 0 || n == anArgIter)
+  {
+    di << "Syntax error: wrong number of arguments\n";
+    return 1;
+  }
+
+  for (; anArgIter < n; anArgIter += 3)
+  {
+    gp_Dir aNormal (Draw::Atof (a[anArgIter]),
+                    Draw::Atof (a[anArgIter + 1]),
+                    Draw::Atof (a[anArgIter + 2]));
+    aViews.AddView (HLRAlgo_Projector (gp_Ax2 (gp_Pnt (0., 0., 0.), aNormal)));
+  }
+
+  aViews.Perform();
+
+  for (Standard_Integer i = 1; i <= aViews.NbViews(); ++i)
+  {
+    HLRBRep_HLRToShape aHLRToShape (aViews.Algo (i));
+
+    TopoDS_Compound aResult;
+    BRep_Builder BB;
+    BB.MakeCompound (aResult);
+
+    const TopoDS_Shape aLines[4] = { aHLRToShape.VCompound(),
+                                     aHLRToShape.OutLineVCompound(),
+                                     aHLRToShape.HCompound(),
+                                     aHLRToShape.OutLineHCompound() };
+    for (Standard_Integer j = 0; j < 4; ++j)
+    {
+      if (!aLines[j].IsNull())
+        BB.Add (aResult, aLines[j]);
+    }
+
+    TCollection_AsciiString aName = TCollection_AsciiString (a[1]) + "_" + i;
+    DBRep::Set (aName.ToCString(), aResult);
+    di << aName << " ";
+  }
+
+  return 0;
+}
+
 //=======================================================================
 //function : Commands
 //purpose  : 
@@ -589,6 +661,13 @@ void HLRTest::Commands (Draw_Interpretor& theCommands)
   theCommands.Add("hlrin2d",
                   "hlrin2d res shape proj_X proj_Y proj_Z eye_x eye_y eye_z",
                   __FILE__, hlrin2d, g);
+
+  theCommands.Add("hlrviews",
+                  "hlrviews res shape [-parallel] proj_X proj_Y proj_Z [proj_X proj_Y proj_Z ...]"
+                  "\n\t\t: Computes the visible and hidden lines of the shape in several views"
+                  "\n\t\t: and stores them in res_1, res_2, ..."
+                  "\n\t\t: -parallel computes the views in parallel threads.",
+                  __FILE__, hlrviews, g);
   
   hider = new HLRBRep_Algo();
 }
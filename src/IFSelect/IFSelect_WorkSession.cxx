@@ -175,7 +175,10 @@ void  IFSelect_WorkSession::SetModel
   myModel->SetGTool (thegtool);
   
   thegraph.Nullify();
-  ComputeGraph();    // fait qqchose si Protocol present. Sinon, ne fait rien
+  // the graph needs the contents of all the entities, it is computed
+  // for a model with entities loaded on demand only when it is needed
+  if (!myModel->HasEntitiesToLoad())
+    ComputeGraph();    // fait qqchose si Protocol present. Sinon, ne fait rien
   ClearData(3);      // RAZ CheckList, a refaire
   thecheckrun.Clear();
   
@@ -334,6 +337,7 @@ Handle(TCollection_HAsciiString) IFSelect_WorkSession::EntityLabel (const Handle
 Handle(TCollection_HAsciiString) IFSelect_WorkSession::EntityName (const Handle(Standard_Transient)& ent) const
 {
   if (myModel.IsNull() || ent.IsNull()) return 0;
+  if (thegraph.IsNull() && !IsLoaded()) return 0;
   Interface_ShareTool sht(thegraph->Graph());
 
   Standard_Integer CN;
@@ -539,7 +543,12 @@ Standard_Boolean IFSelect_WorkSession::IsLoaded () const
   if (theprotocol.IsNull()) return Standard_False;
   if (myModel.IsNull()) return Standard_False;
   if (myModel->NbEntities() == 0) return Standard_False;
-  if (thegraph.IsNull()) return Standard_False;
+  if (thegraph.IsNull())
+  {
+    // the graph of a model with entities loaded on demand is computed at first need
+    if (!myModel->HasEntitiesToLoad()) return Standard_False;
+    if (!const_cast<IFSelect_WorkSession*>(this)->ComputeGraph()) return Standard_False;
+  }
   if (myModel->NbEntities() == thegraph->Graph().Size()) return Standard_True;
   return Standard_False;
 }
@@ -1269,7 +1278,7 @@ Interface_EntityIterator IFSelect_WorkSession::EvalSelection
     return iter;
   }
 
-  if (thegraph.IsNull()) return iter;
+  if (thegraph.IsNull() && !IsLoaded()) return iter;
  iter = sel->UniqueResult(thegraph->Graph());
   return iter;
 }
@@ -2774,6 +2783,7 @@ Standard_Integer IFSelect_WorkSession::QueryParent
   Standard_Integer nson = StartingNumber(entson);
   if (ndad < 1 || nson < 1) return -1;
   if (ndad == nson) return 0;
+  if (thegraph.IsNull() && !IsLoaded()) return -1;
 //  on va calculer : pour chaque pere immediat, de <son>, status avec <dad> + 1
 //  nb : pas protege contre les boucles ...
   Handle(TColStd_HSequenceOfTransient) list =
@@ -137,7 +137,10 @@ public:
   //! if <clearpointed> is True (default) all SelectPointed items
   //! are cleared, else they must be managed by the caller
   //! Remark : SetModel clears the Graph, recomputes it if a
-  //! Protocol is set and if the Model is not empty, of course
+  //! Protocol is set and if the Model is not empty, of course.
+  //! For a Model with entities loaded on demand (see
+  //! Interface_InterfaceModel::HasEntitiesToLoad), the Graph, which
+  //! requires all of them, is computed only when it is needed
   Standard_EXPORT void SetModel (const Handle(Interface_InterfaceModel)& model, const Standard_Boolean clearpointed = Standard_True);
   
   //! Returns the Model of the Work Session (Null Handle if none)
@@ -250,7 +253,8 @@ public:
   
   //! Returns True if a Model is defined and really loaded (not
   //! empty), a Protocol is set and a Graph has been computed.
-  //! In this case, the WorkSession can start to work
+  //! In this case, the WorkSession can start to work.
+  //! The Graph of a Model with entities loaded on demand is computed here
   Standard_EXPORT Standard_Boolean IsLoaded() const;
   
   //! Computes the CheckList for the Model currently loaded
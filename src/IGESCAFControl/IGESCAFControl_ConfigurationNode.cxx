@@ -91,6 +91,8 @@ bool IGESCAFControl_ConfigurationNode::Load(const Handle(DE_ConfigurationContext
     theResource->BooleanVal("read.name", InternalParameters.ReadName, aScope);
   InternalParameters.ReadLayer = 
     theResource->BooleanVal("read.layer", InternalParameters.ReadLayer, aScope);
+  InternalParameters.ReadParallel =
+    theResource->BooleanVal("read.parallel", InternalParameters.ReadParallel, aScope);
 
   InternalParameters.WriteBRepMode = (WriteMode_BRep)
     theResource->IntegerVal("write.brep.mode", InternalParameters.WriteBRepMode, aScope);
@@ -252,6 +254,12 @@ TCollection_AsciiString IGESCAFControl_ConfigurationNode::Save() const
   aResult += aScope + "read.layer :\t " + InternalParameters.ReadLayer + "\n";
   aResult += "!\n";
 
+  aResult += "!\n";
+  aResult += "!Setting up the read.parallel parameter which is used to read entities and to translate independent curves and surfaces in parallel\n";
+  aResult += "!Default value: \"Off\"(0). Available values: \"Off\"(0), \"On\"(1)\n";
+  aResult += aScope + "read.parallel :\t " + InternalParameters.ReadParallel + "\n";
+  aResult += "!\n";
+
   aResult += "!\n";
   aResult += "!Write parameters:\n";
   aResult += "!\n";
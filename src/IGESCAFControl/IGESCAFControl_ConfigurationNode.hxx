@@ -153,6 +153,7 @@ public:
     bool ReadColor = true; //<! ColorMode is used to indicate read Colors or not
     bool ReadName = true; //<! NameMode is used to indicate read Name or not
     bool ReadLayer = true; //<! LayerMode is used to indicate read Layers or not
+    bool ReadParallel = false; //<! Defines whether entities are read and independent curves and surfaces are translated in parallel
 
     // Write
     WriteMode_BRep WriteBRepMode = WriteMode_BRep_Faces; //<! Flag to define entities type to write
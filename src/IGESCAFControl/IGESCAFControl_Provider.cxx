@@ -86,6 +86,7 @@ void IGESCAFControl_Provider::initStatic(const Handle(DE_ConfigurationNode)& the
   myOldValues.ReadSequence = Interface_Static::CVal("read.iges.sequence");
   myOldValues.ReadFaultyEntities = Interface_Static::IVal("read.iges.faulty.entities") == 1;
   myOldValues.ReadOnlyVisible = Interface_Static::IVal("read.iges.onlyvisible") == 1;
+  myOldValues.ReadParallel = Interface_Static::IVal("read.iges.parallel") == 1;
 
   myOldValues.WriteBRepMode = (IGESCAFControl_ConfigurationNode::WriteMode_BRep)Interface_Static::IVal("write.iges.brep.mode");
   myOldValues.WriteConvertSurfaceMode = (IGESCAFControl_ConfigurationNode::WriteMode_ConvertSurface)Interface_Static::IVal("write.convertsurface.mode");
@@ -130,6 +131,7 @@ void IGESCAFControl_Provider::setStatic(const IGESCAFControl_ConfigurationNode::
   Interface_Static::SetCVal("read.iges.sequence", theParameter.ReadSequence.ToCString());
   Interface_Static::SetIVal("read.iges.faulty.entities", theParameter.ReadFaultyEntities);
   Interface_Static::SetIVal("read.iges.onlyvisible", theParameter.ReadOnlyVisible);
+  Interface_Static::SetIVal("read.iges.parallel", theParameter.ReadParallel);
 
   Interface_Static::SetIVal("write.iges.brep.mode", theParameter.WriteBRepMode);
   Interface_Static::SetIVal("write.convertsurface.mode", theParameter.WriteConvertSurfaceMode);
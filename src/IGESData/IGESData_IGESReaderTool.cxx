@@ -34,6 +34,9 @@
 #include <Interface_ParamList.hxx>
 #include <Interface_ReaderModule.hxx>
 #include <Message_Msg.hxx>
+#include <OSD_ThreadPool.hxx>
+#include <Standard_ErrorHandler.hxx>
+#include <Standard_Failure.hxx>
 #include <Standard_Transient.hxx>
 #include <TCollection_HAsciiString.hxx>
 
@@ -43,7 +46,7 @@
 IGESData_IGESReaderTool::IGESData_IGESReaderTool
   (const Handle(IGESData_IGESReaderData)& reader,
    const Handle(IGESData_Protocol)& protocol)
-      : theglib(protocol) , therlib(protocol)
+      : theglib(protocol) , therlib(protocol) , myToParallel(Standard_False)
       {  SetData (reader,protocol);  }
 
 
@@ -58,6 +61,85 @@ IGESData_IGESReaderTool::IGESData_IGESReaderTool
   thereco = reco;
   SetEntities();
   thelist = igesdat->Params(0);
+  if (myToParallel) readRecordsParallel();
+}
+
+
+//  ....        Lecture parallele des entites (apres SetEntities)        ....
+
+//! Number of entities read by one parallel task
+static const Standard_Integer THE_ENTITIES_CHUNK_SIZE = 256;
+
+//! Functor reading a chunk of entities.
+//! Each entity fills only itself and its own check, references
+//! are taken from entities already bound by SetEntities.
+class IGESData_IGESReaderTool::ParallelRecordReader
+{
+public:
+  ParallelRecordReader (const IGESData_IGESReaderTool& theTool,
+                        const Handle(IGESData_IGESReaderData)& theData,
+                        const Handle(TColStd_HArray1OfTransient)& theChecks)
+  : myTool (theTool), myData (theData), myChecks (theChecks) {}
+
+  void operator() (int theThreadIndex, int theChunkIndex) const
+  {
+    (void )theThreadIndex;
+    const Standard_Integer aLower = theChunkIndex * THE_ENTITIES_CHUNK_SIZE + 1;
+    const Standard_Integer anUpper = Min (aLower + THE_ENTITIES_CHUNK_SIZE - 1, myData->NbRecords());
+    for (Standard_Integer aNum = aLower; aNum <= anUpper; ++aNum)
+    {
+      const Handle(Standard_Transient)& anEnt = myData->BoundEntity (aNum);
+      if (anEnt.IsNull())
+      {
+        continue;
+      }
+      Handle(Interface_Check) aCheck = new Interface_Check (anEnt);
+      try
+      {
+        OCC_CATCH_SIGNALS
+        myTool.readRecord (aNum, anEnt, aCheck);
+        myChecks->SetValue (aNum, aCheck);
+      }
+      catch (Standard_Failure const&)
+      {
+        // check is not stored: the entity will be read again
+        // by LoadModel, with the usual recovery of sequential mode
+      }
+    }
+  }
+
+private:
+  const IGESData_IGESReaderTool& myTool;
+  Handle(IGESData_IGESReaderData) myData;
+  Handle(TColStd_HArray1OfTransient) myChecks;
+};
+
+
+//=======================================================================
+//function : readRecordsParallel
+//purpose  : 
+//=======================================================================
+
+void IGESData_IGESReaderTool::readRecordsParallel()
+{
+  myReadChecks.Nullify();
+  DeclareAndCast(IGESData_IGESReaderData,igesdat,Data());
+  const Standard_Integer aNbRecords = igesdat->NbRecords();
+  const Standard_Integer aNbChunks =
+    (aNbRecords + THE_ENTITIES_CHUNK_SIZE - 1) / THE_ENTITIES_CHUNK_SIZE;
+  const Handle(OSD_ThreadPool)& aThreadPool = OSD_ThreadPool::DefaultPool();
+  const Standard_Integer aNbThreads = Min (aNbChunks, aThreadPool->NbDefaultThreadsToLaunch());
+  if (aNbThreads < 2)
+  {
+    // nothing to gain, entities are read sequentially by LoadModel
+    return;
+  }
+
+  Handle(TColStd_HArray1OfTransient) aChecks = new TColStd_HArray1OfTransient (1, aNbRecords);
+  ParallelRecordReader aReader (*this, igesdat, aChecks);
+  OSD_ThreadPool::Launcher aLauncher (*aThreadPool, aNbThreads);
+  aLauncher.Perform (0, aNbChunks, aReader);
+  myReadChecks = aChecks;
 }
 
 
@@ -103,11 +185,28 @@ IGESData_IGESReaderTool::IGESData_IGESReaderTool
 }
 
 
-// Manquent les procedures de reprise sur erreur en cours de route ...
     Standard_Boolean  IGESData_IGESReaderTool::AnalyseRecord
   (const Standard_Integer num, const Handle(Standard_Transient)& anent,
    Handle(Interface_Check)& ach)
 {
+//  Deja lue en parallele par Prepare : on ne fait que recuperer son Check
+  if (!myReadChecks.IsNull() && num >= myReadChecks->Lower() && num <= myReadChecks->Upper()) {
+    Handle(Interface_Check) aReadCheck = Handle(Interface_Check)::DownCast(myReadChecks->Value(num));
+    if (!aReadCheck.IsNull() && Data()->BoundEntity(num) == anent) {
+      myReadChecks->ChangeValue(num).Nullify();
+      ach->GetMessages(aReadCheck);
+      return (!ach->HasFailed());
+    }
+  }
+  return readRecord(num,anent,ach);
+}
+
+
+// Manquent les procedures de reprise sur erreur en cours de route ...
+    Standard_Boolean  IGESData_IGESReaderTool::readRecord
+  (const Standard_Integer num, const Handle(Standard_Transient)& anent,
+   Handle(Interface_Check)& ach) const
+{
 
   Handle(TCollection_HAsciiString) lab;
 
@@ -126,7 +225,7 @@ IGESData_IGESReaderTool::IGESData_IGESReaderTool
   }
   else ReadDir (ent,igesdat,igesdat->DirPart(num),ach);
 
-  thestep = IGESData_ReadDir;
+  IGESData_ReadStage thestep = IGESData_ReadDir;
 
 //   Liste de Parametres : controle de son entete
 //  Handle(Interface_ParamList) list = Data()->Params(num);
@@ -175,6 +274,7 @@ IGESData_IGESReaderTool::IGESData_IGESReaderTool
     void IGESData_IGESReaderTool::EndRead
   (const Handle(Interface_InterfaceModel)& /* amodel */)
 {
+  myReadChecks.Nullify();
 /*
   DeclareAndCast(IGESData_IGESModel,amod,amodel);
   DeclareAndCast(IGESData_IGESReaderData,igesdat,Data());
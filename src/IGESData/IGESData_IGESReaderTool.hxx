@@ -27,6 +27,7 @@
 #include <IGESData_IGESType.hxx>
 #include <IGESData_ReadStage.hxx>
 #include <Interface_FileReaderTool.hxx>
+#include <TColStd_HArray1OfTransient.hxx>
 class Interface_ParamList;
 class IGESData_FileRecognizer;
 class Interface_Check;
@@ -57,8 +58,21 @@ public:
   //! (from IGESData) stored and later used
   //! RQ : Actually, sets DNum into IGES Entities
   //! Also loads the list of parameters for ParamReader
+  //! In parallel mode (see SetParallel), also reads the contents of
+  //! the bound entities, so that LoadModel only registers them
   Standard_EXPORT void Prepare (const Handle(IGESData_FileRecognizer)& reco);
   
+  //! Sets parallel mode of reading entities (False by default).
+  //! When it is set, the directory and parameter parts of entities are
+  //! read by chunks on the default thread pool during Prepare; entities
+  //! are then added to the model in the order of the file, hence their
+  //! numbering is the same as in sequential mode.
+  //! Entities which fail with an exception are read again sequentially.
+  void SetParallel (const Standard_Boolean theToParallel) { myToParallel = theToParallel; }
+
+  //! Returns True if parallel mode of reading entities is set
+  Standard_Boolean IsParallel() const { return myToParallel; }
+  
   //! recognizes records by asking Protocol (on data of DirType)
   Standard_EXPORT Standard_Boolean Recognize (const Standard_Integer num, Handle(Interface_Check)& ach, Handle(Standard_Transient)& ent) Standard_OVERRIDE;
   
@@ -110,7 +124,16 @@ protected:
 
 private:
 
+  //! Reads the contents of an entity (works for AnalyseRecord);
+  //! does not change the state of the tool, so it can be called
+  //! from several threads for different entities
+  Standard_Boolean readRecord (const Standard_Integer num, const Handle(Standard_Transient)& anent, Handle(Interface_Check)& acheck) const;
+
+  //! Reads the contents of all bound entities in parallel threads,
+  //! keeping their checks for AnalyseRecord
+  void readRecordsParallel();
 
+  class ParallelRecordReader;
 
   Handle(Interface_ParamList) thelist;
   Handle(IGESData_FileRecognizer) thereco;
@@ -118,11 +141,12 @@ private:
   Interface_ReaderLib therlib;
   Standard_Integer thecnum;
   IGESData_IGESType thectyp;
-  IGESData_ReadStage thestep;
   Handle(Interface_Check) thechk;
   Standard_Integer thegradweight;
   Standard_Real themaxweight;
   Standard_Real thedefweight;
+  Standard_Boolean myToParallel;
+  Handle(TColStd_HArray1OfTransient) myReadChecks; //!< checks of entities read by Prepare
 
 
 };
@@ -31,7 +31,7 @@
 
 #include <stdio.h>
 // MGE 03/08/98
-static Standard_Integer testconv = -1;  // cf parametre de session
+static Standard_THREADLOCAL Standard_Integer testconv = -1;  // cf parametre de session (par thread : lecture parallele)
 
 //  ....              Gestion generale (etat, courant ...)              ....
 
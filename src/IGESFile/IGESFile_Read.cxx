@@ -19,6 +19,7 @@
 #include <IGESData_IGESReaderTool.hxx>
 #include <IGESData_GeneralModule.hxx>
 #include <Interface_Check.hxx>
+#include <Interface_Static.hxx>
 
 //  Pour traiter les exceptions :
 #include <Standard_ErrorHandler.hxx>
@@ -160,6 +161,7 @@ Standard_Integer IGESFile_Read
   IGESFile_Check(2, Msg15);
   iges_finfile(1);
   IGESData_IGESReaderTool IT (IR,protocol);
+  IT.SetParallel (Interface_Static::IVal("read.iges.parallel") == 1);
   IT.Prepare(reco); 
   IT.SetErrorHandle(Standard_True);
 
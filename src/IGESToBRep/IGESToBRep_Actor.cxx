@@ -17,16 +17,23 @@
 #include <IGESToBRep.hxx>
 #include <IGESToBRep_Actor.hxx>
 #include <IGESToBRep_CurveAndSurface.hxx>
+#include <Interface_EntityIterator.hxx>
+#include <Interface_Graph.hxx>
+#include <Interface_HGraph.hxx>
 #include <Interface_InterfaceModel.hxx>
 #include <Interface_Macros.hxx>
 #include <Interface_Static.hxx>
 #include <Message_ProgressScope.hxx>
+#include <NCollection_DataMap.hxx>
+#include <NCollection_Vector.hxx>
+#include <OSD_ThreadPool.hxx>
 #include <ShapeExtend_Explorer.hxx>
 #include <ShapeFix_ShapeTolerance.hxx>
 #include <Standard_ErrorHandler.hxx>
 #include <Standard_Failure.hxx>
 #include <Standard_Transient.hxx>
 #include <Standard_Type.hxx>
+#include <TColStd_Array1OfInteger.hxx>
 #include <TopoDS_Shape.hxx>
 #include <Transfer_Binder.hxx>
 #include <Transfer_TransientProcess.hxx>
@@ -36,6 +43,31 @@
 
 IMPLEMENT_STANDARD_RTTIEXT(IGESToBRep_Actor,Transfer_ActorOfTransientProcess)
 
+namespace
+{
+  // Name of the TransientProcess context keeping curves and surfaces converted in advance
+  static const Standard_CString THE_PARALLEL_CONTEXT = "IGESToBRep_Actor_Parallel";
+
+  //! Result of the conversion of one entity made in a parallel thread
+  struct IGESToBRep_ParallelResult
+  {
+    Handle(Transfer_TransientProcess) TP;
+    TopoDS_Shape Shape;
+    Standard_Real Eps;
+    Standard_Integer Continuity;
+
+    IGESToBRep_ParallelResult() : Eps (0.0), Continuity (0) {}
+  };
+
+  //! Results of the parallel conversion, attached to the main TransientProcess
+  class IGESToBRep_ParallelResults : public Standard_Transient
+  {
+  public:
+    NCollection_DataMap<Handle(Standard_Transient), IGESToBRep_ParallelResult> Map;
+    DEFINE_STANDARD_RTTI_INLINE(IGESToBRep_ParallelResults, Standard_Transient)
+  };
+}
+
 //=======================================================================
 //function : IGESToBRep_Actor
 //purpose  : 
@@ -131,6 +163,37 @@ static void TrimTolerances (const TopoDS_Shape& shape,
   }
 }
 
+//=======================================================================
+//function : InitCurveAndSurface
+//purpose  : INTERNAL to set up the tool from the model and statics,
+//           returns the precision to be used
+//=======================================================================
+
+static Standard_Real InitCurveAndSurface (IGESToBRep_CurveAndSurface& CAS,
+                                          const Handle(IGESData_IGESModel)& mymodel,
+                                          const Standard_Integer continuity,
+                                          const Handle(Transfer_TransientProcess)& TP)
+{
+  Standard_Real eps;
+  CAS.SetModel(mymodel);
+  CAS.SetContinuity(continuity);
+  CAS.SetTransferProcess(TP);
+  Standard_Integer Ival = Interface_Static::IVal("read.precision.mode");
+  if ( Ival == 0)
+    eps = mymodel->GlobalSection().Resolution();
+  else
+    eps = Interface_Static::RVal("read.precision.val"); //:10 ABV 11 Nov 97
+//:10      eps = BRepAPI::Precision(); 
+  Ival = Interface_Static::IVal("read.iges.bspline.approxd1.mode");
+  CAS.SetModeApprox ( (Ival > 0) );
+  Ival = Interface_Static::IVal("read.surfacecurve.mode");
+  CAS.SetSurfaceCurve (Ival);
+
+  if (eps > 1.E-08)
+    CAS.SetEpsGeom(eps);
+  return eps;
+}
+
 //=======================================================================
 //function : Transfer
 //purpose  : 
@@ -161,28 +224,19 @@ Handle(Transfer_Binder) IGESToBRep_Actor::Transfer
     Message_ProgressScope aPS(theProgress, "Transfer stage", 2);
 
     XSAlgo::AlgoContainer()->PrepareForTransfer();
+    if (Interface_Static::IVal("read.iges.parallel") == 1) {
+      Handle(Standard_Transient) aResults;
+      if (!TP->GetContext(THE_PARALLEL_CONTEXT, STANDARD_TYPE(IGESToBRep_ParallelResults), aResults))
+        prepareParallelTransfer(TP);
+    }
     IGESToBRep_CurveAndSurface CAS;
-    CAS.SetModel(mymodel);
-    CAS.SetContinuity(thecontinuity);
-    CAS.SetTransferProcess(TP);
-    Standard_Integer Ival = Interface_Static::IVal("read.precision.mode");
-    if ( Ival == 0)
-      eps = mymodel->GlobalSection().Resolution();
-    else
-      eps = Interface_Static::RVal("read.precision.val"); //:10 ABV 11 Nov 97
-//:10      eps = BRepAPI::Precision(); 
-    Ival = Interface_Static::IVal("read.iges.bspline.approxd1.mode");
-    CAS.SetModeApprox ( (Ival > 0) );
-    Ival = Interface_Static::IVal("read.surfacecurve.mode");
-    CAS.SetSurfaceCurve (Ival);
-
+    eps = InitCurveAndSurface(CAS, mymodel, thecontinuity, TP);
     if (eps > 1.E-08) {
-      CAS.SetEpsGeom(eps);
       theeps = eps*CAS.GetUnitFactor();
 //      Interface_Static::SetRVal("lastpreci",theeps);
     }
     Standard_Integer nbTPitems = TP->NbMapped();
-    {
+    if (!takeParallelResult(ent, TP, eps, shape)) {
       try {
         OCC_CATCH_SIGNALS
         shape = CAS.TransferGeometry(ent, aPS.Next());
@@ -219,3 +273,218 @@ Handle(Transfer_Binder) IGESToBRep_Actor::Transfer
 
     Standard_Real  IGESToBRep_Actor::UsedTolerance () const
       {  return theeps;  }
+
+//=======================================================================
+//function : IsTransferredGeometry
+//purpose  : INTERNAL, True for the entities converted by CurveAndSurface
+//=======================================================================
+
+static Standard_Boolean IsTransferredGeometry (const Handle(Standard_Transient)& theEnt)
+{
+  DeclareAndCast(IGESData_IGESEntity,ent,theEnt);
+  if (ent.IsNull()) return Standard_False;
+  Standard_Integer typnum = ent->TypeNumber();
+  return IGESToBRep::IsCurveAndSurface(ent)
+      || typnum == 402 || typnum == 408 || typnum == 308;
+}
+
+//=======================================================================
+//class    : ParallelTransfer
+//purpose  : Functor converting one entity into its own TransientProcess
+//=======================================================================
+
+class IGESToBRep_Actor::ParallelTransfer
+{
+public:
+
+  struct Task
+  {
+    Handle(IGESData_IGESEntity) Ent;
+    IGESToBRep_ParallelResult Result;
+  };
+
+  ParallelTransfer (const Handle(IGESData_IGESModel)& theModel,
+                    const Handle(Interface_HGraph)& theGraph,
+                    const Standard_Integer theContinuity,
+                    NCollection_Vector<Task>& theTasks)
+  : myModel (theModel), myGraph (theGraph), myContinuity (theContinuity), myTasks (theTasks) {}
+
+  void operator() (int theThreadIndex, int theIndex) const
+  {
+    (void )theThreadIndex;
+    Task& aTask = myTasks.ChangeValue (theIndex);
+    Handle(Transfer_TransientProcess) aTP = new Transfer_TransientProcess (100);
+    aTP->SetGraph (myGraph);
+    IGESToBRep_CurveAndSurface CAS;
+    const Standard_Real anEps = InitCurveAndSurface (CAS, myModel, myContinuity, aTP);
+    TopoDS_Shape aShape;
+    try
+    {
+      OCC_CATCH_SIGNALS
+      aShape = CAS.TransferGeometry (aTask.Ent, Message_ProgressRange());
+    }
+    catch (Standard_Failure const&)
+    {
+      // the entity is left to the sequential transfer
+      return;
+    }
+    aTask.Result.TP = aTP;
+    aTask.Result.Shape = aShape;
+    aTask.Result.Eps = anEps;
+    aTask.Result.Continuity = myContinuity;
+  }
+
+private:
+  ParallelTransfer& operator= (const ParallelTransfer& );
+
+private:
+  Handle(IGESData_IGESModel) myModel;
+  Handle(Interface_HGraph) myGraph;
+  Standard_Integer myContinuity;
+  NCollection_Vector<Task>& myTasks;
+};
+
+//=======================================================================
+//function : prepareParallelTransfer
+//purpose  : 
+//=======================================================================
+
+void IGESToBRep_Actor::prepareParallelTransfer (const Handle(Transfer_TransientProcess)& TP)
+{
+  Handle(IGESToBRep_ParallelResults) aResults = new IGESToBRep_ParallelResults;
+  TP->SetContext (THE_PARALLEL_CONTEXT, aResults);
+
+  DeclareAndCast(IGESData_IGESModel,mymodel,themodel);
+  const Standard_Integer aNbEnt = mymodel->NbEntities();
+  if (aNbEnt < 2)
+    return;
+  Handle(Interface_HGraph) aHGraph = TP->HGraph();
+  if (aHGraph.IsNull())
+    aHGraph = new Interface_HGraph (mymodel);
+  const Interface_Graph& aGraph = aHGraph->Graph();
+  const Standard_Boolean isFaultyRead = (Interface_Static::IVal("read.iges.faulty.entities") != 0);
+
+  // candidates are curves and surfaces not referred by other entities
+  NCollection_Vector<ParallelTransfer::Task> aCandidates;
+  for (Standard_Integer anEnt = 1; anEnt <= aNbEnt; ++anEnt)
+  {
+    DeclareAndCast(IGESData_IGESEntity,ent,mymodel->Value (anEnt));
+    if (!IGESToBRep::IsCurveAndSurface (ent)
+     || (!isFaultyRead && mymodel->IsErrorEntity (anEnt))
+     ||  TP->IsBound (ent)
+     ||  aGraph.Sharings (ent).More())
+      continue;
+    aCandidates.Appended().Ent = ent;
+  }
+  if (aCandidates.Size() < 2)
+    return;
+
+  // each geometric entity reached from a candidate is owned by it;
+  // a candidate which shares geometry with others is converted sequentially,
+  // so that shared entities are converted once and give the same shapes
+  TColStd_Array1OfInteger anOwners (1, aNbEnt);
+  anOwners.Init (0);
+  NCollection_Vector<Standard_Boolean> isShared;
+  NCollection_Vector<Standard_Integer> aStack;
+  for (Standard_Integer aCandIt = 0; aCandIt < aCandidates.Size(); ++aCandIt)
+  {
+    isShared.Append (Standard_False);
+    aStack.Append (mymodel->Number (aCandidates.Value (aCandIt).Ent));
+    anOwners.SetValue (aStack.Last(), aCandIt + 1);
+    while (!aStack.IsEmpty())
+    {
+      const Standard_Integer aNum = aStack.Last();
+      aStack.EraseLast();
+      for (Interface_EntityIterator anIter = aGraph.Shareds (mymodel->Value (aNum)); anIter.More(); anIter.Next())
+      {
+        const Standard_Integer aSharedNum = mymodel->Number (anIter.Value());
+        if (aSharedNum <= 0 || !IsTransferredGeometry (anIter.Value()))
+          continue;
+        const Standard_Integer anOwner = anOwners.Value (aSharedNum);
+        if (anOwner == 0)
+        {
+          anOwners.SetValue (aSharedNum, aCandIt + 1);
+          aStack.Append (aSharedNum);
+        }
+        else if (anOwner != aCandIt + 1)
+        {
+          isShared.ChangeValue (anOwner - 1) = Standard_True;
+          isShared.ChangeValue (aCandIt) = Standard_True;
+        }
+      }
+    }
+  }
+  for (Standard_Integer aNum = 1; aNum <= aNbEnt; ++aNum)
+  {
+    const Standard_Integer anOwner = anOwners.Value (aNum);
+    if (anOwner == 0)
+      continue;
+    for (Interface_EntityIterator anIter = aGraph.Sharings (mymodel->Value (aNum)); anIter.More(); anIter.Next())
+    {
+      if (IsTransferredGeometry (anIter.Value())
+       && anOwners.Value (mymodel->Number (anIter.Value())) != anOwner)
+        isShared.ChangeValue (anOwner - 1) = Standard_True;
+    }
+  }
+
+  NCollection_Vector<ParallelTransfer::Task> aTasks;
+  for (Standard_Integer aCandIt = 0; aCandIt < aCandidates.Size(); ++aCandIt)
+  {
+    if (!isShared.Value (aCandIt))
+      aTasks.Append (aCandidates.Value (aCandIt));
+  }
+  if (aTasks.Size() < 2)
+    return;
+
+  const Handle(OSD_ThreadPool)& aPool = OSD_ThreadPool::DefaultPool();
+  const Standard_Integer aNbThreads = Min (aPool->NbDefaultThreadsToLaunch(), aTasks.Size());
+  if (aNbThreads < 2)
+    return;
+
+  ParallelTransfer aFunctor (mymodel, aHGraph, thecontinuity, aTasks);
+  OSD_ThreadPool::Launcher aLauncher (*aPool, aNbThreads);
+  aLauncher.Perform (0, aTasks.Size(), aFunctor);
+
+  for (NCollection_Vector<ParallelTransfer::Task>::Iterator aTaskIt (aTasks); aTaskIt.More(); aTaskIt.Next())
+  {
+    const ParallelTransfer::Task& aTask = aTaskIt.Value();
+    if (!aTask.Result.TP.IsNull())
+      aResults->Map.Bind (aTask.Ent, aTask.Result);
+  }
+}
+
+//=======================================================================
+//function : takeParallelResult
+//purpose  : 
+//=======================================================================
+
+Standard_Boolean IGESToBRep_Actor::takeParallelResult (const Handle(IGESData_IGESEntity)& theEnt,
+                                                       const Handle(Transfer_TransientProcess)& TP,
+                                                       const Standard_Real theEps,
+                                                       TopoDS_Shape& theShape)
+{
+  Handle(Standard_Transient) aContext;
+  if (!TP->GetContext (THE_PARALLEL_CONTEXT, STANDARD_TYPE(IGESToBRep_ParallelResults), aContext))
+    return Standard_False;
+
+  Handle(IGESToBRep_ParallelResults) aResults = Handle(IGESToBRep_ParallelResults)::DownCast (aContext);
+  const IGESToBRep_ParallelResult* aResult = aResults->Map.Seek (theEnt);
+  if (aResult == NULL)
+    return Standard_False;
+
+  // the epsilon and the continuity may have been changed since the curves and
+  // surfaces were translated; an entity already bound is translated again
+  if (aResult->Eps != theEps
+   || aResult->Continuity != thecontinuity
+   || TP->IsBound (theEnt))
+  {
+    aResults->Map.UnBind (theEnt);
+    return Standard_False;
+  }
+
+  // the sub-entities of the entity keep their results and messages
+  TP->TakeBindings (aResult->TP);
+  theShape = aResult->Shape;
+  aResults->Map.UnBind (theEnt);
+  return Standard_True;
+}
@@ -24,8 +24,10 @@
 #include <Transfer_ActorOfTransientProcess.hxx>
 #include <Message_ProgressRange.hxx>
 
+class IGESData_IGESEntity;
 class Interface_InterfaceModel;
 class Standard_Transient;
+class TopoDS_Shape;
 class Transfer_Binder;
 class Transfer_TransientProcess;
 
@@ -76,6 +78,25 @@ protected:
 
 
 
+private:
+
+  //! Converts the curves and surfaces which are not referred by other entities,
+  //! and which do not share geometric entities with others, in parallel threads,
+  //! each one into its own TransientProcess; results are kept in the context of <TP>.
+  //! Called once per TransientProcess when read.iges.parallel is on.
+  void prepareParallelTransfer (const Handle(Transfer_TransientProcess)& TP);
+
+  //! Gives in <theShape> the result of the conversion of <theEnt> made by
+  //! prepareParallelTransfer() and moves all bindings of its TransientProcess to <TP>.
+  //! Returns False if there is no such result or if it was made with another
+  //! precision than <theEps>.
+  Standard_Boolean takeParallelResult (const Handle(IGESData_IGESEntity)& theEnt,
+                                       const Handle(Transfer_TransientProcess)& TP,
+                                       const Standard_Real theEps,
+                                       TopoDS_Shape& theShape);
+
+  class ParallelTransfer;
+
 private:
 
 
@@ -28,6 +28,11 @@
 
 #include <NCollection_Map.hxx>
 
+namespace
+{
+  Standard_Boolean myGlobalRunParallel = Standard_True;
+}
+
 static Standard_Integer ComputeIntersection(IntPolyh_PMaillageAffinage& theMaillage);
 
 //=======================================================================
@@ -50,6 +55,24 @@ IntPolyh_Intersection::IntPolyh_Intersection(const Handle(Adaptor3d_Surface)& th
   Perform();
 }
 
+//=======================================================================
+//function : SetParallelMode
+//purpose  : 
+//=======================================================================
+void IntPolyh_Intersection::SetParallelMode(const Standard_Boolean theNewMode)
+{
+  myGlobalRunParallel = theNewMode;
+}
+
+//=======================================================================
+//function : GetParallelMode
+//purpose  : 
+//=======================================================================
+Standard_Boolean IntPolyh_Intersection::GetParallelMode()
+{
+  return myGlobalRunParallel;
+}
+
 //=======================================================================
 //function : IntPolyh_Intersection
 //purpose  : 
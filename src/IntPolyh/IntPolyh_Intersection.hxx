@@ -75,6 +75,19 @@ public: //! @name Constructors
                                         const TColStd_Array1OfReal&       theVPars2);
 
 
+public: //! @name Parallel processing mode
+
+  //! Gets the global mode of checking the couples of triangles
+  //! for contact in parallel threads.
+  Standard_EXPORT static Standard_Boolean GetParallelMode();
+
+  //! Sets the global mode of checking the couples of triangles for contact
+  //! in parallel threads. By default the mode is on, and the couples are
+  //! checked in parallel when there are enough of them.
+  //! The result of the intersection does not depend on the mode.
+  Standard_EXPORT static void SetParallelMode(const Standard_Boolean theNewMode);
+
+
 public: //! @name Getting the results
 
   //! Returns state of the operation
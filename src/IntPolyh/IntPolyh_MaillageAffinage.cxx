@@ -32,12 +32,15 @@
 #include <BVH_LinearBuilder.hxx>
 #include <BVH_Traverse.hxx>
 #include <gp_Pnt.hxx>
+#include <IntPolyh_Intersection.hxx>
 #include <IntPolyh_MaillageAffinage.hxx>
 #include <IntPolyh_Point.hxx>
 #include <IntPolyh_SectionLine.hxx>
 #include <IntPolyh_StartPoint.hxx>
 #include <IntPolyh_Tools.hxx>
 #include <IntPolyh_Triangle.hxx>
+#include <NCollection_Array1.hxx>
+#include <OSD_Parallel.hxx>
 #include <TColStd_Array1OfInteger.hxx>
 #include <TColStd_MapOfInteger.hxx>
 #include <TColStd_ListIteratorOfListOfInteger.hxx>
@@ -270,6 +273,64 @@ static
   }
 }
 
+//! Minimal number of couples of triangles to be checked for contact in parallel
+static const Standard_Integer THE_NB_COUPLES_TO_RUN_PARALLEL = 1000;
+
+//=======================================================================
+//class    : IntPolyh_TriContactFunctor
+//purpose  : Checks the couples of triangles for contact
+//=======================================================================
+class IntPolyh_TriContactFunctor
+{
+public:
+  IntPolyh_TriContactFunctor(const IntPolyh_MaillageAffinage& theMaillage,
+                             const IntPolyh_ArrayOfTriangles& theTriangles1,
+                             const IntPolyh_ArrayOfPoints& thePoints1,
+                             const IntPolyh_ArrayOfTriangles& theTriangles2,
+                             const IntPolyh_ArrayOfPoints& thePoints2,
+                             NCollection_Array1<IntPolyh_Couple>& theCouples,
+                             NCollection_Array1<Standard_Boolean>& theContacts)
+  : myMaillage(theMaillage),
+    myTriangles1(theTriangles1),
+    myPoints1(thePoints1),
+    myTriangles2(theTriangles2),
+    myPoints2(thePoints2),
+    myCouples(theCouples),
+    myContacts(theContacts)
+  {}
+
+  //! Checks the couple for contact; the angle of the couple is left
+  //! equal to RealLast() if it is not computed by TriContact()
+  void operator()(const Standard_Integer theIndex) const
+  {
+    IntPolyh_Couple& aCouple = myCouples(theIndex);
+    const IntPolyh_Triangle& aTriangle1 = myTriangles1[aCouple.FirstValue()];
+    const IntPolyh_Triangle& aTriangle2 = myTriangles2[aCouple.SecondValue()];
+    Standard_Real anAngle = RealLast();
+    myContacts(theIndex) =
+      myMaillage.TriContact(myPoints1[aTriangle1.FirstPoint()],
+                            myPoints1[aTriangle1.SecondPoint()],
+                            myPoints1[aTriangle1.ThirdPoint()],
+                            myPoints2[aTriangle2.FirstPoint()],
+                            myPoints2[aTriangle2.SecondPoint()],
+                            myPoints2[aTriangle2.ThirdPoint()],
+                            anAngle) != 0;
+    aCouple.SetAngle(anAngle);
+  }
+
+private:
+  IntPolyh_TriContactFunctor& operator=(const IntPolyh_TriContactFunctor&);
+
+private:
+  const IntPolyh_MaillageAffinage& myMaillage;
+  const IntPolyh_ArrayOfTriangles& myTriangles1;
+  const IntPolyh_ArrayOfPoints& myPoints1;
+  const IntPolyh_ArrayOfTriangles& myTriangles2;
+  const IntPolyh_ArrayOfPoints& myPoints2;
+  NCollection_Array1<IntPolyh_Couple>& myCouples;
+  NCollection_Array1<Standard_Boolean>& myContacts;
+};
+
 //=======================================================================
 //function : IntPolyh_MaillageAffinage
 //purpose  : 
@@ -2347,35 +2408,48 @@ Standard_Integer IntPolyh_MaillageAffinage::TriangleCompare ()
     return 0;
   }
   //
-  Standard_Real CoupleAngle = -2.0;
-  //
-  // Intersection of the triangles
-  Standard_Integer i, aNb = aDMILI.Extent();
+  // Collect the couples in the order of their analysis
+  Standard_Integer i, aNb = aDMILI.Extent(), aNbCouples = 0;
+  for (i = 1; i <= aNb; ++i) {
+    aNbCouples += aDMILI(i).Extent();
+  }
+  NCollection_Array1<IntPolyh_Couple> aCouples(0, aNbCouples - 1);
+  Standard_Integer aCoupleIndex = 0;
   for (i = 1; i <= aNb; ++i) {
     const Standard_Integer i_S1 = aDMILI.FindKey(i);
-    IntPolyh_Triangle &Triangle1 =  TTriangles1[i_S1];
-    const IntPolyh_Point& P1 = TPoints1[Triangle1.FirstPoint()];
-    const IntPolyh_Point& P2 = TPoints1[Triangle1.SecondPoint()];
-    const IntPolyh_Point& P3 = TPoints1[Triangle1.ThirdPoint()];
-    //
-    const TColStd_ListOfInteger& aLI2 = aDMILI(i);
-    TColStd_ListOfInteger::Iterator aItLI(aLI2);
+    TColStd_ListOfInteger::Iterator aItLI(aDMILI(i));
     for (; aItLI.More(); aItLI.Next()) {
-      const Standard_Integer i_S2 = aItLI.Value();
-      IntPolyh_Triangle &Triangle2 =  TTriangles2[i_S2];
-      const IntPolyh_Point& Q1 = TPoints2[Triangle2.FirstPoint()];
-      const IntPolyh_Point& Q2 = TPoints2[Triangle2.SecondPoint()];
-      const IntPolyh_Point& Q3 = TPoints2[Triangle2.ThirdPoint()];
-      //
-      if (TriContact(P1, P2, P3, Q1, Q2, Q3, CoupleAngle)) {
-        IntPolyh_Couple aCouple(i_S1, i_S2, CoupleAngle);
-        TTrianglesContacts.Append(aCouple);
-        //
-        Triangle1.SetIntersection(Standard_True);
-        Triangle2.SetIntersection(Standard_True);
-      }
+      aCouples(aCoupleIndex++).SetCoupleValue(i_S1, aItLI.Value());
     }
   }
+  //
+  // Intersection of the triangles; the couples are checked in parallel
+  // if there are enough of them and the parallel mode is not switched off
+  NCollection_Array1<Standard_Boolean> aContacts(0, aNbCouples - 1);
+  IntPolyh_TriContactFunctor aFunctor(*this, TTriangles1, TPoints1,
+                                      TTriangles2, TPoints2, aCouples, aContacts);
+  const Standard_Boolean isForceSingleThread = !IntPolyh_Intersection::GetParallelMode() ||
+                                              aNbCouples < THE_NB_COUPLES_TO_RUN_PARALLEL;
+  OSD_Parallel::For(0, aNbCouples, aFunctor, isForceSingleThread);
+  //
+  // Save the couples in contact in the order of analysis
+  Standard_Real CoupleAngle = -2.0;
+  for (i = 0; i < aNbCouples; ++i) {
+    if (!aContacts(i)) {
+      continue;
+    }
+    IntPolyh_Couple& aCouple = aCouples(i);
+    // the angle is not computed for degenerated triangles,
+    // in this case the angle of the previous couple is kept
+    if (aCouple.Angle() != RealLast()) {
+      CoupleAngle = aCouple.Angle();
+    }
+    aCouple.SetAngle(CoupleAngle);
+    TTrianglesContacts.Append(aCouple);
+    //
+    TTriangles1[aCouple.FirstValue()].SetIntersection(Standard_True);
+    TTriangles2[aCouple.SecondValue()].SetIntersection(Standard_True);
+  }
   return TTrianglesContacts.Extent();
 }
 
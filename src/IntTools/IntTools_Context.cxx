@@ -55,7 +55,7 @@ IMPLEMENT_STANDARD_RTTIEXT(IntTools_Context,Standard_Transient)
 IntTools_Context::IntTools_Context()
 :
   myAllocator(NCollection_BaseAllocator::CommonBaseAllocator()),
-  myFClass2dMap(100, myAllocator),
+  myFClass2dMap(100, NCollection_BaseAllocator::CommonBaseAllocator()),
   myProjPSMap(100, myAllocator),
   myProjPCMap(100, myAllocator),
   mySClassMap(100, myAllocator),
@@ -66,7 +66,11 @@ IntTools_Context::IntTools_Context()
   mySurfAdaptorMap(100, myAllocator),
   myOBBMap(100, myAllocator),
   myCreateFlag(0),
-  myPOnSTolerance(1.e-12)
+  myPOnSTolerance(1.e-12),
+  myMainContext(NULL),
+  myNbHits(0),
+  myNbMisses(0),
+  myNbHitsBeforeKept(-1)
 {
 }
 //=======================================================================
@@ -77,7 +81,7 @@ IntTools_Context::IntTools_Context
   (const Handle(NCollection_BaseAllocator)& theAllocator)
 :
   myAllocator(theAllocator),
-  myFClass2dMap(100, myAllocator),
+  myFClass2dMap(100, NCollection_BaseAllocator::CommonBaseAllocator()),
   myProjPSMap(100, myAllocator),
   myProjPCMap(100, myAllocator),
   mySClassMap(100, myAllocator),
@@ -88,7 +92,11 @@ IntTools_Context::IntTools_Context
   mySurfAdaptorMap(100, myAllocator),
   myOBBMap(100, myAllocator),
   myCreateFlag(1),
-  myPOnSTolerance(1.e-12)
+  myPOnSTolerance(1.e-12),
+  myMainContext(NULL),
+  myNbHits(0),
+  myNbMisses(0),
+  myNbHitsBeforeKept(-1)
 {
 }
 //=======================================================================
@@ -100,9 +108,7 @@ IntTools_Context::~IntTools_Context()
   for (NCollection_DataMap<TopoDS_Shape, IntTools_FClass2d*, TopTools_ShapeMapHasher>::Iterator anIt (myFClass2dMap);
        anIt.More(); anIt.Next())
   {
-    IntTools_FClass2d* pFClass2d = anIt.Value();;
-    (*pFClass2d).~IntTools_FClass2d();
-    myAllocator->Free (pFClass2d);
+    delete anIt.Value();
   }
   myFClass2dMap.Clear();
 
@@ -187,7 +193,7 @@ IntTools_Context::~IntTools_Context()
 Bnd_Box& IntTools_Context::BndBox(const TopoDS_Shape& aS)
 {
   Bnd_Box* pBox = NULL;
-  if (!myBndBoxDataMap.Find (aS, pBox))
+  if (!isFound (myBndBoxDataMap.Find (aS, pBox)))
   {
     //
     pBox=(Bnd_Box*)myAllocator->Allocate(sizeof(Bnd_Box));
@@ -223,21 +229,41 @@ Standard_Boolean IntTools_Context::IsInfiniteFace
 IntTools_FClass2d& IntTools_Context::FClass2d(const TopoDS_Face& aF)
 {
   IntTools_FClass2d* pFClass2d = NULL;
-  if (!myFClass2dMap.Find (aF, pFClass2d))
+  IntTools_Context* aMainContext = myMainContext != NULL ? myMainContext : this;
+  isFound (aMainContext->sharedFClass2d (aF, pFClass2d));
+  return *pFClass2d;
+}
+
+//=======================================================================
+//function : sharedFClass2d
+//purpose  : 
+//=======================================================================
+Standard_Boolean IntTools_Context::sharedFClass2d (const TopoDS_Face& theFace,
+                                                   IntTools_FClass2d*& theFClass2d)
+{
   {
-    Standard_Real aTolF;
-    TopoDS_Face aFF;
-    //
-    aFF=aF;
-    aFF.Orientation(TopAbs_FORWARD);
-    aTolF=BRep_Tool::Tolerance(aFF);
-    //
-    pFClass2d=(IntTools_FClass2d*)myAllocator->Allocate(sizeof(IntTools_FClass2d));
-    new (pFClass2d) IntTools_FClass2d(aFF, aTolF);
-    //
-    myFClass2dMap.Bind(aFF, pFClass2d);
+    Standard_Mutex::Sentry aLocker (myFClass2dMutex);
+    if (myFClass2dMap.Find (theFace, theFClass2d))
+    {
+      return Standard_True;
+    }
   }
-  return *pFClass2d;
+  //
+  // Build the classifier out of the lock not to stop the other threads
+  TopoDS_Face aFF = theFace;
+  aFF.Orientation (TopAbs_FORWARD);
+  IntTools_FClass2d* pFClass2d = new IntTools_FClass2d (aFF, BRep_Tool::Tolerance (aFF));
+  //
+  Standard_Mutex::Sentry aLocker (myFClass2dMutex);
+  if (myFClass2dMap.Find (aFF, theFClass2d))
+  {
+    // The classifier has been built by other thread in the meantime
+    delete pFClass2d;
+    return Standard_False;
+  }
+  theFClass2d = pFClass2d;
+  myFClass2dMap.Bind (aFF, pFClass2d);
+  return Standard_False;
 }
 
 //=======================================================================
@@ -247,7 +273,7 @@ IntTools_FClass2d& IntTools_Context::FClass2d(const TopoDS_Face& aF)
 GeomAPI_ProjectPointOnSurf& IntTools_Context::ProjPS(const TopoDS_Face& aF)
 {
   GeomAPI_ProjectPointOnSurf* pProjPS = NULL;
-  if (!myProjPSMap.Find (aF, pProjPS))
+  if (!isFound (myProjPSMap.Find (aF, pProjPS)))
   {
     Standard_Real Umin, Usup, Vmin, Vsup;
     UVBounds(aF, Umin, Usup, Vmin, Vsup);
@@ -269,7 +295,7 @@ GeomAPI_ProjectPointOnSurf& IntTools_Context::ProjPS(const TopoDS_Face& aF)
 GeomAPI_ProjectPointOnCurve& IntTools_Context::ProjPC(const TopoDS_Edge& aE)
 {
   GeomAPI_ProjectPointOnCurve* pProjPC = NULL;
-  if (!myProjPCMap.Find (aE, pProjPC))
+  if (!isFound (myProjPCMap.Find (aE, pProjPC)))
   {
     Standard_Real f, l;
     //
@@ -293,7 +319,7 @@ GeomAPI_ProjectPointOnCurve& IntTools_Context::ProjPT
 
 {
   GeomAPI_ProjectPointOnCurve* pProjPT = NULL;
-  if (!myProjPTMap.Find (aC3D, pProjPT))
+  if (!isFound (myProjPTMap.Find (aC3D, pProjPT)))
   {
     Standard_Real f, l;
     f=aC3D->FirstParameter();
@@ -316,7 +342,7 @@ BRepClass3d_SolidClassifier& IntTools_Context::SolidClassifier
   (const TopoDS_Solid& aSolid)
 {
   BRepClass3d_SolidClassifier* pSC = NULL;
-  if (!mySClassMap.Find (aSolid, pSC))
+  if (!isFound (mySClassMap.Find (aSolid, pSC)))
   {
     pSC=(BRepClass3d_SolidClassifier*)myAllocator->Allocate(sizeof(BRepClass3d_SolidClassifier));
     new (pSC) BRepClass3d_SolidClassifier(aSolid);
@@ -334,7 +360,7 @@ BRepAdaptor_Surface& IntTools_Context::SurfaceAdaptor
   (const TopoDS_Face& theFace)
 {
   BRepAdaptor_Surface* pBAS = NULL;
-  if (!mySurfAdaptorMap.Find (theFace, pBAS))
+  if (!isFound (mySurfAdaptorMap.Find (theFace, pBAS)))
   {
     //
     pBAS=(BRepAdaptor_Surface*)myAllocator->Allocate(sizeof(BRepAdaptor_Surface));
@@ -352,7 +378,7 @@ BRepAdaptor_Surface& IntTools_Context::SurfaceAdaptor
 Geom2dHatch_Hatcher& IntTools_Context::Hatcher(const TopoDS_Face& aF)
 {
   Geom2dHatch_Hatcher* pHatcher = NULL;
-  if (!myHatcherMap.Find (aF, pHatcher))
+  if (!isFound (myHatcherMap.Find (aF, pHatcher)))
   {
     Standard_Real aTolArcIntr, aTolTangfIntr, aTolHatch2D, aTolHatch3D;
     Standard_Real aU1, aU2, aEpsT;
@@ -411,7 +437,7 @@ Bnd_OBB& IntTools_Context::OBB(const TopoDS_Shape& aS,
                                const Standard_Real theGap)
 {
   Bnd_OBB* pBox = NULL;
-  if (!myOBBMap.Find (aS, pBox))
+  if (!isFound (myOBBMap.Find (aS, pBox)))
   {
     pBox = (Bnd_OBB*)myAllocator->Allocate(sizeof(Bnd_OBB));
     new (pBox) Bnd_OBB();
@@ -433,7 +459,7 @@ IntTools_SurfaceRangeLocalizeData& IntTools_Context::SurfaceData
   (const TopoDS_Face& aF) 
 {
   IntTools_SurfaceRangeLocalizeData* pSData = NULL;
-  if (!myProjSDataMap.Find (aF, pSData))
+  if (!isFound (myProjSDataMap.Find (aF, pSData)))
   {
     pSData=(IntTools_SurfaceRangeLocalizeData*)
       myAllocator->Allocate(sizeof(IntTools_SurfaceRangeLocalizeData));
@@ -1061,3 +1087,91 @@ void IntTools_Context::UVBounds(const TopoDS_Face& theFace,
   VMin = aBAS.FirstVParameter();
   VMax = aBAS.LastVParameter ();
 }
+
+//=======================================================================
+//function : PrepareThreadContexts
+//purpose  : 
+//=======================================================================
+void IntTools_Context::PrepareThreadContexts()
+{
+  Standard_Mutex::Sentry aLocker (myThreadMutex);
+  for (NCollection_DataMap<Standard_ThreadId, Handle(IntTools_Context)>::Iterator anIt (myThreadContexts); anIt.More(); anIt.Next())
+  {
+    const Handle(IntTools_Context)& aContext = anIt.Value();
+    if (aContext->myNbHitsBeforeKept < 0)
+    {
+      aContext->myNbHitsBeforeKept = aContext->myNbHits;
+    }
+  }
+}
+
+//=======================================================================
+//function : ThreadContext
+//purpose  : 
+//=======================================================================
+const Handle(IntTools_Context)& IntTools_Context::ThreadContext (const Standard_ThreadId theThreadId)
+{
+  Standard_Mutex::Sentry aLocker (myThreadMutex);
+  if (Handle(IntTools_Context)* aContext = myThreadContexts.ChangeSeek (theThreadId))
+  {
+    return *aContext;
+  }
+  return *myThreadContexts.Bound (theThreadId, newThreadContext());
+}
+
+//=======================================================================
+//function : newThreadContext
+//purpose  : 
+//=======================================================================
+Handle(IntTools_Context) IntTools_Context::newThreadContext()
+{
+  Handle(IntTools_Context) aContext = new IntTools_Context (NCollection_BaseAllocator::CommonBaseAllocator());
+  aContext->myMainContext = myMainContext != NULL ? myMainContext : this;
+  return aContext;
+}
+
+//=======================================================================
+//function : NbHits
+//purpose  : 
+//=======================================================================
+Standard_Integer IntTools_Context::NbHits() const
+{
+  Standard_Integer aNb = myNbHits;
+  for (NCollection_DataMap<Standard_ThreadId, Handle(IntTools_Context)>::Iterator anIt (myThreadContexts); anIt.More(); anIt.Next())
+  {
+    aNb += anIt.Value()->NbHits();
+  }
+  return aNb;
+}
+
+//=======================================================================
+//function : NbMisses
+//purpose  : 
+//=======================================================================
+Standard_Integer IntTools_Context::NbMisses() const
+{
+  Standard_Integer aNb = myNbMisses;
+  for (NCollection_DataMap<Standard_ThreadId, Handle(IntTools_Context)>::Iterator anIt (myThreadContexts); anIt.More(); anIt.Next())
+  {
+    aNb += anIt.Value()->NbMisses();
+  }
+  return aNb;
+}
+
+//=======================================================================
+//function : NbKeptHits
+//purpose  : 
+//=======================================================================
+Standard_Integer IntTools_Context::NbKeptHits() const
+{
+  Standard_Integer aNb = 0;
+  for (NCollection_DataMap<Standard_ThreadId, Handle(IntTools_Context)>::Iterator anIt (myThreadContexts); anIt.More(); anIt.Next())
+  {
+    const Handle(IntTools_Context)& aContext = anIt.Value();
+    if (aContext->myNbHitsBeforeKept >= 0)
+    {
+      aNb += aContext->myNbHits - aContext->myNbHitsBeforeKept;
+    }
+  }
+  return aNb;
+}
@@ -26,6 +26,8 @@
 #include <Standard_Transient.hxx>
 #include <TopAbs_State.hxx>
 #include <BRepAdaptor_Surface.hxx>
+#include <Standard_Mutex.hxx>
+#include <Standard_ThreadId.hxx>
 class IntTools_FClass2d;
 class TopoDS_Face;
 class GeomAPI_ProjectPointOnSurf;
@@ -47,6 +49,16 @@ class Bnd_OBB;
 //! and topological toolkit (classifiers, projectors, etc).
 //! The intersection Context is for caching the tools
 //! to increase the performance.
+//!
+//! The cached tools keep the state of their last computation,
+//! so the context can be used by one thread only. The parallel
+//! loops of the algorithms give each thread its own context, which
+//! is kept by the context of the algorithm (see ThreadContext()),
+//! so the tools built by the thread in one
+//! parallel stage are reused in the next stages of the algorithm.
+//! The 2D classifiers of the faces do not depend on the classified
+//! point and are shared by the context of the algorithm with the
+//! contexts of its threads, so each face is prepared once.
 class IntTools_Context : public Standard_Transient
 {
 public:
@@ -235,6 +247,35 @@ Standard_EXPORT virtual  ~IntTools_Context();
   //! correct value for all projectors
   Standard_EXPORT void SetPOnSProjectionTolerance (const Standard_Real theValue);
 
+public: //! @name Contexts of the parallel threads
+
+  //! Marks the contexts of the threads created in the previous parallel
+  //! loops as kept for the next one (see NbKeptHits()).
+  //! Should be called before launching the parallel loop.
+  Standard_EXPORT void PrepareThreadContexts();
+
+  //! Returns the context of the given thread, creating it on the first call.
+  //! The contexts are kept by the thread identity under the lock, so a thread
+  //! gets the same context in nested and subsequent parallel loops, and
+  //! the context is never used by two threads. The parallel loops should
+  //! look the context up once per thread and reuse it for all their tasks.
+  Standard_EXPORT const Handle(IntTools_Context)& ThreadContext (const Standard_ThreadId theThreadId);
+
+  //! Returns the number of look-ups of the cached tools found in this context
+  //! and in the contexts of its threads. Should not be called during the parallel loop.
+  Standard_EXPORT Standard_Integer NbHits() const;
+
+  //! Returns the number of look-ups of the cached tools which have required
+  //! building the tool in this context and in the contexts of its threads.
+  //! Should not be called during the parallel loop.
+  Standard_EXPORT Standard_Integer NbMisses() const;
+
+  //! Returns the number of look-ups of the cached tools found in the contexts
+  //! of the threads of the pool after these contexts have been kept for the next
+  //! parallel stages, i.e. in the stages following the one they were created in.
+  //! Should not be called during the parallel loop.
+  Standard_EXPORT Standard_Integer NbKeptHits() const;
+
 
 
   DEFINE_STANDARD_RTTIEXT(IntTools_Context,Standard_Transient)
@@ -254,9 +295,37 @@ protected:
   NCollection_DataMap<TopoDS_Shape, Bnd_OBB*, TopTools_ShapeMapHasher> myOBBMap; // Map of oriented bounding boxes
   Standard_Integer myCreateFlag;
   Standard_Real myPOnSTolerance;
+  NCollection_DataMap<Standard_ThreadId, Handle(IntTools_Context)> myThreadContexts;
+  Standard_Mutex myThreadMutex;
+  Standard_Mutex myFClass2dMutex;
+  IntTools_Context* myMainContext; // Context of the algorithm for the contexts of its threads
+  Standard_Integer myNbHits;
+  Standard_Integer myNbMisses;
+  Standard_Integer myNbHitsBeforeKept; // Hits of the context of the thread at the start of its second stage
 
 private:
 
+  //! Finds the 2D classifier of the face in the map shared by the
+  //! contexts of the threads or builds it. Returns true if found.
+  Standard_EXPORT Standard_Boolean sharedFClass2d (const TopoDS_Face& theFace,
+                                                   IntTools_FClass2d*& theFClass2d);
+
+  //! Creates the context of the thread.
+  Standard_EXPORT Handle(IntTools_Context) newThreadContext();
+
+  //! Counts the look-up of the cached tool and returns its result.
+  Standard_Boolean isFound (const Standard_Boolean theIsFound)
+  {
+    if (theIsFound)
+    {
+      ++myNbHits;
+    }
+    else
+    {
+      ++myNbMisses;
+    }
+    return theIsFound;
+  }
   
   //! Clears map of already cached projectors.
   Standard_EXPORT void clearCachedPOnSProjectors();
@@ -62,7 +62,8 @@ static const Handle(Interface_Check)& nulch()
 //=======================================================================
 
 Interface_InterfaceModel::Interface_InterfaceModel ()
-     : haschecksem (Standard_False), isdispatch (Standard_False)
+     : haschecksem (Standard_False), isdispatch (Standard_False),
+       myHasToLoad (Standard_False)
 {
   thecheckstx = new Interface_Check;
   thechecksem = new Interface_Check;
@@ -167,6 +168,7 @@ void Interface_InterfaceModel::ClearEntities ()
   thereports.Clear();
   therepch.Clear();
   haschecksem = Standard_False;
+  myHasToLoad = Standard_False;
 
   if (!thegtool.IsNull()) {
 // WhenDeleteCase is not applicable    
@@ -260,10 +262,34 @@ Standard_Integer Interface_InterfaceModel::DENumber
 const Handle(Standard_Transient)& Interface_InterfaceModel::Value
        (const Standard_Integer num) const
 {
+  if (myHasToLoad) LoadEntity(num);
   return theentities.FindKey(num);
 }
 
 
+//=======================================================================
+//function : LoadEntities
+//purpose  : 
+//=======================================================================
+
+void Interface_InterfaceModel::LoadEntities () const
+{
+  Standard_Integer nb = NbEntities();
+  for (Standard_Integer i = 1; i <= nb && myHasToLoad; i ++)
+    LoadEntity(i);
+}
+
+
+//=======================================================================
+//function : LoadEntity
+//purpose  : 
+//=======================================================================
+
+void Interface_InterfaceModel::LoadEntity (const Standard_Integer ) const
+{
+}    // par defaut, tout est deja charge
+
+
 //=======================================================================
 //function : NbTypes
 //purpose  : 
@@ -660,6 +686,7 @@ void Interface_InterfaceModel::AddWithRefs(const Handle(Standard_Transient)& ane
 void Interface_InterfaceModel::ReplaceEntity(const Standard_Integer nument,
                                              const Handle(Standard_Transient)& anent)
 {
+  LoadEntities();  // les entites a charger sont reperees par leur numero
   theentities.Substitute(nument,anent);
 }
 
@@ -677,6 +704,7 @@ void Interface_InterfaceModel::ReverseOrders (const Standard_Integer after)
 {
   Standard_Integer nb = NbEntities();  //Standard_Integer num; svv #2
   if (nb < 2 || after >= nb) return;
+  LoadEntities();
   TColStd_Array1OfTransient ents(1,nb);
   Standard_Integer i; // svv #1
   for (i = 1; i <= nb; i ++)
@@ -712,6 +740,7 @@ void Interface_InterfaceModel::ChangeOrder(const Standard_Integer oldnum,
 {
   Standard_Integer nb = NbEntities();  Standard_Integer i; //, num; svv #2 
   if (nb < 2 || newnum >= nb || cnt<= 0) return;
+  LoadEntities();
   TColStd_Array1OfTransient ents(1,nb);
   //  On va preparer le changement
   Standard_Integer minum  = (oldnum > newnum ? newnum : oldnum);
@@ -811,6 +840,7 @@ Standard_Integer Interface_InterfaceModel::CategoryNumber
 void Interface_InterfaceModel::FillIterator(Interface_EntityIterator& iter) const
 {
   Standard_Integer nb = NbEntities();
+  LoadEntities();
   for (Standard_Integer i = 1; i <= nb; i ++)
     iter.GetOneItem (theentities.FindKey(i));
 }
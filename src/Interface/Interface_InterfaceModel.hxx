@@ -135,8 +135,18 @@ public:
   //! Remark : For a Reported Entity, (Erroneous, Corrected, Unknown), this
   //! method returns this Reported Entity.
   //! See ReportEntity for other questions.
+  //! If the Model has entities to load (see HasEntitiesToLoad), the
+  //! contents of the entity is loaded at this time, by LoadEntity
   Standard_EXPORT const Handle(Standard_Transient)& Value (const Standard_Integer num) const;
   
+  //! Returns True if the contents of some entities is not loaded yet,
+  //! but on demand, when they are queried by Value or Entities
+  //! (False by default)
+  Standard_Boolean HasEntitiesToLoad() const { return myHasToLoad; }
+  
+  //! Loads the contents of all the entities still to be loaded
+  Standard_EXPORT void LoadEntities() const;
+  
   //! Returns the count of DISTINCT types under which an entity may
   //! be processed. Defined by the Protocol, which gives default as
   //! 1 (dynamic Type).
@@ -399,6 +409,18 @@ protected:
   
   //! Defines empty InterfaceModel, ready to be filled
   Standard_EXPORT Interface_InterfaceModel();
+  
+  //! Declares that the contents of entities are loaded on demand,
+  //! by LoadEntity called from Value
+  void SetEntitiesToLoad (const Standard_Boolean theToLoad) { myHasToLoad = theToLoad; }
+  
+  //! Loads the contents of the entity <num> if it is not loaded yet.
+  //! Called only if HasEntitiesToLoad is True; default does nothing
+  Standard_EXPORT virtual void LoadEntity (const Standard_Integer num) const;
+  
+  //! Returns the entity <num> as Value, but without loading its contents
+  const Handle(Standard_Transient)& RawValue (const Standard_Integer num) const
+  { return theentities.FindKey(num); }
 
 
 
@@ -414,6 +436,7 @@ private:
   Standard_Boolean isdispatch;
   Handle(TCollection_HAsciiString) thecategory;
   Handle(Interface_GTool) thegtool;
+  Standard_Boolean myHasToLoad;
 
 
 };
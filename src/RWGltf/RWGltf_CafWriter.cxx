@@ -237,6 +237,270 @@ private:
 };
 #endif
 
+//! Return TRUE if texture coordinates of the face should be exported.
+static bool toSaveTextCoords (const RWMesh_FaceIterator& theFaceIter,
+                              const bool theIsForcedUVExport)
+{
+  if (!theFaceIter.HasTexCoords())
+  {
+    return false;
+  }
+  if (theIsForcedUVExport)
+  {
+    return true;
+  }
+  if (theFaceIter.FaceStyle().Material().IsNull())
+  {
+    return false;
+  }
+
+  return !RWGltf_GltfMaterialMap::baseColorTexture (theFaceIter.FaceStyle().Material()).IsNull()
+      || !theFaceIter.FaceStyle().Material()->PbrMaterial().MetallicRoughnessTexture.IsNull()
+      || !theFaceIter.FaceStyle().Material()->PbrMaterial().EmissiveTexture.IsNull()
+      || !theFaceIter.FaceStyle().Material()->PbrMaterial().OcclusionTexture.IsNull()
+      || !theFaceIter.FaceStyle().Material()->PbrMaterial().NormalTexture.IsNull();
+}
+
+//! Buffer collecting binary data of one array type for a sequence of faces.
+//! Faces are first added sequentially in the order of the file to define accessors and offsets
+//! (as RWGltf_CafWriter::saveNodes(), saveNormals(), saveTextCoords() and saveIndices() do),
+//! then the data of all faces is filled in parallel threads and written at once.
+class BinDataBuffer
+{
+public:
+
+  //! Face to be written.
+  struct FaceData
+  {
+    TopoDS_Face        Face;      //!< face with triangulation
+    RWGltf_GltfFace*   GltfFace;  //!< glTF face definition
+    size_t             Offset;    //!< data offset within the buffer
+    Standard_Integer   NodeFirst; //!< shift of node indices for RWGltf_GltfArrayType_Indices
+    Graphic3d_BndBox3d BndBox;    //!< bounding box of nodes for RWGltf_GltfArrayType_Position
+  };
+
+public:
+
+  //! Main constructor.
+  BinDataBuffer (const RWMesh_CoordinateSystemConverter& theCSTrsf,
+                 const bool theIsForcedUVExport)
+  : myCSTrsf (&theCSTrsf),
+    myArrType (RWGltf_GltfArrayType_UNKNOWN),
+    myBuffViewOffset (0),
+    myIsForcedUVExport (theIsForcedUVExport) {}
+
+  //! Start buffer view of specified array type.
+  void Init (const RWGltf_GltfArrayType theArrType,
+             const int64_t theBuffViewOffset)
+  {
+    myArrType = theArrType;
+    myBuffViewOffset = theBuffViewOffset;
+    myFaces.clear();
+    myData.clear();
+  }
+
+  //! Return size of pending data.
+  size_t Size() const { return myData.size(); }
+
+  //! Add face, define its accessor and reserve space for its data.
+  void AddFace (RWGltf_GltfFace& theGltfFace,
+                const RWMesh_FaceIterator& theFaceIter,
+                Standard_Integer& theAccessorNb,
+                std::ostream& theBinFile)
+  {
+    RWGltf_GltfAccessor* anAccessor = NULL;
+    RWGltf_GltfAccessorLayout aLayout = RWGltf_GltfAccessorLayout_Vec3;
+    RWGltf_GltfAccessorCompType aCompType = RWGltf_GltfAccessorCompType_Float32;
+    FaceData aFaceData;
+    aFaceData.Face      = theFaceIter.Face();
+    aFaceData.GltfFace  = &theGltfFace;
+    aFaceData.Offset    = myData.size();
+    aFaceData.NodeFirst = 0;
+    size_t aDataSize = 0;
+    switch (myArrType)
+    {
+      case RWGltf_GltfArrayType_Position:
+      {
+        anAccessor = &theGltfFace.NodePos;
+        aDataSize  = theFaceIter.NbNodes() * sizeof(Graphic3d_Vec3);
+        break;
+      }
+      case RWGltf_GltfArrayType_Normal:
+      {
+        if (!theFaceIter.HasNormals())
+        {
+          return;
+        }
+        anAccessor = &theGltfFace.NodeNorm;
+        aDataSize  = theFaceIter.NbNodes() * sizeof(Graphic3d_Vec3);
+        break;
+      }
+      case RWGltf_GltfArrayType_TCoord0:
+      {
+        if (!toSaveTextCoords (theFaceIter, myIsForcedUVExport))
+        {
+          return;
+        }
+        anAccessor = &theGltfFace.NodeUV;
+        aLayout    = RWGltf_GltfAccessorLayout_Vec2;
+        aDataSize  = theFaceIter.NbNodes() * sizeof(Graphic3d_Vec2);
+        break;
+      }
+      case RWGltf_GltfArrayType_Indices:
+      {
+        anAccessor = &theGltfFace.Indices;
+        aLayout    = RWGltf_GltfAccessorLayout_Scalar;
+        aCompType  = theGltfFace.NodePos.Count > std::numeric_limits<uint16_t>::max()
+                   ? RWGltf_GltfAccessorCompType_UInt32
+                   : RWGltf_GltfAccessorCompType_UInt16;
+        break;
+      }
+      default:
+      {
+        return;
+      }
+    }
+
+    if (anAccessor->Id == RWGltf_GltfAccessor::INVALID_ID)
+    {
+      anAccessor->Id            = theAccessorNb++;
+      anAccessor->ByteOffset    = (int64_t )theBinFile.tellp() + (int64_t )myData.size() - myBuffViewOffset;
+      anAccessor->Type          = aLayout;
+      anAccessor->ComponentType = aCompType;
+    }
+    if (myArrType == RWGltf_GltfArrayType_Indices)
+    {
+      aFaceData.NodeFirst = theGltfFace.NbIndexedNodes - theFaceIter.ElemLower();
+      theGltfFace.NbIndexedNodes += theFaceIter.NbNodes();
+      anAccessor->Count += theFaceIter.NbTriangles() * 3;
+      aDataSize = theFaceIter.NbTriangles() * 3
+                * (anAccessor->ComponentType == RWGltf_GltfAccessorCompType_UInt32 ? sizeof(uint32_t) : sizeof(uint16_t));
+    }
+    else
+    {
+      anAccessor->Count += theFaceIter.NbNodes();
+    }
+
+    myData.resize (myData.size() + aDataSize);
+    myFaces.push_back (aFaceData);
+  }
+
+  //! Add alignment by 4 bytes.
+  void AddPadding (std::ostream& theBinFile)
+  {
+    int64_t aContentLen64 = (int64_t )theBinFile.tellp() + (int64_t )myData.size();
+    for (; aContentLen64 % 4 != 0; ++aContentLen64)
+    {
+      myData.push_back (' ');
+    }
+  }
+
+  //! Fill data of added faces in parallel threads and write it into the file.
+  void Flush (std::ostream& theBinFile)
+  {
+    OSD_Parallel::For (0, int(myFaces.size()), *this);
+    if (myArrType == RWGltf_GltfArrayType_Position)
+    {
+      for (std::vector<FaceData>::const_iterator aFaceIter = myFaces.begin(); aFaceIter != myFaces.end(); ++aFaceIter)
+      {
+        aFaceIter->GltfFace->NodePos.BndBox.Combine (aFaceIter->BndBox);
+      }
+    }
+    if (!myData.empty())
+    {
+      theBinFile.write (myData.data(), std::streamsize(myData.size()));
+    }
+    myFaces.clear();
+    myData.clear();
+  }
+
+  //! Fill data of the face with specified index.
+  void operator() (int theFaceIndex) const
+  {
+    FaceData& aFaceData = myFaces[theFaceIndex];
+    char* aData = myData.data() + aFaceData.Offset;
+    RWMesh_FaceIterator aFaceIter (aFaceData.Face, XCAFPrs_Style());
+    const Standard_Integer aNodeUpper = aFaceIter.NodeUpper();
+    switch (myArrType)
+    {
+      case RWGltf_GltfArrayType_Position:
+      {
+        for (Standard_Integer aNodeIter = aFaceIter.NodeLower(); aNodeIter <= aNodeUpper; ++aNodeIter)
+        {
+          gp_XYZ aNode = aFaceIter.NodeTransformed (aNodeIter).XYZ();
+          myCSTrsf->TransformPosition (aNode);
+          aFaceData.BndBox.Add (Graphic3d_Vec3d(aNode.X(), aNode.Y(), aNode.Z()));
+          const Graphic3d_Vec3 aVec3 (float(aNode.X()), float(aNode.Y()), float(aNode.Z()));
+          memcpy (aData, aVec3.GetData(), sizeof(aVec3));
+          aData += sizeof(aVec3);
+        }
+        break;
+      }
+      case RWGltf_GltfArrayType_Normal:
+      {
+        for (Standard_Integer aNodeIter = aFaceIter.NodeLower(); aNodeIter <= aNodeUpper; ++aNodeIter)
+        {
+          const gp_Dir aNormal = aFaceIter.NormalTransformed (aNodeIter);
+          Graphic3d_Vec3 aVecNormal ((float )aNormal.X(), (float )aNormal.Y(), (float )aNormal.Z());
+          myCSTrsf->TransformNormal (aVecNormal);
+          memcpy (aData, aVecNormal.GetData(), sizeof(aVecNormal));
+          aData += sizeof(aVecNormal);
+        }
+        break;
+      }
+      case RWGltf_GltfArrayType_TCoord0:
+      {
+        for (Standard_Integer aNodeIter = aFaceIter.NodeLower(); aNodeIter <= aNodeUpper; ++aNodeIter)
+        {
+          const gp_Pnt2d aTexCoord = aFaceIter.NodeTexCoord (aNodeIter);
+          const Graphic3d_Vec2 aVec2 (float(aTexCoord.X()), float(1.0 - aTexCoord.Y()));
+          memcpy (aData, aVec2.GetData(), sizeof(aVec2));
+          aData += sizeof(aVec2);
+        }
+        break;
+      }
+      case RWGltf_GltfArrayType_Indices:
+      {
+        const bool isUInt16 = aFaceData.GltfFace->Indices.ComponentType == RWGltf_GltfAccessorCompType_UInt16;
+        const Standard_Integer anElemUpper = aFaceIter.ElemUpper();
+        for (Standard_Integer anElemIter = aFaceIter.ElemLower(); anElemIter <= anElemUpper; ++anElemIter)
+        {
+          Poly_Triangle aTri = aFaceIter.TriangleOriented (anElemIter);
+          aTri(1) += aFaceData.NodeFirst;
+          aTri(2) += aFaceData.NodeFirst;
+          aTri(3) += aFaceData.NodeFirst;
+          if (isUInt16)
+          {
+            const NCollection_Vec3<uint16_t> aTri16 ((uint16_t)aTri(1), (uint16_t)aTri(2), (uint16_t)aTri(3));
+            memcpy (aData, aTri16.GetData(), sizeof(aTri16));
+            aData += sizeof(aTri16);
+          }
+          else
+          {
+            const Graphic3d_Vec3i aTri32 (aTri(1), aTri(2), aTri(3));
+            memcpy (aData, aTri32.GetData(), sizeof(aTri32));
+            aData += sizeof(aTri32);
+          }
+        }
+        break;
+      }
+      default:
+      {
+        break;
+      }
+    }
+  }
+
+private:
+
+  const RWMesh_CoordinateSystemConverter* myCSTrsf;
+  mutable std::vector<FaceData> myFaces;
+  mutable std::vector<char>     myData;
+  RWGltf_GltfArrayType          myArrType;
+  int64_t                       myBuffViewOffset;
+  bool                          myIsForcedUVExport;
+};
+
 //================================================================
 // Function : Constructor
 // Purpose  :
@@ -398,26 +662,10 @@ void RWGltf_CafWriter::saveTextCoords (RWGltf_GltfFace& theGltfFace,
                                        Standard_Integer& theAccessorNb,
                                        const std::shared_ptr<RWGltf_CafWriter::Mesh>& theMesh) const
 {
-  if (!theFaceIter.HasTexCoords())
+  if (!toSaveTextCoords (theFaceIter, myIsForcedUVExport))
   {
     return;
   }
-  if (!myIsForcedUVExport)
-  {
-    if (theFaceIter.FaceStyle().Material().IsNull())
-    {
-      return;
-    }
-
-    if (RWGltf_GltfMaterialMap::baseColorTexture (theFaceIter.FaceStyle().Material()).IsNull()
-     && theFaceIter.FaceStyle().Material()->PbrMaterial().MetallicRoughnessTexture.IsNull()
-     && theFaceIter.FaceStyle().Material()->PbrMaterial().EmissiveTexture.IsNull()
-     && theFaceIter.FaceStyle().Material()->PbrMaterial().OcclusionTexture.IsNull()
-     && theFaceIter.FaceStyle().Material()->PbrMaterial().NormalTexture.IsNull())
-    {
-      return;
-    }
-  }
 
   if (theGltfFace.NodeUV.Id == RWGltf_GltfAccessor::INVALID_ID)
   {
@@ -718,6 +966,10 @@ bool RWGltf_CafWriter::writeBinData (const Handle(TDocStd_Document)& theDocument
 
   std::vector<std::shared_ptr<RWGltf_CafWriter::Mesh>> aMeshes;
   Standard_Integer aNbAccessors = 0;
+  // binary data is filled in parallel threads by blocks of faces (not applicable to Draco compression)
+  const bool toFillParallel = myToParallel && !myDracoParameters.DracoCompression;
+  const size_t aParallelBlockSize = 16 * 1024 * 1024;
+  BinDataBuffer aBinDataBuffer (myCSTrsf, myIsForcedUVExport);
   NCollection_Map<Handle(RWGltf_GltfFaceList)> aWrittenFaces;
   NCollection_DataMap<TopoDS_Shape, Handle(RWGltf_GltfFace), TopTools_ShapeMapHasher> aWrittenPrimData;
   for (Standard_Integer aTypeIter = 0; aTypeIter < 4; ++aTypeIter)
@@ -733,6 +985,7 @@ bool RWGltf_CafWriter::writeBinData (const Handle(TDocStd_Document)& theDocument
       default: break;
     }
     aBuffView->ByteOffset = aBinFile->tellp();
+    aBinDataBuffer.Init (anArrType, aBuffView->ByteOffset);
     aWrittenFaces.Clear (false);
     aWrittenPrimData.Clear (false);
 #ifdef HAVE_DRACO
@@ -803,6 +1056,16 @@ bool RWGltf_CafWriter::writeBinData (const Handle(TDocStd_Document)& theDocument
 
         for (RWMesh_FaceIterator aFaceIter (aGltfFace->Shape, aGltfFace->Style); aFaceIter.More() && aPSentryBin.More(); aFaceIter.Next())
         {
+          if (toFillParallel)
+          {
+            if (anArrType == RWGltf_GltfArrayType_Position)
+            {
+              aGltfFace->NbIndexedNodes = 0; // reset to zero before RWGltf_GltfArrayType_Indices step
+            }
+            aBinDataBuffer.AddFace (*aGltfFace, aFaceIter, aNbAccessors, *aBinFile);
+            continue;
+          }
+
           switch (anArrType)
           {
             case RWGltf_GltfArrayType_Position:
@@ -840,7 +1103,15 @@ bool RWGltf_CafWriter::writeBinData (const Handle(TDocStd_Document)& theDocument
         }
 
         // add alignment by 4 bytes (might happen on RWGltf_GltfAccessorCompType_UInt16 indices)
-        if (!myDracoParameters.DracoCompression)
+        if (toFillParallel)
+        {
+          aBinDataBuffer.AddPadding (*aBinFile);
+          if (aBinDataBuffer.Size() >= aParallelBlockSize)
+          {
+            aBinDataBuffer.Flush (*aBinFile);
+          }
+        }
+        else if (!myDracoParameters.DracoCompression)
         {
           int64_t aContentLen64 = (int64_t)aBinFile->tellp();
           while (aContentLen64 % 4 != 0)
@@ -852,6 +1123,15 @@ bool RWGltf_CafWriter::writeBinData (const Handle(TDocStd_Document)& theDocument
       }
     }
 
+    if (toFillParallel)
+    {
+      aBinDataBuffer.Flush (*aBinFile);
+      if (!aBinFile->good())
+      {
+        Message::SendFail (TCollection_AsciiString ("File '") + myBinFileNameFull + "' cannot be written");
+        return false;
+      }
+    }
     if (!myDracoParameters.DracoCompression)
     {
       aBuffView->ByteLength = (int64_t)aBinFile->tellp() - aBuffView->ByteOffset;
@@ -130,6 +130,9 @@ public:
   bool ToParallel() const { return myToParallel; }
 
   //! Setup multithreaded execution.
+  //! Without Draco compression, binary data of faces is filled in parallel threads
+  //! directly (bypassing saveNodes(), saveNormals(), saveTextCoords() and saveIndices())
+  //! producing the same file as sequential export.
   void SetParallel (bool theToParallel) { myToParallel = theToParallel; }
 
   //! Return Draco parameters
@@ -21,7 +21,8 @@ IMPLEMENT_STANDARD_RTTIEXT(RWObj_CafReader, RWMesh_CafReader)
 // Purpose  :
 //================================================================
 RWObj_CafReader::RWObj_CafReader()
-: myIsSinglePrecision (Standard_False)
+: myIsSinglePrecision (Standard_False),
+  myToParallel (Standard_False)
 {
   //myCoordSysConverter.SetInputLengthUnit (-1.0); // length units are undefined within OBJ file
   // OBJ format does not define coordinate system (apart from mentioning that it is right-handed),
@@ -101,6 +102,7 @@ Standard_Boolean RWObj_CafReader::performMesh (std::istream& theStream,
 {
   Handle(RWObj_TriangulationReader) aCtx = createReaderContext();
   aCtx->SetSinglePrecision (myIsSinglePrecision);
+  aCtx->SetParallel (myToParallel);
   aCtx->SetCreateShapes (Standard_True);
   aCtx->SetShapeReceiver (this);
   aCtx->SetTransformation (myCoordSysConverter);
@@ -32,6 +32,12 @@ public:
   //! Setup single/double precision flag for reading vertex data (coordinates).
   void SetSinglePrecision (Standard_Boolean theIsSinglePrecision) { myIsSinglePrecision = theIsSinglePrecision; }
 
+  //! Return flag to parse the file in parallel threads; FALSE by default.
+  Standard_Boolean ToParallel() const { return myToParallel; }
+
+  //! Setup flag to parse the file in parallel threads (see RWObj_Reader::SetParallel()).
+  void SetParallel (Standard_Boolean theToParallel) { myToParallel = theToParallel; }
+
 protected:
 
   //! Read the mesh from specified file.
@@ -59,6 +65,7 @@ protected:
 
   NCollection_DataMap<TCollection_AsciiString, Handle(XCAFDoc_VisMaterial)> myObjMaterialMap;
   Standard_Boolean myIsSinglePrecision; //!< flag for reading vertex data with single or double floating point precision
+  Standard_Boolean myToParallel;        //!< flag to parse the file in parallel threads
 };
 
 #endif // _RWObj_CafReader_HeaderFile
@@ -16,6 +16,7 @@
 #include <Message.hxx>
 #include <Message_LazyProgressScope.hxx>
 #include <OSD_OpenFile.hxx>
+#include <OSD_Parallel.hxx>
 #include <OSD_Path.hxx>
 #include <RWMesh_FaceIterator.hxx>
 #include <RWObj_ObjMaterialMap.hxx>
@@ -53,14 +54,60 @@ namespace
     }
     return TCollection_AsciiString (aNodeName->Get());
   }
+
+  //! Number of nodes of faces formatted by parallel threads at once.
+  static const Standard_Integer THE_PARALLEL_NB_NODES = 256 * 1024;
 }
 
+//! Face to be formatted by parallel threads.
+class RWObj_CafWriter::FaceJob
+{
+public:
+  TopoDS_Face            Face;    //!< face with triangulation
+  XCAFPrs_Style          Style;   //!< face style
+  RWObj_ObjWriterContext Context; //!< in-memory writer context
+  Standard_Integer       NbSteps; //!< number of progress steps
+  bool                   IsDone;  //!< formatting result
+
+  FaceJob() : NbSteps (0), IsDone (false) {}
+};
+
+//! Functor formatting faces into in-memory writer contexts.
+class RWObj_CafWriter::FaceFormatFunctor
+{
+public:
+
+  //! Main constructor.
+  FaceFormatFunctor (RWObj_CafWriter* theWriter,
+                     std::vector<FaceJob>& theJobs)
+  : myWriter (theWriter),
+    myJobs (&theJobs) {}
+
+  //! Format the face with specified index.
+  void operator() (int theJobIndex) const
+  {
+    FaceJob& aJob = myJobs->at (theJobIndex);
+    // progress is advanced by the caller after writing the data
+    Message_LazyProgressScope aPSentry (Message_ProgressRange(), NULL, aJob.NbSteps, aJob.NbSteps + 1);
+    RWMesh_FaceIterator aFaceIter (aJob.Face, aJob.Style);
+    aJob.IsDone = myWriter->writePositions (aJob.Context, aPSentry, aFaceIter)
+              && (!aJob.Context.HasNormals()   || myWriter->writeNormals    (aJob.Context, aPSentry, aFaceIter))
+              && (!aJob.Context.HasTexCoords() || myWriter->writeTextCoords (aJob.Context, aPSentry, aFaceIter))
+              &&  myWriter->writeIndices (aJob.Context, aPSentry, aFaceIter);
+  }
+
+private:
+  RWObj_CafWriter*      myWriter;
+  std::vector<FaceJob>* myJobs;
+};
+
 //================================================================
 // Function : Constructor
 // Purpose  :
 //================================================================
 RWObj_CafWriter::RWObj_CafWriter (const TCollection_AsciiString& theFile)
-: myFile (theFile)
+: myFile (theFile),
+  myToParallel (Standard_False)
 {
   // OBJ file format doesn't define length units;
   // Y-up coordinate system is most commonly used (but also undefined)
@@ -269,6 +316,8 @@ bool RWObj_CafWriter::writeShape (RWObj_ObjWriterContext&        theWriter,
                                   const TCollection_AsciiString& theName)
 {
   bool toCreateGroup = true;
+  std::vector<FaceJob> aJobs;
+  Standard_Integer aNbJobNodes = 0;
   for (RWMesh_FaceIterator aFaceIter (theLabel, theParentTrsf, true, theParentStyle); aFaceIter.More() && !thePSentry.IsAborted(); aFaceIter.Next())
   {
     if (toSkipFaceMesh (aFaceIter))
@@ -290,8 +339,20 @@ bool RWObj_CafWriter::writeShape (RWObj_ObjWriterContext&        theWriter,
       theWriter.SetTexCoords(hasTexCoords);
     }
 
+    // in parallel mode, face data (including group and material definitions) is put into in-memory context
+    RWObj_ObjWriterContext* aFaceWriter = &theWriter;
+    if (myToParallel)
+    {
+      aJobs.push_back (FaceJob());
+      FaceJob& aJob = aJobs.back();
+      aJob.Face  = aFaceIter.Face();
+      aJob.Style = aFaceIter.FaceStyle();
+      aJob.Context.SetState (theWriter);
+      aFaceWriter = &aJob.Context;
+    }
+
     if (toCreateGroup
-    && !theWriter.WriteGroup (theName))
+    && !aFaceWriter->WriteGroup (theName))
     {
       return false;
     }
@@ -303,9 +364,36 @@ bool RWObj_CafWriter::writeShape (RWObj_ObjWriterContext&        theWriter,
     {
       aMatName = theMatMgr.AddMaterial (aFaceIter.FaceStyle());
     }
-    if (aMatName != theWriter.ActiveMaterial())
+    if (aMatName != aFaceWriter->ActiveMaterial())
     {
-      theWriter.WriteActiveMaterial (aMatName);
+      aFaceWriter->WriteActiveMaterial (aMatName);
+    }
+
+    if (myToParallel)
+    {
+      FaceJob& aJob = aJobs.back();
+      aJob.NbSteps = aFaceIter.NbNodes() + aFaceIter.NbTriangles();
+      if (aJob.Context.HasNormals())
+      {
+        aJob.NbSteps += aFaceIter.NbNodes();
+      }
+      if (aJob.Context.HasTexCoords())
+      {
+        aJob.NbSteps += aFaceIter.NbNodes();
+      }
+      theWriter.SetState (aJob.Context);
+      theWriter.FlushFace (aFaceIter.NbNodes());
+
+      aNbJobNodes += aFaceIter.NbNodes();
+      if (aNbJobNodes >= THE_PARALLEL_NB_NODES)
+      {
+        if (!writeFaceJobs (theWriter, thePSentry, aJobs))
+        {
+          return false;
+        }
+        aNbJobNodes = 0;
+      }
+      continue;
     }
 
     // write nodes
@@ -333,6 +421,37 @@ bool RWObj_CafWriter::writeShape (RWObj_ObjWriterContext&        theWriter,
     }
     theWriter.FlushFace (aFaceIter.NbNodes());
   }
+  return writeFaceJobs (theWriter, thePSentry, aJobs);
+}
+
+// =======================================================================
+// function : writeFaceJobs
+// purpose  :
+// =======================================================================
+bool RWObj_CafWriter::writeFaceJobs (RWObj_ObjWriterContext&    theWriter,
+                                     Message_LazyProgressScope& thePSentry,
+                                     std::vector<FaceJob>&      theJobs)
+{
+  if (theJobs.empty())
+  {
+    return true;
+  }
+
+  FaceFormatFunctor aFunctor (this, theJobs);
+  OSD_Parallel::For (0, int(theJobs.size()), aFunctor);
+  for (std::vector<FaceJob>::const_iterator aJobIter = theJobs.begin(); aJobIter != theJobs.end(); ++aJobIter)
+  {
+    if (!aJobIter->IsDone
+     || !theWriter.WriteBuffer (aJobIter->Context))
+    {
+      return false;
+    }
+    for (Standard_Integer aStepIter = 0; aStepIter < aJobIter->NbSteps && thePSentry.More(); ++aStepIter)
+    {
+      thePSentry.Next();
+    }
+  }
+  theJobs.clear();
   return true;
 }
 
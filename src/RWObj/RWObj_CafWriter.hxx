@@ -22,6 +22,7 @@
 #include <XCAFPrs_Style.hxx>
 
 #include <memory>
+#include <vector>
 
 class Message_ProgressRange;
 class RWMesh_FaceIterator;
@@ -59,6 +60,15 @@ public:
   //! Set default material definition to be used for nodes with only color defined.
   void SetDefaultStyle (const XCAFPrs_Style& theStyle) { myDefaultStyle = theStyle; }
 
+  //! Return TRUE if multithreaded optimizations are allowed; FALSE by default.
+  bool ToParallel() const { return myToParallel; }
+
+  //! Setup multithreaded execution.
+  //! When enabled, face data is formatted by writePositions(), writeNormals(), writeTextCoords() and writeIndices()
+  //! into in-memory writer contexts from parallel threads and then written into the file in the original order,
+  //! so that these methods should be thread-safe in sub-classes.
+  void SetParallel (bool theToParallel) { myToParallel = theToParallel; }
+
   //! Write OBJ file and associated MTL material file.
   //! Triangulation data should be precomputed within shapes!
   //! @param[in] theDocument     input document
@@ -155,12 +165,26 @@ protected:
                                              Message_LazyProgressScope& thePSentry,
                                              const RWMesh_FaceIterator& theFace);
 
+private:
+
+  class FaceJob;
+  class FaceFormatFunctor;
+
+  //! Format the data of pending faces in parallel threads and write it in the same order.
+  //! @param[in] theWriter   OBJ writer context
+  //! @param[in] thePSentry  progress sentry
+  //! @param[in][out] theJobs  pending faces, cleared on success
+  //! @return FALSE on writing file error
+  Standard_EXPORT bool writeFaceJobs (RWObj_ObjWriterContext&    theWriter,
+                                      Message_LazyProgressScope& thePSentry,
+                                      std::vector<FaceJob>&      theJobs);
 
 protected:
 
   TCollection_AsciiString          myFile;         //!< output OBJ file
   RWMesh_CoordinateSystemConverter myCSTrsf;       //!< transformation from OCCT to OBJ coordinate system
   XCAFPrs_Style                    myDefaultStyle; //!< default material definition to be used for nodes with only color defined
+  Standard_Boolean                 myToParallel;   //!< flag to use multithreading; FALSE by default
 
 };
 
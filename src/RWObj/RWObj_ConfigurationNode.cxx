@@ -75,11 +75,15 @@ bool RWObj_ConfigurationNode::Load(const Handle(DE_ConfigurationContext)& theRes
     theResource->BooleanVal("read.fill.incomplete", InternalParameters.ReadFillIncomplete, aScope);
   InternalParameters.ReadMemoryLimitMiB = 
     theResource->IntegerVal("read.memory.limit.mib", InternalParameters.ReadMemoryLimitMiB, aScope);
+  InternalParameters.ReadParallel =
+    theResource->BooleanVal("read.parallel", InternalParameters.ReadParallel, aScope);
 
   InternalParameters.WriteComment = 
     theResource->StringVal("write.comment", InternalParameters.WriteComment, aScope);
   InternalParameters.WriteAuthor = 
     theResource->StringVal("write.author", InternalParameters.WriteAuthor, aScope);
+  InternalParameters.WriteParallel =
+    theResource->BooleanVal("write.parallel", InternalParameters.WriteParallel, aScope);
   return true;
 }
 
@@ -156,6 +160,12 @@ TCollection_AsciiString RWObj_ConfigurationNode::Save() const
   aResult += aScope + "read.memory.limit.mib :\t " + InternalParameters.ReadMemoryLimitMiB + "\n";
   aResult += "!\n";
 
+  aResult += "!\n";
+  aResult += "!Flag for parsing the file in parallel threads\n";
+  aResult += "!Default value: 0(false). Available values: 0(false), 1(true)\n";
+  aResult += aScope + "read.parallel :\t " + InternalParameters.ReadParallel + "\n";
+  aResult += "!\n";
+
   aResult += "!\n";
   aResult += "!Write parameters:\n";
   aResult += "!\n";
@@ -172,6 +182,12 @@ TCollection_AsciiString RWObj_ConfigurationNode::Save() const
   aResult += aScope + "write.author :\t " + InternalParameters.WriteAuthor + "\n";
   aResult += "!\n";
 
+  aResult += "!\n";
+  aResult += "!Flag for formatting the file in parallel threads\n";
+  aResult += "!Default value: 0(false). Available values: 0(false), 1(true)\n";
+  aResult += aScope + "write.parallel :\t " + InternalParameters.WriteParallel + "\n";
+  aResult += "!\n";
+
   aResult += "!*****************************************************************************\n";
   return aResult;
 }
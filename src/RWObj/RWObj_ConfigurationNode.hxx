@@ -92,9 +92,11 @@ public:
     bool ReadFillDoc = true; //!< Flag for fill document from shape sequence
     bool ReadFillIncomplete = true; //!< Flag for fill the document with partially retrieved data even if reader has failed with error
     int ReadMemoryLimitMiB = -1; //!< Memory usage limit
+    bool ReadParallel = false; //!< Flag for parsing the file in parallel threads
     // Writing
     TCollection_AsciiString WriteComment; //!< Export special comment
     TCollection_AsciiString WriteAuthor; //!< Author of exported file name
+    bool WriteParallel = false; //!< Flag for formatting the file in parallel threads
   } InternalParameters;
 };
 
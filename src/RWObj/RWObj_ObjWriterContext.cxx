@@ -82,6 +82,22 @@ RWObj_ObjWriterContext::RWObj_ObjWriterContext (const TCollection_AsciiString& t
   }
 }
 
+// ================================================================
+// Function : RWObj_ObjWriterContext
+// Purpose  :
+// ================================================================
+RWObj_ObjWriterContext::RWObj_ObjWriterContext()
+: NbFaces (0),
+  myFile (NULL),
+  myElemPosFirst (1, 1, 1, 1),
+  myElemNormFirst(1, 1, 1, 1),
+  myElemUVFirst  (1, 1, 1, 1),
+  myHasNormals   (false),
+  myHasTexCoords (false)
+{
+  //
+}
+
 // ================================================================
 // Function : ~RWObj_ObjWriterContext
 // Purpose  :
@@ -101,11 +117,55 @@ RWObj_ObjWriterContext::~RWObj_ObjWriterContext()
 // ================================================================
 bool RWObj_ObjWriterContext::Close()
 {
+  if (myFile == NULL)
+  {
+    return true;
+  }
+
   bool isOk = ::fclose (myFile) == 0;
   myFile = NULL;
   return isOk;
 }
 
+// ================================================================
+// Function : write
+// Purpose  :
+// ================================================================
+bool RWObj_ObjWriterContext::write (const char* theData, size_t theSize)
+{
+  if (myFile == NULL)
+  {
+    myBuffer.append (theData, theSize);
+    return true;
+  }
+  return ::fwrite (theData, 1, theSize, myFile) == theSize;
+}
+
+// ================================================================
+// Function : SetState
+// Purpose  :
+// ================================================================
+void RWObj_ObjWriterContext::SetState (const RWObj_ObjWriterContext& theOther)
+{
+  NbFaces          = theOther.NbFaces;
+  myActiveMaterial = theOther.myActiveMaterial;
+  myElemPosFirst   = theOther.myElemPosFirst;
+  myElemNormFirst  = theOther.myElemNormFirst;
+  myElemUVFirst    = theOther.myElemUVFirst;
+  myHasNormals     = theOther.myHasNormals;
+  myHasTexCoords   = theOther.myHasTexCoords;
+}
+
+// ================================================================
+// Function : WriteBuffer
+// Purpose  :
+// ================================================================
+bool RWObj_ObjWriterContext::WriteBuffer (const RWObj_ObjWriterContext& theOther)
+{
+  return theOther.myBuffer.empty()
+      || write (theOther.myBuffer.data(), theOther.myBuffer.size());
+}
+
 // ================================================================
 // Function : WriteHeader
 // Purpose  :
@@ -161,8 +221,8 @@ bool RWObj_ObjWriterContext::WriteActiveMaterial (const TCollection_AsciiString&
 {
   myActiveMaterial = theMaterial;
   return !theMaterial.IsEmpty()
-        ? Fprintf (myFile, "usemtl %s\n", theMaterial.ToCString()) != 0
-        : Fprintf (myFile, "usemtl\n") != 0;
+        ? write ("usemtl ", 7) && write (theMaterial) && write ("\n", 1)
+        : write ("usemtl\n", 7);
 }
 
 // ================================================================
@@ -171,6 +231,7 @@ bool RWObj_ObjWriterContext::WriteActiveMaterial (const TCollection_AsciiString&
 // ================================================================
 bool RWObj_ObjWriterContext::WriteTriangle (const Graphic3d_Vec3i& theTri)
 {
+  char aBuffer[256];
   const Graphic3d_Vec3i aTriPos = theTri + myElemPosFirst.xyz();
   if (myHasNormals)
   {
@@ -178,30 +239,30 @@ bool RWObj_ObjWriterContext::WriteTriangle (const Graphic3d_Vec3i& theTri)
     if (myHasTexCoords)
     {
       const Graphic3d_Vec3i aTriUv = theTri + myElemUVFirst.xyz();
-      return Fprintf (myFile, "f %d/%d/%d %d/%d/%d %d/%d/%d\n",
-                      aTriPos[0], aTriUv[0], aTriNorm[0],
-                      aTriPos[1], aTriUv[1], aTriNorm[1],
-                      aTriPos[2], aTriUv[2], aTriNorm[2]) != 0;
+      return write (aBuffer, Sprintf (aBuffer, "f %d/%d/%d %d/%d/%d %d/%d/%d\n",
+                                      aTriPos[0], aTriUv[0], aTriNorm[0],
+                                      aTriPos[1], aTriUv[1], aTriNorm[1],
+                                      aTriPos[2], aTriUv[2], aTriNorm[2]));
     }
     else
     {
-      return Fprintf (myFile, "f %d//%d %d//%d %d//%d\n",
-                      aTriPos[0], aTriNorm[0],
-                      aTriPos[1], aTriNorm[1],
-                      aTriPos[2], aTriNorm[2]) != 0;
+      return write (aBuffer, Sprintf (aBuffer, "f %d//%d %d//%d %d//%d\n",
+                                      aTriPos[0], aTriNorm[0],
+                                      aTriPos[1], aTriNorm[1],
+                                      aTriPos[2], aTriNorm[2]));
     }
   }
   if (myHasTexCoords)
   {
     const Graphic3d_Vec3i aTriUv = theTri + myElemUVFirst.xyz();
-    return Fprintf (myFile, "f %d/%d %d/%d %d/%d\n",
-                    aTriPos[0], aTriUv[0],
-                    aTriPos[1], aTriUv[1],
-                    aTriPos[2], aTriUv[2]) != 0;
+    return write (aBuffer, Sprintf (aBuffer, "f %d/%d %d/%d %d/%d\n",
+                                    aTriPos[0], aTriUv[0],
+                                    aTriPos[1], aTriUv[1],
+                                    aTriPos[2], aTriUv[2]));
   }
   else
   {
-    return Fprintf (myFile, "f %d %d %d\n", aTriPos[0], aTriPos[1], aTriPos[2]) != 0;
+    return write (aBuffer, Sprintf (aBuffer, "f %d %d %d\n", aTriPos[0], aTriPos[1], aTriPos[2]));
   }
 }
 
@@ -211,6 +272,7 @@ bool RWObj_ObjWriterContext::WriteTriangle (const Graphic3d_Vec3i& theTri)
 // ================================================================
 bool RWObj_ObjWriterContext::WriteQuad (const Graphic3d_Vec4i& theQuad)
 {
+  char aBuffer[256];
   const Graphic3d_Vec4i aQPos = theQuad + myElemPosFirst;
   if (myHasNormals)
   {
@@ -218,33 +280,33 @@ bool RWObj_ObjWriterContext::WriteQuad (const Graphic3d_Vec4i& theQuad)
     if (myHasTexCoords)
     {
       const Graphic3d_Vec4i aQTex = theQuad + myElemUVFirst;
-      return Fprintf (myFile, "f %d/%d/%d %d/%d/%d %d/%d/%d %d/%d/%d\n",
-                      aQPos[0], aQTex[0], aQNorm[0],
-                      aQPos[1], aQTex[1], aQNorm[1],
-                      aQPos[2], aQTex[2], aQNorm[2],
-                      aQPos[3], aQTex[3], aQNorm[3]) != 0;
+      return write (aBuffer, Sprintf (aBuffer, "f %d/%d/%d %d/%d/%d %d/%d/%d %d/%d/%d\n",
+                                      aQPos[0], aQTex[0], aQNorm[0],
+                                      aQPos[1], aQTex[1], aQNorm[1],
+                                      aQPos[2], aQTex[2], aQNorm[2],
+                                      aQPos[3], aQTex[3], aQNorm[3]));
     }
     else
     {
-      return Fprintf (myFile, "f %d//%d %d//%d %d//%d %d//%d\n",
-                      aQPos[0], aQNorm[0],
-                      aQPos[1], aQNorm[1],
-                      aQPos[2], aQNorm[2],
-                      aQPos[3], aQNorm[3]) != 0;
+      return write (aBuffer, Sprintf (aBuffer, "f %d//%d %d//%d %d//%d %d//%d\n",
+                                      aQPos[0], aQNorm[0],
+                                      aQPos[1], aQNorm[1],
+                                      aQPos[2], aQNorm[2],
+                                      aQPos[3], aQNorm[3]));
     }
   }
   if (myHasTexCoords)
   {
     const Graphic3d_Vec4i aQTex = theQuad + myElemUVFirst;
-    return Fprintf (myFile, "f %d/%d %d/%d %d/%d %d/%d\n",
-                    aQPos[0], aQTex[0],
-                    aQPos[1], aQTex[1],
-                    aQPos[2], aQTex[2],
-                    aQPos[3], aQTex[3]) != 0;
+    return write (aBuffer, Sprintf (aBuffer, "f %d/%d %d/%d %d/%d %d/%d\n",
+                                    aQPos[0], aQTex[0],
+                                    aQPos[1], aQTex[1],
+                                    aQPos[2], aQTex[2],
+                                    aQPos[3], aQTex[3]));
   }
   else
   {
-    return Fprintf (myFile, "f %d %d %d %d\n", aQPos[0], aQPos[1], aQPos[2], aQPos[3]) != 0;
+    return write (aBuffer, Sprintf (aBuffer, "f %d %d %d %d\n", aQPos[0], aQPos[1], aQPos[2], aQPos[3]));
   }
 }
 
@@ -254,7 +316,8 @@ bool RWObj_ObjWriterContext::WriteQuad (const Graphic3d_Vec4i& theQuad)
 // ================================================================
 bool RWObj_ObjWriterContext::WriteVertex (const Graphic3d_Vec3& theValue)
 {
-  return Fprintf (myFile, "v %f %f %f\n",  theValue.x(), theValue.y(), theValue.z()) != 0;
+  char aBuffer[256];
+  return write (aBuffer, Sprintf (aBuffer, "v %f %f %f\n",  theValue.x(), theValue.y(), theValue.z()));
 }
 
 // ================================================================
@@ -263,7 +326,8 @@ bool RWObj_ObjWriterContext::WriteVertex (const Graphic3d_Vec3& theValue)
 // ================================================================
 bool RWObj_ObjWriterContext::WriteNormal (const Graphic3d_Vec3& theValue)
 {
-  return Fprintf (myFile, "vn %f %f %f\n", theValue.x(), theValue.y(), theValue.z()) != 0;
+  char aBuffer[256];
+  return write (aBuffer, Sprintf (aBuffer, "vn %f %f %f\n", theValue.x(), theValue.y(), theValue.z()));
 }
 
 // ================================================================
@@ -272,7 +336,8 @@ bool RWObj_ObjWriterContext::WriteNormal (const Graphic3d_Vec3& theValue)
 // ================================================================
 bool RWObj_ObjWriterContext::WriteTexCoord (const Graphic3d_Vec2& theValue)
 {
-  return Fprintf (myFile, "vt %f %f\n", theValue.x(), theValue.y()) != 0;
+  char aBuffer[256];
+  return write (aBuffer, Sprintf (aBuffer, "vt %f %f\n", theValue.x(), theValue.y()));
 }
 
 // ================================================================
@@ -282,8 +347,8 @@ bool RWObj_ObjWriterContext::WriteTexCoord (const Graphic3d_Vec2& theValue)
 bool RWObj_ObjWriterContext::WriteGroup (const TCollection_AsciiString& theValue)
 {
   return !theValue.IsEmpty()
-        ? Fprintf (myFile, "g %s\n", theValue.ToCString()) != 0
-        : Fprintf (myFile, "g\n") != 0;
+        ? write ("g ", 2) && write (theValue) && write ("\n", 1)
+        : write ("g\n", 2);
 }
 
 // ================================================================
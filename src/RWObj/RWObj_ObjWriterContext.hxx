@@ -18,6 +18,8 @@
 #include <TCollection_AsciiString.hxx>
 #include <TColStd_IndexedDataMapOfStringString.hxx>
 
+#include <string>
+
 //! Auxiliary low-level tool writing OBJ file.
 class RWObj_ObjWriterContext
 {
@@ -26,12 +28,30 @@ public:
   //! Main constructor.
   Standard_EXPORT RWObj_ObjWriterContext (const TCollection_AsciiString& theName);
 
+  //! Constructor for writing into memory buffer instead of file.
+  //! Such buffer could be formatted independently (e.g. in another thread)
+  //! and then written into the file context using WriteBuffer().
+  Standard_EXPORT RWObj_ObjWriterContext();
+
   //! Destructor, will emit error message if file was not closed.
   Standard_EXPORT ~RWObj_ObjWriterContext();
 
   //! Return true if file has been opened.
   bool IsOpened() const { return myFile != NULL; }
 
+  //! Return memory buffer (empty for file context).
+  const std::string& Buffer() const { return myBuffer; }
+
+  //! Clear memory buffer.
+  void ClearBuffer() { myBuffer.clear(); }
+
+  //! Copy state (number of faces, active material, indices shift and normals / texture coordinates flags)
+  //! from another context.
+  Standard_EXPORT void SetState (const RWObj_ObjWriterContext& theOther);
+
+  //! Write memory buffer of another context.
+  Standard_EXPORT bool WriteBuffer (const RWObj_ObjWriterContext& theOther);
+
   //! Correctly close the file.
   Standard_EXPORT bool Close();
 
@@ -84,9 +104,18 @@ public:
 
   Standard_Integer NbFaces;
 
+private:
+
+  //! Write data into file or memory buffer.
+  Standard_EXPORT bool write (const char* theData, size_t theSize);
+
+  //! Write string into file or memory buffer.
+  bool write (const TCollection_AsciiString& theString) { return write (theString.ToCString(), (size_t )theString.Length()); }
+
 private:
 
   FILE* myFile;
+  std::string myBuffer;
   TCollection_AsciiString myName;
   TCollection_AsciiString myActiveMaterial;
   Graphic3d_Vec4i myElemPosFirst;
@@ -94,6 +94,7 @@ bool RWObj_Provider::Read(const TCollection_AsciiString& thePath,
   aReader.SetDocument(theDocument);
   aReader.SetRootPrefix(aNode->InternalParameters.ReadRootPrefix);
   aReader.SetMemoryLimitMiB(aNode->InternalParameters.ReadMemoryLimitMiB);
+  aReader.SetParallel(aNode->InternalParameters.ReadParallel);
   if (!aReader.Perform(thePath, theProgress))
   {
     Message::SendFail() << "Error in the RWObj_ConfigurationNode during reading the file " << thePath;
@@ -147,6 +148,7 @@ bool RWObj_Provider::Write(const TCollection_AsciiString& thePath,
 
   RWObj_CafWriter aWriter(thePath);
   aWriter.SetCoordinateSystemConverter(aConverter);
+  aWriter.SetParallel(aNode->InternalParameters.WriteParallel);
   if (!aWriter.Perform(theDocument, aFileInfo, theProgress))
   {
     Message::SendFail() << "Error in the RWObj_ConfigurationNode during writing the file " << thePath;
@@ -208,6 +210,7 @@ bool RWObj_Provider::Read(const TCollection_AsciiString& thePath,
   aSimpleReader.SetCreateShapes(aNode->InternalParameters.ReadCreateShapes);
   aSimpleReader.SetSinglePrecision(aNode->InternalParameters.ReadSinglePrecision);
   aSimpleReader.SetMemoryLimit(aNode->InternalParameters.ReadMemoryLimitMiB);
+  aSimpleReader.SetParallel(aNode->InternalParameters.ReadParallel);
   if (!aSimpleReader.Read(thePath, theProgress))
   {
     Message::SendFail() << "Error in the RWObj_ConfigurationNode during reading the file " << thePath;
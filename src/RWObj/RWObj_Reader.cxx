@@ -25,6 +25,7 @@
 #include <NCollection_IncAllocator.hxx>
 #include <OSD_OpenFile.hxx>
 #include <OSD_Path.hxx>
+#include <OSD_ThreadPool.hxx>
 #include <OSD_Timer.hxx>
 #include <Standard_CLocaleSentry.hxx>
 #include <Standard_ReadLineBuffer.hxx>
@@ -47,6 +48,54 @@ namespace
   // The length of buffer to read (in bytes)
   static const size_t THE_BUFFER_SIZE = 4 * 1024;
 
+  // The length of block to read per thread in parallel mode (in bytes)
+  static const size_t THE_PARALLEL_BLOCK_SIZE = 4 * 1024 * 1024;
+
+  //! Return TRUE if the line ended by given new line symbol is continued
+  //! by the next one (multi-line syntax with '\\' at the end of line).
+  static bool isContinuedLine (const char* theBegin,
+                               const char* theNewLine)
+  {
+    if (theNewLine > theBegin && theNewLine[-1] == '\r')
+    {
+      --theNewLine;
+    }
+    return theNewLine > theBegin && theNewLine[-1] == '\\';
+  }
+
+  //! Return the position after the first line end found from thePos, or theEnd.
+  static char* nextLineEnd (char* theBegin, char* thePos, char* theEnd)
+  {
+    while (thePos < theEnd)
+    {
+      char* aNewLine = (char* )::memchr (thePos, '\n', theEnd - thePos);
+      if (aNewLine == NULL)
+      {
+        break;
+      }
+      if (!isContinuedLine (theBegin, aNewLine))
+      {
+        return aNewLine + 1;
+      }
+      thePos = aNewLine + 1;
+    }
+    return theEnd;
+  }
+
+  //! Return the position after the last line end found before theEnd, or theBegin.
+  static char* lastLineEnd (char* theBegin, char* theEnd)
+  {
+    for (char* aPos = theEnd - 1; aPos >= theBegin; --aPos)
+    {
+      if (*aPos == '\n'
+      && !isContinuedLine (theBegin, aPos))
+      {
+        return aPos + 1;
+      }
+    }
+    return theBegin;
+  }
+
 
   //! Return TRUE if given polygon has clockwise node order.
   static bool isClockwisePolygon (const Handle(BRepMesh_DataStructureOfDelaun)& theMesh,
@@ -66,6 +115,190 @@ namespace
   }
 }
 
+//! Range of lines of the file parsed in parallel thread.
+//! Values and indices are parsed into arrays, and each meaningful line is recorded
+//! so that the lines can be passed to the reader in the order of the file.
+class RWObj_Reader::ParsedChunk
+{
+public:
+
+  //! Type of the parsed line.
+  enum RecordType
+  {
+    RecordType_Comment, //!< comment at the beginning of range, Value is index in Texts
+    RecordType_Other,   //!< unknown line at the beginning of range
+    RecordType_Vertex,  //!< "v", next in Nodes
+    RecordType_Normal,  //!< "vn", next in Normals
+    RecordType_Texel,   //!< "vt", next in Texels
+    RecordType_Element, //!< "f", Value is the number of next triplets in Indices
+    RecordType_Command  //!< other line handled by the reader, Value is index in Texts
+  };
+
+  //! Parsed line.
+  struct Record
+  {
+    RecordType       Type;
+    Standard_Integer Value;
+    Standard_Integer NbLines; //!< number of lines since the previous record (including this one)
+  };
+
+public:
+
+  char*                                Begin;       //!< start of the range
+  char*                                End;         //!< end of the range (after the last line end)
+  std::vector<Record>                  Records;     //!< parsed lines
+  std::vector<gp_Pnt>                  Nodes;       //!< parsed vertices
+  std::vector<Graphic3d_Vec3>          Normals;     //!< parsed normals
+  std::vector<Graphic3d_Vec2>          Texels;      //!< parsed texels
+  std::vector<Graphic3d_Vec3i>         Indices;     //!< parsed indices of elements
+  std::vector<TCollection_AsciiString> Texts;       //!< comments and commands
+  Standard_Integer                     NbTailLines; //!< number of lines after the last record
+
+  //! Empty constructor.
+  ParsedChunk() : Begin (NULL), End (NULL), NbTailLines (0) {}
+
+  //! Reset the range, keeping allocated memory.
+  void Clear()
+  {
+    Begin = End = NULL;
+    Records.clear();
+    Nodes.clear();
+    Normals.clear();
+    Texels.clear();
+    Indices.clear();
+    Texts.clear();
+    NbTailLines = 0;
+  }
+
+  //! Parse the lines of the range.
+  //! Lines are null-terminated in place (multi-line syntax being joined as by Standard_ReadLineBuffer).
+  void Parse (const RWObj_Reader& theReader)
+  {
+    Standard_Integer aNbLines = 0;
+    bool isStart = true;
+    for (char* aPos = Begin; aPos < End;)
+    {
+      char* aLine = aPos;
+      char* aLineEnd = aPos;
+      for (;;)
+      {
+        char* aNewLine = (char* )::memchr (aPos, '\n', End - aPos);
+        char* aPartEnd = aNewLine != NULL ? aNewLine : End;
+        if (aNewLine != NULL && aPartEnd > aPos && aPartEnd[-1] == '\r')
+        {
+          --aPartEnd;
+        }
+        const bool isContinued = aNewLine != NULL && aPartEnd > aPos && aPartEnd[-1] == '\\';
+        if (isContinued)
+        {
+          aPartEnd[-1] = ' ';
+        }
+        if (aLineEnd != aPos)
+        {
+          ::memmove (aLineEnd, aPos, aPartEnd - aPos);
+        }
+        aLineEnd += aPartEnd - aPos;
+        aPos = aNewLine != NULL ? aNewLine + 1 : End;
+        if (!isContinued || aPos >= End)
+        {
+          break;
+        }
+      }
+      *aLineEnd = '\0';
+      ++aNbLines;
+
+      Record aRecord = { RecordType_Other, 0, 0 };
+      if (*aLine == '#')
+      {
+        if (!isStart)
+        {
+          continue;
+        }
+        aRecord.Type  = RecordType_Comment;
+        aRecord.Value = (Standard_Integer )Texts.size();
+        Texts.push_back (TCollection_AsciiString (aLine + 1));
+      }
+      else if (*aLine == '\0')
+      {
+        continue;
+      }
+      else if (aLine[0] == 'v' && RWObj_Tools::isSpaceChar (aLine[1]))
+      {
+        aRecord.Type = RecordType_Vertex;
+        Nodes.push_back (theReader.readVertex (aLine + 2));
+      }
+      else if (aLine[0] == 'v'
+            && aLine[1] == 'n'
+            && RWObj_Tools::isSpaceChar (aLine[2]))
+      {
+        aRecord.Type = RecordType_Normal;
+        Normals.push_back (theReader.readNormal (aLine + 3));
+      }
+      else if (aLine[0] == 'v'
+            && aLine[1] == 't'
+            && RWObj_Tools::isSpaceChar (aLine[2]))
+      {
+        aRecord.Type = RecordType_Texel;
+        Texels.push_back (RWObj_Reader::readTexel (aLine + 3));
+      }
+      else if (aLine[0] == 'f' && RWObj_Tools::isSpaceChar (aLine[1]))
+      {
+        aRecord.Type  = RecordType_Element;
+        aRecord.Value = RWObj_Reader::readIndices (aLine + 2, Indices);
+      }
+      else if ((aLine[0] == 'g' && IsSpace (aLine[1]))
+            || (aLine[0] == 's' && IsSpace (aLine[1]))
+            || (aLine[0] == 'o' && IsSpace (aLine[1]))
+            || ::strncmp (aLine, "mtllib", 6) == 0
+            || ::strncmp (aLine, "usemtl", 6) == 0)
+      {
+        aRecord.Type  = RecordType_Command;
+        aRecord.Value = (Standard_Integer )Texts.size();
+        Texts.push_back (TCollection_AsciiString (aLine));
+      }
+      else if (!isStart)
+      {
+        continue;
+      }
+
+      if (aRecord.Type != RecordType_Comment)
+      {
+        isStart = false;
+      }
+      aRecord.NbLines = aNbLines;
+      aNbLines = 0;
+      Records.push_back (aRecord);
+    }
+    NbTailLines = aNbLines;
+  }
+};
+
+//! Functor parsing the ranges of lines in parallel threads.
+class RWObj_Reader::ParallelChunkParser
+{
+public:
+
+  //! Main constructor.
+  ParallelChunkParser (const RWObj_Reader& theReader,
+                       std::vector<ParsedChunk>& theChunks)
+  : myReader (theReader),
+    myChunks (theChunks) {}
+
+  //! Parse the range with specified index.
+  void operator() (int theThreadIndex,
+                   int theChunkIndex) const
+  {
+    (void )theThreadIndex;
+    myChunks[theChunkIndex].Parse (myReader);
+  }
+
+private:
+  ParallelChunkParser& operator= (const ParallelChunkParser& );
+private:
+  const RWObj_Reader&       myReader;
+  std::vector<ParsedChunk>& myChunks;
+};
+
 // ================================================================
 // Function : Read
 // Purpose  :
@@ -77,7 +310,8 @@ RWObj_Reader::RWObj_Reader()
   myNbProbeNodes (0),
   myNbProbeElems (0),
   myNbElemsBig (0),
-  myToAbort (false)
+  myToAbort (false),
+  myToParallel (false)
 {
   //
 }
@@ -134,126 +368,87 @@ Standard_Boolean RWObj_Reader::read (std::istream& theStream,
   const Standard_Integer aNbMiBTotal = Standard_Integer(aFileLen / (1024 * 1024));
   Standard_Integer       aNbMiBPassed = 0;
   Message_ProgressScope aPS (theProgress, "Reading text OBJ file", aNbMiBTotal);
-  OSD_Timer aTimer;
-  aTimer.Start();
-  bool isStart = true;
-  int64_t aPosition = 0;
-  size_t aLineLen = 0;
-  int64_t aReadBytes = 0;
-  const char* aLine = NULL;
-  for (;;)
+  const Standard_Integer aNbThreads = myToParallel && !theToProbe
+                                    ? OSD_ThreadPool::DefaultPool()->NbDefaultThreadsToLaunch()
+                                    : 1;
+  if (aNbThreads > 1)
   {
-    aLine = aBuffer.ReadLine (theStream, aLineLen, aReadBytes);
-    if (aLine == NULL)
+    if (!readParallel (theStream, aNbThreads, aPS))
     {
-      break;
+      return false;
     }
-    ++myNbLines;
-    aPosition += aReadBytes;
-    if (aTimer.ElapsedTime() > 1.0)
+  }
+  else
+  {
+    OSD_Timer aTimer;
+    aTimer.Start();
+    bool isStart = true;
+    int64_t aPosition = 0;
+    size_t aLineLen = 0;
+    int64_t aReadBytes = 0;
+    const char* aLine = NULL;
+    for (;;)
     {
-      if (!aPS.More())
+      aLine = aBuffer.ReadLine (theStream, aLineLen, aReadBytes);
+      if (aLine == NULL)
       {
-        return false;
+        break;
       }
-
-      const Standard_Integer aNbMiBRead = Standard_Integer(aPosition / (1024 * 1024));
-      aPS.Next (aNbMiBRead - aNbMiBPassed);
-      aNbMiBPassed = aNbMiBRead;
-      aTimer.Reset();
-      aTimer.Start();
-    }
-
-    if (*aLine == '#')
-    {
-      if (isStart)
+      ++myNbLines;
+      aPosition += aReadBytes;
+      if (aTimer.ElapsedTime() > 1.0)
       {
-        TCollection_AsciiString aComment (aLine + 1);
-        aComment.LeftAdjust();
-        aComment.RightAdjust();
-        if (!aComment.IsEmpty())
+        if (!aPS.More())
         {
-          if (!myFileComments.IsEmpty())
-          {
-            myFileComments += "\n";
-          }
-          myFileComments += aComment;
+          return false;
         }
-      }
-      continue;
-    }
-    else if (*aLine == '\n'
-          || *aLine == '\0')
-    {
 
-      continue;
-    }
-    isStart = false;
+        const Standard_Integer aNbMiBRead = Standard_Integer(aPosition / (1024 * 1024));
+        aPS.Next (aNbMiBRead - aNbMiBPassed);
+        aNbMiBPassed = aNbMiBRead;
+        aTimer.Reset();
+        aTimer.Start();
+      }
 
-    if (theToProbe)
-    {
-      if (::strncmp (aLine, "mtllib", 6) == 0)
+      if (*aLine == '#')
       {
-        readMaterialLib (IsSpace (aLine[6]) ? aLine + 7 : "");
+        if (isStart)
+        {
+          pushComment (aLine + 1);
+        }
+        continue;
       }
-      else if (aLine[0] == 'v' && RWObj_Tools::isSpaceChar (aLine[1]))
+      else if (*aLine == '\n'
+            || *aLine == '\0')
       {
-        ++myNbProbeNodes;
+
+        continue;
       }
-      else if (aLine[0] == 'f' && RWObj_Tools::isSpaceChar (aLine[1]))
+      isStart = false;
+
+      if (theToProbe)
       {
-        ++myNbProbeElems;
+        if (::strncmp (aLine, "mtllib", 6) == 0)
+        {
+          readMaterialLib (IsSpace (aLine[6]) ? aLine + 7 : "");
+        }
+        else if (aLine[0] == 'v' && RWObj_Tools::isSpaceChar (aLine[1]))
+        {
+          ++myNbProbeNodes;
+        }
+        else if (aLine[0] == 'f' && RWObj_Tools::isSpaceChar (aLine[1]))
+        {
+          ++myNbProbeElems;
+        }
+        continue;
       }
-      continue;
-    }
 
-    if (aLine[0] == 'v' && RWObj_Tools::isSpaceChar (aLine[1]))
-    {
-      ++myNbProbeNodes;
-      pushVertex (aLine + 2);
-    }
-    else if (aLine[0] == 'v'
-          && aLine[1] == 'n'
-          && RWObj_Tools::isSpaceChar (aLine[2]))
-    {
-      pushNormal (aLine + 3);
-    }
-    else if (aLine[0] == 'v'
-          && aLine[1] == 't'
-          && RWObj_Tools::isSpaceChar (aLine[2]))
-    {
-      pushTexel (aLine + 3);
-    }
-    else if (aLine[0] == 'f' && RWObj_Tools::isSpaceChar (aLine[1]))
-    {
-      ++myNbProbeElems;
-      pushIndices (aLine + 2);
-    }
-    else if (aLine[0] == 'g' && IsSpace (aLine[1]))
-    {
-      pushGroup (aLine + 2);
-    }
-    else if (aLine[0] == 's' && IsSpace (aLine[1]))
-    {
-      pushSmoothGroup (aLine + 2);
-    }
-    else if (aLine[0] == 'o' && IsSpace (aLine[1]))
-    {
-      pushObject (aLine + 2);
-    }
-    else if (::strncmp (aLine, "mtllib", 6) == 0)
-    {
-      readMaterialLib (IsSpace (aLine[6]) ? aLine + 7 : "");
-    }
-    else if (::strncmp (aLine, "usemtl", 6) == 0)
-    {
-      pushMaterial (IsSpace (aLine[6]) ? aLine + 7 : "");
-    }
-
-    if (!checkMemory())
-    {
-      addMesh (myActiveSubMesh, RWObj_SubMeshReason_NewObject);
-      return false;
+      pushLine (aLine);
+      if (!checkMemory())
+      {
+        addMesh (myActiveSubMesh, RWObj_SubMeshReason_NewObject);
+        return false;
+      }
     }
   }
 
@@ -289,15 +484,236 @@ Standard_Boolean RWObj_Reader::read (std::istream& theStream,
 }
 
 // =======================================================================
-// function : pushIndices
+// function : pushComment
+// purpose  :
+// =======================================================================
+void RWObj_Reader::pushComment (const char* theComment)
+{
+  TCollection_AsciiString aComment (theComment);
+  aComment.LeftAdjust();
+  aComment.RightAdjust();
+  if (!aComment.IsEmpty())
+  {
+    if (!myFileComments.IsEmpty())
+    {
+      myFileComments += "\n";
+    }
+    myFileComments += aComment;
+  }
+}
+
+// =======================================================================
+// function : pushLine
+// purpose  :
+// =======================================================================
+void RWObj_Reader::pushLine (const char* theLine)
+{
+  if (theLine[0] == 'v' && RWObj_Tools::isSpaceChar (theLine[1]))
+  {
+    ++myNbProbeNodes;
+    pushVertex (readVertex (theLine + 2));
+  }
+  else if (theLine[0] == 'v'
+        && theLine[1] == 'n'
+        && RWObj_Tools::isSpaceChar (theLine[2]))
+  {
+    pushNormal (readNormal (theLine + 3));
+  }
+  else if (theLine[0] == 'v'
+        && theLine[1] == 't'
+        && RWObj_Tools::isSpaceChar (theLine[2]))
+  {
+    pushTexel (readTexel (theLine + 3));
+  }
+  else if (theLine[0] == 'f' && RWObj_Tools::isSpaceChar (theLine[1]))
+  {
+    ++myNbProbeElems;
+    pushIndices (theLine + 2);
+  }
+  else if (theLine[0] == 'g' && IsSpace (theLine[1]))
+  {
+    pushGroup (theLine + 2);
+  }
+  else if (theLine[0] == 's' && IsSpace (theLine[1]))
+  {
+    pushSmoothGroup (theLine + 2);
+  }
+  else if (theLine[0] == 'o' && IsSpace (theLine[1]))
+  {
+    pushObject (theLine + 2);
+  }
+  else if (::strncmp (theLine, "mtllib", 6) == 0)
+  {
+    readMaterialLib (IsSpace (theLine[6]) ? theLine + 7 : "");
+  }
+  else if (::strncmp (theLine, "usemtl", 6) == 0)
+  {
+    pushMaterial (IsSpace (theLine[6]) ? theLine + 7 : "");
+  }
+}
+
+// =======================================================================
+// function : readParallel
+// purpose  :
+// =======================================================================
+bool RWObj_Reader::readParallel (std::istream& theStream,
+                                 const Standard_Integer theNbThreads,
+                                 Message_ProgressScope& thePS)
+{
+  const Handle(OSD_ThreadPool)& aPool = OSD_ThreadPool::DefaultPool();
+  const size_t aBlockSize = THE_PARALLEL_BLOCK_SIZE * size_t(theNbThreads);
+
+  // split each block into more ranges than threads for better balance
+  std::vector<ParsedChunk> aChunks (size_t(theNbThreads) * 4);
+  std::vector<char> aBlock;
+  size_t  aNbKept = 0; // bytes of incomplete line kept from the previous block
+  int64_t aPosition = 0;
+  Standard_Integer aNbMiBPassed = 0;
+  bool isStart = true;
+  for (bool isLastBlock = false; !isLastBlock;)
+  {
+    if (!thePS.More())
+    {
+      return false;
+    }
+
+    aBlock.resize (aNbKept + aBlockSize + 1);
+    theStream.read (aBlock.data() + aNbKept, std::streamsize(aBlockSize));
+    const size_t aNbRead = size_t(theStream.gcount());
+    const size_t aBlockLen = aNbKept + aNbRead;
+    isLastBlock = aNbRead < aBlockSize;
+    aPosition += aNbRead;
+
+    // the block is parsed up to its last line end, the rest being kept for the next block
+    char* aBegin = aBlock.data();
+    char* anEnd  = aBegin + aBlockLen;
+    if (!isLastBlock)
+    {
+      anEnd = lastLineEnd (aBegin, anEnd);
+      if (anEnd == aBegin)
+      {
+        aNbKept = aBlockLen;
+        continue;
+      }
+    }
+
+    Standard_Integer aNbChunks = 0;
+    for (char* aRangeBegin = aBegin; aRangeBegin < anEnd; ++aNbChunks)
+    {
+      ParsedChunk& aChunk = aChunks[aNbChunks];
+      aChunk.Clear();
+      aChunk.Begin = aRangeBegin;
+      aChunk.End   = anEnd;
+      if (size_t(aNbChunks + 1) < aChunks.size())
+      {
+        const size_t aStep = size_t(anEnd - aRangeBegin) / (aChunks.size() - size_t(aNbChunks));
+        aChunk.End = nextLineEnd (aBegin, aRangeBegin + aStep, anEnd);
+      }
+      aRangeBegin = aChunk.End;
+    }
+
+    OSD_ThreadPool::Launcher aLauncher (*aPool, Min (theNbThreads, aNbChunks));
+    aLauncher.Perform (0, aNbChunks, ParallelChunkParser (*this, aChunks));
+    for (Standard_Integer aChunkIter = 0; aChunkIter < aNbChunks; ++aChunkIter)
+    {
+      if (!pushChunk (aChunks[aChunkIter], isStart))
+      {
+        addMesh (myActiveSubMesh, RWObj_SubMeshReason_NewObject);
+        return false;
+      }
+    }
+
+    aNbKept = size_t(aBegin + aBlockLen - anEnd);
+    if (aNbKept != 0)
+    {
+      ::memmove (aBegin, anEnd, aNbKept);
+    }
+
+    const Standard_Integer aNbMiBRead = Standard_Integer(aPosition / (1024 * 1024));
+    thePS.Next (aNbMiBRead - aNbMiBPassed);
+    aNbMiBPassed = aNbMiBRead;
+  }
+  return true;
+}
+
+// =======================================================================
+// function : pushChunk
 // purpose  :
 // =======================================================================
-void RWObj_Reader::pushIndices (const char* thePos)
+bool RWObj_Reader::pushChunk (const ParsedChunk& theChunk,
+                              bool& theIsStart)
+{
+  size_t aNodeIter = 0, aNormIter = 0, aTexelIter = 0, anIndexIter = 0;
+  for (std::vector<ParsedChunk::Record>::const_iterator aRecIter = theChunk.Records.begin();
+       aRecIter != theChunk.Records.end(); ++aRecIter)
+  {
+    const ParsedChunk::Record& aRecord = *aRecIter;
+    myNbLines += aRecord.NbLines;
+    switch (aRecord.Type)
+    {
+      case ParsedChunk::RecordType_Comment:
+      {
+        if (theIsStart)
+        {
+          pushComment (theChunk.Texts[aRecord.Value].ToCString());
+        }
+        continue;
+      }
+      case ParsedChunk::RecordType_Other:
+      {
+        break;
+      }
+      case ParsedChunk::RecordType_Vertex:
+      {
+        ++myNbProbeNodes;
+        pushVertex (theChunk.Nodes[aNodeIter++]);
+        break;
+      }
+      case ParsedChunk::RecordType_Normal:
+      {
+        pushNormal (theChunk.Normals[aNormIter++]);
+        break;
+      }
+      case ParsedChunk::RecordType_Texel:
+      {
+        pushTexel (theChunk.Texels[aTexelIter++]);
+        break;
+      }
+      case ParsedChunk::RecordType_Element:
+      {
+        ++myNbProbeElems;
+        pushIndices (theChunk.Indices.data() + anIndexIter, aRecord.Value);
+        anIndexIter += aRecord.Value;
+        break;
+      }
+      case ParsedChunk::RecordType_Command:
+      {
+        pushLine (theChunk.Texts[aRecord.Value].ToCString());
+        break;
+      }
+    }
+
+    theIsStart = false;
+    if (!checkMemory())
+    {
+      return false;
+    }
+  }
+  myNbLines += theChunk.NbTailLines;
+  return true;
+}
+
+// =======================================================================
+// function : readIndices
+// purpose  :
+// =======================================================================
+Standard_Integer RWObj_Reader::readIndices (const char* thePos,
+                                            std::vector<Graphic3d_Vec3i>& theIndices)
 {
   char* aNext = NULL;
 
   Standard_Integer aNbElemNodes = 0;
-  for (Standard_Integer aNode = 0;; ++aNode)
+  for (;;)
   {
     Graphic3d_Vec3i a3Indices (-1, -1, -1);
     a3Indices[0] = int(strtol (thePos, &aNext, 10) - 1);
@@ -323,6 +739,35 @@ void RWObj_Reader::pushIndices (const char* thePos)
       }
     }
 
+    theIndices.push_back (a3Indices);
+    ++aNbElemNodes;
+
+    if (*thePos == '\n'
+     || *thePos == '\0')
+    {
+      break;
+    }
+
+    if (*thePos != ' ')
+    {
+      ++thePos;
+    }
+  }
+  return aNbElemNodes;
+}
+
+// =======================================================================
+// function : pushIndices
+// purpose  :
+// =======================================================================
+void RWObj_Reader::pushIndices (const Graphic3d_Vec3i* theIndices,
+                                const Standard_Integer theNbNodes)
+{
+  Standard_Integer aNbElemNodes = 0;
+  for (Standard_Integer aNode = 0; aNode < theNbNodes; ++aNode)
+  {
+    Graphic3d_Vec3i a3Indices = theIndices[aNode];
+
     // handle negative indices
     if (a3Indices[0] < -1)
     {
@@ -406,17 +851,6 @@ void RWObj_Reader::pushIndices (const char* thePos)
     }
     myCurrElem[aNode] = anIndex;
     aNbElemNodes = aNode + 1;
-
-    if (*thePos == '\n'
-     || *thePos == '\0')
-    {
-      break;
-    }
-
-    if (*thePos != ' ')
-    {
-      ++thePos;
-    }
   }
 
   if (myCurrElem[0] < 0
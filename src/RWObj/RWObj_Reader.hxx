@@ -33,6 +33,8 @@
 
 #include <vector>
 
+class Message_ProgressScope;
+
 //! An abstract class implementing procedure to read OBJ file.
 //!
 //! This class is not bound to particular data structure
@@ -128,6 +130,16 @@ public:
   //! Setup single/double precision flag for reading vertex data (coordinates).
   void SetSinglePrecision (Standard_Boolean theIsSinglePrecision) { myObjVerts.SetSinglePrecision (theIsSinglePrecision); }
 
+  //! Return flag to parse the file in parallel threads; FALSE by default.
+  Standard_Boolean ToParallel() const { return myToParallel; }
+
+  //! Setup flag to parse the file in parallel threads.
+  //! The file is then read by blocks, the lines of each block being split into ranges
+  //! parsed in parallel (values and indices), and then passed to the sub-class
+  //! in the order of the file, so that sub-meshes, memory limit and messages
+  //! remain the same as for sequential reading.
+  void SetParallel (Standard_Boolean theToParallel) { myToParallel = theToParallel; }
+
 protected:
 
   //! Reads data from OBJ file.
@@ -184,45 +196,97 @@ protected:
 //! @name implementation details
 private:
 
-  //! Handle "v X Y Z".
-  void pushVertex (const char* theXYZ)
+  class ParsedChunk;        //!< Range of lines parsed in parallel threads
+  class ParallelChunkParser; //!< Functor parsing the ranges of lines
+
+  //! Read "X Y Z" of vertex.
+  gp_Pnt readVertex (const char* theXYZ) const
   {
     char* aNext = NULL;
     gp_Pnt anXYZ;
     RWObj_Tools::ReadVec3 (theXYZ, aNext, anXYZ.ChangeCoord());
     myCSTrsf.TransformPosition (anXYZ.ChangeCoord());
-
-    myMemEstim += myObjVerts.IsSinglePrecision() ? sizeof(Graphic3d_Vec3) : sizeof(gp_Pnt);
-    myObjVerts.Append (anXYZ);
+    return anXYZ;
   }
 
-  //! Handle "vn NX NY NZ".
-  void pushNormal (const char* theXYZ)
+  //! Read "NX NY NZ" of normal.
+  Graphic3d_Vec3 readNormal (const char* theXYZ) const
   {
     char* aNext = NULL;
     Graphic3d_Vec3 aNorm;
     RWObj_Tools::ReadVec3 (theXYZ, aNext, aNorm);
     myCSTrsf.TransformNormal (aNorm);
-
-    myMemEstim += sizeof(Graphic3d_Vec3);
-    myObjNorms.Append (aNorm);
+    return aNorm;
   }
 
-  //! Handle "vt U V".
-  void pushTexel (const char* theUV)
+  //! Read "U V" of texel.
+  static Graphic3d_Vec2 readTexel (const char* theUV)
   {
     char* aNext = NULL;
     Graphic3d_Vec2 anUV;
     anUV.x() = (float )Strtod (theUV, &aNext);
     theUV = aNext;
     anUV.y() = (float )Strtod (theUV, &aNext);
+    return anUV;
+  }
+
+  //! Read the "v/vt/vn" triplets of element, as written in the file
+  //! (with 0-based and not yet resolved negative indices), and append them to theIndices.
+  //! @return number of element nodes
+  static Standard_Integer readIndices (const char* thePos,
+                                       std::vector<Graphic3d_Vec3i>& theIndices);
 
+  //! Handle "v X Y Z".
+  void pushVertex (const gp_Pnt& theXYZ)
+  {
+    myMemEstim += myObjVerts.IsSinglePrecision() ? sizeof(Graphic3d_Vec3) : sizeof(gp_Pnt);
+    myObjVerts.Append (theXYZ);
+  }
+
+  //! Handle "vn NX NY NZ".
+  void pushNormal (const Graphic3d_Vec3& theNorm)
+  {
+    myMemEstim += sizeof(Graphic3d_Vec3);
+    myObjNorms.Append (theNorm);
+  }
+
+  //! Handle "vt U V".
+  void pushTexel (const Graphic3d_Vec2& theUV)
+  {
     myMemEstim += sizeof(Graphic3d_Vec2);
-    myObjVertsUV.Append (anUV);
+    myObjVertsUV.Append (theUV);
   }
 
   //! Handle "f indices".
-  void pushIndices (const char* thePos);
+  void pushIndices (const char* thePos)
+  {
+    myElemIndices.clear();
+    const Standard_Integer aNbNodes = readIndices (thePos, myElemIndices);
+    pushIndices (myElemIndices.data(), aNbNodes);
+  }
+
+  //! Handle element defined by the "v/vt/vn" triplets returned by readIndices().
+  void pushIndices (const Graphic3d_Vec3i* theIndices,
+                    const Standard_Integer theNbNodes);
+
+  //! Handle a line which is neither empty nor comment.
+  void pushLine (const char* theLine);
+
+  //! Reads the data by blocks parsed in parallel threads.
+  //! @return FALSE on out of memory or user break
+  bool readParallel (std::istream& theStream,
+                     const Standard_Integer theNbThreads,
+                     Message_ProgressScope& thePS);
+
+  //! Pass the lines parsed in parallel thread to the sub-class.
+  //! @param theChunk  parsed lines
+  //! @param theIsStart flag indicating that only comments have been met so far
+  //! @return FALSE on out of memory
+  bool pushChunk (const ParsedChunk& theChunk,
+                  bool& theIsStart);
+
+  //! Append file comment (line starting with #).
+  void pushComment (const char* theComment);
 
   //! Compute the center of planar polygon.
   //! @param theIndices polygon indices
@@ -366,6 +430,7 @@ protected:
   Standard_Integer                   myNbProbeElems;  //!< number of probed elements
   Standard_Integer                   myNbElemsBig;    //!< number of big elements (polygons with 5+ nodes)
   Standard_Boolean                   myToAbort;       //!< flag indicating abort state (e.g. syntax error)
+  Standard_Boolean                   myToParallel;    //!< flag to parse the file in parallel threads
 
   // Each node in the Element specifies independent indices of Vertex position, Texture coordinates and Normal.
   // This scheme does not match natural definition of Primitive Array
@@ -382,6 +447,7 @@ protected:
 
   RWObj_SubMesh                      myActiveSubMesh; //!< active sub-mesh definition
   std::vector<Standard_Integer>      myCurrElem;      //!< indices for the current element
+  std::vector<Graphic3d_Vec3i>       myElemIndices;   //!< triplets of indices for the current element
 };
 
 #endif // _RWObj_Reader_HeaderFile
@@ -59,19 +59,48 @@ public:
   //! @param[in] theMergeAngle maximum angle in radians between triangles to merge equal nodes; M_PI/2 means ignore angle
   //! @param[in] theProgress progress indicator
   //! @return result triangulation or NULL in case of error
+  static Handle(Poly_Triangulation) ReadFile (const Standard_CString theFile,
+                                              const Standard_Real theMergeAngle,
+                                              const Message_ProgressRange& theProgress = Message_ProgressRange())
+  {
+    return ReadFile (theFile, theMergeAngle, Standard_False, theProgress);
+  }
+
+  //! Read specified STL file and returns its content as triangulation.
+  //! @param[in] theFile file path to read
+  //! @param[in] theMergeAngle maximum angle in radians between triangles to merge equal nodes; M_PI/2 means ignore angle
+  //! @param[in] theToParallel use multithreaded reading (see RWStl_Reader::SetParallel())
+  //! @param[in] theProgress progress indicator
+  //! @return result triangulation or NULL in case of error
   Standard_EXPORT static Handle(Poly_Triangulation) ReadFile (const Standard_CString theFile,
                                                               const Standard_Real theMergeAngle,
+                                                              const Standard_Boolean theToParallel,
                                                               const Message_ProgressRange& theProgress = Message_ProgressRange());
-  
+
+  //! Read specified STL file and fills triangulation list for multi-domain case.
+  //! @param[in] theFile file path to read
+  //! @param[in] theMergeAngle maximum angle in radians between triangles to merge equal nodes; M_PI/2 means ignore angle
+  //! @param[out] theTriangList triangulation list for multi-domain case
+  //! @param[in] theProgress progress indicator
+  static void ReadFile (const Standard_CString theFile,
+                        const Standard_Real theMergeAngle,
+                        NCollection_Sequence<Handle(Poly_Triangulation)>& theTriangList,
+                        const Message_ProgressRange& theProgress = Message_ProgressRange())
+  {
+    ReadFile (theFile, theMergeAngle, Standard_False, theTriangList, theProgress);
+  }
+
   //! Read specified STL file and fills triangulation list for multi-domain case.
   //! @param[in] theFile file path to read
   //! @param[in] theMergeAngle maximum angle in radians between triangles to merge equal nodes; M_PI/2 means ignore angle
+  //! @param[in] theToParallel use multithreaded reading (see RWStl_Reader::SetParallel())
   //! @param[out] theTriangList triangulation list for multi-domain case
   //! @param[in] theProgress progress indicator
-  Standard_EXPORT static void ReadFile(const Standard_CString theFile,
-                                       const Standard_Real theMergeAngle,
-                                       NCollection_Sequence<Handle(Poly_Triangulation)>& theTriangList,
-                                       const Message_ProgressRange& theProgress = Message_ProgressRange());
+  Standard_EXPORT static void ReadFile (const Standard_CString theFile,
+                                        const Standard_Real theMergeAngle,
+                                        const Standard_Boolean theToParallel,
+                                        NCollection_Sequence<Handle(Poly_Triangulation)>& theTriangList,
+                                        const Message_ProgressRange& theProgress = Message_ProgressRange());
   
   //! Read triangulation from a binary STL file
   //! In case of error, returns Null handle.
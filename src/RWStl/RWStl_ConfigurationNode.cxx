@@ -62,6 +62,8 @@ bool RWStl_ConfigurationNode::Load(const Handle(DE_ConfigurationContext)& theRes
     theResource->RealVal("read.merge.angle", InternalParameters.ReadMergeAngle, aScope);
   InternalParameters.ReadBRep = 
     theResource->BooleanVal("read.brep", InternalParameters.ReadBRep, aScope);
+  InternalParameters.ReadParallel = 
+    theResource->BooleanVal("read.parallel", InternalParameters.ReadParallel, aScope);
   InternalParameters.WriteAscii = 
     theResource->BooleanVal("write.ascii", InternalParameters.WriteAscii, aScope);
   return true;
@@ -94,6 +96,12 @@ TCollection_AsciiString RWStl_ConfigurationNode::Save() const
   aResult += aScope + "read.brep :\t " + InternalParameters.ReadBRep + "\n";
   aResult += "!\n";
 
+  aResult += "!\n";
+  aResult += "!Setting up multithreaded reading of triangulation\n";
+  aResult += "!Default value: false. Available values: \"on\", \"off\"\n";
+  aResult += aScope + "read.parallel :\t " + InternalParameters.ReadParallel + "\n";
+  aResult += "!\n";
+
   aResult += "!\n";
   aResult += "!Write parameters:\n";
   aResult += "!\n";
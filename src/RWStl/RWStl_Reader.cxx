@@ -18,10 +18,15 @@
 #include <Message.hxx>
 #include <Message_Messenger.hxx>
 #include <Message_ProgressScope.hxx>
+#include <NCollection_Array1.hxx>
+#include <NCollection_Buffer.hxx>
 #include <NCollection_DataMap.hxx>
 #include <NCollection_IncAllocator.hxx>
+#include <NCollection_Vec3.hxx>
+#include <NCollection_Vector.hxx>
 #include <FSD_BinaryFile.hxx>
 #include <OSD_FileSystem.hxx>
+#include <OSD_ThreadPool.hxx>
 #include <OSD_Timer.hxx>
 #include <Poly_MergeNodesTool.hxx>
 #include <Standard_CLocaleSentry.hxx>
@@ -119,13 +124,443 @@ namespace
 
 }
 
+static inline bool str_starts_with (const char* theStr, const char* theWord, int theN);
+static bool ReadVertex (const char* theStr, double& theX, double& theY, double& theZ);
+
+namespace
+{
+  //! Result of parsing of a part of STL data.
+  enum StlChunkStatus
+  {
+    StlChunkStatus_Done,     //!< all facets of the part have been read
+    StlChunkStatus_EndSolid, //!< "endsolid" keyword has been found
+    StlChunkStatus_EndOfFile,//!< end of data has been reached within a facet
+    StlChunkStatus_Error     //!< unexpected data, to be read sequentially
+  };
+
+  //! Part of STL data read by one thread.
+  struct StlChunk
+  {
+    const char* Begin;  //!< first facet (Ascii line or binary record)
+    const char* Limit;  //!< beginning of the next part
+    const char* Stop;   //!< position where reading has stopped
+    NCollection_Vector<gp_XYZ> Nodes; //!< nodes of Ascii facets
+    Standard_Integer NbTriangles;
+    StlChunkStatus Status;
+
+    StlChunk() : Begin (NULL), Limit (NULL), Stop (NULL), Nodes (3 * 4096), NbTriangles (0), Status (StlChunkStatus_Done) {}
+  };
+
+  //! Hasher of node positions rounded to float, as within Poly_MergeNodesTool.
+  struct StlNodeHasher
+  {
+    size_t operator()(const NCollection_Vec3<float>& theKey) const
+    {
+      return opencascade::hashBytes (theKey.GetData(), 3 * sizeof(float));
+    }
+
+    bool operator()(const NCollection_Vec3<float>& theKey1, const NCollection_Vec3<float>& theKey2) const
+    {
+      return memcmp (theKey1.GetData(), theKey2.GetData(), 3 * sizeof(float)) == 0;
+    }
+  };
+
+  //! Copies the line starting at thePos into theLine as null-terminated string
+  //! without end of line symbols (as Standard_ReadLineBuffer does) and moves thePos to the next line.
+  //! Returns 1 on success, 0 at the end of data, -1 if the line is too long.
+  static int readBufferLine (const char*& thePos, const char* theEnd, char* theLine)
+  {
+    if (thePos >= theEnd)
+    {
+      return 0;
+    }
+    const char* anEol = (const char* )memchr (thePos, '\n', theEnd - thePos);
+    const char* aNext = anEol != NULL ? anEol + 1 : theEnd;
+    size_t aLen = (anEol != NULL ? anEol : theEnd) - thePos;
+    if (anEol != NULL && aLen > 0 && thePos[aLen - 1] == '\r')
+    {
+      --aLen;
+    }
+    if (aLen >= THE_BUFFER_SIZE)
+    {
+      return -1;
+    }
+    memcpy (theLine, thePos, aLen);
+    theLine[aLen] = '\0';
+    thePos = aNext;
+    return 1;
+  }
+
+  //! Auxiliary tool reading one solid of STL data kept in memory using several threads.
+  //!
+  //! Nodes are merged only by exactly matching coordinates (rounded to float),
+  //! which is what MergeNodeTool does with zero tolerance and any angle between triangles.
+  //! Each thread finds first occurrences of nodes within its own part of the hash space,
+  //! then nodes and triangles are given to the reader in the order of the file.
+  class ParallelReadTool
+  {
+  public:
+
+    //! Constructor.
+    ParallelReadTool (RWStl_Reader* theReader,
+                      const Handle(OSD_ThreadPool)& thePool,
+                      const Standard_Integer theNbThreads,
+                      const bool theToMerge)
+    : myReader (theReader),
+      myPool (thePool),
+      myNbThreads (theNbThreads),
+      myToMerge (theToMerge),
+      myEnd (NULL),
+      myStop (NULL),
+      myNbChunks (0),
+      myNbNodes (0) {}
+
+    //! Returns the position of data after the solid.
+    const char* Stop() const { return myStop; }
+
+    //! Reads Ascii facets starting from the line following header "solid ...".
+    //! Returns false if data should be read sequentially.
+    bool ParseAscii (const char* theBegin, const char* theEnd)
+    {
+      // skip header and empty lines
+      char aLine[THE_BUFFER_SIZE];
+      const char* aPos = theBegin;
+      const char* aFirst = aPos;
+      if (readBufferLine (aPos, theEnd, aLine) != 1)
+      {
+        return false;
+      }
+      for (;;)
+      {
+        aFirst = aPos;
+        const int aRes = readBufferLine (aPos, theEnd, aLine);
+        if (aRes != 1)
+        {
+          return false;
+        }
+        if (*aLine != '\0')
+        {
+          break;
+        }
+      }
+
+      // split data at facet lines
+      myEnd = theEnd;
+      const Standard_Integer aNbChunks = myNbThreads * 4;
+      const size_t aChunkSize = (theEnd - aFirst) / aNbChunks + 1;
+      myChunks.Resize (0, aNbChunks - 1, false);
+      myNbChunks = 0;
+      for (const char* aBegin = aFirst; aBegin < theEnd; ++myNbChunks)
+      {
+        StlChunk& aChunk = myChunks.ChangeValue (myNbChunks);
+        aChunk.Begin = aBegin;
+        aChunk.Limit = myNbChunks + 1 < aNbChunks
+                     ? findFacet (aBegin + std::min (aChunkSize, size_t(theEnd - aBegin)), theEnd)
+                     : theEnd;
+        aBegin = aChunk.Limit;
+      }
+      if (myNbChunks == 0)
+      {
+        return false;
+      }
+
+      OSD_ThreadPool::Launcher aLauncher (*myPool, Min (myNbThreads, myNbChunks));
+      aLauncher.Perform (0, myNbChunks, *this);
+
+      // the solid ends by "endsolid" or by the end of data within a facet;
+      // any other case is left to sequential reading, to get the same errors
+      for (Standard_Integer aChunkIter = 0; aChunkIter < myNbChunks; ++aChunkIter)
+      {
+        const StlChunk& aChunk = myChunks.Value (aChunkIter);
+        if (aChunk.Status == StlChunkStatus_Error
+         || (aChunk.Status == StlChunkStatus_Done && aChunkIter + 1 == myNbChunks))
+        {
+          return false;
+        }
+        if (aChunk.Status != StlChunkStatus_Done)
+        {
+          myNbChunks = aChunkIter + 1;
+          myStop = aChunk.Stop;
+          break;
+        }
+      }
+      return countNodes();
+    }
+
+    //! Splits binary facets starting from the header.
+    //! Returns false if data should be read sequentially.
+    bool SplitBinary (const char* theBegin, const char* theEnd)
+    {
+      if (size_t(theEnd - theBegin) < THE_STL_HEADER_SIZE)
+      {
+        return false;
+      }
+      int32_t aNbFacets = 0;
+      memcpy (&aNbFacets, theBegin + 80, sizeof(int32_t));
+      if (aNbFacets <= 0
+       || size_t(theEnd - theBegin - THE_STL_HEADER_SIZE) / THE_STL_SIZEOF_FACET < size_t(aNbFacets))
+      {
+        return false;
+      }
+
+      const Standard_Integer aNbChunks = Min (myNbThreads * 4, Standard_Integer(aNbFacets));
+      const Standard_Integer aChunkSize = aNbFacets / aNbChunks + 1;
+      myChunks.Resize (0, aNbChunks - 1, false);
+      myNbChunks = 0;
+      for (Standard_Integer aFacetIter = 0; aFacetIter < aNbFacets; aFacetIter += aChunkSize, ++myNbChunks)
+      {
+        StlChunk& aChunk = myChunks.ChangeValue (myNbChunks);
+        aChunk.Begin = theBegin + THE_STL_HEADER_SIZE + size_t(aFacetIter) * THE_STL_SIZEOF_FACET;
+        aChunk.NbTriangles = Min (aChunkSize, aNbFacets - aFacetIter);
+        aChunk.Limit = aChunk.Begin + size_t(aChunk.NbTriangles) * THE_STL_SIZEOF_FACET;
+      }
+      myStop = theBegin + THE_STL_HEADER_SIZE + size_t(aNbFacets) * THE_STL_SIZEOF_FACET;
+      return countNodes();
+    }
+
+    //! Merges nodes and gives them with triangles to the reader.
+    bool Perform (const Message_ProgressRange& theProgress)
+    {
+      Message_ProgressScope aPS (theProgress, "Merging STL nodes", 2);
+      myFirstNodes.Resize (0, Max (myNbNodes, 1) - 1, false);
+      if (myToMerge)
+      {
+        OSD_ThreadPool::Launcher aLauncher (*myPool, myNbThreads);
+        MergeFunctor aFunctor (*this);
+        aLauncher.Perform (0, myNbThreads, aFunctor);
+      }
+      aPS.Next();
+      if (!aPS.More())
+      {
+        return false;
+      }
+
+      // the same calls as by MergeNodeTool::AddTriangle();
+      // index of first occurrence of each node is replaced by the index returned by AddNode()
+      Standard_Integer aNode = 0;
+      for (Standard_Integer aChunkIter = 0; aChunkIter < myNbChunks; ++aChunkIter)
+      {
+        const StlChunk& aChunk = myChunks.Value (aChunkIter);
+        for (Standard_Integer aTriIter = 0; aTriIter < aChunk.NbTriangles; ++aTriIter)
+        {
+          int aNodesRes[3] = { -1, -1, -1 };
+          for (int aNodeIter = 0; aNodeIter < 3; ++aNodeIter, ++aNode)
+          {
+            const Standard_Integer aFirst = myToMerge ? myFirstNodes.Value (aNode) : aNode;
+            if (aFirst == aNode)
+            {
+              aNodesRes[aNodeIter] = myReader->AddNode (node (aChunk, aTriIter * 3 + aNodeIter));
+              myFirstNodes.SetValue (aNode, aNodesRes[aNodeIter]);
+            }
+            else
+            {
+              aNodesRes[aNodeIter] = myFirstNodes.Value (aFirst);
+            }
+          }
+          if (aNodesRes[0] != aNodesRes[1]
+           && aNodesRes[1] != aNodesRes[2]
+           && aNodesRes[2] != aNodesRes[0])
+          {
+            myReader->AddTriangle (aNodesRes[0], aNodesRes[1], aNodesRes[2]);
+          }
+        }
+      }
+      aPS.Next();
+      return aPS.More();
+    }
+
+    //! Parses Ascii part theChunkIndex.
+    void operator() (int theThreadIndex, int theChunkIndex) const
+    {
+      (void )theThreadIndex;
+      Standard_CLocaleSentry aLocaleSentry; // C locale within the thread
+      StlChunk& aChunk = myChunks.ChangeValue (theChunkIndex);
+      aChunk.Status = parseAscii (aChunk);
+      aChunk.NbTriangles = aChunk.Nodes.Size() / 3;
+    }
+
+  private:
+
+    //! Finds first occurrences of nodes which hash belongs to part theIndex of the hash space.
+    class MergeFunctor
+    {
+    public:
+      MergeFunctor (ParallelReadTool& theTool) : myTool (theTool) {}
+
+      void operator() (int theThreadIndex, int theIndex) const
+      {
+        (void )theThreadIndex;
+        const StlNodeHasher aHasher;
+        const size_t aNbParts = (size_t )myTool.myNbThreads;
+        NCollection_DataMap<NCollection_Vec3<float>, Standard_Integer, StlNodeHasher>
+          aNodeMap (myTool.myNbNodes / myTool.myNbThreads + 1, new NCollection_IncAllocator (1024 * 1024));
+        Standard_Integer aNode = 0;
+        for (Standard_Integer aChunkIter = 0; aChunkIter < myTool.myNbChunks; ++aChunkIter)
+        {
+          const StlChunk& aChunk = myTool.myChunks.Value (aChunkIter);
+          const Standard_Integer aNbNodes = aChunk.NbTriangles * 3;
+          for (Standard_Integer aNodeIter = 0; aNodeIter < aNbNodes; ++aNodeIter, ++aNode)
+          {
+            const gp_XYZ aPnt = node (aChunk, aNodeIter);
+            const NCollection_Vec3<float> aKey ((float )aPnt.X(), (float )aPnt.Y(), (float )aPnt.Z());
+            if (aHasher (aKey) % aNbParts != (size_t )theIndex)
+            {
+              continue;
+            }
+            Standard_Integer aFirst = aNode;
+            if (aKey.x() == aKey.x() && aKey.y() == aKey.y() && aKey.z() == aKey.z()) // NaN never matches
+            {
+              if (const Standard_Integer* aFound = aNodeMap.Seek (aKey))
+              {
+                aFirst = *aFound;
+              }
+              else
+              {
+                aNodeMap.Bind (aKey, aNode);
+              }
+            }
+            myTool.myFirstNodes.SetValue (aNode, aFirst);
+          }
+        }
+      }
+
+    private:
+      MergeFunctor& operator= (const MergeFunctor& );
+    private:
+      ParallelReadTool& myTool;
+    };
+
+    //! Returns node theIndex of the part.
+    static gp_XYZ node (const StlChunk& theChunk, const Standard_Integer theIndex)
+    {
+      if (theChunk.Nodes.IsEmpty())
+      {
+        // normal + 3 nodes + 2 extra bytes
+        const size_t aVec3Size = sizeof(float) * 3;
+        return readStlFloatVec3 (theChunk.Begin + size_t(theIndex / 3) * THE_STL_SIZEOF_FACET
+                                                + aVec3Size * (theIndex % 3 + 1));
+      }
+      return theChunk.Nodes.Value (theIndex);
+    }
+
+    //! Returns the beginning of the first line starting with "facet" after thePos.
+    static const char* findFacet (const char* thePos, const char* theEnd)
+    {
+      const char* aLine = (const char* )memchr (thePos, '\n', theEnd - thePos);
+      while (aLine != NULL && ++aLine < theEnd)
+      {
+        const char* aWord = aLine;
+        while (aWord < theEnd && (*aWord == ' ' || *aWord == '\t'))
+        {
+          ++aWord;
+        }
+        if (theEnd - aWord >= 5 && !strncasecmp (aWord, "facet", 5))
+        {
+          return aLine;
+        }
+        aLine = (const char* )memchr (aWord, '\n', theEnd - aWord);
+      }
+      return theEnd;
+    }
+
+    //! Reads facets of Ascii part, following the same rules as ReadAscii()
+    //! and checking also keywords of lines skipped by it.
+    StlChunkStatus parseAscii (StlChunk& theChunk) const
+    {
+      char aLine[THE_BUFFER_SIZE];
+      const char* aPos = theChunk.Begin;
+      while (aPos < theChunk.Limit)
+      {
+        if (readBufferLine (aPos, myEnd, aLine) != 1)
+        {
+          return StlChunkStatus_Error;
+        }
+        if (str_starts_with (aLine, "endsolid", 8))
+        {
+          theChunk.Stop = aPos;
+          return StlChunkStatus_EndSolid;
+        }
+        if (!str_starts_with (aLine, "facet", 5)
+          || readBufferLine (aPos, myEnd, aLine) != 1
+          || !str_starts_with (aLine, "outer", 5))
+        {
+          return StlChunkStatus_Error;
+        }
+
+        gp_XYZ aVertex[3];
+        for (Standard_Integer i = 0; i < 3; i++)
+        {
+          const int aRes = readBufferLine (aPos, myEnd, aLine);
+          if (aRes == 0)
+          {
+            // the end of file within a facet stops reading without error
+            theChunk.Stop = aPos;
+            return StlChunkStatus_EndOfFile;
+          }
+          if (aRes != 1
+          || !ReadVertex (aLine, aVertex[i].ChangeCoord (1), aVertex[i].ChangeCoord (2), aVertex[i].ChangeCoord (3)))
+          {
+            return StlChunkStatus_Error;
+          }
+        }
+
+        if (readBufferLine (aPos, myEnd, aLine) != 1
+        || !str_starts_with (aLine, "endloop", 7)
+        ||  readBufferLine (aPos, myEnd, aLine) != 1
+        || !str_starts_with (aLine, "endfacet", 8))
+        {
+          return StlChunkStatus_Error;
+        }
+        theChunk.Nodes.Append (aVertex[0]);
+        theChunk.Nodes.Append (aVertex[1]);
+        theChunk.Nodes.Append (aVertex[2]);
+      }
+      theChunk.Stop = aPos;
+      return aPos == theChunk.Limit ? StlChunkStatus_Done : StlChunkStatus_Error;
+    }
+
+    //! Counts nodes of the solid; returns false if they cannot be indexed.
+    bool countNodes()
+    {
+      Standard_Size aNbNodes = 0;
+      for (Standard_Integer aChunkIter = 0; aChunkIter < myNbChunks; ++aChunkIter)
+      {
+        aNbNodes += Standard_Size(myChunks.Value (aChunkIter).NbTriangles) * 3;
+      }
+      if (aNbNodes == 0
+       || aNbNodes > Standard_Size(std::numeric_limits<Standard_Integer>::max()))
+      {
+        return false;
+      }
+      myNbNodes = Standard_Integer(aNbNodes);
+      return true;
+    }
+
+  private:
+    ParallelReadTool& operator= (const ParallelReadTool& );
+
+  private:
+    RWStl_Reader* myReader;
+    Handle(OSD_ThreadPool) myPool;
+    Standard_Integer myNbThreads;
+    bool myToMerge;                                   //!< merge equal nodes
+    const char* myEnd;                                //!< end of data
+    const char* myStop;                               //!< end of the solid
+    mutable NCollection_Array1<StlChunk> myChunks;    //!< parts of the solid
+    Standard_Integer myNbChunks;                      //!< number of used parts
+    Standard_Integer myNbNodes;                       //!< number of nodes of triangles
+    NCollection_Array1<Standard_Integer> myFirstNodes;//!< index of first node with equal position
+  };
+}
+
 //==============================================================================
 //function : RWStl_Reader
 //purpose  :
 //==============================================================================
 RWStl_Reader::RWStl_Reader()
 : myMergeAngle (M_PI/2.0),
-  myMergeTolearance (0.0)
+  myMergeTolearance (0.0),
+  myToParallel (false)
 {
   //
 }
@@ -157,6 +592,28 @@ Standard_Boolean RWStl_Reader::Read (const char* theFile,
 
   Standard_ReadLineBuffer aBuffer (THE_BUFFER_SIZE);
 
+  // in parallel mode, the whole file is loaded into memory;
+  // nodes can be merged in parallel only by matching coordinates (see MergeNodeTool)
+  Handle(NCollection_Buffer) aData;
+  const Handle(OSD_ThreadPool)& aPool = OSD_ThreadPool::DefaultPool();
+  const Standard_Integer aNbThreads = aPool->NbDefaultThreadsToLaunch();
+  const bool isMergeAnyAngle = (float )myMergeAngle <= 0.0f || (float )Cos (myMergeAngle) <= 0.01f;
+  if (myToParallel
+   && aNbThreads > 1
+   && isMergeAnyAngle
+   && (float )myMergeTolearance <= 0.0f
+   && (size_t )theEnd > 0)
+  {
+    aData = new NCollection_Buffer (NCollection_BaseAllocator::CommonBaseAllocator());
+    if (!aData->Allocate ((size_t )theEnd)
+     || aStream->read ((char* )aData->ChangeData(), (std::streamsize )theEnd).gcount() != (std::streamsize )theEnd)
+    {
+      aData.Nullify();
+    }
+    aStream->clear();
+    aStream->seekg (0, aStream->beg);
+  }
+
   // Note: here we are trying to handle rare but realistic case of
   // STL files which are composed of several STL data blocks
   // running translation in cycle.
@@ -165,6 +622,27 @@ Standard_Boolean RWStl_Reader::Read (const char* theFile,
   Message_ProgressScope aPS (theProgress, NULL, 1, true);
   while (aStream->good())
   {
+    if (!aData.IsNull())
+    {
+      // read the solid in parallel threads or, if its data is not as expected, sequentially
+      const char* aBegin = (const char* )aData->Data() + (size_t )aStream->tellg();
+      const char* anEnd  = (const char* )aData->Data() + aData->Size();
+      ParallelReadTool aTool (this, aPool, aNbThreads, (float )myMergeAngle > 0.0f);
+      if (isAscii ? aTool.ParseAscii (aBegin, anEnd) : aTool.SplitBinary (aBegin, anEnd))
+      {
+        if (!aTool.Perform (aPS.Next (2)))
+        {
+          break;
+        }
+        aStream->seekg (aTool.Stop() - (const char* )aData->Data(), aStream->beg);
+        *aStream >> std::ws; // skip any white spaces
+        AddSolid();
+        continue;
+      }
+      // the line buffer of sequential reading runs ahead of the stream position
+      aData.Nullify();
+    }
+
     if (isAscii)
     {
       if (!ReadAscii (*aStream, aBuffer, theEnd, aPS.Next (2)))
@@ -38,6 +38,18 @@ public:
   //! Default constructor.
   Standard_EXPORT RWStl_Reader();
 
+  //! Return TRUE if multithreaded reading is allowed; FALSE by default.
+  bool ToParallel() const { return myToParallel; }
+
+  //! Setup multithreaded reading by Read().
+  //! The file is loaded into memory at once, facets are parsed by several threads
+  //! and equal nodes are found using a hash map split between threads;
+  //! methods AddNode() and AddTriangle() are still called from the calling thread
+  //! in the same order as by sequential reading.
+  //! Applies only when nodes are merged by exactly matching coordinates
+  //! (zero merge tolerance, merge angle 0 or M_PI/2), otherwise the file is read sequentially.
+  void SetParallel (bool theToParallel) { myToParallel = theToParallel; }
+
   //! Reads data from STL file (either binary or Ascii).
   //! This function supports reading multi-domain STL files formed by concatenation 
   //! of several "plain" files. 
@@ -107,6 +119,7 @@ protected:
 
   Standard_Real myMergeAngle;
   Standard_Real myMergeTolearance;
+  Standard_Boolean myToParallel;
 
 };
 
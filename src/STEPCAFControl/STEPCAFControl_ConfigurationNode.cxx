@@ -118,6 +118,12 @@ bool STEPCAFControl_ConfigurationNode::Load(const Handle(DE_ConfigurationContext
     theResource->BooleanVal("read.props", InternalParameters.ReadProps, aScope);
   InternalParameters.ReadMetadata =
     theResource->BooleanVal("read.metadata", InternalParameters.ReadMetadata, aScope);
+  InternalParameters.ReadParallel =
+    theResource->BooleanVal("read.parallel", InternalParameters.ReadParallel, aScope);
+  InternalParameters.ReadFastLexer =
+    theResource->BooleanVal("read.fast_lexer", InternalParameters.ReadFastLexer, aScope);
+  InternalParameters.ReadLazy =
+    theResource->BooleanVal("read.lazy", InternalParameters.ReadLazy, aScope);
 
   InternalParameters.WritePrecisionMode = (StepData_ConfParameters::WriteMode_PrecisionMode)
     theResource->IntegerVal("write.precision.mode", InternalParameters.WritePrecisionMode, aScope);
@@ -153,6 +159,8 @@ bool STEPCAFControl_ConfigurationNode::Load(const Handle(DE_ConfigurationContext
     theResource->BooleanVal("write.props", InternalParameters.WriteProps, aScope);
   InternalParameters.WriteModelType = (STEPControl_StepModelType)
     theResource->IntegerVal("write.model.type", InternalParameters.WriteModelType, aScope);
+  InternalParameters.WriteParallel =
+    theResource->BooleanVal("write.parallel", InternalParameters.WriteParallel, aScope);
 
   return true;
 }
@@ -378,6 +386,24 @@ TCollection_AsciiString STEPCAFControl_ConfigurationNode::Save() const
   aResult += aScope + "read.metadata :\t " + InternalParameters.ReadMetadata + "\n";
   aResult += "!\n";
 
+  aResult += "!\n";
+  aResult += "!Setting up the read.parallel parameter which is used to read the file records into entities and to translate solid models in parallel\n";
+  aResult += "!Default value: 0(\"OFF\"). Available values: 0(\"OFF\"), 1(\"ON\")\n";
+  aResult += aScope + "read.parallel :\t " + InternalParameters.ReadParallel + "\n";
+  aResult += "!\n";
+
+  aResult += "!\n";
+  aResult += "!Setting up the read.fast_lexer parameter which is used to parse the file by the hand-written lexer working on the file mapped into memory\n";
+  aResult += "!Default value: 0(\"OFF\"). Available values: 0(\"OFF\"), 1(\"ON\")\n";
+  aResult += aScope + "read.fast_lexer :\t " + InternalParameters.ReadFastLexer + "\n";
+  aResult += "!\n";
+
+  aResult += "!\n";
+  aResult += "!Setting up the read.lazy parameter which is used to read the contents of entities on demand, at their first access\n";
+  aResult += "!Default value: 0(\"OFF\"). Available values: 0(\"OFF\"), 1(\"ON\")\n";
+  aResult += aScope + "read.lazy :\t " + InternalParameters.ReadLazy + "\n";
+  aResult += "!\n";
+
   aResult += "!\n";
   aResult += "!Write Parameters:\n";
   aResult += "!\n";
@@ -488,6 +514,12 @@ TCollection_AsciiString STEPCAFControl_ConfigurationNode::Save() const
   aResult += aScope + "write.model.type :\t " + InternalParameters.WriteModelType + "\n";
   aResult += "!\n";
 
+  aResult += "!\n";
+  aResult += "!Setting up the write.parallel parameter which is used to translate the sub-shapes of a manifold shape in parallel\n";
+  aResult += "!Default value: 0(\"OFF\"). Available values: 0(\"OFF\"), 1(\"ON\")\n";
+  aResult += aScope + "write.parallel :\t " + InternalParameters.WriteParallel + "\n";
+  aResult += "!\n";
+
   aResult += "!*****************************************************************************\n";
 
   return aResult;
@@ -30,6 +30,10 @@
 #include <Interface_Static.hxx>
 #include <Message_Messenger.hxx>
 #include <Message_ProgressScope.hxx>
+#include <NCollection_DataMap.hxx>
+#include <NCollection_Map.hxx>
+#include <NCollection_Vector.hxx>
+#include <OSD_ThreadPool.hxx>
 #include <OSD_Timer.hxx>
 #include <Precision.hxx>
 #include <Standard_ErrorHandler.hxx>
@@ -205,6 +209,28 @@ namespace {
   // The better way is to pass this information via binder or via TopoDS_Shape itself, however,
   // this is very specific info to do so...
   Standard_Boolean NM_DETECTED = Standard_False;
+
+  // Name of the TransientProcess context keeping solid models converted in advance
+  static const Standard_CString THE_PARALLEL_CONTEXT = "STEPControl_ActorRead_Parallel";
+
+  //! Result of the conversion of one representation item made in a parallel thread
+  struct STEPControl_ParallelResult
+  {
+    Handle(Transfer_TransientProcess) TP;
+    Standard_Real Precision;
+    Standard_Real MaxTol;
+    StepData_Factors Factors;
+
+    STEPControl_ParallelResult() : Precision (0.0), MaxTol (0.0) {}
+  };
+
+  //! Results of the parallel conversion, attached to the main TransientProcess
+  class STEPControl_ParallelResults : public Standard_Transient
+  {
+  public:
+    NCollection_DataMap<Handle(Standard_Transient), STEPControl_ParallelResult> Map;
+    DEFINE_STANDARD_RTTI_INLINE(STEPControl_ParallelResults, Standard_Transient)
+  };
 }
 
 // ============================================================================
@@ -335,6 +361,12 @@ Handle(Transfer_Binder)  STEPControl_ActorRead::Transfer
   }
   // [END] Get version of preprocessor (to detect I-Deas case) (ssv; 23.11.2010)
   Standard_Boolean aTrsfUse = (aStepModel->InternalParameters.ReadRootTransformation == 1);
+  if (aStepModel->InternalParameters.ReadParallel)
+  {
+    Handle(Standard_Transient) aResults;
+    if (!TP->GetContext(THE_PARALLEL_CONTEXT, STANDARD_TYPE(STEPControl_ParallelResults), aResults))
+      prepareParallelTransfer(TP, aLocalFactors);
+  }
   return TransferShape(start, TP, aLocalFactors, Standard_True, aTrsfUse, theProgress);
 }
 
@@ -1828,7 +1860,10 @@ Handle(Transfer_Binder) STEPControl_ActorRead::TransferShape(
     // Here starts the entity to be treated : Shape Representation Subtype
   // It can be also other Root entities
     DeclareAndCast(StepGeom_GeometricRepresentationItem,git,start);
-    shbinder = TransferEntity(git, TP, theLocalFactors, isManifold, theProgress);
+    if (isManifold)
+      shbinder = takeParallelResult(git, TP, theLocalFactors);
+    if (shbinder.IsNull())
+      shbinder = TransferEntity(git, TP, theLocalFactors, isManifold, theProgress);
   }
   else if (start->IsKind(STANDARD_TYPE(StepRepr_MappedItem))) {
     DeclareAndCast(StepRepr_MappedItem,mapit,start);
@@ -1843,6 +1878,165 @@ Handle(Transfer_Binder) STEPControl_ActorRead::TransferShape(
   
   return shbinder;
 }
+//=======================================================================
+//class    : ParallelItemTransfer
+//purpose  : Functor converting one representation item into its own
+//           TransientProcess by a separate actor
+//=======================================================================
+
+class STEPControl_ActorRead::ParallelItemTransfer
+{
+public:
+
+  struct Task
+  {
+    Handle(StepShape_ShapeRepresentation) Rep;
+    Handle(StepGeom_GeometricRepresentationItem) Item;
+    STEPControl_ParallelResult Result;
+  };
+
+  ParallelItemTransfer (const Handle(Transfer_TransientProcess)& theTP,
+                        const StepData_Factors& theLocalFactors,
+                        NCollection_Vector<Task>& theTasks)
+  : myTP (theTP), myFactors (theLocalFactors), myTasks (theTasks) {}
+
+  void operator() (int theThreadIndex, int theIndex) const
+  {
+    (void )theThreadIndex;
+    Task& aTask = myTasks.ChangeValue (theIndex);
+    Handle(Transfer_TransientProcess) aTP = new Transfer_TransientProcess (100);
+    if (!myTP->HGraph().IsNull())
+      aTP->SetGraph (myTP->HGraph());
+    else
+      aTP->SetModel (myTP->Model());
+    Handle(STEPControl_ActorRead) anActor = new STEPControl_ActorRead (myTP->Model());
+    StepData_Factors aFactors = myFactors;
+    try
+    {
+      OCC_CATCH_SIGNALS
+      anActor->PrepareUnits (aTask.Rep, aTP, aFactors);
+      anActor->TransferEntity (aTask.Item, aTP, aFactors, Standard_True, Message_ProgressRange());
+    }
+    catch (Standard_Failure const&)
+    {
+      // the item is left to the sequential transfer
+      return;
+    }
+    aTask.Result.TP = aTP;
+    aTask.Result.Precision = anActor->myPrecision;
+    aTask.Result.MaxTol = anActor->myMaxTol;
+    aTask.Result.Factors = aFactors;
+  }
+
+private:
+  ParallelItemTransfer& operator= (const ParallelItemTransfer& );
+
+private:
+  Handle(Transfer_TransientProcess) myTP;
+  StepData_Factors myFactors;
+  NCollection_Vector<Task>& myTasks;
+};
+
+//=======================================================================
+//function : prepareParallelTransfer
+//purpose  : 
+//=======================================================================
+
+void STEPControl_ActorRead::prepareParallelTransfer (const Handle(Transfer_TransientProcess)& TP,
+                                                     const StepData_Factors& theLocalFactors)
+{
+  Handle(STEPControl_ParallelResults) aResults = new STEPControl_ParallelResults;
+  TP->SetContext (THE_PARALLEL_CONTEXT, aResults);
+
+  // non-manifold processing depends on the state of the actor kept between items
+  Handle(StepData_StepModel) aStepModel = Handle(StepData_StepModel)::DownCast (TP->Model());
+  if (aStepModel.IsNull() || aStepModel->InternalParameters.ReadNonmanifold != 0)
+    return;
+
+  // collect solid models not yet transferred, each one with its first representation
+  NCollection_Vector<ParallelItemTransfer::Task> aTasks;
+  NCollection_Map<Handle(Standard_Transient)> anItems;
+  const Standard_Integer aNbEnt = aStepModel->NbEntities();
+  for (Standard_Integer anEnt = 1; anEnt <= aNbEnt; ++anEnt)
+  {
+    DeclareAndCast(StepShape_ShapeRepresentation, aRep, aStepModel->Value (anEnt));
+    if (aRep.IsNull() || aRep->Items().IsNull())
+      continue;
+    for (Standard_Integer anItemIt = 1; anItemIt <= aRep->NbItems(); ++anItemIt)
+    {
+      const Handle(StepRepr_RepresentationItem)& anItem = aRep->ItemsValue (anItemIt);
+      if (anItem.IsNull()
+      || !anItem->IsKind (STANDARD_TYPE(StepShape_ManifoldSolidBrep))
+      ||  TP->IsBound (anItem)
+      || !anItems.Add (anItem))
+        continue;
+      ParallelItemTransfer::Task& aTask = aTasks.Appended();
+      aTask.Rep = aRep;
+      aTask.Item = Handle(StepGeom_GeometricRepresentationItem)::DownCast (anItem);
+    }
+  }
+  if (aTasks.Size() < 2)
+    return;
+
+  const Handle(OSD_ThreadPool)& aPool = OSD_ThreadPool::DefaultPool();
+  const Standard_Integer aNbThreads = Min (aPool->NbDefaultThreadsToLaunch(), aTasks.Size());
+  if (aNbThreads < 2)
+    return;
+
+  ParallelItemTransfer aFunctor (TP, theLocalFactors, aTasks);
+  OSD_ThreadPool::Launcher aLauncher (*aPool, aNbThreads);
+  aLauncher.Perform (0, aTasks.Size(), aFunctor);
+
+  for (NCollection_Vector<ParallelItemTransfer::Task>::Iterator aTaskIt (aTasks); aTaskIt.More(); aTaskIt.Next())
+  {
+    const ParallelItemTransfer::Task& aTask = aTaskIt.Value();
+    if (!aTask.Result.TP.IsNull())
+      aResults->Map.Bind (aTask.Item, aTask.Result);
+  }
+}
+
+//=======================================================================
+//function : takeParallelResult
+//purpose  : 
+//=======================================================================
+
+Handle(TransferBRep_ShapeBinder) STEPControl_ActorRead::takeParallelResult
+                   (const Handle(StepGeom_GeometricRepresentationItem)& theItem,
+                    const Handle(Transfer_TransientProcess)& TP,
+                    const StepData_Factors& theLocalFactors)
+{
+  Handle(TransferBRep_ShapeBinder) aBinder;
+  Handle(Standard_Transient) aContext;
+  if (mySRContext.IsNull()
+  || !TP->GetContext (THE_PARALLEL_CONTEXT, STANDARD_TYPE(STEPControl_ParallelResults), aContext))
+    return aBinder;
+
+  Handle(STEPControl_ParallelResults) aResults = Handle(STEPControl_ParallelResults)::DownCast (aContext);
+  const STEPControl_ParallelResult* aResult = aResults->Map.Seek (theItem);
+  if (aResult == NULL)
+    return aBinder;
+
+  // the solid may be shared by representations with other units or
+  // be reached with another precision than in its representation
+  if (aResult->Precision != myPrecision
+   || aResult->MaxTol != myMaxTol
+   || aResult->Factors.LengthFactor() != theLocalFactors.LengthFactor()
+   || aResult->Factors.PlaneAngleFactor() != theLocalFactors.PlaneAngleFactor()
+   || aResult->Factors.SolidAngleFactor() != theLocalFactors.SolidAngleFactor()
+   || aResult->Factors.CascadeUnit() != theLocalFactors.CascadeUnit())
+  {
+    aResults->Map.UnBind (theItem);
+    return aBinder;
+  }
+
+  // the binder of the solid is found then as if it was translated here
+  TP->TakeBindings (aResult->TP);
+  aResults->Map.UnBind (theItem);
+
+  aBinder = Handle(TransferBRep_ShapeBinder)::DownCast (TP->Find (theItem));
+  return aBinder;
+}
+
 // ============================================================================
 // Method  : STEPControl_ActorRead::PrepareUnits
 // Purpose : Set the unit conversion factors
@@ -221,6 +221,23 @@ private:
                                                   TopoDS_Compound& theCund,
                                                   Message_ProgressScope& thePS);
 
+  //! Converts solid models (ManifoldSolidBrep and its subtypes) referred by
+  //! shape representations of the model in parallel threads, each one into its own
+  //! TransientProcess; results are kept in the context of <TP>.
+  //! Called once per TransientProcess when read.step.parallel is on.
+  void prepareParallelTransfer (const Handle(Transfer_TransientProcess)& TP,
+                                const StepData_Factors& theLocalFactors);
+
+  //! Returns the result of the conversion of <theItem> made by prepareParallelTransfer()
+  //! and moves all bindings of its TransientProcess to <TP>.
+  //! Returns Null if there is no such result or if it was made with other
+  //! units or tolerances than the current ones.
+  Handle(TransferBRep_ShapeBinder) takeParallelResult (const Handle(StepGeom_GeometricRepresentationItem)& theItem,
+                                                       const Handle(Transfer_TransientProcess)& TP,
+                                                       const StepData_Factors& theLocalFactors);
+
+  class ParallelItemTransfer;
+
   StepToTopoDS_NMTool myNMTool;
   Standard_Real myPrecision;
   Standard_Real myMaxTol;
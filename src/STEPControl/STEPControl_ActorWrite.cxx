@@ -26,10 +26,13 @@
 #include <Geom_Plane.hxx>
 #include <Geom_Surface.hxx>
 #include <GeomToStep_MakeAxis2Placement3d.hxx>
+#include <Interface_Check.hxx>
 #include <Interface_Macros.hxx>
 #include <Interface_MSG.hxx>
 #include <Interface_Static.hxx>
 #include <Message_ProgressScope.hxx>
+#include <NCollection_Array1.hxx>
+#include <OSD_ThreadPool.hxx>
 #include <ShapeAnalysis_ShapeTolerance.hxx>
 #include <ShapeProcess_ShapeContext.hxx>
 #include <Standard_Type.hxx>
@@ -690,7 +693,371 @@ static Standard_Boolean transferVertex (const Handle(Transfer_FinderProcess)& FP
   return IsDone;
 }
 
-     
+
+//=======================================================================
+//function : makeRepresentationItem
+//purpose  : Creates the STEP entities corresponding to a shape according
+//           to the translation mode; returns False if the shape cannot be
+//           written as a faceted one (fails are recorded on <start>)
+//=======================================================================
+
+static Standard_Boolean makeRepresentationItem (const Handle(Transfer_Finder)& start,
+                                                const TopoDS_Shape& aShape,
+                                                const STEPControl_StepModelType trmode,
+                                                const Handle(Transfer_FinderProcess)& FP,
+                                                const StepData_Factors& theLocalFactors,
+                                                const Standard_Real Tol,
+                                                Handle(StepGeom_GeometricRepresentationItem)& item,
+                                                Handle(StepGeom_GeometricRepresentationItem)& itemTess,
+                                                const Message_ProgressRange& theProgress)
+{
+  Message_ProgressScope aPS(theProgress, NULL, 1);
+  switch (trmode)
+    {
+    case STEPControl_ManifoldSolidBrep:
+      {
+        if (aShape.ShapeType() == TopAbs_SOLID) {
+          TopoDS_Solid aSolid = TopoDS::Solid(aShape);
+
+          //:d6 abv 13 Mar 98: if solid has more than 1 shell, 
+          // try to treat it as solid with voids
+          Standard_Integer nbShells = 0;
+          for ( TopoDS_Iterator It ( aSolid ); It.More(); It.Next() ) 
+            if (It.Value().ShapeType() == TopAbs_SHELL) nbShells++;
+          if ( nbShells >1 ) {
+            TopoDSToStep_MakeBrepWithVoids MkBRepWithVoids(aSolid, FP, theLocalFactors, aPS.Next());
+            MkBRepWithVoids.Tolerance() = Tol;
+            if (MkBRepWithVoids.IsDone()) 
+            {
+              item = MkBRepWithVoids.Value();
+              itemTess = MkBRepWithVoids.TessellatedValue();
+            }
+            else nbShells = 1; //smth went wrong; let it will be just Manifold
+          }
+          if ( nbShells ==1 ) {
+            TopoDSToStep_MakeManifoldSolidBrep MkManifoldSolidBrep(aSolid, FP, theLocalFactors, aPS.Next());
+            MkManifoldSolidBrep.Tolerance() = Tol;
+            if (MkManifoldSolidBrep.IsDone()) 
+            {
+              item = MkManifoldSolidBrep.Value();
+              itemTess = MkManifoldSolidBrep.TessellatedValue();
+            }
+          }
+        }
+        else if (aShape.ShapeType() == TopAbs_SHELL) {
+          TopoDS_Shell aShell = TopoDS::Shell(aShape);
+          TopoDSToStep_MakeManifoldSolidBrep MkManifoldSolidBrep(aShell, FP, theLocalFactors, aPS.Next());
+          MkManifoldSolidBrep.Tolerance() = Tol;
+          if (MkManifoldSolidBrep.IsDone()) 
+          {
+            item = MkManifoldSolidBrep.Value();
+            itemTess = MkManifoldSolidBrep.TessellatedValue();
+          }
+        }
+        break;
+      }
+    case STEPControl_BrepWithVoids:
+      {
+        if (aShape.ShapeType() == TopAbs_SOLID) {
+          TopoDS_Solid aSolid = TopoDS::Solid(aShape);
+          TopoDSToStep_MakeBrepWithVoids MkBRepWithVoids(aSolid, FP, theLocalFactors, aPS.Next());
+          MkBRepWithVoids.Tolerance() = Tol;
+          if (MkBRepWithVoids.IsDone()) 
+          {
+            item = MkBRepWithVoids.Value();
+            itemTess = MkBRepWithVoids.TessellatedValue();
+          }
+        }
+        break;
+      }
+    case STEPControl_FacetedBrep:
+      {
+        TopoDSToStep_FacetedError facErr = TopoDSToStep_FacetedTool::CheckTopoDSShape(aShape);
+        if (facErr != TopoDSToStep_FacetedDone) {
+          FP->AddFail(start,"Error in Faceted Shape from TopoDS");
+          if (facErr == TopoDSToStep_SurfaceNotPlane) {
+            FP->AddFail(start,"-- The TopoDS_Face is not plane");
+          }
+          else if (facErr == TopoDSToStep_PCurveNotLinear) {
+            FP->AddFail(start,"-- The Face contains non linear PCurves");
+          }
+          return Standard_False;
+        }
+        if (aShape.ShapeType() == TopAbs_SOLID) {
+          TopoDS_Solid aSolid = TopoDS::Solid(aShape);
+          TopoDSToStep_MakeFacetedBrep MkFacetedBrep(aSolid, FP, theLocalFactors, aPS.Next());
+          MkFacetedBrep.Tolerance() = Tol;
+          if (MkFacetedBrep.IsDone()) 
+          {
+            item = MkFacetedBrep.Value();
+            itemTess = MkFacetedBrep.TessellatedValue();
+          }
+        }
+        break;
+      }
+    case STEPControl_FacetedBrepAndBrepWithVoids:
+      {
+        TopoDSToStep_FacetedError facErr = TopoDSToStep_FacetedTool::CheckTopoDSShape(aShape);
+        if (facErr != TopoDSToStep_FacetedDone) {
+          FP->AddFail(start,"Error in Faceted Shape from TopoDS");
+          if (facErr == TopoDSToStep_SurfaceNotPlane) {
+            FP->AddFail(start,"-- The TopoDS_Face is not plane");
+          }
+          else if (facErr == TopoDSToStep_PCurveNotLinear) {
+            FP->AddFail(start,"-- The Face contains non linear PCurves");
+          }
+          return Standard_False;
+        }
+        if (aShape.ShapeType() == TopAbs_SOLID) {
+          TopoDS_Solid aSolid = TopoDS::Solid(aShape);
+          TopoDSToStep_MakeFacetedBrepAndBrepWithVoids 
+            MkFacetedBrepAndBrepWithVoids(aSolid, FP, theLocalFactors, aPS.Next());
+          MkFacetedBrepAndBrepWithVoids.Tolerance() = Tol;
+          if (MkFacetedBrepAndBrepWithVoids.IsDone()) 
+          {
+            item = MkFacetedBrepAndBrepWithVoids.Value();
+            itemTess = MkFacetedBrepAndBrepWithVoids.TessellatedValue();
+          }
+        }
+        break;
+      }
+    case STEPControl_ShellBasedSurfaceModel:
+      {
+        if (aShape.ShapeType() == TopAbs_SOLID) {
+          TopoDS_Solid aSolid = TopoDS::Solid(aShape);
+          TopoDSToStep_MakeShellBasedSurfaceModel
+            MkShellBasedSurfaceModel(aSolid, FP, theLocalFactors, aPS.Next());
+          MkShellBasedSurfaceModel.Tolerance() = Tol;
+          if (MkShellBasedSurfaceModel.IsDone()) 
+          {
+            item = MkShellBasedSurfaceModel.Value();
+            itemTess = MkShellBasedSurfaceModel.TessellatedValue();
+         }
+        }
+        else if (aShape.ShapeType() == TopAbs_SHELL) {
+          TopoDS_Shell aShell = TopoDS::Shell(aShape);
+          // Non-manifold topology is stored via NMSSR containing series of SBSM (ssv; 13.11.2010)
+          TopoDSToStep_MakeShellBasedSurfaceModel MkShellBasedSurfaceModel(aShell, FP, theLocalFactors, aPS.Next());
+          MkShellBasedSurfaceModel.Tolerance() = Tol;
+          if (MkShellBasedSurfaceModel.IsDone()) 
+          {
+            item = MkShellBasedSurfaceModel.Value();
+            itemTess = MkShellBasedSurfaceModel.TessellatedValue();
+          }
+        }
+        else if (aShape.ShapeType() == TopAbs_FACE) {
+          TopoDS_Face aFace = TopoDS::Face(aShape);
+          TopoDSToStep_MakeShellBasedSurfaceModel
+            MkShellBasedSurfaceModel(aFace, FP, theLocalFactors, aPS.Next());
+          MkShellBasedSurfaceModel.Tolerance() = Tol;
+          if (MkShellBasedSurfaceModel.IsDone()) 
+          {
+            item = MkShellBasedSurfaceModel.Value();
+            itemTess = MkShellBasedSurfaceModel.TessellatedValue();
+          }
+        }
+        break;
+      }
+    case STEPControl_GeometricCurveSet:
+      {
+        TopoDSToStep_MakeGeometricCurveSet MkGeometricCurveSet(aShape, FP, theLocalFactors);
+        MkGeometricCurveSet.Tolerance() = Tol;
+        if (MkGeometricCurveSet.IsDone()) {
+          item = MkGeometricCurveSet.Value();
+        }
+        // PTV 22.08.2002 OCC609 ------------------------- begin --------------------
+        // modified by PTV 16.09.2002 OCC725
+        else if (aShape.ShapeType() == TopAbs_COMPOUND || 
+                 aShape.ShapeType() == TopAbs_VERTEX) {
+          // it is compound with solo vertices.
+          Standard_Integer aNbVrtx = 0;
+          Standard_Integer curNb = 0;
+          TopExp_Explorer anExp (aShape, TopAbs_VERTEX);
+          for ( ; anExp.More(); anExp.Next() ) {
+            if ( anExp.Current().ShapeType() != TopAbs_VERTEX )
+              continue;
+            aNbVrtx++;
+          }
+          if ( aNbVrtx ) {
+            // create new geometric curve set for all vertices
+            Handle(StepShape_HArray1OfGeometricSetSelect) aGSS =
+              new StepShape_HArray1OfGeometricSetSelect(1,aNbVrtx);
+            Handle(TCollection_HAsciiString) empty = new TCollection_HAsciiString("");
+            Handle(StepShape_GeometricCurveSet) aGCSet =
+              new StepShape_GeometricCurveSet;
+            aGCSet->SetName(empty);
+            // iterates on compound with vertices and traces each vertex
+            for ( anExp.ReInit() ; anExp.More(); anExp.Next() ) {
+              const TopoDS_Shape& aVertex = anExp.Current();
+              if ( aVertex.ShapeType() != TopAbs_VERTEX )
+                continue;
+              curNb++;
+              transferVertex (FP, aGSS, aVertex, curNb, theLocalFactors);
+            } // end of iteration on compound with vertices.
+            aGCSet->SetElements(aGSS);
+            item = aGCSet;
+          } // end of check that number of vertices is not null
+        }
+        // PTV 22.08.2002 OCC609-------------------------  end  --------------------
+        break;
+      }
+    default: break;
+    }
+  return Standard_True;
+}
+
+
+//=======================================================================
+//function : itemModelType
+//purpose  : Returns the translation mode of an item of the representation
+//=======================================================================
+
+static STEPControl_StepModelType itemModelType (const STEPControl_StepModelType theMode,
+                                                const TopoDS_Shape& theShape)
+{
+  if (theMode != STEPControl_AsIs)
+    return theMode;
+  switch (theShape.ShapeType()) {
+    case TopAbs_SOLID : return STEPControl_ManifoldSolidBrep;
+    case TopAbs_SHELL : return STEPControl_ShellBasedSurfaceModel;
+    case TopAbs_FACE :  return STEPControl_ShellBasedSurfaceModel;
+    default : return STEPControl_GeometricCurveSet;
+  }
+}
+
+//=======================================================================
+//function : mergeFinderProcess
+//purpose  : Moves the bindings (results and checks) of a FinderProcess
+//           used to convert one item into the main one
+//=======================================================================
+
+static void mergeFinderProcess (const Handle(Transfer_FinderProcess)& theFP,
+                                const Handle(Transfer_FinderProcess)& theItemFP)
+{
+  for (Standard_Integer aMapIt = 1; aMapIt <= theItemFP->NbMapped(); ++aMapIt)
+  {
+    const Handle(Transfer_Binder)& anItemBinder = theItemFP->MapItem (aMapIt);
+    if (anItemBinder.IsNull())
+      continue;
+    const Handle(Transfer_Finder)& aMapper = theItemFP->Mapped (aMapIt);
+    Handle(Transfer_Binder) aBinder = theFP->Find (aMapper);
+    if (aBinder.IsNull())
+    {
+      theFP->Bind (aMapper, anItemBinder);
+      continue;
+    }
+    if (anItemBinder->HasResult())
+      aBinder->AddResult (anItemBinder);
+    aBinder->CCheck()->GetMessages (anItemBinder->Check());
+  }
+}
+
+namespace
+{
+  //! Item of a representation processed and converted in a parallel thread
+  struct STEPControl_ParallelItem
+  {
+    TopoDS_Shape Shape;                                     //!< item to convert
+    STEPControl_StepModelType Mode;
+    Message_ProgressRange Range;
+    Handle(Transfer_FinderProcess) FP;                      //!< bindings made for the item
+    Handle(Standard_Transient) Info;                        //!< shape processing info
+    Handle(StepGeom_GeometricRepresentationItem) Item, ItemTess;
+    Standard_Boolean IsDone;                                //!< False if shape cannot be written in the mode
+    Standard_Boolean IsAborted;
+
+    STEPControl_ParallelItem() : Mode (STEPControl_AsIs), IsDone (Standard_False), IsAborted (Standard_False) {}
+  };
+
+  //! Functor processing and converting one item of a representation
+  //! with its own FinderProcess
+  class STEPControl_ParallelItemTransfer
+  {
+  public:
+
+    STEPControl_ParallelItemTransfer (const Handle(Transfer_Finder)& theStart,
+                                      const Handle(Transfer_FinderProcess)& theFP,
+                                      const StepData_Factors& theLocalFactors,
+                                      const Standard_Real theTol,
+                                      NCollection_Array1<STEPControl_ParallelItem>& theItems)
+    : myStart (theStart), myFP (theFP), myFactors (theLocalFactors), myTol (theTol), myItems (theItems) {}
+
+    void operator() (int theThreadIndex, int theIndex) const
+    {
+      (void )theThreadIndex;
+      STEPControl_ParallelItem& anItem = myItems.ChangeValue (theIndex);
+      Message_ProgressScope aPS (anItem.Range, NULL, 2);
+      Handle(StepData_StepModel) aStepModel = Handle(StepData_StepModel)::DownCast (myFP->Model());
+      Handle(Transfer_FinderProcess) aFP = new Transfer_FinderProcess (100);
+      aFP->SetModel (aStepModel);
+
+      TopoDS_Shape aShape = anItem.Shape;
+      if (hasGeometry (aShape))
+      {
+        Standard_Real maxTol = aStepModel->InternalParameters.ReadMaxPrecisionVal;
+        aShape = XSAlgo::AlgoContainer()->ProcessShape (anItem.Shape, myTol, maxTol,
+                                                        "write.step.resource.name",
+                                                        "write.step.sequence", anItem.Info,
+                                                        aPS.Next());
+        if (aPS.UserBreak())
+        {
+          anItem.IsAborted = Standard_True;
+          return;
+        }
+      }
+      anItem.IsDone = makeRepresentationItem (myStart, aShape, anItem.Mode, aFP, myFactors, myTol,
+                                              anItem.Item, anItem.ItemTess, aPS.Next());
+      anItem.Shape = aShape;
+      anItem.FP = aFP;
+    }
+
+  private:
+    STEPControl_ParallelItemTransfer& operator= (const STEPControl_ParallelItemTransfer& );
+
+  private:
+    Handle(Transfer_Finder) myStart;
+    Handle(Transfer_FinderProcess) myFP;
+    StepData_Factors myFactors;
+    Standard_Real myTol;
+    NCollection_Array1<STEPControl_ParallelItem>& myItems;
+  };
+}
+
+//=======================================================================
+//function : prepareParallelItems
+//purpose  : Processes and converts the items of a manifold representation
+//           in parallel threads; leaves <theItems> empty if not worth
+//=======================================================================
+
+static void prepareParallelItems (const Handle(Transfer_Finder)& theStart,
+                                  const Handle(TopTools_HSequenceOfShape)& theRepItems,
+                                  const STEPControl_StepModelType theMode,
+                                  const Handle(Transfer_FinderProcess)& theFP,
+                                  const StepData_Factors& theLocalFactors,
+                                  const Standard_Real theTol,
+                                  Message_ProgressScope& thePS,
+                                  NCollection_Array1<STEPControl_ParallelItem>& theItems)
+{
+  const Standard_Integer aNbItems = theRepItems->Length();
+  const Handle(OSD_ThreadPool)& aPool = OSD_ThreadPool::DefaultPool();
+  const Standard_Integer aNbThreads = Min (aPool->NbDefaultThreadsToLaunch(), aNbItems);
+  if (aNbThreads < 2)
+    return;
+
+  theItems.Resize (1, aNbItems, Standard_False);
+  for (Standard_Integer anItemIt = 1; anItemIt <= aNbItems; ++anItemIt)
+  {
+    STEPControl_ParallelItem& anItem = theItems.ChangeValue (anItemIt);
+    anItem.Shape = theRepItems->Value (anItemIt);
+    anItem.Mode = itemModelType (theMode, anItem.Shape);
+    anItem.Range = thePS.Next();
+  }
+
+  STEPControl_ParallelItemTransfer aFunctor (theStart, theFP, theLocalFactors, theTol, theItems);
+  OSD_ThreadPool::Launcher aLauncher (*aPool, aNbThreads);
+  aLauncher.Perform (1, aNbItems + 1, aFunctor);
+}
+
 Handle(Transfer_Binder) STEPControl_ActorWrite::TransferShape
                    (const Handle(Transfer_Finder)& start,
                     const Handle(StepShape_ShapeDefinitionRepresentation)& SDR0,
@@ -973,17 +1340,18 @@ Handle(Transfer_Binder) STEPControl_ActorWrite::TransferShape
   ItemSeq->Append (myContext.GetDefaultAxis());
   STEPControl_StepModelType trmode = mymode;
   Message_ProgressScope aPS (aPSRoot.Next(), NULL, nbs);
+
+  // items of a manifold shape do not share STEP entities, so they can be
+  // processed and converted in parallel, each one with its own FinderProcess;
+  // results are then added in the order of items
+  NCollection_Array1<STEPControl_ParallelItem> aParallelItems;
+  if (isManifold && aStepModel->InternalParameters.WriteParallel)
+    prepareParallelItems (start, RepItemSeq, mymode, FP, theLocalFactors, Tol, aPS, aParallelItems);
+
   for (Standard_Integer i = 1; i <= nbs && aPS.More(); i++) {
     TopoDS_Shape xShape = RepItemSeq->Value(i);
+    trmode = itemModelType (mymode, xShape);
  
-    if(mymode == STEPControl_AsIs) {
-      switch(xShape.ShapeType()) {
-        case TopAbs_SOLID :  trmode = STEPControl_ManifoldSolidBrep;break;
-        case TopAbs_SHELL :  trmode = STEPControl_ShellBasedSurfaceModel; break;
-        case TopAbs_FACE : trmode = STEPControl_ShellBasedSurfaceModel;break;
-        default : trmode =STEPControl_GeometricCurveSet; break;
-      }
-    }
     //:abv 24Jan99 CAX-IF TRJ3: expanded Shape Processing
 //    TopoDS_Shape aShape = xShape;
     // eliminate conical surfaces with negative semiangles
@@ -995,221 +1363,48 @@ Handle(Transfer_Binder) STEPControl_ActorWrite::TransferShape
 //    BRepTools_Modifier DMT(aShape,DM);
 //    if ( DMT.IsDone() ) aShape = DMT.ModifiedShape ( aShape );
 ////    aShape = TopoDSToStep::DirectFaces(xShape);
-    Message_ProgressScope aPS1(aPS.Next(), NULL, 2);
-
     TopoDS_Shape aShape = xShape;
     Handle(Standard_Transient) info;
+    Handle(StepGeom_GeometricRepresentationItem) item, itemTess;
 
-    if (hasGeometry(aShape)) 
+    if (!aParallelItems.IsEmpty())
     {
-      Standard_Real maxTol = aStepModel->InternalParameters.ReadMaxPrecisionVal;
-
-      aShape = XSAlgo::AlgoContainer()->ProcessShape(xShape, Tol, maxTol,
-        "write.step.resource.name",
-        "write.step.sequence", info,
-        aPS1.Next());
-      if (aPS1.UserBreak())
+      const STEPControl_ParallelItem& aPrepared = aParallelItems.Value(i);
+      if (aPrepared.IsAborted)
         return Handle(Transfer_Binder)();
+      mergeFinderProcess(FP, aPrepared.FP);
+      if (!aPrepared.IsDone)
+        return binder;
+      aShape = aPrepared.Shape;
+      info = aPrepared.Info;
+      item = aPrepared.Item;
+      itemTess = aPrepared.ItemTess;
     }
-
-    if (!isManifold) 
+    else
     {
-      mergeInfoForNM(FP, info);
-    }
+      Message_ProgressScope aPS1(aPS.Next(), NULL, 2);
 
-    // create a STEP entity corresponding to shape
-    Handle(StepGeom_GeometricRepresentationItem) item, itemTess;
-    switch (trmode)
+      if (hasGeometry(aShape)) 
       {
-      case STEPControl_ManifoldSolidBrep:
-	{
-	  if (aShape.ShapeType() == TopAbs_SOLID) {
-	    TopoDS_Solid aSolid = TopoDS::Solid(aShape);
-
-	    //:d6 abv 13 Mar 98: if solid has more than 1 shell, 
-	    // try to treat it as solid with voids
-	    Standard_Integer nbShells = 0;
-	    for ( TopoDS_Iterator It ( aSolid ); It.More(); It.Next() ) 
-              if (It.Value().ShapeType() == TopAbs_SHELL) nbShells++;
-	    if ( nbShells >1 ) {
-	      TopoDSToStep_MakeBrepWithVoids MkBRepWithVoids(aSolid, FP, theLocalFactors, aPS1.Next());
-	      MkBRepWithVoids.Tolerance() = Tol;
-	      if (MkBRepWithVoids.IsDone()) 
-              {
-		item = MkBRepWithVoids.Value();
-                itemTess = MkBRepWithVoids.TessellatedValue();
-              }
-              else nbShells = 1; //smth went wrong; let it will be just Manifold
-	    }
-	    if ( nbShells ==1 ) {
-              TopoDSToStep_MakeManifoldSolidBrep MkManifoldSolidBrep(aSolid, FP, theLocalFactors, aPS1.Next());
-	      MkManifoldSolidBrep.Tolerance() = Tol;
-	      if (MkManifoldSolidBrep.IsDone()) 
-              {
-		item = MkManifoldSolidBrep.Value();
-                itemTess = MkManifoldSolidBrep.TessellatedValue();
-              }
-            }
-	  }
-	  else if (aShape.ShapeType() == TopAbs_SHELL) {
-	    TopoDS_Shell aShell = TopoDS::Shell(aShape);
-	    TopoDSToStep_MakeManifoldSolidBrep MkManifoldSolidBrep(aShell, FP, theLocalFactors, aPS1.Next());
-	    MkManifoldSolidBrep.Tolerance() = Tol;
-	    if (MkManifoldSolidBrep.IsDone()) 
-            {
-	      item = MkManifoldSolidBrep.Value();
-              itemTess = MkManifoldSolidBrep.TessellatedValue();
-            }
-          }
-	  break;
-	}
-      case STEPControl_BrepWithVoids:
-	{
-	  if (aShape.ShapeType() == TopAbs_SOLID) {
-	    TopoDS_Solid aSolid = TopoDS::Solid(aShape);
-	    TopoDSToStep_MakeBrepWithVoids MkBRepWithVoids(aSolid, FP, theLocalFactors, aPS1.Next());
-	    MkBRepWithVoids.Tolerance() = Tol;
-	    if (MkBRepWithVoids.IsDone()) 
-            {
-	      item = MkBRepWithVoids.Value();
-              itemTess = MkBRepWithVoids.TessellatedValue();
-	    }
-	  }
-	  break;
-	}
-      case STEPControl_FacetedBrep:
-	{
-	  TopoDSToStep_FacetedError facErr = TopoDSToStep_FacetedTool::CheckTopoDSShape(aShape);
-	  if (facErr != TopoDSToStep_FacetedDone) {
-	    FP->AddFail(start,"Error in Faceted Shape from TopoDS");
-	    if (facErr == TopoDSToStep_SurfaceNotPlane) {
-	      FP->AddFail(start,"-- The TopoDS_Face is not plane");
-	    }
-	    else if (facErr == TopoDSToStep_PCurveNotLinear) {
-	      FP->AddFail(start,"-- The Face contains non linear PCurves");
-	    }
-	    return binder;
-	  }
-	  if (aShape.ShapeType() == TopAbs_SOLID) {
-	    TopoDS_Solid aSolid = TopoDS::Solid(aShape);
-	    TopoDSToStep_MakeFacetedBrep MkFacetedBrep(aSolid, FP, theLocalFactors, aPS1.Next());
-	    MkFacetedBrep.Tolerance() = Tol;
-	    if (MkFacetedBrep.IsDone()) 
-            {
-	      item = MkFacetedBrep.Value();
-              itemTess = MkFacetedBrep.TessellatedValue();
-            }
-	  }
-	  break;
-	}
-      case STEPControl_FacetedBrepAndBrepWithVoids:
-	{
-	  TopoDSToStep_FacetedError facErr = TopoDSToStep_FacetedTool::CheckTopoDSShape(aShape);
-	  if (facErr != TopoDSToStep_FacetedDone) {
-	    FP->AddFail(start,"Error in Faceted Shape from TopoDS");
-	    if (facErr == TopoDSToStep_SurfaceNotPlane) {
-	      FP->AddFail(start,"-- The TopoDS_Face is not plane");
-	    }
-	    else if (facErr == TopoDSToStep_PCurveNotLinear) {
-	      FP->AddFail(start,"-- The Face contains non linear PCurves");
-	    }
-	    return binder;
-	  }
-	  if (aShape.ShapeType() == TopAbs_SOLID) {
-	    TopoDS_Solid aSolid = TopoDS::Solid(aShape);
-	    TopoDSToStep_MakeFacetedBrepAndBrepWithVoids 
-	      MkFacetedBrepAndBrepWithVoids(aSolid, FP, theLocalFactors, aPS1.Next());
-	    MkFacetedBrepAndBrepWithVoids.Tolerance() = Tol;
-	    if (MkFacetedBrepAndBrepWithVoids.IsDone()) 
-            {
-	      item = MkFacetedBrepAndBrepWithVoids.Value();
-              itemTess = MkFacetedBrepAndBrepWithVoids.TessellatedValue();
-            }
-	  }
-	  break;
-	}
-      case STEPControl_ShellBasedSurfaceModel:
-	{
-	  if (aShape.ShapeType() == TopAbs_SOLID) {
-	    TopoDS_Solid aSolid = TopoDS::Solid(aShape);
-	    TopoDSToStep_MakeShellBasedSurfaceModel
-	      MkShellBasedSurfaceModel(aSolid, FP, theLocalFactors, aPS1.Next());
-	    MkShellBasedSurfaceModel.Tolerance() = Tol;
-	    if (MkShellBasedSurfaceModel.IsDone()) 
-            {
-	      item = MkShellBasedSurfaceModel.Value();
-              itemTess = MkShellBasedSurfaceModel.TessellatedValue();
-           }
-	  }
-	  else if (aShape.ShapeType() == TopAbs_SHELL) {
-            TopoDS_Shell aShell = TopoDS::Shell(aShape);
-            // Non-manifold topology is stored via NMSSR containing series of SBSM (ssv; 13.11.2010)
-            TopoDSToStep_MakeShellBasedSurfaceModel MkShellBasedSurfaceModel(aShell, FP, theLocalFactors, aPS1.Next());
-            MkShellBasedSurfaceModel.Tolerance() = Tol;
-            if (MkShellBasedSurfaceModel.IsDone()) 
-            {
-              item = MkShellBasedSurfaceModel.Value();
-              itemTess = MkShellBasedSurfaceModel.TessellatedValue();
-            }
-	  }
-	  else if (aShape.ShapeType() == TopAbs_FACE) {
-	    TopoDS_Face aFace = TopoDS::Face(aShape);
-            TopoDSToStep_MakeShellBasedSurfaceModel
-	      MkShellBasedSurfaceModel(aFace, FP, theLocalFactors, aPS1.Next());
-	    MkShellBasedSurfaceModel.Tolerance() = Tol;
-	    if (MkShellBasedSurfaceModel.IsDone()) 
-            {
-	      item = MkShellBasedSurfaceModel.Value();
-              itemTess = MkShellBasedSurfaceModel.TessellatedValue();
-            }
-          }
-	  break;
-	}
-      case STEPControl_GeometricCurveSet:
-	{
-	  TopoDSToStep_MakeGeometricCurveSet MkGeometricCurveSet(aShape, FP, theLocalFactors);
-	  MkGeometricCurveSet.Tolerance() = Tol;
-	  if (MkGeometricCurveSet.IsDone()) {
-	    item = MkGeometricCurveSet.Value();
-	  }
-          // PTV 22.08.2002 OCC609 ------------------------- begin --------------------
-          // modified by PTV 16.09.2002 OCC725
-          else if (aShape.ShapeType() == TopAbs_COMPOUND || 
-                   aShape.ShapeType() == TopAbs_VERTEX) {
-            // it is compound with solo vertices.
-            Standard_Integer aNbVrtx = 0;
-            Standard_Integer curNb = 0;
-            TopExp_Explorer anExp (aShape, TopAbs_VERTEX);
-            for ( ; anExp.More(); anExp.Next() ) {
-              if ( anExp.Current().ShapeType() != TopAbs_VERTEX )
-                continue;
-              aNbVrtx++;
-            }
-            if ( aNbVrtx ) {
-              // create new geometric curve set for all vertices
-              Handle(StepShape_HArray1OfGeometricSetSelect) aGSS =
-                new StepShape_HArray1OfGeometricSetSelect(1,aNbVrtx);
-              Handle(TCollection_HAsciiString) empty = new TCollection_HAsciiString("");
-              Handle(StepShape_GeometricCurveSet) aGCSet =
-                new StepShape_GeometricCurveSet;
-              aGCSet->SetName(empty);
-              // iterates on compound with vertices and traces each vertex
-              for ( anExp.ReInit() ; anExp.More(); anExp.Next() ) {
-                const TopoDS_Shape& aVertex = anExp.Current();
-                if ( aVertex.ShapeType() != TopAbs_VERTEX )
-                  continue;
-                curNb++;
-                transferVertex (FP, aGSS, aVertex, curNb, theLocalFactors);
-              } // end of iteration on compound with vertices.
-              aGCSet->SetElements(aGSS);
-              item = aGCSet;
-            } // end of check that number of vertices is not null
-          }
-          // PTV 22.08.2002 OCC609-------------------------  end  --------------------
-	  break;
-	}
-      default: break;
+        Standard_Real maxTol = aStepModel->InternalParameters.ReadMaxPrecisionVal;
+
+        aShape = XSAlgo::AlgoContainer()->ProcessShape(xShape, Tol, maxTol,
+          "write.step.resource.name",
+          "write.step.sequence", info,
+          aPS1.Next());
+        if (aPS1.UserBreak())
+          return Handle(Transfer_Binder)();
       }
+
+      if (!isManifold) 
+      {
+        mergeInfoForNM(FP, info);
+      }
+
+      // create a STEP entity corresponding to shape
+      if (!makeRepresentationItem(start, aShape, trmode, FP, theLocalFactors, Tol, item, itemTess, aPS1.Next()))
+        return binder;
+    }
     if ( item.IsNull() && itemTess.IsNull() ) continue;
 
     // add resulting item to the FP
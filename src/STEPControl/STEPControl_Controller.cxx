@@ -272,6 +272,34 @@ STEPControl_Controller::STEPControl_Controller ()
     Interface_Static::Init("step", "read.step.root.transformation", '&', "eval ON");
     Interface_Static::SetCVal("read.step.root.transformation", "ON");
 
+    // Mode to read file records into entities and to translate solid models in parallel
+    Interface_Static::Init("step", "read.step.parallel", 'e', "");
+    Interface_Static::Init("step", "read.step.parallel", '&', "enum 0");
+    Interface_Static::Init("step", "read.step.parallel", '&', "eval OFF");
+    Interface_Static::Init("step", "read.step.parallel", '&', "eval ON");
+    Interface_Static::SetCVal("read.step.parallel", "OFF");
+
+    // Mode to parse the file by the hand-written lexer on the file mapped into memory
+    Interface_Static::Init("step", "read.step.fast_lexer", 'e', "");
+    Interface_Static::Init("step", "read.step.fast_lexer", '&', "enum 0");
+    Interface_Static::Init("step", "read.step.fast_lexer", '&', "eval OFF");
+    Interface_Static::Init("step", "read.step.fast_lexer", '&', "eval ON");
+    Interface_Static::SetCVal("read.step.fast_lexer", "OFF");
+
+    // Mode to read the contents of entities on demand, at their first access
+    Interface_Static::Init("step", "read.step.lazy", 'e', "");
+    Interface_Static::Init("step", "read.step.lazy", '&', "enum 0");
+    Interface_Static::Init("step", "read.step.lazy", '&', "eval OFF");
+    Interface_Static::Init("step", "read.step.lazy", '&', "eval ON");
+    Interface_Static::SetCVal("read.step.lazy", "OFF");
+
+    // Mode to translate the sub-shapes of a manifold shape into STEP entities in parallel
+    Interface_Static::Init("step", "write.step.parallel", 'e', "");
+    Interface_Static::Init("step", "write.step.parallel", '&', "enum 0");
+    Interface_Static::Init("step", "write.step.parallel", '&', "eval OFF");
+    Interface_Static::Init("step", "write.step.parallel", '&', "eval ON");
+    Interface_Static::SetCVal("write.step.parallel", "OFF");
+
     // STEP file encoding for names translation
     // Note: the numbers should be consistent with Resource_FormatType enumeration
     Interface_Static::Init("step", "read.step.codepage", 'e', "");
@@ -199,6 +199,7 @@ IFSelect_ReturnStatus STEPControl_Writer::WriteStream (std::ostream& theOStream)
   }
 
   StepData_StepWriter aWriter (aModel);
+  aWriter.SetStream (&theOStream);
   aWriter.SendModel (aProtocol);
   return aWriter.Print (theOStream)
        ? IFSelect_RetDone
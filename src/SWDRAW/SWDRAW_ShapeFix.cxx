@@ -418,6 +418,11 @@ static Standard_Integer fixshape (Draw_Interpretor& di, Standard_Integer argc, c
       }
       continue;
     }
+    else if (!strcmp(argv[i], "-parallel"))
+    {
+      sfs->SetRunParallel (Standard_True);
+      continue;
+    }
     else if (!strcmp(argv[i], "-maxtaila"))
     {
       if (++i >= argc)
@@ -455,7 +460,7 @@ static Standard_Integer fixshape (Draw_Interpretor& di, Standard_Integer argc, c
 
   if ( par <2 ) {
     di << "Use: " << argv[0] << " result shape [tolerance [max_tolerance]] [switches]\n"
-      "[-maxtaila <degrees>] [-maxtailw <width>]\n";
+      "[-maxtaila <degrees>] [-maxtailw <width>] [-parallel]\n";
     di << "Switches allow to tune parameters of ShapeFix\n"; 
     di << "The following syntax is used: <symbol><parameter>\n"; 
     di << "- symbol may be - to set parameter off, + to set on or * to set default\n"; 
@@ -469,6 +474,7 @@ static Standard_Integer fixshape (Draw_Interpretor& di, Standard_Integer argc, c
     di << "  i - FixSelfIntersectionMode\n"; 
     di << "  n - FixNotchedEdgesMode\n"; 
     di << "For enhanced message output, use switch '+?'\n"; 
+    di << "Use -parallel to fix independent sub-shapes of compounds in parallel threads\n";
     return 1;
   }
 
@@ -845,7 +851,7 @@ static Standard_Integer connectedges(Draw_Interpretor& di, Standard_Integer n, c
 		   __FILE__,reface,g);
   theCommands.Add ("fixshape",
 "res shape [preci [maxpreci]] [{switches}]\n"
-"  [-maxtaila <degrees>] [-maxtailw <width>]",
+"  [-maxtaila <degrees>] [-maxtailw <width>] [-parallel]",
 		   __FILE__,fixshape,g);
 //  theCommands.Add ("testfill","result edge1 edge2",
 //		   __FILE__,XSHAPE_testfill,g);
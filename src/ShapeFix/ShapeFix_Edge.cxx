@@ -871,3 +871,16 @@ void ShapeFix_Edge::SetContext (const Handle(ShapeBuild_ReShape)& context)
 {
   myContext = context;
 }
+
+//=======================================================================
+//function : Copy
+//purpose  : 
+//=======================================================================
+
+Handle(ShapeFix_Edge) ShapeFix_Edge::Copy() const
+{
+  Handle(ShapeFix_Edge) aCopy = new ShapeFix_Edge (*this);
+  if (!myProjector.IsNull())
+    aCopy->myProjector = new ShapeConstruct_ProjectCurveOnSurface (*myProjector);
+  return aCopy;
+}
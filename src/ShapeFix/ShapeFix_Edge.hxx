@@ -223,6 +223,10 @@ public:
   //! Returns context
   Standard_EXPORT Handle(ShapeBuild_ReShape) Context() const;
 
+  //! Returns the copy of this tool having its own projector,
+  //! so that the copy can be used in another thread.
+  Standard_EXPORT Handle(ShapeFix_Edge) Copy() const;
+
   DEFINE_STANDARD_RTTIEXT(ShapeFix_Edge,Standard_Transient)
 
 protected:
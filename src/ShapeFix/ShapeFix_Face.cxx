@@ -2786,3 +2786,16 @@ Standard_Boolean ShapeFix_Face::FixPeriodicDegenerated()
 
   return Standard_True;
 }
+
+//=======================================================================
+//function : Copy
+//purpose  : 
+//=======================================================================
+
+Handle(ShapeFix_Face) ShapeFix_Face::Copy() const
+{
+  Handle(ShapeFix_Face) aCopy = new ShapeFix_Face (*this);
+  if (!myFixWire.IsNull())
+    aCopy->myFixWire = myFixWire->Copy();
+  return aCopy;
+}
@@ -246,6 +246,10 @@ public:
 
 
 
+  //! Returns the copy of this tool having its own copy of the wire
+  //! fixing tool, so that the copy can be used in another thread.
+  Standard_EXPORT Handle(ShapeFix_Face) Copy() const;
+
   DEFINE_STANDARD_RTTIEXT(ShapeFix_Face,ShapeFix_Root)
 
 protected:
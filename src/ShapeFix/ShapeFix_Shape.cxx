@@ -16,8 +16,14 @@
 
 
 #include <BRep_Builder.hxx>
+#include <Message_Msg.hxx>
 #include <Message_ProgressScope.hxx>
+#include <NCollection_Array1.hxx>
+#include <NCollection_DataMap.hxx>
+#include <NCollection_List.hxx>
+#include <OSD_ThreadPool.hxx>
 #include <ShapeBuild_ReShape.hxx>
+#include <ShapeExtend_BasicMsgRegistrator.hxx>
 #include <ShapeFix.hxx>
 #include <ShapeFix_Edge.hxx>
 #include <ShapeFix_Shape.hxx>
@@ -25,8 +31,10 @@
 #include <ShapeFix_Solid.hxx>
 #include <ShapeFix_Wire.hxx>
 #include <Standard_Type.hxx>
+#include <TColStd_SequenceOfInteger.hxx>
 #include <TopAbs_ShapeEnum.hxx>
 #include <TopExp_Explorer.hxx>
+#include <TopTools_ShapeMapHasher.hxx>
 #include <TopoDS.hxx>
 #include <TopoDS_Face.hxx>
 #include <TopoDS_Iterator.hxx>
@@ -49,6 +57,7 @@ ShapeFix_Shape::ShapeFix_Shape()
   myFixSameParameterMode = -1;
   myFixVertexPositionMode =0;
   myFixVertexTolMode = -1;
+  myRunParallel = Standard_False;
   myFixSolid = new ShapeFix_Solid;
 }
 
@@ -68,6 +77,7 @@ ShapeFix_Shape::ShapeFix_Shape(const TopoDS_Shape& shape)
   myFixSolid = new ShapeFix_Solid;
   myFixVertexPositionMode =0;
   myFixVertexTolMode = -1;
+  myRunParallel = Standard_False;
   Init(shape);
 }
 
@@ -146,11 +156,14 @@ Standard_Boolean ShapeFix_Shape::Perform(const Message_ProgressRange& theProgres
 
     // Open progress indication scope for sub-shape fixing
     Message_ProgressScope aPSSubShape(aPS.Next(), "Fixing sub-shape", aShapesNb);
-    for ( TopoDS_Iterator anIter(S); anIter.More() && aPSSubShape.More(); anIter.Next())
+    if (!myRunParallel || !performParallel (S, aPSSubShape, status))
     {
-      myShape = anIter.Value();
-      if (Perform (aPSSubShape.Next()))
-        status = Standard_True;
+      for ( TopoDS_Iterator anIter(S); anIter.More() && aPSSubShape.More(); anIter.Next())
+      {
+        myShape = anIter.Value();
+        if (Perform (aPSSubShape.Next()))
+          status = Standard_True;
+      }
     }
     if ( !aPSSubShape.More() )
       return Standard_False; // aborted execution
@@ -273,6 +286,244 @@ Standard_Boolean ShapeFix_Shape::Perform(const Message_ProgressRange& theProgres
   return status;
 }  
 
+namespace
+{
+  //! Message registrator keeping messages in the order of sending
+  //! to pass them later to another registrator.
+  class ShapeFix_MsgRecorder : public ShapeExtend_BasicMsgRegistrator
+  {
+  public:
+
+    virtual void Send (const Handle(Standard_Transient)& theObject,
+                       const Message_Msg& theMessage,
+                       const Message_Gravity theGravity) Standard_OVERRIDE
+    {
+      myRecords.Append (Record (theObject, TopoDS_Shape(), theMessage, theGravity));
+    }
+
+    virtual void Send (const TopoDS_Shape& theShape,
+                       const Message_Msg& theMessage,
+                       const Message_Gravity theGravity) Standard_OVERRIDE
+    {
+      myRecords.Append (Record (Handle(Standard_Transient)(), theShape, theMessage, theGravity));
+    }
+
+    //! Sends recorded messages to another registrator.
+    void Replay (const Handle(ShapeExtend_BasicMsgRegistrator)& theMsgReg) const
+    {
+      for (NCollection_List<Record>::Iterator anIter (myRecords); anIter.More(); anIter.Next())
+      {
+        const Record& aRecord = anIter.Value();
+        if (!aRecord.Object.IsNull())
+          theMsgReg->Send (aRecord.Object, aRecord.Message, aRecord.Gravity);
+        else
+          theMsgReg->Send (aRecord.Shape, aRecord.Message, aRecord.Gravity);
+      }
+    }
+
+  private:
+    struct Record
+    {
+      Record (const Handle(Standard_Transient)& theObject,
+              const TopoDS_Shape& theShape,
+              const Message_Msg& theMessage,
+              const Message_Gravity theGravity)
+      : Object (theObject), Shape (theShape), Message (theMessage), Gravity (theGravity) {}
+
+      Handle(Standard_Transient) Object;
+      TopoDS_Shape               Shape;
+      Message_Msg                Message;
+      Message_Gravity            Gravity;
+    };
+    NCollection_List<Record> myRecords;
+  };
+
+  //! Auxiliary functor fixing groups of independent shapes,
+  //! each thread using its own fixer.
+  class ShapeFix_GroupFunctor
+  {
+  public:
+    ShapeFix_GroupFunctor (const NCollection_Array1<TopoDS_Shape>& theShapes,
+                           const NCollection_Array1<TColStd_SequenceOfInteger>& theGroups,
+                           const NCollection_Array1<Message_ProgressRange>& theRanges,
+                           const NCollection_Array1<Handle(ShapeFix_Shape)>& theFixers,
+                           const NCollection_Array1<Handle(ShapeFix_MsgRecorder)>& theRecorders,
+                           NCollection_Array1<Standard_Boolean>& theIsDone,
+                           NCollection_Array1<Standard_Integer>& theStatuses)
+    : myShapes (theShapes), myGroups (theGroups), myRanges (theRanges), myFixers (theFixers),
+      myRecorders (theRecorders), myIsDone (theIsDone), myStatuses (theStatuses) {}
+
+    void operator() (int theThreadIndex, int theGroupIndex) const
+    {
+      const Handle(ShapeFix_Shape)& aFixer = myFixers.Value (theThreadIndex);
+      if (!myRecorders.IsEmpty())
+        aFixer->SetMsgRegistrator (myRecorders.Value (theGroupIndex));
+      for (TColStd_SequenceOfInteger::Iterator anIter (myGroups.Value (theGroupIndex)); anIter.More(); anIter.Next())
+      {
+        const Standard_Integer anIndex = anIter.Value();
+        const Message_ProgressRange& aRange = myRanges.Value (anIndex);
+        if (aRange.UserBreak())
+          return;
+        aFixer->Init (myShapes.Value (anIndex));
+        if (aFixer->Perform (aRange))
+          myIsDone.ChangeValue (anIndex) = Standard_True;
+        // status is reset by each Perform, so keep it for each shape
+        Standard_Integer& aStatus = myStatuses.ChangeValue (anIndex);
+        for (Standard_Integer aStat = ShapeExtend_DONE1; aStat <= ShapeExtend_DONE8; ++aStat)
+        {
+          if (aFixer->Status ((ShapeExtend_Status )aStat))
+            aStatus |= ShapeExtend::EncodeStatus ((ShapeExtend_Status )aStat);
+        }
+        for (Standard_Integer aStat = ShapeExtend_FAIL1; aStat <= ShapeExtend_FAIL8; ++aStat)
+        {
+          if (aFixer->Status ((ShapeExtend_Status )aStat))
+            aStatus |= ShapeExtend::EncodeStatus ((ShapeExtend_Status )aStat);
+        }
+      }
+    }
+
+  private:
+    const NCollection_Array1<TopoDS_Shape>&                     myShapes;
+    const NCollection_Array1<TColStd_SequenceOfInteger>&        myGroups;
+    const NCollection_Array1<Message_ProgressRange>&            myRanges;
+    const NCollection_Array1<Handle(ShapeFix_Shape)>&           myFixers;
+    const NCollection_Array1<Handle(ShapeFix_MsgRecorder)>&     myRecorders;
+    NCollection_Array1<Standard_Boolean>&                       myIsDone;
+    NCollection_Array1<Standard_Integer>&                       myStatuses;
+  };
+}
+
+//=======================================================================
+//function : performParallel
+//purpose  : 
+//=======================================================================
+
+Standard_Boolean ShapeFix_Shape::performParallel (const TopoDS_Shape& theCompound,
+                                                  Message_ProgressScope& theScope,
+                                                  Standard_Boolean& theIsDone)
+{
+  const Standard_Integer aNbShapes = theCompound.NbChildren();
+  if (aNbShapes < 2)
+    return Standard_False;
+
+  // Split sub-shapes into groups connected by common vertices,
+  // taking into account shared shapes with different locations
+  NCollection_Array1<TopoDS_Shape> aShapes (1, aNbShapes);
+  NCollection_Array1<Standard_Integer> aRoots (1, aNbShapes);
+  NCollection_DataMap<TopoDS_Shape, Standard_Integer, TopTools_ShapeMapHasher> aVertexShape;
+  Standard_Integer anIndex = 1;
+  for (TopoDS_Iterator anIter (theCompound); anIter.More(); anIter.Next(), ++anIndex)
+  {
+    aShapes.SetValue (anIndex, anIter.Value());
+    aRoots.SetValue (anIndex, anIndex);
+    TopoDS_Shape aShapeNullLoc = anIter.Value();
+    aShapeNullLoc.Location (TopLoc_Location(), Standard_False);
+    for (TopExp_Explorer anExp (aShapeNullLoc, TopAbs_VERTEX); anExp.More(); anExp.Next())
+    {
+      TopoDS_Shape aVertex = anExp.Current();
+      aVertex.Location (TopLoc_Location(), Standard_False);
+      const Standard_Integer* anOther = aVertexShape.Seek (aVertex);
+      if (anOther == NULL)
+      {
+        aVertexShape.Bind (aVertex, anIndex);
+        continue;
+      }
+      // join groups keeping the smallest index as root
+      Standard_Integer aRoot1 = anIndex, aRoot2 = *anOther;
+      while (aRoots (aRoot1) != aRoot1) aRoot1 = aRoots (aRoot1);
+      while (aRoots (aRoot2) != aRoot2) aRoot2 = aRoots (aRoot2);
+      if (aRoot1 != aRoot2)
+        aRoots.ChangeValue (Max (aRoot1, aRoot2)) = Min (aRoot1, aRoot2);
+    }
+  }
+  NCollection_Array1<Standard_Integer> aGroupIndices (1, aNbShapes);
+  Standard_Integer aNbGroups = 0;
+  for (anIndex = 1; anIndex <= aNbShapes; ++anIndex)
+  {
+    Standard_Integer aRoot = anIndex;
+    while (aRoots (aRoot) != aRoot) aRoot = aRoots (aRoot);
+    aGroupIndices.SetValue (anIndex, aRoot == anIndex ? aNbGroups++ : aGroupIndices (aRoot));
+  }
+  if (aNbGroups < 2)
+    return Standard_False;
+
+  NCollection_Array1<TColStd_SequenceOfInteger> aGroups (0, aNbGroups - 1);
+  for (anIndex = 1; anIndex <= aNbShapes; ++anIndex)
+    aGroups.ChangeValue (aGroupIndices (anIndex)).Append (anIndex);
+
+  // Progress ranges are taken in the order of sub-shapes as in the sequential loop
+  NCollection_Array1<Message_ProgressRange> aRanges (1, aNbShapes);
+  for (anIndex = 1; anIndex <= aNbShapes; ++anIndex)
+    aRanges.ChangeValue (anIndex) = theScope.Next();
+
+  // Prepare fixer for each thread with its own context
+  const Handle(OSD_ThreadPool)& aThreadPool = OSD_ThreadPool::DefaultPool();
+  OSD_ThreadPool::Launcher aLauncher (*aThreadPool, aNbGroups);
+  NCollection_Array1<Handle(ShapeFix_Shape)> aFixers (aLauncher.LowerThreadIndex(), aLauncher.UpperThreadIndex());
+  for (Standard_Integer aThreadIndex = aFixers.Lower(); aThreadIndex <= aFixers.Upper(); ++aThreadIndex)
+  {
+    Handle(ShapeBuild_ReShape) aContext = new ShapeBuild_ReShape;
+    aContext->ModeConsiderLocation() = Context()->ModeConsiderLocation();
+    aContext->Append (*Context());
+    Handle(ShapeFix_Shape) aFixer = Copy();
+    aFixer->SetContext (aContext);
+    aFixer->myFixSameParameterMode = Standard_False;
+    aFixer->myFixVertexTolMode = Standard_False;
+    aFixer->myRunParallel = Standard_False;
+    aFixers.SetValue (aThreadIndex, aFixer);
+  }
+  // Messages are recorded for each group to keep their order
+  NCollection_Array1<Handle(ShapeFix_MsgRecorder)> aRecorders;
+  if (!MsgRegistrator().IsNull())
+  {
+    aRecorders.Resize (0, aNbGroups - 1, Standard_False);
+    for (Standard_Integer aGroupIndex = 0; aGroupIndex < aNbGroups; ++aGroupIndex)
+      aRecorders.SetValue (aGroupIndex, new ShapeFix_MsgRecorder());
+  }
+  NCollection_Array1<Standard_Boolean> anIsDone (1, aNbShapes);
+  NCollection_Array1<Standard_Integer> aStatuses (1, aNbShapes);
+  anIsDone.Init (Standard_False);
+  aStatuses.Init (ShapeExtend::EncodeStatus (ShapeExtend_OK));
+  aLauncher.Perform (0, aNbGroups, ShapeFix_GroupFunctor (aShapes, aGroups, aRanges, aFixers,
+                                                          aRecorders, anIsDone, aStatuses));
+  if (!theScope.More())
+    return Standard_True; // aborted execution
+
+  // Merge results
+  for (Standard_Integer aThreadIndex = aFixers.Lower(); aThreadIndex <= aFixers.Upper(); ++aThreadIndex)
+  {
+    const Handle(ShapeFix_Shape)& aFixer = aFixers (aThreadIndex);
+    Context()->Append (*aFixer->Context());
+    for (TopTools_MapOfShape::Iterator anIter (aFixer->myMapFixingShape); anIter.More(); anIter.Next())
+      myMapFixingShape.Add (anIter.Key());
+  }
+  if (!aRecorders.IsEmpty())
+  {
+    for (Standard_Integer aGroupIndex = 0; aGroupIndex < aNbGroups; ++aGroupIndex)
+      aRecorders (aGroupIndex)->Replay (MsgRegistrator());
+  }
+  for (anIndex = 1; anIndex <= aNbShapes; ++anIndex)
+  {
+    if (anIsDone (anIndex))
+      theIsDone = Standard_True;
+  }
+  // as in the sequential loop, the status is the one of the last sub-shape
+  myStatus = aStatuses (aNbShapes);
+  return Standard_True;
+}
+
+//=======================================================================
+//function : Copy
+//purpose  : 
+//=======================================================================
+
+Handle(ShapeFix_Shape) ShapeFix_Shape::Copy() const
+{
+  Handle(ShapeFix_Shape) aFixer = new ShapeFix_Shape (*this);
+  aFixer->myFixSolid = myFixSolid->Copy();
+  return aFixer;
+}
+
 //=======================================================================
 //function : SameParameter
 //purpose  : 
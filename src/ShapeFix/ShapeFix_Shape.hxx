@@ -33,6 +33,7 @@ class ShapeFix_Face;
 class ShapeFix_Wire;
 class ShapeFix_Edge;
 class ShapeExtend_BasicMsgRegistrator;
+class Message_ProgressScope;
 
 // resolve name collisions with X11 headers
 #ifdef Status
@@ -129,6 +130,22 @@ public:
   //! after performing all fixes
     Standard_Integer& FixVertexTolMode();
 
+  //! Sets mode for fixing independent sub-shapes of compounds in parallel threads.
+  //! Sub-shapes having no common vertices (e.g. solids of an assembly or free faces)
+  //! are fixed concurrently, each thread using its own copies of fix tools,
+  //! reshape context and message registrator. The contexts and messages
+  //! are merged in the order of sub-shapes, so that the result does not
+  //! depend on the number of threads. Default is False.
+    void SetRunParallel (const Standard_Boolean theIsParallel);
+
+  //! Returns mode for fixing in parallel threads.
+    Standard_Boolean RunParallel() const;
+
+  //! Returns the copy of this fixer having its own copies of all fix tools,
+  //! so that the copy can be used in another thread.
+  //! The context and the message registrator are shared with this fixer.
+  Standard_EXPORT Handle(ShapeFix_Shape) Copy() const;
+
 
 
 
@@ -154,10 +171,18 @@ protected:
   Standard_Integer myFixVertexPositionMode;
   Standard_Integer myFixVertexTolMode;
   Standard_Integer myStatus;
+  Standard_Boolean myRunParallel;
 
 
 private:
 
+  //! Fixes sub-shapes of the compound split into the groups
+  //! of independent sub-shapes in parallel threads.
+  //! Returns False if there are less than two such groups.
+  Standard_Boolean performParallel (const TopoDS_Shape& theCompound,
+                                    Message_ProgressScope& theScope,
+                                    Standard_Boolean& theIsDone);
+
 
 
 
@@ -1112,3 +1112,16 @@ void ShapeFix_Shell::SetNonManifoldFlag(const Standard_Boolean isNonManifold)
 {
     myNonManifold = isNonManifold;
 }
+
+//=======================================================================
+//function : Copy
+//purpose  : 
+//=======================================================================
+
+Handle(ShapeFix_Shell) ShapeFix_Shell::Copy() const
+{
+  Handle(ShapeFix_Shell) aCopy = new ShapeFix_Shell (*this);
+  if (!myFixFace.IsNull())
+    aCopy->myFixFace = myFixFace->Copy();
+  return aCopy;
+}
@@ -121,6 +121,10 @@ public:
   Standard_EXPORT virtual void SetNonManifoldFlag(const Standard_Boolean isNonManifold);
 
 
+  //! Returns the copy of this tool having its own copy of the face
+  //! fixing tool, so that the copy can be used in another thread.
+  Standard_EXPORT Handle(ShapeFix_Shell) Copy() const;
+
   DEFINE_STANDARD_RTTIEXT(ShapeFix_Shell,ShapeFix_Root)
 
 protected:
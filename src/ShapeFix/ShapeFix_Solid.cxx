@@ -638,3 +638,16 @@ void ShapeFix_Solid::SetMaxTolerance (const Standard_Real maxtol)
   ShapeFix_Root::SetMaxTolerance ( maxtol );
   myFixShell->SetMaxTolerance ( maxtol );
 }
+
+//=======================================================================
+//function : Copy
+//purpose  : 
+//=======================================================================
+
+Handle(ShapeFix_Solid) ShapeFix_Solid::Copy() const
+{
+  Handle(ShapeFix_Solid) aCopy = new ShapeFix_Solid (*this);
+  if (!myFixShell.IsNull())
+    aCopy->myFixShell = myFixShell->Copy();
+  return aCopy;
+}
@@ -115,6 +115,10 @@ public:
   //! else returns one solid.
   Standard_EXPORT TopoDS_Shape Shape();
 
+  //! Returns the copy of this tool having its own copy of the shell
+  //! fixing tool, so that the copy can be used in another thread.
+  Standard_EXPORT Handle(ShapeFix_Solid) Copy() const;
+
   DEFINE_STANDARD_RTTIEXT(ShapeFix_Solid,ShapeFix_Root)
 
 protected:
@@ -3639,3 +3639,18 @@ Standard_Boolean ShapeFix_Wire::FixTails()
   myStatusNotches = myLastFixStatus;
   return ShapeExtend::DecodeStatus(myLastFixStatus, ShapeExtend_DONE);
 }
+
+//=======================================================================
+//function : Copy
+//purpose  : 
+//=======================================================================
+
+Handle(ShapeFix_Wire) ShapeFix_Wire::Copy() const
+{
+  Handle(ShapeFix_Wire) aCopy = new ShapeFix_Wire (*this);
+  aCopy->myAnalyzer = new ShapeAnalysis_Wire;
+  aCopy->myAnalyzer->SetPrecision (myAnalyzer->Precision());
+  if (!myFixEdge.IsNull())
+    aCopy->myFixEdge = myFixEdge->Copy();
+  return aCopy;
+}
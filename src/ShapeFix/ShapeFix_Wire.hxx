@@ -452,6 +452,10 @@ public:
 
 
 
+  //! Returns the copy of this tool having its own analyzer and
+  //! edge fixing tool, so that the copy can be used in another thread.
+  Standard_EXPORT Handle(ShapeFix_Wire) Copy() const;
+
   DEFINE_STANDARD_RTTIEXT(ShapeFix_Wire,ShapeFix_Root)
 
 protected:
@@ -722,6 +722,7 @@ static Standard_Boolean fixshape (const Handle(ShapeProcess_Context)& context,
   sfs->FixSolidMode()         = ctx->IntegerVal ( "FixSolidMode", -1 );
   sfs->FixVertexPositionMode() = ctx->IntegerVal ( "FixVertexPositionMode", 0 );
   sfs->FixVertexTolMode()      = ctx->IntegerVal ( "FixVertexToleranceMode", -1 );
+  sfs->SetRunParallel ( ctx->BooleanVal ( "RunParallel", Standard_False ) );
 
   sfs->FixSolidTool()->FixShellMode() = ctx->IntegerVal ( "FixShellMode", -1 );
   sfs->FixSolidTool()->FixShellOrientationMode() = ctx->IntegerVal ( "FixShellOrientationMode", -1 );
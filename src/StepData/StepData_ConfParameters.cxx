@@ -59,6 +59,9 @@ void StepData_ConfParameters::InitFromStatic()
   ReadLayer = Interface_Static::IVal("read.layer") == 1;
   ReadProps = Interface_Static::IVal("read.props") == 1;
   ReadMetadata = Interface_Static::IVal("read.metadata") == 1;
+  ReadParallel = Interface_Static::IVal("read.step.parallel") == 1;
+  ReadFastLexer = Interface_Static::IVal("read.step.fast_lexer") == 1;
+  ReadLazy = Interface_Static::IVal("read.step.lazy") == 1;
 
   WritePrecisionMode = (StepData_ConfParameters::WriteMode_PrecisionMode)Interface_Static::IVal("write.precision.mode");
   WritePrecisionVal = Interface_Static::RVal("write.precision.val");
@@ -78,6 +81,7 @@ void StepData_ConfParameters::InitFromStatic()
   WriteLayer = Interface_Static::IVal("write.layer") == 1;
   WriteProps = Interface_Static::IVal("write.props") == 1;
   WriteModelType = (STEPControl_StepModelType)Interface_Static::IVal("write.model.type");
+  WriteParallel = Interface_Static::IVal("write.step.parallel") == 1;
 }
 
 //=======================================================================
@@ -167,6 +167,9 @@ public:
   bool ReadLayer = true; //<! LayerMode is used to indicate read Layers or not
   bool ReadProps = true; //<! PropsMode is used to indicate read Validation properties or not
   bool ReadMetadata = true; //! Parameter for metadata reading
+  bool ReadParallel = false; //<! Defines whether file records are read into entities and solid models are translated in parallel
+  bool ReadFastLexer = false; //<! Defines whether the file is parsed by the hand-written lexer working on the file mapped into memory
+  bool ReadLazy = false; //<! Defines whether the contents of entities is read on demand, at their first access
   
   // Write
   WriteMode_PrecisionMode WritePrecisionMode = WriteMode_PrecisionMode_Average; //<! Specifies the mode of writing the resolution value into the STEP file
@@ -187,6 +190,7 @@ public:
   bool WriteLayer = true; //<! LayerMode is used to indicate write Layers or not
   bool WriteProps = true; //<! PropsMode is used to indicate write Validation properties or not
   STEPControl_StepModelType WriteModelType = STEPControl_AsIs; //<! Gives you the choice of translation mode for an Open CASCADE shape that is being translated to STEP
+  bool WriteParallel = false; //<! Defines whether the sub-shapes of a manifold shape are translated into STEP entities in parallel
 };
 
 #endif // _StepData_ConfParameters_HeaderFile
@@ -0,0 +1,233 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <StepData_StepLazyLoader.hxx>
+
+#include <Interface_Check.hxx>
+#include <Interface_FileParameter.hxx>
+#include <Interface_Protocol.hxx>
+#include <Interface_ReportEntity.hxx>
+#include <Message_Msg.hxx>
+#include <Standard_ErrorHandler.hxx>
+#include <Standard_Failure.hxx>
+#include <StepData_StepModel.hxx>
+#include <StepData_StepReaderData.hxx>
+#include <StepData_StepReaderTool.hxx>
+#include <StepData_UndefinedEntity.hxx>
+
+IMPLEMENT_STANDARD_RTTIEXT(StepData_StepLazyLoader, Standard_Transient)
+
+//=======================================================================
+//function : StepData_StepLazyLoader
+//purpose  :
+//=======================================================================
+
+StepData_StepLazyLoader::StepData_StepLazyLoader (const Handle(StepData_StepReaderData)& theData,
+                                                  const Handle(Interface_Protocol)& theProtocol,
+                                                  const Handle(StepData_StepModel)& theModel)
+: myData (theData),
+  myProtocol (theProtocol),
+  myLib (theProtocol),
+  myRecords (1, Max (1, theModel->NbEntities())),
+  myIsDone (false)
+{
+  myRecords.Init (0);
+  for (Standard_Integer aRecord = theData->FindNextRecord (0); aRecord > 0;
+       aRecord = theData->FindNextRecord (aRecord))
+  {
+    // null entities are not in the model
+    const Standard_Integer aNum = theModel->Number (theData->BoundEntity (aRecord));
+    if (aNum > 0 && aNum <= myRecords.Upper())
+    {
+      myRecords.SetValue (aNum, aRecord);
+      myToLoad.Add (aRecord);
+    }
+  }
+  if (myToLoad.IsEmpty())
+  {
+    release();
+  }
+}
+
+//=======================================================================
+//function : NbToLoad
+//purpose  :
+//=======================================================================
+
+Standard_Integer StepData_StepLazyLoader::NbToLoad() const
+{
+  Standard_Mutex::Sentry aSentry (myMutex);
+  return myIsDone ? 0 : myToLoad.Extent();
+}
+
+//=======================================================================
+//function : IsLoaded
+//purpose  :
+//=======================================================================
+
+Standard_Boolean StepData_StepLazyLoader::IsLoaded (const Standard_Integer theNum) const
+{
+  if (theNum < myRecords.Lower() || theNum > myRecords.Upper())
+  {
+    return Standard_True;
+  }
+  Standard_Mutex::Sentry aSentry (myMutex);
+  return myIsDone || !myToLoad.Contains (myRecords.Value (theNum));
+}
+
+//=======================================================================
+//function : Load
+//purpose  :
+//=======================================================================
+
+void StepData_StepLazyLoader::Load (StepData_StepModel& theModel,
+                                    const Standard_Integer theNum)
+{
+  // entities added to the model after reading are complete;
+  // the flag is checked once more under the lock, as another thread
+  // may load the last entities and release the data in the meantime
+  if (myIsDone || theNum < myRecords.Lower() || theNum > myRecords.Upper())
+  {
+    return;
+  }
+
+  Standard_Mutex::Sentry aSentry (myMutex);
+  if (myIsDone)
+  {
+    return;
+  }
+  const Standard_Integer aRecord = myRecords.Value (theNum);
+  if (!myToLoad.Remove (aRecord))
+  {
+    return;
+  }
+
+  // the entities referred by a loaded entity are loaded with it,
+  // as their contents is accessed through it, not through the model
+  NCollection_Vector<Standard_Integer> aStack;
+  aStack.Append (aRecord);
+  while (!aStack.IsEmpty())
+  {
+    const Standard_Integer aCurrent = aStack.Last();
+    aStack.EraseLast();
+    addReferences (aCurrent, aStack);
+    readRecord (theModel, aCurrent);
+  }
+
+  if (myToLoad.IsEmpty())
+  {
+    release();
+  }
+}
+
+//=======================================================================
+//function : addReferences
+//purpose  :
+//=======================================================================
+
+void StepData_StepLazyLoader::addReferences (const Standard_Integer theRecord,
+                                             NCollection_Vector<Standard_Integer>& theStack)
+{
+  // a complex entity is defined by a chain of records
+  for (Standard_Integer aPart = theRecord; aPart > 0; aPart = myData->NextForComplex (aPart))
+  {
+    const Standard_Integer aNbParams = myData->NbParams (aPart);
+    for (Standard_Integer aParamIter = 1; aParamIter <= aNbParams; ++aParamIter)
+    {
+      const Interface_FileParameter& aParam = myData->Param (aPart, aParamIter);
+      const Standard_Integer aRefRecord = aParam.EntityNumber();
+      if (aRefRecord <= 0)
+      {
+        continue;
+      }
+      if (aParam.ParamType() == Interface_ParamIdent)
+      {
+        if (myToLoad.Remove (aRefRecord))
+        {
+          theStack.Append (aRefRecord);
+        }
+      }
+      else if (aParam.ParamType() == Interface_ParamSub)
+      {
+        addReferences (aRefRecord, theStack);
+      }
+    }
+  }
+}
+
+//=======================================================================
+//function : readRecord
+//purpose  :
+//=======================================================================
+
+void StepData_StepLazyLoader::readRecord (StepData_StepModel& theModel,
+                                          const Standard_Integer theRecord)
+{
+  const Handle(Standard_Transient)& anEnt = myData->BoundEntity (theRecord);
+  const Standard_Integer aNum = theModel.Number (anEnt);
+  if (aNum <= 0)
+  {
+    return;
+  }
+
+  // an entity not recognized already has its report
+  Handle(Interface_ReportEntity) aRep = theModel.ReportEntity (aNum);
+  Handle(Interface_Check) aCheck = aRep.IsNull() ? new Interface_Check (anEnt) : aRep->Check();
+  try
+  {
+    OCC_CATCH_SIGNALS
+    StepData_StepReaderTool::ReadRecord (myLib, myData, theRecord, anEnt, aCheck);
+  }
+  catch (Standard_Failure const&)
+  {
+    Message_Msg aMsg ("XSTEP_278");
+    aMsg.Arg (theModel.StringLabel (anEnt));
+    aCheck->SendFail (aMsg);
+  }
+
+  // same as Interface_FileReaderTool::LoadedEntity
+  Standard_Integer aNbFails = aCheck->NbFails();
+  if (aNbFails + aCheck->NbWarnings() > 0 && aRep.IsNull())
+  {
+    aRep = new Interface_ReportEntity (aCheck, anEnt);
+    theModel.SetReportEntity (0, aRep);
+  }
+  if (myData->IsErrorLoad())
+  {
+    aNbFails = (myData->ResetErrorLoad() ? 1 : 0);
+  }
+  if (aNbFails > 0 && !aRep.IsNull())
+  {
+    Handle(StepData_UndefinedEntity) anUndef =
+      Handle(StepData_UndefinedEntity)::DownCast (myProtocol->UnknownEntity());
+    if (!anUndef.IsNull())
+    {
+      Handle(Interface_Check) anUndefCheck = new Interface_Check;
+      anUndef->ReadRecord (myData, theRecord, anUndefCheck);
+      aRep->SetContent (anUndef);
+    }
+  }
+}
+
+//=======================================================================
+//function : release
+//purpose  :
+//=======================================================================
+
+void StepData_StepLazyLoader::release()
+{
+  myData.Nullify();
+  mySource.Nullify();
+  myToLoad.Clear();
+  myIsDone = true;
+}
@@ -0,0 +1,106 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _StepData_StepLazyLoader_HeaderFile
+#define _StepData_StepLazyLoader_HeaderFile
+
+#include <Interface_ReaderLib.hxx>
+#include <NCollection_Vector.hxx>
+#include <Standard_Mutex.hxx>
+#include <Standard_Transient.hxx>
+#include <TColStd_Array1OfInteger.hxx>
+#include <TColStd_PackedMapOfInteger.hxx>
+
+#include <atomic>
+
+class Interface_Protocol;
+class StepData_StepModel;
+class StepData_StepReaderData;
+
+class StepData_StepLazyLoader;
+DEFINE_STANDARD_HANDLE(StepData_StepLazyLoader, Standard_Transient)
+
+//! Loads on demand the contents of the entities of a StepModel
+//! read in lazy mode (see StepData_StepReaderTool::SetLazy).
+//!
+//! In this mode, records are prepared as usually: each one is bound to an
+//! empty entity of the recognized type, added to the model, so the model
+//! gives the count, numbers, labels and types of all the entities at once.
+//! The contents of an entity is read from its record at its first access
+//! by StepModel::Value, together with the contents of all the entities it
+//! refers to, directly or not, so that the data got from a loaded entity
+//! is always complete.
+//!
+//! The records, and the texts of parameters they refer to, are kept until
+//! all the entities are loaded; then they are released.
+//! Loading is protected by a mutex, so Value can be called from several threads.
+class StepData_StepLazyLoader : public Standard_Transient
+{
+public:
+
+  //! Creates a loader of the entities of <theModel>, bound to the
+  //! records of <theData>. <theProtocol> gives the ReaderLib.
+  Standard_EXPORT StepData_StepLazyLoader (const Handle(StepData_StepReaderData)& theData,
+                                           const Handle(Interface_Protocol)& theProtocol,
+                                           const Handle(StepData_StepModel)& theModel);
+
+  //! Keeps an object which owns the texts of parameters
+  //! (e.g. the contents of the file), until all the entities are loaded
+  void SetSource (const Handle(Standard_Transient)& theSource) { mySource = theSource; }
+
+  //! Returns True when all the entities have been loaded.
+  //! The flag is atomic, as it is checked without the lock before loading
+  Standard_Boolean IsDone() const { return myIsDone; }
+
+  //! Returns the count of entities still to be loaded
+  Standard_EXPORT Standard_Integer NbToLoad() const;
+
+  //! Returns True if the contents of entity <theNum> of the model is loaded
+  Standard_EXPORT Standard_Boolean IsLoaded (const Standard_Integer theNum) const;
+
+  //! Loads the contents of entity <theNum> of <theModel> if not yet done,
+  //! and of the entities it refers to. Fails and warnings are recorded
+  //! in the model by report entities, as when all entities are read at once
+  Standard_EXPORT void Load (StepData_StepModel& theModel,
+                             const Standard_Integer theNum);
+
+  DEFINE_STANDARD_RTTIEXT(StepData_StepLazyLoader, Standard_Transient)
+
+private:
+
+  //! Reads the contents of the entity bound to record <theRecord>
+  void readRecord (StepData_StepModel& theModel,
+                   const Standard_Integer theRecord);
+
+  //! Moves the records of the entities referred by record <theRecord>
+  //! (and its sub-lists), which are still to be loaded, to <theStack>
+  void addReferences (const Standard_Integer theRecord,
+                      NCollection_Vector<Standard_Integer>& theStack);
+
+  //! Releases the data once all the entities are loaded
+  void release();
+
+private:
+
+  Handle(StepData_StepReaderData) myData;     //!< Records of the file
+  Handle(Interface_Protocol) myProtocol;
+  Interface_ReaderLib myLib;
+  Handle(Standard_Transient) mySource;        //!< Owner of the texts of parameters
+  TColStd_Array1OfInteger myRecords;          //!< Records of the entities of the model
+  TColStd_PackedMapOfInteger myToLoad;        //!< Records still to be loaded
+  mutable Standard_Mutex myMutex;
+  std::atomic<bool> myIsDone;                 //!< All entities are loaded, set under the lock
+
+};
+
+#endif // _StepData_StepLazyLoader_HeaderFile
@@ -245,3 +245,58 @@ Standard_Real StepData_StepModel::WriteLengthUnit() const
 {
   return myWriteUnit;
 }
+
+//=======================================================================
+//function : ClearEntities
+//purpose  :
+//=======================================================================
+void StepData_StepModel::ClearEntities()
+{
+  myLazyLoader.Nullify();
+  Interface_InterfaceModel::ClearEntities();
+}
+
+//=======================================================================
+//function : SetLazyLoader
+//purpose  :
+//=======================================================================
+void StepData_StepModel::SetLazyLoader(const Handle(StepData_StepLazyLoader)& theLoader)
+{
+  myLazyLoader = theLoader;
+  SetEntitiesToLoad(!theLoader.IsNull());
+}
+
+//=======================================================================
+//function : LoadEntity
+//purpose  :
+//=======================================================================
+void StepData_StepModel::LoadEntity(const Standard_Integer num) const
+{
+  if (!myLazyLoader.IsNull())
+  {
+    myLazyLoader->Load(*const_cast<StepData_StepModel*>(this), num);
+  }
+}
+
+//=======================================================================
+//function : IsLoaded
+//purpose  :
+//=======================================================================
+Standard_Boolean StepData_StepModel::IsLoaded(const Standard_Integer num) const
+{
+  return myLazyLoader.IsNull() || myLazyLoader->IsLoaded(num);
+}
+
+//=======================================================================
+//function : EntityType
+//purpose  :
+//=======================================================================
+Handle(Standard_Type) StepData_StepModel::EntityType(const Standard_Integer num) const
+{
+  // the empty entity bound to the record already has its final type
+  if (num < 1 || num > NbEntities())
+  {
+    return Handle(Standard_Type)();
+  }
+  return RawValue(num)->DynamicType();
+}
@@ -23,6 +23,7 @@
 #include <Resource_FormatType.hxx>
 #include <StepData_Factors.hxx>
 #include <StepData_ConfParameters.hxx>
+#include <StepData_StepLazyLoader.hxx>
 
 class Standard_Transient;
 class Interface_EntityIterator;
@@ -122,6 +123,25 @@ public:
   //! False - the unit value was not initialized, the default value is used
   Standard_Boolean IsInitializedUnit() const { return myReadUnitIsInitialized; }
 
+  //! Clears the entities, and the lazy loader if any
+  Standard_EXPORT virtual void ClearEntities() Standard_OVERRIDE;
+
+  //! Sets the loader of the entities read in lazy mode (see
+  //! StepData_StepLazyLoader); their contents is then read at first access
+  //! by Value. A null loader means that all the entities are loaded
+  Standard_EXPORT void SetLazyLoader (const Handle(StepData_StepLazyLoader)& theLoader);
+
+  //! Returns the loader of the entities read in lazy mode, null if none
+  const Handle(StepData_StepLazyLoader)& LazyLoader() const { return myLazyLoader; }
+
+  //! Returns True if the contents of entity <num> is loaded,
+  //! always True if the model has not been read in lazy mode
+  Standard_EXPORT Standard_Boolean IsLoaded (const Standard_Integer num) const;
+
+  //! Returns the type of entity <num>, without loading its contents.
+  //! Allows to select the entities to be queried by Value in lazy mode
+  Standard_EXPORT Handle(Standard_Type) EntityType (const Standard_Integer num) const;
+
 public:
 
   StepData_ConfParameters InternalParameters;
@@ -130,6 +150,9 @@ public:
 
 protected:
 
+  //! Loads the contents of entity <num> by the lazy loader
+  Standard_EXPORT virtual void LoadEntity (const Standard_Integer num) const Standard_OVERRIDE;
+
 
 
 
@@ -141,6 +164,7 @@ private:
   Standard_Boolean myReadUnitIsInitialized;
   Standard_Real myWriteUnit;
   Standard_Real myLocalLengthUnit;
+  Handle(StepData_StepLazyLoader) myLazyLoader;
 };
 
 
@@ -57,7 +57,7 @@ IMPLEMENT_STANDARD_RTTIEXT(StepData_StepReaderData, Interface_FileReaderData)
 //  #########################################################################
 //  ....   Creation et Acces de base aux donnees atomiques du fichier    ....
 typedef TCollection_HAsciiString String;
-static char txtmes[200];  // plus commode que redeclarer partout
+static Standard_THREADLOCAL char txtmes[200];  // plus commode que redeclarer partout (par thread : lecture parallele)
 
 
 static Standard_Boolean initstr = Standard_False;
@@ -137,6 +137,7 @@ void StepData_StepReaderData::cleanText(const Handle(TCollection_HAsciiString)&
         }
         else
         {
+          Standard_Mutex::Sentry aLock(myMutex);
           thecheck->AddWarning("String control directive \\P*\\ with an unsupported symbol in place of *");
         }
         isConverted = Standard_True;
@@ -201,6 +202,7 @@ void StepData_StepReaderData::cleanText(const Handle(TCollection_HAsciiString)&
           if (aStrLen % anIterStep)
           {
             aTempExtString.AssignCat('?');
+            Standard_Mutex::Sentry aLock(myMutex);
             thecheck->AddWarning("String control directive \\X2\\ is followed by number of digits not multiple of 4");
           }
           else
@@ -226,6 +228,7 @@ void StepData_StepReaderData::cleanText(const Handle(TCollection_HAsciiString)&
           if (aStrLen % 8)
           {
             aTempExtString.AssignCat('?');
+            Standard_Mutex::Sentry aLock(myMutex);
             thecheck->AddWarning("String control directive \\X4\\ is followed by number of digits not multiple of 8");
           }
           else
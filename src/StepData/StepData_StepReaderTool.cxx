@@ -16,12 +16,15 @@
 #include <Interface_Macros.hxx>
 #include <Message.hxx>
 #include <Message_Messenger.hxx>
+#include <NCollection_Vector.hxx>
+#include <OSD_ThreadPool.hxx>
 #include <Standard_ErrorHandler.hxx>
 #include <Standard_Failure.hxx>
 #include <Standard_Transient.hxx>
 #include <StepData_FileRecognizer.hxx>
 #include <StepData_Protocol.hxx>
 #include <StepData_ReadWriteModule.hxx>
+#include <StepData_StepLazyLoader.hxx>
 #include <StepData_StepModel.hxx>
 #include <StepData_StepReaderData.hxx>
 #include <StepData_StepReaderTool.hxx>
@@ -35,7 +38,8 @@
 StepData_StepReaderTool::StepData_StepReaderTool
   (const Handle(StepData_StepReaderData)& reader,
    const Handle(StepData_Protocol)& protocol)
-:  theglib(protocol) , therlib(protocol)
+:  theglib(protocol) , therlib(protocol) , myToParallel(Standard_False) ,
+   myIsLazy(Standard_False)
 {
   SetData(reader,protocol);
 }
@@ -95,6 +99,7 @@ void StepData_StepReaderTool::Prepare (const Standard_Boolean optim)
       OCC_CATCH_SIGNALS
       stepdat->SetEntityNumbers(optim);
       SetEntities();
+      if (myToParallel && !myIsLazy) readRecordsParallel();
     }
     catch(Standard_Failure const& anException) {
       Message_Messenger::StreamBuffer sout = Message::SendInfo();
@@ -106,10 +111,97 @@ void StepData_StepReaderTool::Prepare (const Standard_Boolean optim)
   else {
     stepdat->SetEntityNumbers(optim);
     SetEntities();
+    if (myToParallel && !myIsLazy) readRecordsParallel();
   }
 }
 
 
+//  ....         Lecture parallele des records (apres SetEntities)         ....
+
+//! Number of records read by one parallel task
+static const Standard_Integer THE_RECORDS_CHUNK_SIZE = 512;
+
+//! Functor reading a chunk of data records.
+//! Each record fills only its own entity and its own check, references
+//! are taken from entities already bound by SetEntities.
+class StepData_StepReaderTool::ParallelRecordReader
+{
+public:
+  ParallelRecordReader (const StepData_StepReaderTool& theTool,
+                        const Handle(StepData_StepReaderData)& theData,
+                        const NCollection_Vector<Standard_Integer>& theRecords,
+                        const Handle(TColStd_HArray1OfTransient)& theChecks)
+  : myTool (theTool), myData (theData), myRecords (theRecords), myChecks (theChecks) {}
+
+  void operator() (int theThreadIndex, int theChunkIndex) const
+  {
+    (void )theThreadIndex;
+    const Standard_Integer aLower = theChunkIndex * THE_RECORDS_CHUNK_SIZE;
+    const Standard_Integer anUpper = Min (aLower + THE_RECORDS_CHUNK_SIZE, myRecords.Length());
+    for (Standard_Integer anIter = aLower; anIter < anUpper; ++anIter)
+    {
+      const Standard_Integer aNum = myRecords.Value (anIter);
+      const Handle(Standard_Transient)& anEnt = myData->BoundEntity (aNum);
+      if (anEnt.IsNull())
+      {
+        continue;
+      }
+      Handle(Interface_Check) aCheck = new Interface_Check (anEnt);
+      try
+      {
+        OCC_CATCH_SIGNALS
+        myTool.readRecord (aNum, anEnt, aCheck);
+        myChecks->SetValue (aNum, aCheck);
+      }
+      catch (Standard_Failure const&)
+      {
+        // check is not stored: the record will be read again
+        // by LoadModel, with the usual recovery of sequential mode
+      }
+    }
+  }
+
+private:
+  const StepData_StepReaderTool& myTool;
+  Handle(StepData_StepReaderData) myData;
+  const NCollection_Vector<Standard_Integer>& myRecords;
+  Handle(TColStd_HArray1OfTransient) myChecks;
+};
+
+
+//=======================================================================
+//function : readRecordsParallel
+//purpose  : 
+//=======================================================================
+
+void StepData_StepReaderTool::readRecordsParallel()
+{
+  myReadChecks.Nullify();
+  DeclareAndCast(StepData_StepReaderData,stepdat,Data());
+  NCollection_Vector<Standard_Integer> aRecords (4096);
+  for (Standard_Integer num = stepdat->FindNextRecord(0); num > 0;
+       num = stepdat->FindNextRecord(num)) {
+    aRecords.Append (num);
+  }
+
+  const Standard_Integer aNbChunks =
+    (aRecords.Length() + THE_RECORDS_CHUNK_SIZE - 1) / THE_RECORDS_CHUNK_SIZE;
+  const Handle(OSD_ThreadPool)& aThreadPool = OSD_ThreadPool::DefaultPool();
+  const Standard_Integer aNbThreads = Min (aNbChunks, aThreadPool->NbDefaultThreadsToLaunch());
+  if (aNbThreads < 2)
+  {
+    // nothing to gain, records are read sequentially by LoadModel
+    return;
+  }
+
+  Handle(TColStd_HArray1OfTransient) aChecks = new TColStd_HArray1OfTransient (1, stepdat->NbRecords());
+  ParallelRecordReader aReader (*this, stepdat, aRecords, aChecks);
+  OSD_ThreadPool::Launcher aLauncher (*aThreadPool, aNbThreads);
+  aLauncher.Perform (0, aNbChunks, aReader);
+  myReadChecks = aChecks;
+}
+
+
 // ....            Gestion du Header : Preparation, lecture            .... //
 
 
@@ -212,22 +304,67 @@ Standard_Boolean StepData_StepReaderTool::AnalyseRecord
   (const Standard_Integer num,
    const Handle(Standard_Transient)& anent,
    Handle(Interface_Check)& acheck)
+{
+//  Mode paresseux : les entites de donnees seront lues a la demande
+  if (myIsLazy) {
+    DeclareAndCast(StepData_StepReaderData,stepdat,Data());
+    if (num >= stepdat->FindNextRecord(0)) return Standard_True;
+  }
+//  Deja lu en parallele par Prepare : on ne fait que recuperer son Check
+  if (!myReadChecks.IsNull() && num >= myReadChecks->Lower() && num <= myReadChecks->Upper()) {
+    Handle(Interface_Check) aReadCheck = Handle(Interface_Check)::DownCast(myReadChecks->Value(num));
+    if (!aReadCheck.IsNull() && Data()->BoundEntity(num) == anent) {
+      myReadChecks->ChangeValue(num).Nullify();
+      acheck->GetMessages(aReadCheck);
+      return (!acheck->HasFailed());
+    }
+  }
+  readRecord(num,anent,acheck);
+  return (!acheck->HasFailed());
+}
+
+
+//=======================================================================
+//function : readRecord
+//purpose  : 
+//=======================================================================
+
+Standard_Boolean StepData_StepReaderTool::readRecord
+  (const Standard_Integer num,
+   const Handle(Standard_Transient)& anent,
+   Handle(Interface_Check)& acheck) const
 {
   DeclareAndCast(StepData_StepReaderData,stepdat,Data());
+  return ReadRecord (therlib,stepdat,num,anent,acheck);
+}
+
+
+//=======================================================================
+//function : ReadRecord
+//purpose  : 
+//=======================================================================
+
+Standard_Boolean StepData_StepReaderTool::ReadRecord
+  (const Interface_ReaderLib& theLib,
+   const Handle(StepData_StepReaderData)& theData,
+   const Standard_Integer num,
+   const Handle(Standard_Transient)& anent,
+   Handle(Interface_Check)& acheck)
+{
   Handle(Interface_ReaderModule) imodule;
   Standard_Integer CN;
-  if (therlib.Select(anent,imodule,CN))
+  if (theLib.Select(anent,imodule,CN))
   {
     Handle(StepData_ReadWriteModule) module =
       Handle(StepData_ReadWriteModule)::DownCast (imodule);
-    module->ReadStep(CN,stepdat,num,acheck,anent);
+    module->ReadStep(CN,theData,num,acheck,anent);
   }
   else {
 //  Pas trouve : tenter UndefinedEntity de StepData
     DeclareAndCast(StepData_UndefinedEntity,und,anent);
     if (und.IsNull()) acheck->AddFail
       ("# Entity neither Recognized nor set as UndefinedEntity from StepData #");
-    else und->ReadRecord(stepdat,num,acheck);
+    else und->ReadRecord(theData,num,acheck);
   }
   return (!acheck->HasFailed());
 }
@@ -241,6 +378,7 @@ Standard_Boolean StepData_StepReaderTool::AnalyseRecord
 void StepData_StepReaderTool::EndRead
   (const Handle(Interface_InterfaceModel)& amodel)
 {
+  myReadChecks.Nullify();
   DeclareAndCast(StepData_StepReaderData,stepdat,Data());
   DeclareAndCast(StepData_StepModel,stepmodel,amodel);
   if (stepmodel.IsNull()) return;
@@ -248,4 +386,6 @@ void StepData_StepReaderTool::EndRead
   while ( (i = stepdat->FindNextRecord(i)) != 0) {
     stepmodel->SetIdentLabel(stepdat->BoundEntity(i),stepdat->RecordIdent(i));
   }
+  if (myIsLazy)
+    stepmodel->SetLazyLoader (new StepData_StepLazyLoader (stepdat,Protocol(),stepmodel));
 }
@@ -54,6 +54,8 @@ public:
   //! Works only on data entities (skips header)
   //! <optimize> given False allows to test some internal algorithms
   //! which are normally avoided (see also StepReaderData)
+  //! In parallel mode (see SetParallel), also reads the contents of
+  //! the bound data entities, so that LoadModel only registers them
   Standard_EXPORT void Prepare (const Standard_Boolean optimize = Standard_True);
   
   //! Bounds empty entities to records, works with a specific
@@ -62,6 +64,25 @@ public:
   //! <optimize : same as above
   Standard_EXPORT void Prepare (const Handle(StepData_FileRecognizer)& reco, const Standard_Boolean optimize = Standard_True);
   
+  //! Sets parallel mode of reading data entities (False by default).
+  //! When it is set, records are read by chunks on the default thread pool
+  //! during Prepare; entities are then added to the model in the record
+  //! order, hence their numbering is the same as in sequential mode.
+  //! Records which fail with an exception are read again sequentially.
+  void SetParallel (const Standard_Boolean theToParallel) { myToParallel = theToParallel; }
+
+  //! Returns True if parallel mode of reading data entities is set
+  Standard_Boolean IsParallel() const { return myToParallel; }
+
+  //! Sets lazy mode of reading data entities (False by default).
+  //! When it is set, LoadModel adds the empty entities bound by Prepare
+  //! to the model, and EndRead gives the model a StepData_StepLazyLoader
+  //! which reads their contents on demand. Parallel mode is then ignored.
+  void SetLazy (const Standard_Boolean theToLazy) { myIsLazy = theToLazy; }
+
+  //! Returns True if lazy mode of reading data entities is set
+  Standard_Boolean IsLazy() const { return myIsLazy; }
+
   //! recognizes records, by asking either ReaderLib (default) or
   //! FileRecognizer (if defined) to do so. <ach> is to call
   //! RecognizeByLib
@@ -86,8 +107,18 @@ public:
   
   //! Ends file reading after reading all the entities
   //! Here, it binds in the model, Idents to Entities (for checks)
+  //! In lazy mode, also gives the model its lazy loader
   Standard_EXPORT virtual void EndRead (const Handle(Interface_InterfaceModel)& amodel) Standard_OVERRIDE;
 
+  //! Reads the contents of an entity from its record <num> by a module
+  //! of <theLib>, or as an UndefinedEntity.
+  //! Returns True if no fail has been recorded in <acheck>
+  Standard_EXPORT static Standard_Boolean ReadRecord (const Interface_ReaderLib& theLib,
+                                                      const Handle(StepData_StepReaderData)& theData,
+                                                      const Standard_Integer num,
+                                                      const Handle(Standard_Transient)& anent,
+                                                      Handle(Interface_Check)& acheck);
+
 
 
 
@@ -99,11 +130,26 @@ protected:
 
 private:
 
+  class ParallelRecordReader;
+
+  //! Reads the contents of an entity from its record by the ReaderLib,
+  //! or as an UndefinedEntity; does not modify the tool itself
+  Standard_Boolean readRecord (const Standard_Integer num,
+                               const Handle(Standard_Transient)& anent,
+                               Handle(Interface_Check)& acheck) const;
 
+  //! Reads the contents of all bound data entities in parallel,
+  //! keeps the resulting checks in myReadChecks
+  void readRecordsParallel();
+
+private:
 
   Handle(StepData_FileRecognizer) thereco;
   Interface_GeneralLib theglib;
   Interface_ReaderLib therlib;
+  Handle(TColStd_HArray1OfTransient) myReadChecks; //!< checks of records already read in parallel
+  Standard_Boolean myToParallel;
+  Standard_Boolean myIsLazy;
 
 
 };
@@ -68,6 +68,7 @@ StepData_StepWriter::StepData_StepWriter(const Handle(StepData_StepModel)& amode
 {
   themodel = amodel;  thelabmode = thetypmode = 0;
   thefile  = new TColStd_HSequenceOfHAsciiString();
+  thestream = NULL;  thenbsent = 0;
   thesect  = Standard_False;  thefirst = Standard_True;
   themult  = Standard_False;  thecomm  = Standard_False;
   thelevel = theindval = 0;   theindent = Standard_False;
@@ -76,6 +77,40 @@ StepData_StepWriter::StepData_StepWriter(const Handle(StepData_StepModel)& amode
 
 //  ....                Controle d Envoi des Flottants                ....
 
+//=======================================================================
+//function : SetStream
+//purpose  : 
+//=======================================================================
+
+void StepData_StepWriter::SetStream (Standard_OStream* theStream)
+{
+  thestream = theStream;
+  if (thestream == NULL) return;
+  //  lignes deja preparees : envoyees en premier
+  Standard_Integer nb = thefile->Length();
+  for (Standard_Integer i = 1; i <= nb; i ++)
+    *thestream << thefile->Value(i)->ToCString() << "\n";
+  thenbsent += nb;
+  thefile->Clear();
+}
+
+
+//=======================================================================
+//function : AddLine
+//purpose  : 
+//=======================================================================
+
+void StepData_StepWriter::AddLine (const Handle(TCollection_HAsciiString)& theLine)
+{
+  if (thestream == NULL) {
+    thefile->Append (theLine);
+    return;
+  }
+  *thestream << theLine->ToCString() << "\n";
+  thenbsent ++;
+}
+
+
 //=======================================================================
 //function : FloatWriter
 //purpose  : 
@@ -164,7 +199,7 @@ void StepData_StepWriter::SendModel(const Handle(StepData_Protocol)& protocol,
   StepData_WriterLib lib(protocol);
 
   if (!headeronly)
-    thefile->Append (new TCollection_HAsciiString("ISO-10303-21;"));
+    AddLine (new TCollection_HAsciiString("ISO-10303-21;"));
   SendHeader();
 
 //  ....                Header : suite d entites sans Ident                ....
@@ -242,7 +277,7 @@ void StepData_StepWriter::SendModel(const Handle(StepData_Protocol)& protocol,
 void StepData_StepWriter::SendHeader ()
 {
   NewLine(Standard_False);
-  thefile->Append (new TCollection_HAsciiString("HEADER;"));
+  AddLine (new TCollection_HAsciiString("HEADER;"));
   thesect = Standard_True;
 }
 
@@ -256,7 +291,7 @@ void StepData_StepWriter::SendData ()
 {
   if (thesect) throw Interface_InterfaceMismatch("StepWriter : Data section");
   NewLine(Standard_False);
-  thefile->Append (new TCollection_HAsciiString("DATA;"));
+  AddLine (new TCollection_HAsciiString("DATA;"));
   thesect = Standard_True;
 }
 
@@ -268,7 +303,7 @@ void StepData_StepWriter::SendData ()
 
 void StepData_StepWriter::EndSec ()
 {
-  thefile->Append (new TCollection_HAsciiString("ENDSEC;"));
+  AddLine (new TCollection_HAsciiString("ENDSEC;"));
   thesect = Standard_False;
 }
 
@@ -282,7 +317,7 @@ void StepData_StepWriter::EndFile ()
 {
   if (thesect) throw Interface_InterfaceMismatch("StepWriter : EndFile");
   NewLine(Standard_False);
-  thefile->Append (new TCollection_HAsciiString("END-ISO-10303-21;"));
+  AddLine (new TCollection_HAsciiString("END-ISO-10303-21;"));
   thesect = Standard_False;
 }
 
@@ -397,7 +432,7 @@ void StepData_StepWriter::SendEntity(const Standard_Integer num,
 void StepData_StepWriter::NewLine (const Standard_Boolean evenempty)
 {
   if (evenempty || thecurr.Length() > 0) {
-    thefile->Append(thecurr.Moved());
+    AddLine (thecurr.Moved());
   }
   Standard_Integer indst = thelevel * 2; if (theindent) indst += theindval;
   thecurr.SetInitial(indst);  thecurr.Clear();
@@ -461,7 +496,7 @@ void StepData_StepWriter::SendScope ()
 void StepData_StepWriter::SendEndscope ()
 {
   NewLine(Standard_False);
-  thefile->Append(new TCollection_HAsciiString(textendscope));
+  AddLine (new TCollection_HAsciiString(textendscope));
 }
 
 
@@ -806,7 +841,7 @@ void StepData_StepWriter::Send (const TCollection_AsciiString& val)
   if (thecurr.CanGet(nn)) AddString(aval,0);
   //:i2
   else {
-    thefile->Append(thecurr.Moved());
+    AddLine (thecurr.Moved());
     Standard_Integer indst = thelevel * 2; if (theindent) indst += theindval;
     if ( indst+nn <= StepLong ) thecurr.SetInitial(indst);
     else thecurr.SetInitial(0);
@@ -830,7 +865,7 @@ void StepData_StepWriter::Send (const TCollection_AsciiString& val)
 	  }
 	}
 	TCollection_AsciiString bval = aval.Split(stop);
-	thefile->Append(new TCollection_HAsciiString(aval));
+	AddLine (new TCollection_HAsciiString(aval));
 	aval = bval;
 	nn -= stop;
       }
@@ -842,7 +877,7 @@ void StepData_StepWriter::Send (const TCollection_AsciiString& val)
     Standard_Integer ncurr = thecurr.Length();
     Standard_Integer nbuff = StepLong - ncurr;
     thecurr.Add (aval.ToCString(),nbuff);
-    thefile->Append(thecurr.Moved());
+    AddLine (thecurr.Moved());
     aval.Remove(1,nbuff);
     nn -= nbuff;
     while (nn > 0) {
@@ -852,7 +887,7 @@ void StepData_StepWriter::Send (const TCollection_AsciiString& val)
 	break;
       }
       TCollection_AsciiString bval = aval.Split(StepLong);
-      thefile->Append(new TCollection_HAsciiString(bval));
+      AddLine (new TCollection_HAsciiString(bval));
       nn -= StepLong;
     }
   }
@@ -1078,7 +1113,7 @@ void StepData_StepWriter::AddString(const TCollection_AsciiString& astr,
                                     const Standard_Integer more)
 {
   while (!thecurr.CanGet(astr.Length() + more)) {
-    thefile->Append(thecurr.Moved());
+    AddLine (thecurr.Moved());
     Standard_Integer indst = thelevel * 2; if (theindent) indst += theindval;
     thecurr.SetInitial(indst);
   }
@@ -1096,7 +1131,7 @@ void StepData_StepWriter::AddString(const Standard_CString astr,
                                     const Standard_Integer more)
 {
   while (!thecurr.CanGet(lnstr + more)) {
-    thefile->Append(thecurr.Moved());
+    AddLine (thecurr.Moved());
     Standard_Integer indst = thelevel * 2; if (theindent) indst += theindval;
     thecurr.SetInitial(indst);
   }
@@ -1124,7 +1159,7 @@ Interface_CheckIterator  StepData_StepWriter::CheckList () const
 //=======================================================================
 
 Standard_Integer  StepData_StepWriter::NbLines () const
-{  return thefile->Length();  }
+{  return thenbsent + thefile->Length();  }
 
 
 //=======================================================================
@@ -61,6 +61,14 @@ public:
   //! provides the Number of Entities, as identifiers for File
   Standard_EXPORT StepData_StepWriter(const Handle(StepData_StepModel)& amodel);
   
+  //! Sets a stream to which each line is written as soon as it is
+  //! complete, instead of being kept until Print : the rendered file
+  //! is then never held in memory. Lines already kept are written first.
+  //! Lines sent to the stream are counted by NbLines but cannot be
+  //! queried by Line. Null (default) keeps lines in memory.
+  //! The stream must remain valid until the end of the writing.
+  Standard_EXPORT void SetStream (Standard_OStream* theStream);
+  
   //! ModeLabel controls how to display entity ids :
   //! 0 (D) gives entity number in the model
   //! 1 gives the already recorded label (else, its number)
@@ -261,10 +269,13 @@ public:
   Standard_EXPORT Standard_Integer NbLines() const;
   
   //! Returns a Line given its rank in the File
+  //! (among the lines kept in memory, see SetStream)
   Standard_EXPORT Handle(TCollection_HAsciiString) Line (const Standard_Integer num) const;
   
   //! writes result on an output defined as an OStream
   //! then clears it
+  //! Lines already written to the stream given to SetStream are not
+  //! written again
   Standard_EXPORT Standard_Boolean Print (Standard_OStream& S);
 
 
@@ -286,10 +297,16 @@ private:
   
   //! Same as above, but the string is given by CString + Length
   Standard_EXPORT void AddString (const Standard_CString str, const Standard_Integer lnstr, const Standard_Integer more = 0);
+  
+  //! adds a complete line to the file : writes it to the stream
+  //! if one is set, else keeps it
+  Standard_EXPORT void AddLine (const Handle(TCollection_HAsciiString)& theLine);
 
 
   Handle(StepData_StepModel) themodel;
   Handle(TColStd_HSequenceOfHAsciiString) thefile;
+  Standard_OStream* thestream;
+  Standard_Integer thenbsent;
   Interface_LineBuffer thecurr;
   Standard_Boolean thesect;
   Standard_Boolean thecomm;
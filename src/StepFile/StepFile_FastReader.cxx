@@ -0,0 +1,1188 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <StepFile_FastReader.hxx>
+
+#include <Interface_ParamType.hxx>
+#include <NCollection_IncAllocator.hxx>
+#include <OSD_FileSystem.hxx>
+#include <OSD_ThreadPool.hxx>
+#include <Standard.hxx>
+#include <StepData_StepReaderData.hxx>
+
+#ifdef _WIN32
+  #include <windows.h>
+  #include <TCollection_ExtendedString.hxx>
+#else
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <ctype.h>
+#include <string.h>
+
+namespace
+{
+  // Constant texts, same as ones of StepFile_ReadData
+  static const char THE_SUB_LIST[] = "/* (SUB) */";
+  static const char THE_SUB_1[] = "$1";
+  static const char THE_SUB_2[] = "$2";
+  static const char THE_ID_ZERO[] = "#0";
+
+  //! Minimal size of a part of DATA section parsed by one thread
+  static const Standard_Size THE_MIN_CHUNK_SIZE = 1024 * 1024;
+
+  //! Kinds of tokens, named after ones of step.yacc
+  enum TokenKind
+  {
+    TokenKind_EOF,
+    TokenKind_Error,
+    TokenKind_STEP,
+    TokenKind_HEADER,
+    TokenKind_ENDSEC,
+    TokenKind_DATA,
+    TokenKind_ENDSTEP,
+    TokenKind_SCOPE,
+    TokenKind_ENDSCOPE,
+    TokenKind_ENTITY,
+    TokenKind_IDENT,
+    TokenKind_TYPE,
+    TokenKind_QUID,
+    TokenKind_Open,
+    TokenKind_Close,
+    TokenKind_Comma,
+    TokenKind_Equal,
+    TokenKind_Semicolon,
+    TokenKind_Slash
+  };
+
+  inline Standard_Boolean isDigit (const char theChar)
+  {
+    return theChar >= '0' && theChar <= '9';
+  }
+
+  //! Returns True for [A-Z0-9_]
+  inline Standard_Boolean isUpperWord (const char theChar)
+  {
+    return (theChar >= 'A' && theChar <= 'Z') || isDigit (theChar) || theChar == '_';
+  }
+
+  //! Returns True for [a-zA-Z0-9_]
+  inline Standard_Boolean isWord (const char theChar)
+  {
+    return isUpperWord (theChar) || (theChar >= 'a' && theChar <= 'z');
+  }
+
+  //! Returns True for [A-F0-9]
+  inline Standard_Boolean isHexa (const char theChar)
+  {
+    return (theChar >= 'A' && theChar <= 'F') || isDigit (theChar);
+  }
+
+  //! Returns the length of the keyword <theWord> (upper case) found at <thePos>
+  //! ignoring case, or 0
+  inline Standard_Size matchKeyword (const char* thePos, const char* theEnd, const char* theWord)
+  {
+    Standard_Size aLen = 0;
+    for (; theWord[aLen] != '\0'; ++aLen)
+    {
+      if (thePos + aLen >= theEnd || ::toupper ((unsigned char )thePos[aLen]) != theWord[aLen])
+      {
+        return 0;
+      }
+    }
+    return aLen;
+  }
+
+  //! Returns the length of "<theWord>[0-9\-]*;" found at <thePos> ignoring case, or 0
+  inline Standard_Size matchIsoKeyword (const char* thePos, const char* theEnd, const char* theWord)
+  {
+    Standard_Size aLen = matchKeyword (thePos, theEnd, theWord);
+    if (aLen == 0)
+    {
+      return 0;
+    }
+    while (thePos + aLen < theEnd && (isDigit (thePos[aLen]) || thePos[aLen] == '-'))
+    {
+      ++aLen;
+    }
+    return (thePos + aLen < theEnd && thePos[aLen] == ';') ? aLen + 1 : 0;
+  }
+}
+
+//=======================================================================
+//class    : Chunk
+//purpose  : Tokenizer and parser of a part of the file, collecting records
+//           in the same way as StepFile_ReadData does for bison
+//=======================================================================
+
+class StepFile_FastReader::Chunk
+{
+public:
+  // Standard OCCT memory allocation stuff
+  DEFINE_STANDARD_ALLOC
+
+  //! Text of a token (view into the buffer), or a constant text if myLen < 0
+  struct Text
+  {
+    const char* Ptr;
+    Standard_Integer Len;
+
+    Text() : Ptr (NULL), Len (-1) {}
+    Text (const char* thePtr, const Standard_Integer theLen) : Ptr (thePtr), Len (theLen) {}
+  };
+
+  //! Argument of a record
+  struct Argument
+  {
+    Text Value;
+    Interface_ParamType Type;
+    Standard_Integer Next;   //!< index of the next argument of the record, or -1
+  };
+
+  //! Record: entity, sub-list or part of complex entity
+  struct Record
+  {
+    Text Ident;
+    Text Type;
+    Standard_Integer First;  //!< index of the first argument, or -1
+    Standard_Integer Last;   //!< index of the last argument, or -1
+    Standard_Integer Parent; //!< index of the record to resume after this one, or -1
+  };
+
+  //! Token returned by the tokenizer
+  struct Token
+  {
+    TokenKind Kind;
+    Text Value;
+    Interface_ParamType ParamType;
+  };
+
+public:
+
+  Chunk (const char* theBegin, const char* theEnd)
+  : myEnd (theEnd), myPos (theBegin),
+    myAlloc (new NCollection_IncAllocator()),
+    myCurRec (-1), myNumSub (0), myYaRec (Standard_False),
+    myCurrType (THE_SUB_LIST, -1),
+    myIsDone (Standard_False)
+  {
+    myTok.Kind = TokenKind_EOF;
+    myTok.ParamType = Interface_ParamVoid;
+  }
+
+  //! Parses the header section, up to the DATA keyword
+  Standard_Boolean ParseHeader()
+  {
+    advance();
+    if (!expect (TokenKind_STEP) || !expect (TokenKind_HEADER))
+    {
+      return Standard_False;
+    }
+    while (myTok.Kind == TokenKind_TYPE)
+    {
+      if (!parseEntType() || !expect (TokenKind_Semicolon))
+      {
+        return Standard_False;
+      }
+    }
+    if (!expect (TokenKind_ENDSEC) || myTok.Kind != TokenKind_DATA)
+    {
+      return Standard_False;
+    }
+    // the next token is not read: the data section may be parsed by other chunks
+    myIsDone = Standard_True;
+    return Standard_True;
+  }
+
+  //! Parses a sequence of entities up to the end of the chunk.
+  //! The last chunk should end with the end of the DATA section.
+  Standard_Boolean ParseData (const Standard_Boolean theIsLast)
+  {
+    advance();
+    while (myTok.Kind == TokenKind_ENTITY)
+    {
+      if (!parseBloc())
+      {
+        return Standard_False;
+      }
+    }
+    if (theIsLast)
+    {
+      if (!expect (TokenKind_ENDSEC) || !expect (TokenKind_ENDSTEP))
+      {
+        return Standard_False;
+      }
+    }
+    myIsDone = (myTok.Kind == TokenKind_EOF);
+    return myIsDone;
+  }
+
+  //! Terminates all texts of records in place
+  void Terminate() const
+  {
+    for (NCollection_Vector<Record>::Iterator aRecIter (myRecords); aRecIter.More(); aRecIter.Next())
+    {
+      terminate (aRecIter.Value().Ident);
+      terminate (aRecIter.Value().Type);
+    }
+    for (NCollection_Vector<Argument>::Iterator anArgIter (myArgs); anArgIter.More(); anArgIter.Next())
+    {
+      terminate (anArgIter.Value().Value);
+    }
+  }
+
+  //! Returns position where parsing stopped
+  const char* Position() const { return myPos; }
+
+  //! Returns True if parsing completed successfully
+  Standard_Boolean IsDone() const { return myIsDone; }
+
+  //! Returns number of records added
+  Standard_Integer NbRecords() const { return myOrder.Size(); }
+
+  //! Returns number of arguments created
+  Standard_Integer NbArgs() const { return myArgs.Size(); }
+
+  //! Passes records to StepData_StepReaderData from number <theFirst>
+  void Fill (const Handle(StepData_StepReaderData)& theData, const Standard_Integer theFirst) const
+  {
+    Standard_Integer aNum = theFirst;
+    for (NCollection_Vector<Standard_Integer>::Iterator anOrderIter (myOrder); anOrderIter.More(); anOrderIter.Next(), ++aNum)
+    {
+      const Record& aRec = myRecords.Value (anOrderIter.Value());
+      theData->SetRecord (aNum, aRec.Ident.Ptr, aRec.Type.Ptr, aRec.First >= 0 ? 1 : 0);
+      for (Standard_Integer anArgIndex = aRec.First; anArgIndex >= 0; )
+      {
+        const Argument& anArg = myArgs.Value (anArgIndex);
+        theData->AddStepParam (aNum, anArg.Value.Ptr, anArg.Type);
+        anArgIndex = anArg.Next;
+      }
+      theData->InitParams (aNum);
+    }
+  }
+
+  //! Releases the records, keeping the texts of sub-list idents they refer to
+  void ClearRecords()
+  {
+    myRecords.Clear();
+    myOrder.Clear();
+    myArgs.Clear();
+  }
+
+private:
+
+  //! Writes the terminating null character after the text of a token
+  void terminate (const Text& theText) const
+  {
+    if (theText.Len >= 0)
+    {
+      const_cast<char*>(theText.Ptr)[theText.Len] = '\0';
+    }
+  }
+
+  //! Checks that current token is of kind <theKind> and reads the next one
+  Standard_Boolean expect (const TokenKind theKind)
+  {
+    if (myTok.Kind != theKind)
+    {
+      return Standard_False;
+    }
+    advance();
+    return Standard_True;
+  }
+
+  //! Reads the next token
+  void advance() { nextToken (myTok); }
+
+  //! bloc : entlab '=' unent ';'
+  //! unent : enttype listarg | '(' plex ')'
+  Standard_Boolean parseBloc()
+  {
+    recordIdent (myTok.Value);
+    advance();
+    if (!expect (TokenKind_Equal))
+    {
+      return Standard_False;
+    }
+    if (myTok.Kind == TokenKind_TYPE)
+    {
+      if (!parseEntType())
+      {
+        return Standard_False;
+      }
+    }
+    else if (myTok.Kind == TokenKind_Open)
+    {
+      advance();
+      if (myTok.Kind != TokenKind_TYPE)
+      {
+        return Standard_False;
+      }
+      while (myTok.Kind == TokenKind_TYPE)
+      {
+        if (!parseEntType())
+        {
+          return Standard_False;
+        }
+      }
+      if (!expect (TokenKind_Close))
+      {
+        return Standard_False;
+      }
+    }
+    else
+    {
+      // including SCOPE, not supported
+      return Standard_False;
+    }
+    return expect (TokenKind_Semicolon);
+  }
+
+  //! enttype listarg
+  Standard_Boolean parseEntType()
+  {
+    recordType (myTok.Value);
+    advance();
+    return parseListArg();
+  }
+
+  //! listarg : '(' ')' | '(' arglist ')'
+  Standard_Boolean parseListArg()
+  {
+    if (myTok.Kind != TokenKind_Open)
+    {
+      return Standard_False;
+    }
+    recordListStart();
+    advance();
+    if (myTok.Kind != TokenKind_Close)
+    {
+      for (;;)
+      {
+        if (!parseUnArg())
+        {
+          return Standard_False;
+        }
+        if (myTok.Kind != TokenKind_Comma)
+        {
+          break;
+        }
+        advance();
+      }
+      if (myTok.Kind != TokenKind_Close)
+      {
+        return Standard_False;
+      }
+    }
+    recordNewEntity();
+    advance();
+    return Standard_True;
+  }
+
+  //! unarg : IDENT | QUID | listarg | listype listarg
+  Standard_Boolean parseUnArg()
+  {
+    switch (myTok.Kind)
+    {
+      case TokenKind_IDENT:
+      {
+        createNewArg (myTok.Value, Interface_ParamIdent);
+        advance();
+        return Standard_True;
+      }
+      case TokenKind_QUID:
+      {
+        createNewArg (myTok.Value, myTok.ParamType);
+        advance();
+        return Standard_True;
+      }
+      case TokenKind_TYPE:
+      {
+        myCurrType = myTok.Value;
+        advance();
+        if (myTok.Kind != TokenKind_Open)
+        {
+          return Standard_False;
+        }
+      }
+      Standard_FALLTHROUGH
+      case TokenKind_Open:
+      {
+        if (!parseListArg())
+        {
+          return Standard_False;
+        }
+        createNewArg (mySubArg, Interface_ParamSub);
+        return Standard_True;
+      }
+      default:
+        return Standard_False;
+    }
+  }
+
+  //! See StepFile_ReadData::RecordIdent()
+  void recordIdent (const Text& theIdent)
+  {
+    myCurRec = newRecord (theIdent, -1);
+    myYaRec = Standard_True;
+  }
+
+  //! See StepFile_ReadData::RecordType()
+  void recordType (const Text& theType)
+  {
+    if (!myYaRec)
+    {
+      myCurRec = newRecord (Text (THE_ID_ZERO, -1), -1);
+    }
+    myRecords.ChangeValue (myCurRec).Type = theType;
+    myYaRec = Standard_False;
+    myNumSub = 0;
+  }
+
+  //! See StepFile_ReadData::RecordListStart()
+  void recordListStart()
+  {
+    if (myNumSub > 0)
+    {
+      Text anIdent;
+      switch (myNumSub)
+      {
+        case 1: anIdent = Text (THE_SUB_1, -1); break;
+        case 2: anIdent = Text (THE_SUB_2, -1); break;
+        default:
+        {
+          char* aBufSub = static_cast<char*>(myAlloc->AllocateOptimal (12));
+          Sprintf (aBufSub, "$%d", myNumSub);
+          anIdent = Text (aBufSub, -1);
+        }
+      }
+      const Standard_Integer aSubRec = newRecord (anIdent, myCurRec);
+      myRecords.ChangeValue (aSubRec).Type = myCurrType;
+      myCurrType = Text (THE_SUB_LIST, -1);
+      myCurRec = aSubRec;
+    }
+    myNumSub++;
+  }
+
+  //! See StepFile_ReadData::RecordNewEntity()
+  void recordNewEntity()
+  {
+    myOrder.Append (myCurRec);
+    const Record& aRec = myRecords.Value (myCurRec);
+    mySubArg = aRec.Ident;
+    myCurRec = aRec.Parent;
+  }
+
+  //! See StepFile_ReadData::CreateNewArg()
+  void createNewArg (const Text& theValue, const Interface_ParamType theType)
+  {
+    const Standard_Integer anArgIndex = myArgs.Size();
+    Argument& anArg = myArgs.Appended();
+    anArg.Value = theValue;
+    anArg.Type = theType;
+    anArg.Next = -1;
+
+    Record& aRec = myRecords.ChangeValue (myCurRec);
+    if (aRec.First < 0)
+    {
+      aRec.First = anArgIndex;
+    }
+    else
+    {
+      myArgs.ChangeValue (aRec.Last).Next = anArgIndex;
+    }
+    aRec.Last = anArgIndex;
+  }
+
+  //! Creates a new record without type and arguments
+  Standard_Integer newRecord (const Text& theIdent, const Standard_Integer theParent)
+  {
+    const Standard_Integer aRecIndex = myRecords.Size();
+    Record& aRec = myRecords.Appended();
+    aRec.Ident = theIdent;
+    aRec.First = aRec.Last = -1;
+    aRec.Parent = theParent;
+    return aRecIndex;
+  }
+
+  //! Sets token to be the text from current position of length <theLen>
+  void setToken (Token& theTok, const TokenKind theKind, const Standard_Size theLen,
+                 const Interface_ParamType theType = Interface_ParamMisc)
+  {
+    theTok.Kind = theKind;
+    theTok.Value = Text (myPos, (Standard_Integer )theLen);
+    theTok.ParamType = theType;
+    myPos += theLen;
+  }
+
+  //! Tokenizer: reproduces the rules of step.lex, choosing the longest
+  //! match and, at equal length, the rule defined first
+  void nextToken (Token& theTok)
+  {
+    for (;;)
+    {
+      if (myPos >= myEnd)
+      {
+        theTok.Kind = TokenKind_EOF;
+        return;
+      }
+      const char aChar = *myPos;
+      switch (aChar)
+      {
+        case ' ':
+        case '\t':
+        case '\n':
+        case '\r':
+        case '\0':
+        {
+          ++myPos;
+          continue;
+        }
+        case '/':
+        {
+          if (myPos + 1 < myEnd && myPos[1] == '*')
+          {
+            const char* aPos = myPos + 2;
+            for (; aPos + 1 < myEnd && (aPos[0] != '*' || aPos[1] != '/'); ++aPos) {}
+            if (aPos + 1 >= myEnd)
+            {
+              theTok.Kind = TokenKind_Error;
+              return;
+            }
+            myPos = aPos + 2;
+            continue;
+          }
+          setToken (theTok, TokenKind_Slash, 1);
+          return;
+        }
+        case '\'':
+        {
+          // text ends by apostrophe followed by [ \n\r]* and comma or closing parenthesis
+          for (const char* aPos = myPos + 1; aPos < myEnd; ++aPos)
+          {
+            aPos = static_cast<const char*>(memchr (aPos, '\'', myEnd - aPos));
+            if (aPos == NULL)
+            {
+              break;
+            }
+            const char* aNext = aPos + 1;
+            for (; aNext < myEnd && (*aNext == ' ' || *aNext == '\n' || *aNext == '\r'); ++aNext) {}
+            if (aNext < myEnd && (*aNext == ')' || *aNext == ','))
+            {
+              setToken (theTok, TokenKind_QUID, aPos + 1 - myPos, Interface_ParamText);
+              return;
+            }
+          }
+          theTok.Kind = TokenKind_Error;
+          return;
+        }
+        case '#':
+        {
+          const char* aPos = myPos + 1;
+          for (; aPos < myEnd && isDigit (*aPos); ++aPos) {}
+          if (aPos == myPos + 1)
+          {
+            setToken (theTok, TokenKind_QUID, 1);
+            return;
+          }
+          const char* aNext = aPos;
+          for (; aNext < myEnd && (*aNext == ' ' || *aNext == '\t'); ++aNext) {}
+          setToken (theTok, (aNext < myEnd && *aNext == '=') ? TokenKind_ENTITY : TokenKind_IDENT, aPos - myPos);
+          return;
+        }
+        case '"':
+        {
+          const char* aPos = myPos + 1;
+          for (; aPos < myEnd && isHexa (*aPos); ++aPos) {}
+          if (aPos > myPos + 1 && aPos < myEnd && *aPos == '"')
+          {
+            setToken (theTok, TokenKind_QUID, aPos + 1 - myPos, Interface_ParamHexa);
+            return;
+          }
+          setToken (theTok, TokenKind_QUID, 1);
+          return;
+        }
+        case '$': setToken (theTok, TokenKind_QUID, 1, Interface_ParamVoid); return;
+        case '(': setToken (theTok, TokenKind_Open, 1); return;
+        case ')': setToken (theTok, TokenKind_Close, 1); return;
+        case ',': setToken (theTok, TokenKind_Comma, 1); return;
+        case '=': setToken (theTok, TokenKind_Equal, 1); return;
+        case ';': setToken (theTok, TokenKind_Semicolon, 1); return;
+        case '&':
+        {
+          const Standard_Size aLen = matchKeyword (myPos + 1, myEnd, "SCOPE");
+          setToken (theTok, aLen != 0 ? TokenKind_SCOPE : TokenKind_QUID, aLen + 1);
+          return;
+        }
+        case '!':
+        {
+          const char* aPos = myPos + 1;
+          for (; aPos < myEnd && isWord (*aPos); ++aPos) {}
+          setToken (theTok, aPos > myPos + 1 ? TokenKind_TYPE : TokenKind_QUID, aPos - myPos);
+          return;
+        }
+        default:
+        {
+          nextWordToken (theTok);
+          return;
+        }
+      }
+    }
+  }
+
+  //! Tokenizer of numbers, enumerations, keywords and types
+  void nextWordToken (Token& theTok)
+  {
+    const char aChar = *myPos;
+    Standard_Size aBest = 0;
+    TokenKind aKind = TokenKind_QUID;
+    Interface_ParamType aType = Interface_ParamMisc;
+    Standard_Boolean isEnd = Standard_False;
+    const Standard_Size aMaxLen = myEnd - myPos;
+
+    // [-+0-9][0-9]*
+    if (aChar == '-' || aChar == '+' || isDigit (aChar))
+    {
+      for (aBest = 1; aBest < aMaxLen && isDigit (myPos[aBest]); ++aBest) {}
+      aType = Interface_ParamInteger;
+    }
+    // [-+\.0-9][\.0-9]+ and [-+\.0-9][\.0-9]+E[-+0-9][0-9]*
+    if (aChar == '-' || aChar == '+' || aChar == '.' || isDigit (aChar))
+    {
+      Standard_Size aLen = 1;
+      for (; aLen < aMaxLen && (myPos[aLen] == '.' || isDigit (myPos[aLen])); ++aLen) {}
+      if (aLen > 1)
+      {
+        if (aLen + 1 < aMaxLen && myPos[aLen] == 'E'
+         && (myPos[aLen + 1] == '-' || myPos[aLen + 1] == '+' || isDigit (myPos[aLen + 1])))
+        {
+          for (aLen += 2; aLen < aMaxLen && isDigit (myPos[aLen]); ++aLen) {}
+        }
+        if (aLen > aBest)
+        {
+          aBest = aLen;
+          aType = Interface_ParamReal;
+        }
+      }
+    }
+    // [.]*[A-Z0-9_]+[.]
+    {
+      Standard_Size aLen = 0;
+      for (; aLen < aMaxLen && myPos[aLen] == '.'; ++aLen) {}
+      const Standard_Size aWordStart = aLen;
+      for (; aLen < aMaxLen && isUpperWord (myPos[aLen]); ++aLen) {}
+      if (aLen > aWordStart && aLen < aMaxLen && myPos[aLen] == '.' && aLen + 1 > aBest)
+      {
+        aBest = aLen + 1;
+        aType = Interface_ParamEnum;
+      }
+    }
+    // keywords
+    if (isWord (aChar))
+    {
+      static const struct { const char* Word; TokenKind Kind; } THE_KEYWORDS[] =
+      {
+        { "STEP;",    TokenKind_STEP },
+        { "HEADER;",  TokenKind_HEADER },
+        { "ENDSEC;",  TokenKind_ENDSEC },
+        { "DATA;",    TokenKind_DATA },
+        { "ENDSTEP;", TokenKind_ENDSTEP }
+      };
+      for (Standard_Size aKeyIter = 0; aKeyIter < sizeof(THE_KEYWORDS) / sizeof(THE_KEYWORDS[0]); ++aKeyIter)
+      {
+        Standard_Size aLen = matchKeyword (myPos, myEnd, THE_KEYWORDS[aKeyIter].Word);
+        if (aLen != 0 && THE_KEYWORDS[aKeyIter].Kind == TokenKind_ENDSTEP)
+        {
+          // (?i:ENDSTEP);.*
+          for (; aLen < aMaxLen && myPos[aLen] != '\n'; ++aLen) {}
+        }
+        if (aLen > aBest)
+        {
+          aBest = aLen;
+          aKind = THE_KEYWORDS[aKeyIter].Kind;
+        }
+      }
+      Standard_Size aLen = matchIsoKeyword (myPos, myEnd, "END-ISO");
+      if (aLen > aBest)
+      {
+        aBest = aLen;
+        aKind = TokenKind_ENDSTEP;
+        isEnd = Standard_True;
+      }
+      aLen = matchIsoKeyword (myPos, myEnd, "ISO");
+      if (aLen > aBest)
+      {
+        aBest = aLen;
+        aKind = TokenKind_STEP;
+        isEnd = Standard_False;
+      }
+      aLen = matchKeyword (myPos, myEnd, "ENDSCOPE");
+      if (aLen > aBest)
+      {
+        aBest = aLen;
+        aKind = TokenKind_ENDSCOPE;
+        isEnd = Standard_False;
+      }
+      // [a-zA-Z0-9_]+
+      for (aLen = 0; aLen < aMaxLen && isWord (myPos[aLen]); ++aLen) {}
+      if (aLen > aBest)
+      {
+        aBest = aLen;
+        aKind = TokenKind_TYPE;
+        isEnd = Standard_False;
+      }
+    }
+    if (aBest == 0)
+    {
+      // [^)] : any other character
+      aBest = 1;
+      aType = Interface_ParamMisc;
+    }
+    setToken (theTok, aKind, aBest, aType);
+    if (isEnd)
+    {
+      // everything after the end of STEP data is skipped
+      myPos = myEnd;
+    }
+  }
+
+private:
+
+  const char* myEnd;
+  const char* myPos;
+  Handle(NCollection_IncAllocator) myAlloc;  //!< Allocator for texts of sub-list idents
+  NCollection_Vector<Record> myRecords;      //!< Records in order of creation
+  NCollection_Vector<Standard_Integer> myOrder; //!< Indices of records in order of addition
+  NCollection_Vector<Argument> myArgs;       //!< Arguments of all records
+  Token myTok;                               //!< Current token
+  Standard_Integer myCurRec;                 //!< Current record
+  Standard_Integer myNumSub;                 //!< Number of current sub-list
+  Standard_Boolean myYaRec;                  //!< Record already created (after Ident)
+  Text myCurrType;                           //!< Type of the next sub-list
+  Text mySubArg;                             //!< Ident of the last sub-list
+  Standard_Boolean myIsDone;
+};
+
+namespace
+{
+  //! Functor parsing or terminating parts of DATA section in parallel threads
+  template<class ChunkType>
+  class StepFile_ChunkFunctor
+  {
+  public:
+    StepFile_ChunkFunctor (const NCollection_Vector<ChunkType*>& theChunks,
+                           const Standard_Boolean theToTerminate)
+    : myChunks (theChunks), myToTerminate (theToTerminate) {}
+
+    void operator() (int theThreadIndex, int theIndex) const
+    {
+      (void )theThreadIndex;
+      ChunkType* aChunk = myChunks.Value (theIndex + 1);
+      if (myToTerminate)
+      {
+        aChunk->Terminate();
+      }
+      else
+      {
+        aChunk->ParseData (theIndex + 2 == myChunks.Size());
+      }
+    }
+
+  private:
+    StepFile_ChunkFunctor& operator= (const StepFile_ChunkFunctor& );
+
+  private:
+    const NCollection_Vector<ChunkType*>& myChunks;
+    Standard_Boolean myToTerminate;
+  };
+
+  //! Returns the position just after ';' preceding "#ident=" found from <thePos>, or NULL
+  static const char* findRecordStart (const char* thePos, const char* theEnd)
+  {
+    for (const char* aPos = thePos; aPos < theEnd; ++aPos)
+    {
+      aPos = static_cast<const char*>(memchr (aPos, ';', theEnd - aPos));
+      if (aPos == NULL)
+      {
+        return NULL;
+      }
+      const char* aNext = aPos + 1;
+      for (; aNext < theEnd && (*aNext == ' ' || *aNext == '\t' || *aNext == '\n' || *aNext == '\r'); ++aNext) {}
+      if (aNext >= theEnd || *aNext != '#')
+      {
+        continue;
+      }
+      const char* aDigits = ++aNext;
+      for (; aNext < theEnd && isDigit (*aNext); ++aNext) {}
+      if (aNext == aDigits)
+      {
+        continue;
+      }
+      for (; aNext < theEnd && (*aNext == ' ' || *aNext == '\t'); ++aNext) {}
+      if (aNext < theEnd && *aNext == '=')
+      {
+        return aPos + 1;
+      }
+    }
+    return NULL;
+  }
+}
+
+//=======================================================================
+//function : StepFile_FastReader
+//purpose  :
+//=======================================================================
+
+StepFile_FastReader::StepFile_FastReader()
+: myBuffer (NULL),
+  mySize (0),
+  myIsMapped (Standard_False)
+{
+}
+
+//=======================================================================
+//function : ~StepFile_FastReader
+//purpose  :
+//=======================================================================
+
+StepFile_FastReader::~StepFile_FastReader()
+{
+  Close();
+}
+
+//=======================================================================
+//function : Open
+//purpose  :
+//=======================================================================
+
+Standard_Boolean StepFile_FastReader::Open (const char* theName,
+                                           std::istream* theIStream)
+{
+  Close();
+  if (theIStream != nullptr)
+  {
+    return readStream (*theIStream);
+  }
+  if (mapFile (theName))
+  {
+    return Standard_True;
+  }
+  const Handle(OSD_FileSystem)& aFileSystem = OSD_FileSystem::DefaultFileSystem();
+  std::shared_ptr<std::istream> aFileStream = aFileSystem->OpenIStream (theName, std::ios::in | std::ios::binary);
+  return aFileStream.get() != nullptr
+     && !aFileStream->fail()
+     && readStream (*aFileStream);
+}
+
+//=======================================================================
+//function : mapFile
+//purpose  :
+//=======================================================================
+
+Standard_Boolean StepFile_FastReader::mapFile (const char* theName)
+{
+  // the mapping is private (copy on write) to allow terminating texts in place
+#ifdef _WIN32
+  const TCollection_ExtendedString aNameW (theName, Standard_True);
+  HANDLE aFile = CreateFileW (aNameW.ToWideString(), GENERIC_READ, FILE_SHARE_READ,
+                              NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+  if (aFile == INVALID_HANDLE_VALUE)
+  {
+    return Standard_False;
+  }
+  LARGE_INTEGER aFileSize;
+  if (!GetFileSizeEx (aFile, &aFileSize) || aFileSize.QuadPart == 0)
+  {
+    CloseHandle (aFile);
+    return Standard_False;
+  }
+  HANDLE aMapping = CreateFileMappingW (aFile, NULL, PAGE_WRITECOPY, 0, 0, NULL);
+  CloseHandle (aFile);
+  if (aMapping == NULL)
+  {
+    return Standard_False;
+  }
+  void* aView = MapViewOfFile (aMapping, FILE_MAP_COPY, 0, 0, 0);
+  CloseHandle (aMapping);
+  if (aView == NULL)
+  {
+    return Standard_False;
+  }
+  myBuffer = static_cast<char*>(aView);
+  mySize = (Standard_Size )aFileSize.QuadPart;
+#else
+  const int aFile = open (theName, O_RDONLY);
+  if (aFile < 0)
+  {
+    return Standard_False;
+  }
+  struct stat aStat;
+  if (fstat (aFile, &aStat) != 0 || !S_ISREG(aStat.st_mode) || aStat.st_size == 0)
+  {
+    close (aFile);
+    return Standard_False;
+  }
+  void* aView = mmap (NULL, (size_t )aStat.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, aFile, 0);
+  close (aFile);
+  if (aView == MAP_FAILED)
+  {
+    return Standard_False;
+  }
+  myBuffer = static_cast<char*>(aView);
+  mySize = (Standard_Size )aStat.st_size;
+#endif
+  myIsMapped = Standard_True;
+  return Standard_True;
+}
+
+//=======================================================================
+//function : readStream
+//purpose  :
+//=======================================================================
+
+Standard_Boolean StepFile_FastReader::readStream (std::istream& theStream)
+{
+  const std::streampos aStart = theStream.tellg();
+  if (aStart == std::streampos (-1))
+  {
+    return Standard_False;
+  }
+  theStream.seekg (0, std::ios::end);
+  const std::streampos anEnd = theStream.tellg();
+  theStream.seekg (aStart);
+  if (anEnd == std::streampos (-1) || anEnd <= aStart)
+  {
+    theStream.clear();
+    theStream.seekg (aStart);
+    return Standard_False;
+  }
+
+  mySize = (Standard_Size )(anEnd - aStart);
+  myBuffer = static_cast<char*>(Standard::AllocateOptimal (mySize));
+  theStream.read (myBuffer, (std::streamsize )mySize);
+  const Standard_Boolean isRead = (Standard_Size )theStream.gcount() == mySize;
+  // put the stream back to let it be read by another parser if needed
+  theStream.clear();
+  theStream.seekg (aStart);
+  if (!isRead)
+  {
+    Close();
+  }
+  return isRead;
+}
+
+//=======================================================================
+//function : Parse
+//purpose  :
+//=======================================================================
+
+Standard_Boolean StepFile_FastReader::Parse (const Standard_Boolean theToParallel)
+{
+  clearChunks();
+  if (myBuffer == NULL)
+  {
+    return Standard_False;
+  }
+
+  const char* anEnd = myBuffer + mySize;
+  Chunk* aHeader = new Chunk (myBuffer, anEnd);
+  myChunks.Append (aHeader);
+  if (!aHeader->ParseHeader())
+  {
+    clearChunks();
+    return Standard_False;
+  }
+
+  // DATA keyword has been recognized but not consumed by the header
+  const char* aDataBegin = aHeader->Position();
+  if (!theToParallel || !parseParallel (aDataBegin))
+  {
+    while (myChunks.Size() > 1)
+    {
+      delete myChunks.Value (myChunks.Upper());
+      myChunks.EraseLast();
+    }
+    Chunk* aData = new Chunk (aDataBegin, anEnd);
+    myChunks.Append (aData);
+    if (!aData->ParseData (Standard_True))
+    {
+      clearChunks();
+      return Standard_False;
+    }
+  }
+
+  // all texts are parsed: they can be terminated in place
+  aHeader->Terminate();
+  if (myChunks.Size() > 2)
+  {
+    const Handle(OSD_ThreadPool)& aPool = OSD_ThreadPool::DefaultPool();
+    OSD_ThreadPool::Launcher aLauncher (*aPool, Min (aPool->NbDefaultThreadsToLaunch(), myChunks.Size() - 1));
+    StepFile_ChunkFunctor<Chunk> aFunctor (myChunks, Standard_True);
+    aLauncher.Perform (0, myChunks.Size() - 1, aFunctor);
+  }
+  else
+  {
+    myChunks.Value (1)->Terminate();
+  }
+  return Standard_True;
+}
+
+//=======================================================================
+//function : parseParallel
+//purpose  :
+//=======================================================================
+
+Standard_Boolean StepFile_FastReader::parseParallel (const char* theBegin)
+{
+  const Handle(OSD_ThreadPool)& aPool = OSD_ThreadPool::DefaultPool();
+  const Standard_Integer aNbThreads = aPool->NbDefaultThreadsToLaunch();
+  const char* anEnd = myBuffer + mySize;
+  const Standard_Size aDataSize = anEnd - theBegin;
+  const Standard_Size aNbMaxChunks = std::min ((Standard_Size )aNbThreads * 4, aDataSize / THE_MIN_CHUNK_SIZE);
+  if (aNbThreads < 2 || aNbMaxChunks < 2)
+  {
+    return Standard_False;
+  }
+
+  // the DATA section is cut at positions looking like boundaries of records;
+  // a cut inside a text or a comment makes the parsing of the preceding part fail
+  // (it will not end by a complete entity) so the whole section is then parsed at once
+  const Standard_Size aChunkSize = aDataSize / aNbMaxChunks;
+  const char* aBegin = theBegin;
+  while (aBegin < anEnd)
+  {
+    const char* aCut = NULL;
+    if ((Standard_Size )(anEnd - aBegin) > aChunkSize + THE_MIN_CHUNK_SIZE / 2)
+    {
+      aCut = findRecordStart (aBegin + aChunkSize, anEnd);
+    }
+    if (aCut == NULL)
+    {
+      aCut = anEnd;
+    }
+    myChunks.Append (new Chunk (aBegin, aCut));
+    aBegin = aCut;
+  }
+  if (myChunks.Size() < 3)
+  {
+    return Standard_False;
+  }
+
+  OSD_ThreadPool::Launcher aLauncher (*aPool, Min (aNbThreads, myChunks.Size() - 1));
+  StepFile_ChunkFunctor<Chunk> aFunctor (myChunks, Standard_False);
+  aLauncher.Perform (0, myChunks.Size() - 1, aFunctor);
+
+  for (Standard_Integer aChunkIter = 1; aChunkIter < myChunks.Size(); ++aChunkIter)
+  {
+    if (!myChunks.Value (aChunkIter)->IsDone())
+    {
+      return Standard_False;
+    }
+  }
+  return Standard_True;
+}
+
+//=======================================================================
+//function : GetFileNbR
+//purpose  :
+//=======================================================================
+
+void StepFile_FastReader::GetFileNbR (Standard_Integer* theNbHead,
+                                      Standard_Integer* theNbRec,
+                                      Standard_Integer* theNbPar) const
+{
+  *theNbHead = *theNbRec = *theNbPar = 0;
+  for (NCollection_Vector<Chunk*>::Iterator aChunkIter (myChunks); aChunkIter.More(); aChunkIter.Next())
+  {
+    *theNbRec += aChunkIter.Value()->NbRecords();
+    *theNbPar += aChunkIter.Value()->NbArgs();
+  }
+  if (!myChunks.IsEmpty())
+  {
+    *theNbHead = myChunks.First()->NbRecords();
+  }
+}
+
+//=======================================================================
+//function : Fill
+//purpose  :
+//=======================================================================
+
+void StepFile_FastReader::Fill (const Handle(StepData_StepReaderData)& theData) const
+{
+  Standard_Integer aFirst = 1;
+  for (NCollection_Vector<Chunk*>::Iterator aChunkIter (myChunks); aChunkIter.More(); aChunkIter.Next())
+  {
+    aChunkIter.Value()->Fill (theData, aFirst);
+    aFirst += aChunkIter.Value()->NbRecords();
+  }
+}
+
+//=======================================================================
+//function : ClearRecords
+//purpose  :
+//=======================================================================
+
+void StepFile_FastReader::ClearRecords()
+{
+  for (NCollection_Vector<Chunk*>::Iterator aChunkIter (myChunks); aChunkIter.More(); aChunkIter.Next())
+  {
+    aChunkIter.Value()->ClearRecords();
+  }
+}
+
+//=======================================================================
+//function : clearChunks
+//purpose  :
+//=======================================================================
+
+void StepFile_FastReader::clearChunks()
+{
+  for (NCollection_Vector<Chunk*>::Iterator aChunkIter (myChunks); aChunkIter.More(); aChunkIter.Next())
+  {
+    delete aChunkIter.Value();
+  }
+  myChunks.Clear();
+}
+
+//=======================================================================
+//function : Close
+//purpose  :
+//=======================================================================
+
+void StepFile_FastReader::Close()
+{
+  clearChunks();
+  if (myBuffer != NULL)
+  {
+    if (myIsMapped)
+    {
+    #ifdef _WIN32
+      UnmapViewOfFile (myBuffer);
+    #else
+      munmap (myBuffer, mySize);
+    #endif
+    }
+    else
+    {
+      Standard::Free (myBuffer);
+    }
+  }
+  myBuffer = NULL;
+  mySize = 0;
+  myIsMapped = Standard_False;
+}
@@ -0,0 +1,110 @@
+// Copyright (c) 2024 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _StepFile_FastReader_HeaderFile
+#define _StepFile_FastReader_HeaderFile
+
+#include <NCollection_Vector.hxx>
+#include <Standard_DefineAlloc.hxx>
+#include <Standard_Handle.hxx>
+
+#include <iostream>
+
+class StepData_StepReaderData;
+
+//! Hand-written reader of the STEP physical file, an alternative to the
+//! parser built using flex and bison (see StepFile_ReadData).
+//!
+//! The whole file is mapped into memory (or, for a stream or a file which
+//! cannot be mapped, read into one buffer through OSD_FileSystem).
+//! Tokens are kept as views into this buffer: no text is copied, values are
+//! only terminated in place once the whole file has been parsed.
+//! The buffer should therefore be kept until the model is loaded.
+//!
+//! The DATA section can be split at "#ident=" boundaries and parsed in
+//! parallel threads, each one into its own list of records; the lists are
+//! then given in order so the records are numbered as by the flex parser.
+//!
+//! The reader does not perform error recovery: Parse() returns False
+//! on any syntax error or unsupported construct (SCOPE),
+//! in which case the file should be read by the flex parser.
+class StepFile_FastReader
+{
+public:
+  // Standard OCCT memory allocation stuff
+  DEFINE_STANDARD_ALLOC
+
+private:
+
+  class Chunk; //!< Part of the file parsed into its own list of records
+
+public:
+
+  //! Constructs an empty reader
+  Standard_EXPORT StepFile_FastReader();
+
+  //! Destructor releases the buffer and the records
+  Standard_EXPORT ~StepFile_FastReader();
+
+  //! Maps file <theName> into memory, or reads <theIStream> if it is not null.
+  //! A stream is read from its current position and put back to it.
+  //! Returns False if the data cannot be accessed.
+  Standard_EXPORT Standard_Boolean Open (const char* theName,
+                                         std::istream* theIStream);
+
+  //! Parses the data, in parallel threads if <theToParallel> is True.
+  //! Returns False on syntax error, the buffer being then left unchanged.
+  Standard_EXPORT Standard_Boolean Parse (const Standard_Boolean theToParallel);
+
+  //! Returns the counters of records and parameters, as StepFile_ReadData::GetFileNbR()
+  Standard_EXPORT void GetFileNbR (Standard_Integer* theNbHead,
+                                   Standard_Integer* theNbRec,
+                                   Standard_Integer* theNbPar) const;
+
+  //! Fills <theData> with the records read (values refer to the buffer)
+  Standard_EXPORT void Fill (const Handle(StepData_StepReaderData)& theData) const;
+
+  //! Releases the records once given by Fill, keeping the texts they refer to
+  Standard_EXPORT void ClearRecords();
+
+  //! Releases the buffer and the records
+  Standard_EXPORT void Close();
+
+private:
+
+  //! Maps the file into memory; returns False if not possible
+  Standard_Boolean mapFile (const char* theName);
+
+  //! Reads the stream into an allocated buffer
+  Standard_Boolean readStream (std::istream& theStream);
+
+  //! Splits the DATA section and parses its parts in parallel threads
+  Standard_Boolean parseParallel (const char* theBegin);
+
+  //! Releases the parsed records
+  void clearChunks();
+
+private:
+
+  StepFile_FastReader (const StepFile_FastReader& );
+  StepFile_FastReader& operator= (const StepFile_FastReader& );
+
+private:
+
+  char* myBuffer;                  //!< Contents of the file
+  Standard_Size mySize;            //!< Size of the contents
+  Standard_Boolean myIsMapped;     //!< Buffer is a file mapping (else allocated)
+  NCollection_Vector<Chunk*> myChunks; //!< Header followed by parts of DATA section
+};
+
+#endif // _StepFile_FastReader_HeaderFile
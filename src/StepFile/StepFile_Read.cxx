@@ -16,6 +16,7 @@
 
 #include <StepFile_Read.hxx>
 
+#include <StepFile_FastReader.hxx>
 #include <StepFile_ReadData.hxx>
 
 #include <Interface_Check.hxx>
@@ -55,6 +56,21 @@ void StepFile_Interrupt(Standard_CString theErrorMessage, const Standard_Boolean
   sout << "**** ERR StepFile : " << theErrorMessage << "    ****" << std::endl;
 }
 
+namespace
+{
+  //! Owner of the texts of parameters, read either by the flex parser or by
+  //! the fast reader. It is kept by the lazy loader of the model, if any,
+  //! until all the entities are loaded
+  class StepFile_ReadSource : public Standard_Transient
+  {
+  public:
+    StepFile_FastReader FastReader;
+    StepFile_ReadData   FileData;
+
+    DEFINE_STANDARD_RTTI_INLINE(StepFile_ReadSource, Standard_Transient)
+  };
+}
+
 static Standard_Integer StepFile_Read (const char* theName,
                                        std::istream* theIStream,
                                        const Handle(StepData_StepModel)& theStepModel,
@@ -62,20 +78,6 @@ static Standard_Integer StepFile_Read (const char* theName,
                                        const Handle(StepData_FileRecognizer)& theRecogHeader,
                                        const Handle(StepData_FileRecognizer)& theRecogData)
 {
-  // if stream is not provided, open file stream here
-  std::istream* aStreamPtr = theIStream;
-  std::shared_ptr<std::istream> aFileStream;
-  if (aStreamPtr == nullptr)
-  {
-    const Handle(OSD_FileSystem)& aFileSystem = OSD_FileSystem::DefaultFileSystem();
-    aFileStream = aFileSystem->OpenIStream (theName, std::ios::in | std::ios::binary);
-    aStreamPtr = aFileStream.get();
-  }
-  if (aStreamPtr == nullptr || aStreamPtr->fail())
-  {
-    return -1;
-  }
-
 #ifdef CHRONOMESURE
   OSD_Timer c;
   c.Reset();
@@ -85,24 +87,51 @@ static Standard_Integer StepFile_Read (const char* theName,
   Message_Messenger::StreamBuffer sout = Message::SendTrace();
   sout << "      ...    Step File Reading : '" << theName << "'";
 
-  StepFile_ReadData aFileDataModel;
-  try {
-    OCC_CATCH_SIGNALS
-    int aLetat = 0;
-    step::scanner aScanner(&aFileDataModel, aStreamPtr);
-    aScanner.yyrestart(aStreamPtr);
-    step::parser aParser(&aScanner);
-    aLetat = aParser.parse();
-    if (aLetat != 0) {
-      StepFile_Interrupt(aFileDataModel.GetLastError(), Standard_True);
+  // the fast reader keeps the file contents referred by the parameters
+  // until the model is loaded
+  Handle(StepFile_ReadSource) aSource = new StepFile_ReadSource();
+  StepFile_FastReader& aFastReader = aSource->FastReader;
+  StepFile_ReadData& aFileDataModel = aSource->FileData;
+  const Standard_Boolean isFastRead = theStepModel->InternalParameters.ReadFastLexer
+                                  && aFastReader.Open (theName, theIStream)
+                                  && aFastReader.Parse (theStepModel->InternalParameters.ReadParallel);
+  if (!isFastRead)
+  {
+    // syntax errors are reported (and recovered) by the flex parser
+    aFastReader.Close();
+
+    // if stream is not provided, open file stream here
+    std::istream* aStreamPtr = theIStream;
+    std::shared_ptr<std::istream> aFileStream;
+    if (aStreamPtr == nullptr)
+    {
+      const Handle(OSD_FileSystem)& aFileSystem = OSD_FileSystem::DefaultFileSystem();
+      aFileStream = aFileSystem->OpenIStream (theName, std::ios::in | std::ios::binary);
+      aStreamPtr = aFileStream.get();
+    }
+    if (aStreamPtr == nullptr || aStreamPtr->fail())
+    {
+      return -1;
+    }
+
+    try {
+      OCC_CATCH_SIGNALS
+      int aLetat = 0;
+      step::scanner aScanner(&aFileDataModel, aStreamPtr);
+      aScanner.yyrestart(aStreamPtr);
+      step::parser aParser(&aScanner);
+      aLetat = aParser.parse();
+      if (aLetat != 0) {
+        StepFile_Interrupt(aFileDataModel.GetLastError(), Standard_True);
+        return 1;
+      }
+    }
+    catch (Standard_Failure const& anException) {
+      Message::SendFail() << " ...  Exception Raised while reading Step File : '" << theName << "':\n"
+                          << anException << "    ...";
       return 1;
     }
   }
-  catch (Standard_Failure const& anException) {
-    Message::SendFail() << " ...  Exception Raised while reading Step File : '" << theName << "':\n"
-                        << anException << "    ...";
-    return 1;
-  }
 
 #ifdef CHRONOMESURE
   c.Show(sout);
@@ -111,22 +140,32 @@ static Standard_Integer StepFile_Read (const char* theName,
   sout << "      ...    STEP File   Read    ...\n";
 
   Standard_Integer nbhead, nbrec, nbpar;
-  aFileDataModel.GetFileNbR (&nbhead,&nbrec,&nbpar);  // renvoi par lex/yacc
-  Handle(StepData_StepReaderData) undirec =
-    new StepData_StepReaderData(nbhead,nbrec,nbpar, theStepModel->SourceCodePage());  // creation tableau de records
-  for ( Standard_Integer nr = 1; nr <= nbrec; nr ++) {
-    int nbarg; char* ident; char* typrec = 0;
-    aFileDataModel.GetRecordDescription(&ident, &typrec, &nbarg);
-    undirec->SetRecord (nr, ident, typrec, nbarg);
-
-    if (nbarg>0) {
-      Interface_ParamType typa; char* val;
-      while(aFileDataModel.GetArgDescription (&typa, &val) == 1) {
-        undirec->AddStepParam (nr, val, typa);
+  Handle(StepData_StepReaderData) undirec;
+  if (isFastRead)
+  {
+    aFastReader.GetFileNbR (&nbhead, &nbrec, &nbpar);
+    undirec = new StepData_StepReaderData (nbhead, nbrec, nbpar, theStepModel->SourceCodePage());
+    aFastReader.Fill (undirec);
+    aFastReader.ClearRecords();
+  }
+  else
+  {
+    aFileDataModel.GetFileNbR (&nbhead,&nbrec,&nbpar);  // renvoi par lex/yacc
+    undirec = new StepData_StepReaderData(nbhead,nbrec,nbpar, theStepModel->SourceCodePage());  // creation tableau de records
+    for ( Standard_Integer nr = 1; nr <= nbrec; nr ++) {
+      int nbarg; char* ident; char* typrec = 0;
+      aFileDataModel.GetRecordDescription(&ident, &typrec, &nbarg);
+      undirec->SetRecord (nr, ident, typrec, nbarg);
+
+      if (nbarg>0) {
+        Interface_ParamType typa; char* val;
+        while(aFileDataModel.GetArgDescription (&typa, &val) == 1) {
+          undirec->AddStepParam (nr, val, typa);
+        }
       }
+      undirec->InitParams(nr);
+      aFileDataModel.NextRecord();
     }
-    undirec->InitParams(nr);
-    aFileDataModel.NextRecord();
   }
 
   aFileDataModel.ErrorHandle(undirec->GlobalCheck());
@@ -150,6 +189,8 @@ static Standard_Integer StepFile_Read (const char* theName,
 
   StepData_StepReaderTool readtool (undirec, theProtocol);
   readtool.SetErrorHandle (Standard_True);
+  readtool.SetParallel (theStepModel->InternalParameters.ReadParallel);
+  readtool.SetLazy (theStepModel->InternalParameters.ReadLazy);
 
   readtool.PrepareHeader(theRecogHeader);  // Header. reco nul -> pour Protocol
   readtool.Prepare(theRecogData);          // Data.   reco nul -> pour Protocol
@@ -162,7 +203,16 @@ static Standard_Integer StepFile_Read (const char* theName,
 
   readtool.LoadModel(theStepModel);
   if (theStepModel->Protocol().IsNull()) theStepModel->SetProtocol (theProtocol);
-  aFileDataModel.ClearRecorder(2);
+  const Handle(StepData_StepLazyLoader)& aLazyLoader = theStepModel->LazyLoader();
+  if (!aLazyLoader.IsNull())
+  {
+    // the texts are kept until the entities are loaded on demand
+    aLazyLoader->SetSource (aSource);
+  }
+  else
+  {
+    aFileDataModel.ClearRecorder(2);
+  }
   anFailsCount = undirec->GlobalCheck()->NbFails() - anFailsCount;
   if (anFailsCount > 0)
   {
@@ -21,6 +21,7 @@
 #include <Standard_Type.hxx>
 #include <TColStd_HSequenceOfTransient.hxx>
 #include <Transfer_TransientProcess.hxx>
+#include <Transfer_VoidBinder.hxx>
 
 IMPLEMENT_STANDARD_RTTIEXT(Transfer_TransientProcess,Transfer_ProcessForTransient)
 
@@ -279,3 +280,20 @@ Handle(TColStd_HSequenceOfTransient) Transfer_TransientProcess::RootsForTransfer
 {
   return thetrroots;
 }
+
+
+//=======================================================================
+//function : TakeBindings
+//purpose  : 
+//=======================================================================
+
+void Transfer_TransientProcess::TakeBindings (const Handle(Transfer_TransientProcess)& theOther)
+{
+  for (Standard_Integer aMapIt = 1; aMapIt <= theOther->NbMapped(); ++aMapIt)
+  {
+    const Handle(Standard_Transient)& anEnt = theOther->Mapped (aMapIt);
+    Handle(Transfer_Binder) aFormer = Find (anEnt);
+    if (aFormer.IsNull() || aFormer->DynamicType() == STANDARD_TYPE(Transfer_VoidBinder))
+      Bind (anEnt, theOther->MapItem (aMapIt));
+  }
+}
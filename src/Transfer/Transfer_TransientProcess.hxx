@@ -109,6 +109,11 @@ public:
   Standard_EXPORT void PrintStats (const Standard_Integer mode, Standard_OStream& S) const;
   
   Standard_EXPORT Handle(TColStd_HSequenceOfTransient) RootsForTransfer();
+  
+  //! Binds the results and checks recorded by another process
+  //! (e.g. filled by a transfer run in another thread), for the
+  //! entities which have no result yet (not bound or void binder)
+  Standard_EXPORT void TakeBindings (const Handle(Transfer_TransientProcess)& theOther);
 
 
 
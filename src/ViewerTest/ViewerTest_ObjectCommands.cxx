@@ -3073,6 +3073,7 @@ static int VComputeHLR (Draw_Interpretor& ,
   Prs3d_TypeOfHLR anAlgoType = Prs3d_TOH_PolyAlgo;
   bool toShowCNEdges = false, toShowHiddenEdges = false;
   int aNbIsolines = 0;
+  bool toRunParallel = false;
   if (Handle(V3d_Viewer) aViewer = ViewerTest::GetViewerFromContext())
   {
     gp_Dir aRight;
@@ -3149,6 +3150,15 @@ static int VComputeHLR (Draw_Interpretor& ,
     {
       aNbIsolines = Draw::Atoi (theArgVec[++anArgIter]);
     }
+    else if (anArgCase == "-parallel")
+    {
+      toRunParallel = true;
+      if (anArgIter + 1 < theArgNb
+       && Draw::ParseOnOff (theArgVec[anArgIter + 1], toRunParallel))
+      {
+        ++anArgIter;
+      }
+    }
     else if (aSh.IsNull())
     {
       aSh = DBRep::Get (theArgVec[anArgIter]);
@@ -3203,6 +3213,7 @@ static int VComputeHLR (Draw_Interpretor& ,
     Handle(HLRBRep_PolyAlgo) aPolyAlgo = new HLRBRep_PolyAlgo();
     aPolyAlgo->Projector (aProjector);
     aPolyAlgo->Load (aSh);
+    aPolyAlgo->SetRunParallel (toRunParallel);
     aPolyAlgo->Update();
 
     HLRBRep_PolyHLRToShape aHLRToShape;
@@ -7035,6 +7046,7 @@ Command for testing object properties as parent in the hierarchy.
 vcomputehlr shapeInput hlrResult [-algoType {algo|polyAlgo}=polyAlgo]
     [eyeX eyeY eyeZ dirX dirY dirZ upX upY upZ]
     [-showTangentEdges {on|off}=off] [-nbIsolines N=0] [-showHiddenEdges {on|off}=off]
+    [-parallel {on|off}=off]
 Arguments:
   shapeInput - name of the initial shape
   hlrResult  - result HLR object from initial shape
@@ -7044,6 +7056,7 @@ Arguments:
  -showTangentEdges include tangent edges
  -nbIsolines include isolines
  -showHiddenEdges include hidden edges
+ -parallel compute the hidden parts of the edges in parallel threads (polyAlgo only)
 Use vtop to see projected HLR shape.
 )" /* [vcomputehlr] */);
 
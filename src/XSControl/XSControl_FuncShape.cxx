@@ -607,6 +607,7 @@ static IFSelect_ReturnStatus XSControl_trimport
   const Handle(XSControl_TransferReader) &TR = WS->TransferReader();
   if (TR.IsNull()) { sout<<" init not done or failed"<<std::endl; return IFSelect_RetError; }
 
+  WS->InitTransferGraph();
   TR->BeginTransfer();
 
   //  Transferring
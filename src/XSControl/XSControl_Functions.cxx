@@ -334,6 +334,7 @@ static IFSelect_ReturnStatus XSControl_trbegin(const Handle(IFSelect_SessionPilo
       return IFSelect_RetError;
     }
   }
+  XSControl::Session(pilot)->InitTransferGraph();
   TR->BeginTransfer();
   return IFSelect_RetDone;
 }
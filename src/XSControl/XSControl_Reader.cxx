@@ -253,6 +253,7 @@ Standard_Boolean  XSControl_Reader::TransferEntity
   (const Handle(Standard_Transient)& start, const Message_ProgressRange& theProgress)
 {
   if (start.IsNull()) return Standard_False;
+  thesession->InitTransferGraph();
   const Handle(XSControl_TransferReader) &TR = thesession->TransferReader();
   TR->BeginTransfer();
   if (TR->TransferOne (start, Standard_True, theProgress) == 0) return Standard_False;
@@ -277,6 +278,7 @@ Standard_Integer  XSControl_Reader::TransferList
   if (list.IsNull()) return 0;
   Standard_Integer nbt = 0;
   Standard_Integer i, nb = list->Length();
+  thesession->InitTransferGraph();
   const Handle(XSControl_TransferReader) &TR = thesession->TransferReader();
   TR->BeginTransfer();
   ClearShapes();
@@ -304,6 +306,7 @@ Standard_Integer  XSControl_Reader::TransferRoots (const Message_ProgressRange&
   NbRootsForTransfer();
   Standard_Integer nbt = 0;
   Standard_Integer i, nb = theroots.Length();
+  thesession->InitTransferGraph();
   const Handle(XSControl_TransferReader) &TR = thesession->TransferReader();
    
   TR->BeginTransfer();
@@ -64,7 +64,12 @@ void  XSControl_WorkSession::ClearData (const Standard_Integer mode)
     myTransferWriter->Clear(-1);
   }
   if (mode == 6 && !myTransferReader.IsNull()) myTransferReader->Clear(1);
-  myTransferReader->SetGraph (HGraph());
+  // the graph of a model with entities loaded on demand is given
+  // by InitTransferGraph, when a transfer begins
+  if (IsGraphDeferred())
+    myTransferReader->SetModel (Model());
+  else
+    myTransferReader->SetGraph (HGraph());
 }
 
 
@@ -285,7 +290,8 @@ void  XSControl_WorkSession::InitTransferReader(const Standard_Integer mode)
     if (TP.IsNull()) {
       TP = new Transfer_TransientProcess;
       myTransferReader->SetTransientProcess(TP);
-      TP->SetGraph (HGraph());
+      if (IsGraphDeferred()) TP->SetModel (Model());
+      else                   TP->SetGraph (HGraph());
     }
     Handle(TColStd_HSequenceOfTransient) lis = myTransferReader->RecordedList();
     Standard_Integer i, nb = lis->Length();
@@ -312,15 +318,44 @@ void XSControl_WorkSession::SetTransferReader(const Handle(XSControl_TransferRea
     myTransferReader = TR;
   if (TR.IsNull()) return;
   TR->SetController (myController);
-  TR->SetGraph (HGraph());
+  // the graph of a model with entities loaded on demand is given
+  // by InitTransferGraph, when a transfer begins
+  const Standard_Boolean isDeferred = IsGraphDeferred();
+  if (isDeferred) TR->SetModel (Model());
+  else            TR->SetGraph (HGraph());
   if (!TR->TransientProcess().IsNull()) return;
   Handle(Transfer_TransientProcess) TP = new Transfer_TransientProcess
     (Model().IsNull() ? 100 : Model()->NbEntities() + 100);
-  TP->SetGraph (HGraph());
+  if (isDeferred) TP->SetModel (Model());
+  else            TP->SetGraph (HGraph());
   TP->SetErrorHandle(Standard_True);
   TR->SetTransientProcess(TP);
 }
 
+//=======================================================================
+//function : InitTransferGraph
+//purpose  : 
+//=======================================================================
+
+void XSControl_WorkSession::InitTransferGraph()
+{
+  if (myTransferReader.IsNull() || Model().IsNull()) return;
+  // the TransientProcess may keep the graph of a previous model
+  const Handle(Transfer_TransientProcess)& TP = myTransferReader->TransientProcess();
+  if (!thegraph.IsNull() && !TP.IsNull() && TP->HGraph() == thegraph) return;
+  myTransferReader->SetGraph (HGraph());
+}
+
+//=======================================================================
+//function : IsGraphDeferred
+//purpose  : 
+//=======================================================================
+
+Standard_Boolean XSControl_WorkSession::IsGraphDeferred() const
+{
+  return thegraph.IsNull() && !Model().IsNull() && Model()->HasEntitiesToLoad();
+}
+
 //=======================================================================
 //function : MapReader
 //purpose  :
@@ -398,6 +433,7 @@ Standard_Integer XSControl_WorkSession::TransferReadOne (const Handle(Standard_T
   if (ent == model) return TransferReadRoots(theProgress);
 
   Handle(TColStd_HSequenceOfTransient) list = GiveList(ent);
+  InitTransferGraph();
   if (list->Length() == 1)
     return myTransferReader->TransferOne(list->Value(1), Standard_True, theProgress);
   else
@@ -412,6 +448,7 @@ Standard_Integer XSControl_WorkSession::TransferReadOne (const Handle(Standard_T
 
 Standard_Integer XSControl_WorkSession::TransferReadRoots (const Message_ProgressRange& theProgress)
 {
+  InitTransferGraph();
   return myTransferReader->TransferRoots(Graph(), theProgress);
 }
 
@@ -109,8 +109,16 @@ class XSControl_WorkSession : public IFSelect_WorkSession
   Standard_EXPORT void InitTransferReader (const Standard_Integer theMode);
   
   //! Sets a Transfer Reader, which manages transfers on reading
+  //! The graph is not computed for a model which entities are loaded
+  //! on demand, it is given later by InitTransferGraph
   Standard_EXPORT void SetTransferReader (const Handle(XSControl_TransferReader)& theTR);
   
+  //! Gives the graph of the session to the Transfer Reader and its
+  //! TransientProcess, if it has been deferred for a model which
+  //! entities are loaded on demand (the graph is then computed)
+  //! Called before a transfer on reading
+  Standard_EXPORT void InitTransferGraph();
+  
   //! Returns the Transfer Reader, Null if not set
   const Handle(XSControl_TransferReader) & TransferReader () const
   { return myTransferReader; }
@@ -198,6 +206,10 @@ class XSControl_WorkSession : public IFSelect_WorkSession
   //! Clears binders
   Standard_EXPORT void ClearBinders();
 
+  //! Returns True if the graph is not computed yet for a model
+  //! which entities are loaded on demand
+  Standard_EXPORT Standard_Boolean IsGraphDeferred() const;
+
   Handle(XSControl_Controller) myController;
   Handle(XSControl_TransferReader) myTransferReader;
   Handle(XSControl_TransferWriter) myTransferWriter;
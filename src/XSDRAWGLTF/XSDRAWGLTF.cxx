@@ -588,7 +588,7 @@ void XSDRAWGLTF::Factory(Draw_Interpretor& theDI)
             "\n\t\t:   -quantizeGenericBits  quantization bits for skinning attribute (joint indices and joint weights)"
             "\n                        and custom attributes when using Draco compression (by default 12)"
             "\n\t\t:   -unifiedQuantization  quantization is applied on each primitive separately if this option is false"
-            "\n\t\t:   -parallel             use multithreading for Draco compression",
+            "\n\t\t:   -parallel             use multithreading for filling binary data and Draco compression",
             __FILE__, WriteGltf, aGroup);
   theDI.Add("writegltf",
             "writegltf shape file",
@@ -69,6 +69,8 @@ static Standard_Integer ReadObj (Draw_Interpretor& theDI,
   Standard_Real aFileUnitFactor = -1.0;
   RWMesh_CoordinateSystem aResultCoordSys = RWMesh_CoordinateSystem_Zup, aFileCoordSys = RWMesh_CoordinateSystem_Yup;
   Standard_Boolean toListExternalFiles = Standard_False, isSingleFace = Standard_False, isSinglePrecision = Standard_False;
+  Standard_Boolean toParallel = Standard_False;
+  Standard_Integer aMemLimitMiB = -1;
   Standard_Boolean isNoDoc = (TCollection_AsciiString(theArgVec[0]) == "readobj");
   for (Standard_Integer anArgIter = 1; anArgIter < theNbArgs; ++anArgIter)
   {
@@ -121,6 +123,26 @@ static Standard_Integer ReadObj (Draw_Interpretor& theDI,
         ++anArgIter;
       }
     }
+    else if (anArgCase == "-parallel")
+    {
+      toParallel = Standard_True;
+      if (anArgIter + 1 < theNbArgs
+       && Draw::ParseOnOff (theArgVec[anArgIter + 1], toParallel))
+      {
+        ++anArgIter;
+      }
+    }
+    else if (anArgIter + 1 < theNbArgs
+          && (anArgCase == "-memlimit"
+           || anArgCase == "-memorylimit"))
+    {
+      aMemLimitMiB = Draw::Atoi (theArgVec[++anArgIter]);
+      if (aMemLimitMiB <= 0)
+      {
+        Message::SendFail() << "Syntax error: wrong memory limit '" << theArgVec[anArgIter] << "'";
+        return 1;
+      }
+    }
     else if (isNoDoc
           && (anArgCase == "-singleface"
            || anArgCase == "-singletriangulation"))
@@ -193,6 +215,8 @@ static Standard_Integer ReadObj (Draw_Interpretor& theDI,
 
   RWObj_CafReader aReader;
   aReader.SetSinglePrecision (isSinglePrecision);
+  aReader.SetParallel (toParallel);
+  aReader.SetMemoryLimitMiB (aMemLimitMiB);
   aReader.SetSystemLengthUnit (aScaleFactorM);
   aReader.SetSystemCoordinateSystem (aResultCoordSys);
   aReader.SetFileLengthUnit (aFileUnitFactor);
@@ -202,6 +226,11 @@ static Standard_Integer ReadObj (Draw_Interpretor& theDI,
   {
     RWObj_TriangulationReader aSimpleReader;
     aSimpleReader.SetSinglePrecision (isSinglePrecision);
+    aSimpleReader.SetParallel (toParallel);
+    if (aMemLimitMiB != -1)
+    {
+      aSimpleReader.SetMemoryLimit (Standard_Size(aMemLimitMiB) * 1024 * 1024);
+    }
     aSimpleReader.SetCreateShapes (Standard_False);
     aSimpleReader.SetTransformation (aReader.CoordinateSystemConverter());
     aSimpleReader.Read (aFilePath.ToCString(), aProgress->Start());
@@ -254,6 +283,7 @@ static Standard_Integer WriteObj (Draw_Interpretor& theDI,
   TColStd_IndexedDataMapOfStringString aFileInfo;
   Standard_Real aFileUnitFactor = -1.0;
   RWMesh_CoordinateSystem aSystemCoordSys = RWMesh_CoordinateSystem_Zup, aFileCoordSys = RWMesh_CoordinateSystem_Yup;
+  bool toParallel = false;
   for (Standard_Integer anArgIter = 1; anArgIter < theNbArgs; ++anArgIter)
   {
     TCollection_AsciiString anArgCase (theArgVec[anArgIter]);
@@ -305,6 +335,15 @@ static Standard_Integer WriteObj (Draw_Interpretor& theDI,
     {
       aFileInfo.Add ("Author", theArgVec[++anArgIter]);
     }
+    else if (anArgCase == "-parallel")
+    {
+      toParallel = true;
+      if (anArgIter + 1 < theNbArgs
+       && Draw::ParseOnOff (theArgVec[anArgIter + 1], toParallel))
+      {
+        ++anArgIter;
+      }
+    }
     else if (aDoc.IsNull())
     {
       Standard_CString aNameVar = theArgVec[anArgIter];
@@ -347,6 +386,7 @@ static Standard_Integer WriteObj (Draw_Interpretor& theDI,
   aWriter.ChangeCoordinateSystemConverter().SetInputCoordinateSystem (aSystemCoordSys);
   aWriter.ChangeCoordinateSystemConverter().SetOutputLengthUnit (aFileUnitFactor);
   aWriter.ChangeCoordinateSystemConverter().SetOutputCoordinateSystem (aFileCoordSys);
+  aWriter.SetParallel (toParallel);
   aWriter.Perform (aDoc, aFileInfo, aProgress->Start());
   return 0;
 }
@@ -368,30 +408,34 @@ void XSDRAWOBJ::Factory(Draw_Interpretor& theDI)
   theDI.Add("ReadObj",
             "ReadObj Doc file [-fileCoordSys {Zup|Yup}] [-fileUnit Unit]"
             "\n\t\t:                  [-resultCoordSys {Zup|Yup}] [-singlePrecision]"
-            "\n\t\t:                  [-listExternalFiles] [-noCreateDoc]"
+            "\n\t\t:                  [-listExternalFiles] [-noCreateDoc] [-parallel {on|off}]"
+            "\n\t\t:                  [-memLimit MiB]"
             "\n\t\t: Read OBJ file into XDE document."
             "\n\t\t:   -fileUnit       length unit of OBJ file content;"
             "\n\t\t:   -fileCoordSys   coordinate system defined by OBJ file; Yup when not specified."
             "\n\t\t:   -resultCoordSys result coordinate system; Zup when not specified."
             "\n\t\t:   -singlePrecision truncate vertex data to single precision during read; FALSE by default."
             "\n\t\t:   -listExternalFiles do not read mesh and only list external files."
-            "\n\t\t:   -noCreateDoc    read into existing XDE document.",
+            "\n\t\t:   -noCreateDoc    read into existing XDE document."
+            "\n\t\t:   -parallel       parse the file in parallel threads; FALSE by default."
+            "\n\t\t:   -memLimit       memory usage limit in MiB; mesh data exceeding it are truncated.",
             __FILE__, ReadObj, aGroup);
   theDI.Add("readobj",
             "readobj shape file [-fileCoordSys {Zup|Yup}] [-fileUnit Unit]"
             "\n\t\t:                    [-resultCoordSys {Zup|Yup}] [-singlePrecision]"
-            "\n\t\t:                    [-singleFace]"
+            "\n\t\t:                    [-singleFace] [-parallel {on|off}] [-memLimit MiB]"
             "\n\t\t: Same as ReadObj but reads OBJ file into a shape instead of a document."
             "\n\t\t:   -singleFace merge OBJ content into a single triangulation Face.",
             __FILE__, ReadObj, aGroup);
   theDI.Add("WriteObj",
             "WriteObj Doc file [-fileCoordSys {Zup|Yup}] [-fileUnit Unit]"
             "\n\t\t:                   [-systemCoordSys {Zup|Yup}]"
-            "\n\t\t:                   [-comments Text] [-author Name]"
+            "\n\t\t:                   [-comments Text] [-author Name] [-parallel {on|off}]"
             "\n\t\t: Write XDE document into OBJ file."
             "\n\t\t:   -fileUnit       length unit of OBJ file content;"
             "\n\t\t:   -fileCoordSys   coordinate system defined by OBJ file; Yup when not specified."
-            "\n\t\t:   -systemCoordSys system coordinate system; Zup when not specified.",
+            "\n\t\t:   -systemCoordSys system coordinate system; Zup when not specified."
+            "\n\t\t:   -parallel       format face data in parallel threads; FALSE by default.",
             __FILE__, WriteObj, aGroup);
   theDI.Add("writeobj",
             "writeobj shape file",
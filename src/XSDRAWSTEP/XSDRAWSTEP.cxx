@@ -375,6 +375,50 @@ static Standard_Integer steptrans(Draw_Interpretor& theDI,
   return 0;
 }
 
+//=======================================================================
+//function : steplazyload
+//purpose  :
+//=======================================================================
+static Standard_Integer steplazyload(Draw_Interpretor& theDI,
+                                     Standard_Integer theNbArgs,
+                                     const char** theArgVec)
+{
+  Standard_Integer anArgIter = 1;
+  if (theNbArgs > 2 && !strcmp(theArgVec[1], "-read"))
+  {
+    // read the file into the session without transfer
+    STEPControl_Reader aReader(XSDRAW::Session(), Standard_False);
+    if (aReader.ReadFile(theArgVec[2]) != IFSelect_RetDone)
+    {
+      theDI << "Error: Could not read file " << theArgVec[2] << "\n";
+      return 1;
+    }
+    anArgIter = 3;
+  }
+  Handle(StepData_StepModel) aModel =
+    Handle(StepData_StepModel)::DownCast(XSDRAW::Session()->Model());
+  if (aModel.IsNull())
+  {
+    theDI << "Error: No STEP model in the session\n";
+    return 1;
+  }
+  const Standard_Integer aNbEntities = aModel->NbEntities();
+  for (; anArgIter < theNbArgs; ++anArgIter)
+  {
+    const Standard_Integer aNum = XSDRAW::GetEntityNumber(theArgVec[anArgIter]);
+    if (aNum < 1 || aNum > aNbEntities)
+    {
+      theDI << "Error: No entity " << theArgVec[anArgIter] << " in the model\n";
+      return 1;
+    }
+    // the contents of the entity is loaded at its first access
+    aModel->Value(aNum);
+  }
+  const Standard_Integer aNbToLoad = aModel->LazyLoader().IsNull() ? 0 : aModel->LazyLoader()->NbToLoad();
+  theDI << "Loaded entities: " << aNbEntities - aNbToLoad << " of " << aNbEntities << "\n";
+  return 0;
+}
+
 //=======================================================================
 //function : stepwrite
 //purpose  : 
@@ -1043,6 +1087,12 @@ void XSDRAWSTEP::Factory(Draw_Interpretor& theDI)
   theDI.Add("stepread", "stepread  [file] [f or r (type of model full or reduced)]", __FILE__, stepread, aGroup);
   theDI.Add("testreadstep", "testreadstep [file_1 ... file_n] shape [-stream]", __FILE__, testreadstep, aGroup);
   theDI.Add("steptrans", "steptrans shape stepax1 stepax2", __FILE__, steptrans, aGroup);
+  theDI.Add("steplazyload",
+            "steplazyload [-read file] [entity ...]"
+            "\n\t\t: Prints the number of entities of the STEP model of the session with loaded contents"
+            "\n\t\t: (see read.step.lazy), after the access to the given entities."
+            "\n\t\t:  -read reads the file into the session without transfer",
+            __FILE__, steplazyload, aGroup);
   theDI.Add("countexpected", "TEST", __FILE__, countexpected, aGroup);
   theDI.Add("dumpassembly", "TEST", __FILE__, dumpassembly, aGroup);
   theDI.Add("stepfileunits", "stepfileunits name_file", __FILE__, stepfileunits, aGroup);
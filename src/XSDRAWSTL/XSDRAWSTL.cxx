@@ -88,6 +88,7 @@ static Standard_Integer readstl(Draw_Interpretor& theDI,
   TCollection_AsciiString aShapeName, aFilePath;
   bool toCreateCompOfTris = false;
   bool anIsMulti = false;
+  bool toParallel = false;
   double aMergeAngle = M_PI / 2.0;
   for (Standard_Integer anArgIter = 1; anArgIter < theArgc; ++anArgIter)
   {
@@ -119,6 +120,15 @@ static Standard_Integer readstl(Draw_Interpretor& theDI,
         ++anArgIter;
       }
     }
+    else if (anArg == "-parallel")
+    {
+      toParallel = true;
+      if (anArgIter + 1 < theArgc
+       && Draw::ParseOnOff (theArgv[anArgIter + 1], toParallel))
+      {
+        ++anArgIter;
+      }
+    }
     else if (anArg == "-mergeangle"
           || anArg == "-smoothangle"
           || anArg == "-nomergeangle"
@@ -165,7 +175,7 @@ static Standard_Integer readstl(Draw_Interpretor& theDI,
     {
       NCollection_Sequence<Handle(Poly_Triangulation)> aTriangList;
       // Read STL file to the triangulation list.
-      RWStl::ReadFile(aFilePath.ToCString(),aMergeAngle,aTriangList,aProgress->Start());
+      RWStl::ReadFile(aFilePath.ToCString(),aMergeAngle,toParallel,aTriangList,aProgress->Start());
       BRep_Builder aB;
       TopoDS_Face aFace;
       if (aTriangList.Size() == 1)
@@ -192,7 +202,7 @@ static Standard_Integer readstl(Draw_Interpretor& theDI,
     else
     {
       // Read STL file to the triangulation.
-      Handle(Poly_Triangulation) aTriangulation = RWStl::ReadFile (aFilePath.ToCString(),aMergeAngle,aProgress->Start());
+      Handle(Poly_Triangulation) aTriangulation = RWStl::ReadFile (aFilePath.ToCString(),aMergeAngle,toParallel,aProgress->Start());
 
       TopoDS_Face aFace;
       BRep_Builder aB;
@@ -1287,12 +1297,13 @@ void XSDRAWSTL::Factory(Draw_Interpretor& theDI)
 
   theDI.Add("writestl", "shape file [ascii/binary (0/1) : 1 by default] [InParallel (0/1) : 0 by default]", __FILE__, writestl, aGroup);
   theDI.Add("readstl",
-            "readstl shape file [-brep] [-mergeAngle Angle] [-multi]"
+            "readstl shape file [-brep] [-mergeAngle Angle] [-multi] [-parallel {on|off}]=off"
             "\n\t\t: Reads STL file and creates a new shape with specified name."
             "\n\t\t: When -brep is specified, creates a Compound of per-triangle Faces."
             "\n\t\t: Single triangulation-only Face is created otherwise (default)."
             "\n\t\t: -mergeAngle specifies maximum angle in degrees between triangles to merge equal nodes; disabled by default."
-            "\n\t\t: -multi creates a face per solid in multi-domain files; ignored when -brep is set.",
+            "\n\t\t: -multi creates a face per solid in multi-domain files; ignored when -brep is set."
+            "\n\t\t: -parallel reads the file using multiple threads; ignored when -brep is set.",
             __FILE__, readstl, aGroup);
 
   theDI.Add("meshfromstl", "creates MeshVS_Mesh from STL file", __FILE__, createmesh, aGroup);